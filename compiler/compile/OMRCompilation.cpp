@@ -253,6 +253,7 @@ OMR::Compilation::Compilation(
    _loopVersionedWrtAsyncChecks(false),
    _commitedCallSiteInfo(false),
    _containsBigDecimalLoad(false),
+   _reusedCompiledBody(NULL),
    _osrStateIsReliable(true),
    _canAffordOSRControlFlow(true),
    _osrInfrastructureRemoved(false),
@@ -1016,7 +1017,12 @@ int32_t OMR::Compilation::compile()
    LexicalTimer t("compile", self()->signature(), self()->phaseTimer());
    TR::LexicalMemProfiler mp("compile", self()->signature(), self()->phaseMemProfiler());
 
+   // Generating IL is cheap next to optimizing it and generating code, so a
+   // body compiled earlier from the same IL is worth looking for
    if (_ilGenSuccess)
+      _reusedCompiledBody = _ilGenRequest.details().findCompiledBody(self());
+
+   if (_ilGenSuccess && !_reusedCompiledBody)
       {
       _methodSymbol->detectInternalCycles();
 
@@ -1214,6 +1220,12 @@ int32_t OMR::Compilation::compile()
    if (!_ilGenSuccess)
       self()->failCompilation<TR::ILGenFailure>("IL Gen Failure");
 
+   if (_reusedCompiledBody)
+      {
+      _methodSymbol->setMethodAddress(_reusedCompiledBody);
+      return COMPILATION_SUCCEEDED;
+      }
+
 #ifdef J9_PROJECT_SPECIFIC
    if (self()->getOption(TR_TraceCG))
       {
@@ -320,6 +320,13 @@ public:
    TR::IL il;
 
    TR::IlGenRequest &ilGenRequest()     { return _ilGenRequest; }
+
+   /**
+    * @brief The entry point of a body compiled earlier from the same IL,
+    *        which the compilation produced instead of generating code, or NULL
+    *        if it generated code.
+    */
+   void *getReusedCompiledBody()        { return _reusedCompiledBody; }
    TR::CodeGenerator *cg()              { return _codeGenerator; }
    TR_FrontEnd *fe()                    { return _fe; }
    TR::Options *getOptions()            { return _options; }
@@ -1251,6 +1258,7 @@ private:
    bool                              _isServerInlining;
 
    bool                              _ilGenSuccess;
+   void                            * _reusedCompiledBody;
 
    bool                              _osrStateIsReliable;
    bool                              _canAffordOSRControlFlow;
@@ -284,6 +284,8 @@ compileMethodFromDetails(
          static_cast<TR::SegmentAllocator &>(debugSegmentProvider) :
          static_cast<TR::SegmentAllocator &>(defaultSegmentProvider);
    TR::Region dispatchRegion(scratchSegmentProvider, rawAllocator);
+   if (TR::Options::getCmdLineOptions()->getOption(TR_EnableScratchMemoryRecycling))
+      dispatchRegion.setRecyclesMemory(true);
    TR_Memory trMemory(*fe.persistentMemory(), dispatchRegion);
    TR_ResolvedMethod & compilee = *((TR_ResolvedMethod *)details.getMethod());
 
@@ -375,15 +377,25 @@ compileMethodFromDetails(
          startPC = (uint8_t*)compiler.getMethodSymbol()->getMethodAddress();
          uint64_t translationTime = TR::Compiler->vm.getUSecClock() - translationStartTime;
 
+         // A body compiled earlier from the same IL was installed: no code
+         // was generated
+         bool reusedBody = (NULL != compiler.getReusedCompiledBody());
+
          if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompileEnd, TR_VerbosePerformance))
             {
             const char *signature = compilee.signature(&trMemory);
             TR_VerboseLog::CriticalSection vlogLock;
-            TR_VerboseLog::write(TR_Vlog_COMP, "(%s) %s @ " POINTER_PRINTF_FORMAT "-" POINTER_PRINTF_FORMAT,
-                                           compiler.getHotnessName(compiler.getMethodHotness()),
-                                           signature,
-                                           startPC,
-                                           compiler.cg()->getCodeEnd());
+            if (reusedBody)
+               TR_VerboseLog::write(TR_Vlog_COMP, "(%s) %s @ " POINTER_PRINTF_FORMAT " reused",
+                                              compiler.getHotnessName(compiler.getMethodHotness()),
+                                              signature,
+                                              startPC);
+            else
+               TR_VerboseLog::write(TR_Vlog_COMP, "(%s) %s @ " POINTER_PRINTF_FORMAT "-" POINTER_PRINTF_FORMAT,
+                                              compiler.getHotnessName(compiler.getMethodHotness()),
+                                              signature,
+                                              startPC,
+                                              compiler.cg()->getCodeEnd());
 
             if (TR::Options::getVerboseOption(TR_VerbosePerformance))
                {
@@ -398,11 +410,11 @@ compileMethodFromDetails(
             trfflush(jitConfig->options.vLogFile);
             }
 
-         if (
+         if (!reusedBody && (
                compiler.getOption(TR_PerfTool)
             || compiler.getOption(TR_EmitExecutableELFFile)
             || compiler.getOption(TR_EmitRelocatableELFFile)
-            )
+            ))
             {
             TR::CodeCacheManager &codeCacheManager(fe.codeCacheManager());
             TR::CodeGenerator &codeGenerator(*compiler.cg());
@@ -421,6 +433,9 @@ compileMethodFromDetails(
                }
             }
 
+         if (!reusedBody)
+            details.recordCompiledBody(&compiler, startPC);
+
          if (compiler.getOutFile() != NULL && compiler.getOption(TR_TraceAll))
             traceMsg((&compiler), "<result success=\"true\" startPC=\"%#p\" time=\"%lld.%lldms\"/>\n",
                                   startPC,
@@ -302,7 +302,7 @@ enum TR_CompilationOptions
    TR_DisableDelayRelocationForAOTCompilations   = 0x00000200 + 7,
    TR_DisableRecompDueToInlinedMethodRedefinition = 0x00000400 + 7,
    TR_DisableLoopReplicatorColdSideEntryCheck = 0x00000800 + 7,
-   // Available                           = 0x00001000 + 7,
+   TR_RecordStaticRelocations             = 0x00001000 + 7,
    TR_DontDowgradeToColdDuringGracePeriod = 0x00002000 + 7,
    TR_EnableRecompilationPushing          = 0x00004000 + 7,
    TR_EnableJCLInline                     = 0x00008000 + 7, // enable JCL Integer and Long methods inline
@@ -311,7 +311,7 @@ enum TR_CompilationOptions
    TR_DisableCHOpts                       = 0x00040000 + 7,
    TR_ForceLoadAOT                        = 0x00080000 + 7,
    TR_TraceRelocatableDataCG              = 0x00100000 + 7,
-   // Available                           = 0x00200000 + 7,
+   TR_VerifyIncrementalUseDefs            = 0x00200000 + 7,
    TR_TraceRelocatableDataDetailsCG       = 0x00400000 + 7,
    // Available                           = 0x00800000 + 7,
    TR_TurnOffSelectiveNoOptServerIfNoStartupHint = 0x01000000 + 7,
@@ -720,7 +720,7 @@ enum TR_CompilationOptions
    TR_ProfileMemoryRegions                            = 0x00800000 + 21,
    TR_DisableConverterReducer                         = 0x01000000 + 21,
    TR_CompileTimeProfiler                             = 0x02000000 + 21,
-   // Available                                       = 0x04000000 + 21,
+   TR_EnableScratchMemoryRecycling                    = 0x04000000 + 21,
    // Available                                       = 0x08000000 + 21,
    // Available                                       = 0x10000000 + 21,
    TR_PerformLookaheadAtWarmCold                      = 0x20000000 + 21,
@@ -1487,6 +1487,8 @@ public:
       _inlinerVeryLargeCompiledMethodFaninThreshold = 0;
       _largeCompiledMethodExemptionFreqCutoff = 0;
       _maxSzForVPInliningWarm = 0;
+      _optimizerNodeBudget = 0;
+      _optimizerTimeBudget = 0;
       _loopyAsyncCheckInsertionMaxEntryFreq = 0;
       _objectFileName = 0;
       _edoRecompSizeThreshold = 0;
@@ -1735,6 +1737,8 @@ public:
    void setBigCalleeScorchingOptThreshold(int32_t t) { _bigCalleeScorchingOptThreshold = t; }
    int32_t getLargeCompiledMethodExemptionFreqCutoff() const {return _largeCompiledMethodExemptionFreqCutoff;}
    int32_t getMaxSzForVPInliningWarm() const          {return _maxSzForVPInliningWarm;}
+   int32_t getOptimizerNodeBudget() const             {return _optimizerNodeBudget;}
+   int32_t getOptimizerTimeBudget() const             {return _optimizerTimeBudget;}
    int32_t getInlinerVeryLargeCompiledMethodThreshold() const {return _inlinerVeryLargeCompiledMethodThreshold;}
    int32_t getInlinerVeryLargeCompiledMethodFaninThreshold() const {return _inlinerVeryLargeCompiledMethodFaninThreshold;}
 
@@ -2507,6 +2511,8 @@ protected:
    int32_t                     _inlinerVeryLargeCompiledMethodFaninThreshold; // for inlining
    int32_t                     _largeCompiledMethodExemptionFreqCutoff;
    int32_t                     _maxSzForVPInliningWarm;
+   int32_t                     _optimizerNodeBudget; // nodes above which expensive optimizations are skipped
+   int32_t                     _optimizerTimeBudget; // milliseconds of optimization after which expensive optimizations are skipped
 
    int32_t                     _loopyAsyncCheckInsertionMaxEntryFreq;
 
@@ -29,21 +29,29 @@ namespace TR {
 
 Region::Region(TR::SegmentProvider &segmentProvider, TR::RawAllocator rawAllocator) :
    _bytesAllocated(0),
+   _bytesRecycled(0),
+   _recyclesMemory(false),
    _segmentProvider(segmentProvider),
    _rawAllocator(rawAllocator),
    _initialSegment(_initialSegmentArea.data, INITIAL_SEGMENT_SIZE),
    _currentSegment(TR::ref(_initialSegment)),
-   _lastDestroyer(NULL)
+   _lastDestroyer(NULL),
+   _returnedBlocks(NULL),
+   _spareReturnedBlocks(NULL)
    {
    }
 
 Region::Region(const Region &prototype) :
    _bytesAllocated(0),
+   _bytesRecycled(0),
+   _recyclesMemory(false),
    _segmentProvider(prototype._segmentProvider),
    _rawAllocator(prototype._rawAllocator),
    _initialSegment(_initialSegmentArea.data, INITIAL_SEGMENT_SIZE),
    _currentSegment(TR::ref(_initialSegment)),
-   _lastDestroyer(NULL)
+   _lastDestroyer(NULL),
+   _returnedBlocks(NULL),
+   _spareReturnedBlocks(NULL)
    {
    }
 
@@ -76,6 +84,16 @@ void *
 Region::allocate(size_t const size, void *hint)
    {
    size_t const roundedSize = round(size);
+   if (_recyclesMemory && roundedSize <= MAX_RECYCLED_SIZE && roundedSize != 0)
+      {
+      FreeBlock * const block = _freeLists[sizeClass(roundedSize)];
+      if (block != NULL)
+         {
+         _freeLists[sizeClass(roundedSize)] = block->_next;
+         _bytesRecycled += roundedSize;
+         return block;
+         }
+      }
    if (_currentSegment.get().remaining() >= roundedSize)
       {
       _bytesAllocated += roundedSize;
@@ -90,8 +108,78 @@ Region::allocate(size_t const size, void *hint)
    }
 
 void
-Region::deallocate(void * allocation, size_t) throw()
+Region::deallocate(void * allocation, size_t size) throw()
+   {
+   if (!_recyclesMemory || allocation == NULL || size == 0)
+      return;
+
+   size_t const roundedSize = round(size);
+   if (roundedSize > MAX_RECYCLED_SIZE)
+      return;
+
+   if (_returnedBlocks == NULL || _returnedBlocks->_count == ReturnedBlocks::CAPACITY)
+      {
+      ReturnedBlocks *chunk = _spareReturnedBlocks;
+      if (chunk != NULL)
+         {
+         _spareReturnedBlocks = chunk->_next;
+         }
+      else
+         {
+         // Failing to record a block only means it isn't reused
+         try
+            {
+            chunk = static_cast<ReturnedBlocks *>(allocate(sizeof(ReturnedBlocks)));
+            }
+         catch (...)
+            {
+            return;
+            }
+         }
+      chunk->_next = _returnedBlocks;
+      chunk->_count = 0;
+      _returnedBlocks = chunk;
+      }
+
+   _returnedBlocks->_entries[_returnedBlocks->_count]._block = allocation;
+   _returnedBlocks->_entries[_returnedBlocks->_count]._size = roundedSize;
+   _returnedBlocks->_count++;
+   }
+
+void
+Region::recycleReturnedMemory()
+   {
+   while (_returnedBlocks != NULL)
+      {
+      ReturnedBlocks * const chunk = _returnedBlocks;
+      for (size_t i = 0; i < chunk->_count; ++i)
+         {
+         FreeBlock * const block = static_cast<FreeBlock *>(chunk->_entries[i]._block);
+         size_t const sizeClassIndex = sizeClass(chunk->_entries[i]._size);
+         block->_next = _freeLists[sizeClassIndex];
+         _freeLists[sizeClassIndex] = block;
+         }
+      _returnedBlocks = chunk->_next;
+      chunk->_next = _spareReturnedBlocks;
+      _spareReturnedBlocks = chunk;
+      }
+   }
+
+void
+Region::setRecyclesMemory(bool recycles)
+   {
+   if (recycles != _recyclesMemory)
+      clearFreeLists();
+   _recyclesMemory = recycles;
+   }
+
+void
+Region::clearFreeLists()
    {
+   for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+      _freeLists[i] = NULL;
+   _returnedBlocks = NULL;
+   _spareReturnedBlocks = NULL;
    }
 
 size_t
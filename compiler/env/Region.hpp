@@ -137,7 +137,44 @@ public:
       _lastDestroyer = new (*this) TypedDestroyer<T>(_lastDestroyer, obj);
       }
 
-   void deallocate(void * allocation, size_t = 0) throw();
+   /**
+    * \brief Return memory to the Region.
+    *
+    * Memory is normally only freed in bulk when the Region is destroyed, so
+    * this is a no-op unless the Region recycles memory (see
+    * setRecyclesMemory). A recycling Region records small blocks handed back
+    * with their size, as the TR::typed_allocator containers do, and from the
+    * next call to recycleReturnedMemory on reuses them for later allocations
+    * of the same rounded size. Calls that don't give a size are always
+    * ignored.
+    *
+    * \param[in] allocation Memory previously returned by allocate on this
+    *                       Region.
+    * \param[in] size The size that was passed to allocate, or 0 if unknown.
+    */
+   void deallocate(void * allocation, size_t size = 0) throw();
+
+   /**
+    * \brief Enable or disable the reuse of memory returned through sized
+    * deallocate calls.
+    *
+    * Regions created from this one as a prototype start with the mode off,
+    * since nothing would make their returned blocks available for reuse.
+    * Disabling it drops any blocks that are waiting to be reused.
+    */
+   void setRecyclesMemory(bool recycles);
+   bool recyclesMemory() { return _recyclesMemory; }
+
+   /**
+    * \brief Make the blocks returned since the last call available for
+    * reuse.
+    *
+    * A returned block is left untouched until this is called, because some
+    * code still reads a list node it has just erased, for example to step an
+    * iterator past it. Call this only at a point where no such traversal of
+    * memory from this Region can be in progress.
+    */
+   void recycleReturnedMemory();
 
    static void reset(TR::Region& targetRegion, TR::Region& prototypeRegion)
       {
@@ -162,13 +199,48 @@ public:
       }
 
    size_t bytesAllocated() { return _bytesAllocated; }
+
+   /**
+    * \brief Bytes of allocations served from memory returned to the Region,
+    * which bytesAllocated does not count again
+    */
+   size_t bytesRecycled() { return _bytesRecycled; }
+
    static size_t initialSize() { return INITIAL_SEGMENT_SIZE; }
 private:
    friend class TR::RegionProfiler;
 
+   /** \brief A recycled block waiting to be reused, threaded through its own storage. */
+   struct FreeBlock
+      {
+      FreeBlock *_next;
+      };
+
+   /** \brief A chunk of blocks returned since the last recycleReturnedMemory call. */
+   struct ReturnedBlocks
+      {
+      static const size_t CAPACITY = 126;
+
+      ReturnedBlocks *_next;
+      size_t _count;
+      struct
+         {
+         void *_block;
+         size_t _size;
+         } _entries[CAPACITY];
+      };
+
    size_t round(size_t bytes);
 
+   /** \brief Forget all blocks waiting to be recycled or reused */
+   void clearFreeLists();
+
+   /** \brief The free list for blocks of the rounded size \p bytes */
+   static size_t sizeClass(size_t bytes) { return (bytes / ALIGNMENT) - 1; }
+
    size_t _bytesAllocated;
+   size_t _bytesRecycled;
+   bool _recyclesMemory;
    TR::SegmentProvider &_segmentProvider;
    TR::RawAllocator _rawAllocator;
    TR::MemorySegment _initialSegment;
@@ -177,6 +249,19 @@ private:
    Destroyer *_lastDestroyer;
 
    static const size_t INITIAL_SEGMENT_SIZE = 4096;
+   static const size_t ALIGNMENT = 16;
+
+   /**
+    * Larger blocks are not recycled. Most of the short-lived memory in a
+    * compilation is container nodes and small vectors, and a size class per
+    * alignment step keeps reuse exact, so no block is split or padded.
+    */
+   static const size_t MAX_RECYCLED_SIZE = 1024;
+   static const size_t NUM_SIZE_CLASSES = MAX_RECYCLED_SIZE / ALIGNMENT;
+
+   FreeBlock *_freeLists[NUM_SIZE_CLASSES];
+   ReturnedBlocks *_returnedBlocks;      ///< the chunk being filled, linked to the full ones
+   ReturnedBlocks *_spareReturnedBlocks; ///< emptied chunks to fill again
 
    union {
       char data[INITIAL_SEGMENT_SIZE];
@@ -39,7 +39,8 @@ namespace TR {
  * This class makes use of the compiler's debug counter facility to record the
  * difference in memory usage for a region and its segment provider between the
  * two points of execution determined by the invocation of its constructor and
- * the invocation of its destructor. The lifetime of the region tracked by the
+ * the invocation of its destructor, along with the bytes the region served
+ * by recycling returned memory. The lifetime of the region tracked by the
  * profiler object must comprehend the lifetime of the profiler itself. The
  * implementation requires a compilation object in order to determine whether
  * or not the facility is active.
@@ -51,6 +52,7 @@ public:
    RegionProfiler(TR::Region &region, TR::Compilation &compilation, const char *format, ...) :
       _region(region),
       _initialRegionSize(_region.bytesAllocated()),
+      _initialRecycledSize(_region.bytesRecycled()),
       _initialSegmentProviderSize(_region._segmentProvider.bytesAllocated()),
       _compilation(compilation)
       {
@@ -87,12 +89,42 @@ public:
                 ),
             static_cast<int32_t>((_region._segmentProvider.bytesAllocated() - _initialSegmentProviderSize) / 1024)
             );
+         if (_region.recyclesMemory())
+            {
+            TR::DebugCounter::incStaticDebugCounter(
+               &_compilation,
+               TR::DebugCounter::debugCounterName(
+                  &_compilation,
+                  "kbytesRecycled.details/%s",
+                  _identifier
+                  ),
+               static_cast<int32_t>(regionBytesRecycled() / 1024)
+               );
+            }
          }
       }
 
+   /**
+    * @brief Bytes allocated from the region since the profiler was created
+    */
+   size_t regionBytesAllocated() { return _region.bytesAllocated() - _initialRegionSize; }
+
+   /**
+    * @brief Growth of the segment provider's allocation since the profiler
+    * was created, which includes the segments of any other region using it
+    */
+   size_t segmentBytesAllocated() { return _region._segmentProvider.bytesAllocated() - _initialSegmentProviderSize; }
+
+   /**
+    * @brief Bytes the region served from returned memory since the profiler
+    * was created, which regionBytesAllocated does not include
+    */
+   size_t regionBytesRecycled() { return _region.bytesRecycled() - _initialRecycledSize; }
+
 private:
    TR::Region &_region;
    size_t const _initialRegionSize;
+   size_t const _initialRecycledSize;
    size_t const _initialSegmentProviderSize;
    TR::Compilation &_compilation;
    char _identifier[256];
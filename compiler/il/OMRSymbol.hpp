@@ -533,7 +533,6 @@ public:
       CountForRecompile         = 0x02000000,
       RecompilationCounter      = 0x01000000,
       GCRPatchPoint             = 0x00400000,
-      StaticAddressWithinMethodBounds = 0x00800000, // Address is inside a method body and can be accessed with RIP addressing without relocations
 
       //Only Used by Symbols for which isResolvedMethod is true;
       IsJittedMethod            = 0x80000000,
@@ -600,6 +599,7 @@ public:
        */
       StaticDefaultValueInstance = 0x00020000,
       CatchBlockCounter          = 0x00040000,
+      StaticAddressWithinMethodBounds = 0x00080000, // isStatic only: address is inside a method body and can be accessed with RIP addressing without relocations
       };
 
 protected:
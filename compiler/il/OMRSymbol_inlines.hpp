@@ -598,14 +598,14 @@ OMR::Symbol::setConstantPoolAddress()
 bool
 OMR::Symbol::isStaticAddressWithinMethodBounds()
    {
-   return self()->isStatic() && _flags.testAny(StaticAddressWithinMethodBounds);
+   return self()->isStatic() && _flags2.testAny(StaticAddressWithinMethodBounds);
    }
 
 void
 OMR::Symbol::setStaticAddressWithinMethodBounds()
    {
    TR_ASSERT(self()->isStatic(), "Symbol must be static");
-   _flags.set(StaticAddressWithinMethodBounds);
+   _flags2.set(StaticAddressWithinMethodBounds);
    }
 
 bool
@@ -32,11 +32,13 @@ namespace OMR { typedef OMR::IlGeneratorMethodDetails IlGeneratorMethodDetailsCo
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
 #include "env/FilePointerDecl.hpp"
 #include "infra/Annotations.hpp"
 
 class TR_FrontEnd;
 class TR_ResolvedMethod;
+namespace TR { class Compilation; }
 namespace TR { class IlGeneratorMethodDetails; }
 namespace TR { class IlVerifier; }
 
@@ -63,6 +65,31 @@ public:
 
    inline static TR::IlGeneratorMethodDetails & create(TR::IlGeneratorMethodDetails & target, TR_ResolvedMethod *method);
 
+   /**
+    * @brief Looks for a body compiled earlier from the same IL as was just
+    *        generated for the method, which the compilation then returns
+    *        instead of optimizing the method and generating code.
+    * @param comp the compilation, with IL generation complete
+    * @return the entry point of a body ready to run, or NULL if the method
+    *         must be compiled
+    */
+   void *findCompiledBody(TR::Compilation *comp) { return NULL; }
+
+   /**
+    * @brief Called after the method has been compiled successfully, while the
+    *        code generator still describes the generated body.
+    * @param comp the compilation
+    * @param startPC the entry point of the new body
+    */
+   void recordCompiledBody(TR::Compilation *comp, uint8_t *startPC) { }
+
+   /**
+    * @brief Called once the method's body is ready to run, whether compiled
+    *        or found by findCompiledBody().
+    * @param entryPoint the entry point of the body
+    */
+   void registerCompiledBody(void *entryPoint) { }
+
    TR::IlVerifier * getIlVerifier()                     { return _ilVerifier; }
    void setIlVerifier(TR::IlVerifier * ilVerifier)      { _ilVerifier = ilVerifier; }
 
@@ -724,6 +724,8 @@ OMR::MethodBuilder::Compile(void **entry)
 
    int32_t rc=0;
    *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc);
+   if (*entry)
+      details.registerCompiledBody(*entry);
 
    // let TypeDictionary know to clear out sym refs used in this compilation so
    // no dangling pointers
@@ -31,6 +31,8 @@
 
 class TR_BitVector;
 class TR_BitVectorCursor;
+class TR_BitVectorIterator;
+class TR_HybridBitVector;
 namespace TR { class Compilation; }
 
 #if defined(BITVECTOR_64BIT)
@@ -155,6 +157,7 @@ class TR_BitVector
    TR_ALLOC(TR_Memory::BitVector)
 
    typedef TR_BitVectorCursor Cursor;
+   typedef TR_BitVectorIterator Iterator;
    typedef int32_t containerCharacteristic; // used by data flow
    static const containerCharacteristic nullContainerCharacteristic = -1;
 
@@ -611,6 +614,10 @@ class TR_BitVector
          *this -= *v2._bitVector;
       }
 
+   // mixed type operations with hybrid sparse/dense bit vectors, see HybridBitVector.cpp
+   void operator|= (TR_HybridBitVector &v2);
+   void operator&= (TR_HybridBitVector &v2);
+
    // mixed type operations and conversions
    template <class BitVector>
    TR_BitVector & operator= (const BitVector &sparse);
@@ -932,6 +939,8 @@ class TR_BitVector
 
    friend class TR_BitVectorIterator;
    friend class CS2_TR_BitVector;
+   friend class TR_HybridBitVector;
+   friend class TR_HybridBitVectorIterator;
 
    // Re-calculate the first and last chunks with non-zero
    void resetLowAndHighChunks(int32_t low, int32_t high)
@@ -0,0 +1,867 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "infra/HybridBitVector.hpp"
+
+#include <stdint.h>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "env/TRMemory.hpp"
+#include "infra/Assert.hpp"
+#include "infra/Bit.hpp"
+#include "ras/Debug.hpp"
+
+#if defined(TR_HOST_X86) && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define HYBRID_BIT_VECTOR_USE_SSE2
+#endif
+
+// Kernels over dense chunk arrays. With SSE2 each step covers 128 bits.
+//
+#if defined(HYBRID_BIT_VECTOR_USE_SSE2)
+static const int32_t chunksPerVector = sizeof(__m128i) / sizeof(chunk_t);
+#endif
+
+static void orChunks(chunk_t *dst, const chunk_t *src, int32_t n)
+   {
+   int32_t i = 0;
+#if defined(HYBRID_BIT_VECTOR_USE_SSE2)
+   for (; i + chunksPerVector <= n; i += chunksPerVector)
+      {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_or_si128(a, b));
+      }
+#endif
+   for (; i < n; i++)
+      dst[i] |= src[i];
+   }
+
+static void andChunks(chunk_t *dst, const chunk_t *src, int32_t n)
+   {
+   int32_t i = 0;
+#if defined(HYBRID_BIT_VECTOR_USE_SSE2)
+   for (; i + chunksPerVector <= n; i += chunksPerVector)
+      {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_and_si128(a, b));
+      }
+#endif
+   for (; i < n; i++)
+      dst[i] &= src[i];
+   }
+
+static void andNotChunks(chunk_t *dst, const chunk_t *src, int32_t n)
+   {
+   int32_t i = 0;
+#if defined(HYBRID_BIT_VECTOR_USE_SSE2)
+   for (; i + chunksPerVector <= n; i += chunksPerVector)
+      {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_andnot_si128(b, a));
+      }
+#endif
+   for (; i < n; i++)
+      dst[i] &= ~src[i];
+   }
+
+// Returns true if any chunk of a (ANDed with the matching chunk of b if given) is non-zero
+//
+static bool anyChunks(const chunk_t *a, const chunk_t *b, int32_t n)
+   {
+   int32_t i = 0;
+#if defined(HYBRID_BIT_VECTOR_USE_SSE2)
+   __m128i acc = _mm_setzero_si128();
+   for (; i + chunksPerVector <= n; i += chunksPerVector)
+      {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+      if (b)
+         v = _mm_and_si128(v, _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i)));
+      acc = _mm_or_si128(acc, v);
+      }
+   if (_mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128())) != 0xFFFF)
+      return true;
+#endif
+   for (; i < n; i++)
+      {
+      if (b ? (a[i] & b[i]) : a[i])
+         return true;
+      }
+   return false;
+   }
+
+static inline int32_t chunkPopulation(chunk_t bits)
+   {
+   return populationCount(bits);
+   }
+
+// Index within its chunk of the lowest numbered bit that is set
+//
+static inline int32_t firstBitInChunk(chunk_t bits)
+   {
+#if defined(BITVECTOR_BIT_NUMBERING_MSB)
+   return leadingZeroes(bits);
+#else
+   return trailingZeroes(bits);
+#endif
+   }
+
+// Descending cursors over the non-zero chunks of the sources a sparse set is merged with
+//
+struct TR_SparseChunks
+   {
+   TR_SparseChunks(const int32_t *indices, const chunk_t *words, int32_t numWords) : _indices(indices), _words(words), _position(numWords - 1) {}
+   bool valid() { return _position >= 0; }
+   int32_t index() { return _indices[_position]; }
+   chunk_t bits() { return _words[_position]; }
+   void prev() { _position--; }
+
+   const int32_t *_indices;
+   const chunk_t *_words;
+   int32_t _position;
+   };
+
+struct TR_DenseChunks
+   {
+   TR_DenseChunks(const chunk_t *chunks, int32_t first, int32_t last) : _chunks(chunks), _first(first), _position(last) { skipZeros(); }
+   bool valid() { return _position >= _first; }
+   int32_t index() { return _position; }
+   chunk_t bits() { return _chunks[_position]; }
+   void prev() { _position--; skipZeros(); }
+   void skipZeros() { while (_position >= _first && _chunks[_position] == 0) _position--; }
+
+   const chunk_t *_chunks;
+   int32_t _first;
+   int32_t _position;
+   };
+
+TR_HybridBitVector::TR_HybridBitVector(int64_t initBits, TR_Memory *m, TR_AllocationKind allocKind, int32_t denseRatio)
+   {
+   TR::Region *region = NULL;
+   switch (allocKind)
+      {
+      case heapAlloc:
+         region = &(m->heapMemoryRegion());
+         break;
+      case stackAlloc:
+         region = &(m->currentStackRegion());
+         break;
+      default:
+         TR_ASSERT_FATAL(false, "Hybrid bit vectors must be allocated from a region");
+      }
+   init(initBits, region, denseRatio);
+   }
+
+TR_HybridBitVector::TR_HybridBitVector(int64_t initBits, TR::Region &region, int32_t denseRatio)
+   {
+   init(initBits, &region, denseRatio);
+   }
+
+void TR_HybridBitVector::init(int64_t initBits, TR::Region *region, int32_t denseRatio)
+   {
+   TR_ASSERT(denseRatio > 0, "Dense ratio must be positive");
+   _region = region;
+   _numChunks = initBits > 0 ? TR_BitVector::getChunkIndex(initBits - 1) + 1 : 0;
+   _denseRatio = denseRatio;
+   _isDense = false;
+   _chunks = NULL;
+   _chunksCapacity = 0;
+   _indices = NULL;
+   _words = NULL;
+   _numWords = 0;
+   _sparseCapacity = 0;
+   }
+
+// Mask of the bits m to n that fall within the given chunk
+//
+chunk_t TR_HybridBitVector::rangeMask(int32_t chunkIndex, int64_t m, int64_t n)
+   {
+   int64_t chunkStart = TR_BitVector::getBitIndex(chunkIndex);
+   int64_t low = m > chunkStart ? m : chunkStart;
+   int64_t high = n < chunkStart + BITS_IN_CHUNK - 1 ? n : chunkStart + BITS_IN_CHUNK - 1;
+   return TR_BitVector::getBitMask(static_cast<int32_t>(low - chunkStart), static_cast<int32_t>(high - chunkStart));
+   }
+
+void TR_HybridBitVector::ensureChunks(int32_t numChunks)
+   {
+   if (numChunks <= _numChunks)
+      return;
+   if (_isDense)
+      {
+      if (numChunks > _chunksCapacity)
+         {
+         int32_t capacity = numChunks > 2 * _chunksCapacity ? numChunks : 2 * _chunksCapacity;
+         chunk_t *chunks = (chunk_t *)_region->allocate(capacity * sizeof(chunk_t));
+         memcpy(chunks, _chunks, _numChunks * sizeof(chunk_t));
+         _chunks = chunks;
+         _chunksCapacity = capacity;
+         }
+      memset(_chunks + _numChunks, 0, (numChunks - _numChunks) * sizeof(chunk_t));
+      }
+   _numChunks = numChunks;
+   }
+
+void TR_HybridBitVector::ensureSparseCapacity(int32_t numWords)
+   {
+   if (numWords <= _sparseCapacity)
+      return;
+   int32_t capacity = 2 * _sparseCapacity;
+   if (capacity < numWords)
+      capacity = numWords;
+   if (capacity < 4)
+      capacity = 4;
+   int32_t *indices = (int32_t *)_region->allocate(capacity * sizeof(int32_t));
+   chunk_t *words = (chunk_t *)_region->allocate(capacity * sizeof(chunk_t));
+   if (_numWords)
+      {
+      memcpy(indices, _indices, _numWords * sizeof(int32_t));
+      memcpy(words, _words, _numWords * sizeof(chunk_t));
+      }
+   _indices = indices;
+   _words = words;
+   _sparseCapacity = capacity;
+   }
+
+void TR_HybridBitVector::makeDense()
+   {
+   if (_isDense)
+      return;
+   if (_chunksCapacity < _numChunks)
+      {
+      _chunks = (chunk_t *)_region->allocate(_numChunks * sizeof(chunk_t));
+      _chunksCapacity = _numChunks;
+      }
+   memset(_chunks, 0, _numChunks * sizeof(chunk_t));
+   for (int32_t i = 0; i < _numWords; i++)
+      _chunks[_indices[i]] = _words[i];
+   _numWords = 0;
+   _isDense = true;
+   }
+
+int32_t TR_HybridBitVector::findWord(int32_t chunkIndex)
+   {
+   int32_t low = 0;
+   int32_t high = _numWords;
+   while (low < high)
+      {
+      int32_t mid = (low + high) >> 1;
+      if (_indices[mid] < chunkIndex)
+         low = mid + 1;
+      else
+         high = mid;
+      }
+   return low;
+   }
+
+void TR_HybridBitVector::orChunk(int32_t chunkIndex, chunk_t bits)
+   {
+   if (bits == 0)
+      return;
+   ensureChunks(chunkIndex + 1);
+   if (!_isDense)
+      {
+      int32_t i = findWord(chunkIndex);
+      if (i < _numWords && _indices[i] == chunkIndex)
+         {
+         _words[i] |= bits;
+         return;
+         }
+      if (!shouldBeDense(_numWords + 1))
+         {
+         ensureSparseCapacity(_numWords + 1);
+         memmove(_indices + i + 1, _indices + i, (_numWords - i) * sizeof(int32_t));
+         memmove(_words + i + 1, _words + i, (_numWords - i) * sizeof(chunk_t));
+         _indices[i] = chunkIndex;
+         _words[i] = bits;
+         _numWords++;
+         return;
+         }
+      makeDense();
+      }
+   _chunks[chunkIndex] |= bits;
+   }
+
+template <class Chunks>
+void TR_HybridBitVector::orSparseChunks(Chunks chunks)
+   {
+   // Count the chunks in the union first so that the merge can be done in
+   // place, from the highest chunk index down
+   //
+   int32_t count = _numWords;
+   int32_t i = _numWords - 1;
+   for (Chunks c = chunks; c.valid(); c.prev())
+      {
+      while (i >= 0 && _indices[i] > c.index())
+         i--;
+      if (i < 0 || _indices[i] != c.index())
+         count++;
+      }
+
+   if (shouldBeDense(count))
+      {
+      makeDense();
+      for (; chunks.valid(); chunks.prev())
+         _chunks[chunks.index()] |= chunks.bits();
+      return;
+      }
+
+   ensureSparseCapacity(count);
+   i = _numWords - 1;
+   int32_t k = count - 1;
+   for (; chunks.valid(); chunks.prev())
+      {
+      int32_t chunkIndex = chunks.index();
+      while (i >= 0 && _indices[i] > chunkIndex)
+         {
+         _indices[k] = _indices[i];
+         _words[k--] = _words[i--];
+         }
+      chunk_t bits = chunks.bits();
+      if (i >= 0 && _indices[i] == chunkIndex)
+         bits |= _words[i--];
+      _indices[k] = chunkIndex;
+      _words[k--] = bits;
+      }
+   TR_ASSERT(i == k, "Sparse merge out of step");
+   _numWords = count;
+   }
+
+void TR_HybridBitVector::andSparseChunks(const chunk_t *chunks, int32_t numChunks, bool complement)
+   {
+   int32_t k = 0;
+   for (int32_t i = 0; i < _numWords; i++)
+      {
+      chunk_t other = _indices[i] < numChunks ? chunks[_indices[i]] : 0;
+      chunk_t bits = _words[i] & (complement ? ~other : other);
+      if (bits)
+         {
+         _indices[k] = _indices[i];
+         _words[k++] = bits;
+         }
+      }
+   _numWords = k;
+   }
+
+void TR_HybridBitVector::andDenseChunks(const chunk_t *chunks, int32_t numChunks)
+   {
+   int32_t n = numChunks < _numChunks ? numChunks : _numChunks;
+   andChunks(_chunks, chunks, n);
+   memset(_chunks + n, 0, (_numChunks - n) * sizeof(chunk_t));
+   }
+
+bool TR_HybridBitVector::isSet(int64_t n)
+   {
+   int32_t chunkIndex = TR_BitVector::getChunkIndex(n);
+   if (chunkIndex >= _numChunks)
+      return false;
+   chunk_t mask = TR_BitVector::getBitMask(static_cast<int32_t>(n));
+   if (_isDense)
+      return (_chunks[chunkIndex] & mask) != 0;
+   int32_t i = findWord(chunkIndex);
+   return i < _numWords && _indices[i] == chunkIndex && (_words[i] & mask) != 0;
+   }
+
+void TR_HybridBitVector::set(int64_t n)
+   {
+   TR_ASSERT(n >= 0, "assertion failure");
+   orChunk(TR_BitVector::getChunkIndex(n), TR_BitVector::getBitMask(static_cast<int32_t>(n)));
+   }
+
+void TR_HybridBitVector::reset(int64_t n)
+   {
+   int32_t chunkIndex = TR_BitVector::getChunkIndex(n);
+   if (chunkIndex >= _numChunks)
+      return;
+   chunk_t mask = TR_BitVector::getBitMask(static_cast<int32_t>(n));
+   if (_isDense)
+      {
+      _chunks[chunkIndex] &= ~mask;
+      return;
+      }
+   int32_t i = findWord(chunkIndex);
+   if (i < _numWords && _indices[i] == chunkIndex)
+      {
+      _words[i] &= ~mask;
+      if (_words[i] == 0)
+         {
+         memmove(_indices + i, _indices + i + 1, (_numWords - i - 1) * sizeof(int32_t));
+         memmove(_words + i, _words + i + 1, (_numWords - i - 1) * sizeof(chunk_t));
+         _numWords--;
+         }
+      }
+   }
+
+void TR_HybridBitVector::setAll(int64_t m, int64_t n)
+   {
+   if (n < m)
+      return;
+   int32_t firstChunk = TR_BitVector::getChunkIndex(m);
+   int32_t lastChunk = TR_BitVector::getChunkIndex(n);
+   ensureChunks(lastChunk + 1);
+   if (!_isDense && shouldBeDense(_numWords + lastChunk - firstChunk + 1))
+      makeDense();
+   for (int32_t c = firstChunk; c <= lastChunk; c++)
+      orChunk(c, rangeMask(c, m, n));
+   }
+
+void TR_HybridBitVector::resetAll(int64_t m, int64_t n)
+   {
+   if (n < m)
+      return;
+   int32_t firstChunk = TR_BitVector::getChunkIndex(m);
+   int32_t lastChunk = TR_BitVector::getChunkIndex(n);
+   if (lastChunk >= _numChunks)
+      lastChunk = _numChunks - 1;
+   if (_isDense)
+      {
+      for (int32_t c = firstChunk; c <= lastChunk; c++)
+         _chunks[c] &= ~rangeMask(c, m, n);
+      return;
+      }
+   int32_t k = findWord(firstChunk);
+   for (int32_t i = k; i < _numWords; i++)
+      {
+      chunk_t bits = _words[i];
+      if (_indices[i] <= lastChunk)
+         bits &= ~rangeMask(_indices[i], m, n);
+      if (bits)
+         {
+         _indices[k] = _indices[i];
+         _words[k++] = bits;
+         }
+      }
+   _numWords = k;
+   }
+
+bool TR_HybridBitVector::isEmpty()
+   {
+   if (_isDense)
+      return !anyChunks(_chunks, NULL, _numChunks);
+   return _numWords == 0;
+   }
+
+bool TR_HybridBitVector::hasMoreThanOneElement()
+   {
+   const chunk_t *chunks = _isDense ? _chunks : _words;
+   int32_t numChunks = _isDense ? _numChunks : _numWords;
+   bool seenOne = false;
+   for (int32_t i = 0; i < numChunks; i++)
+      {
+      chunk_t bits = chunks[i];
+      if (bits)
+         {
+         if (seenOne || (bits & (bits - 1)))
+            return true;
+         seenOne = true;
+         }
+      }
+   return false;
+   }
+
+int32_t TR_HybridBitVector::elementCount()
+   {
+   const chunk_t *chunks = _isDense ? _chunks : _words;
+   int32_t numChunks = _isDense ? _numChunks : _numWords;
+   int32_t count = 0;
+   for (int32_t i = 0; i < numChunks; i++)
+      count += chunkPopulation(chunks[i]);
+   return count;
+   }
+
+int32_t TR_HybridBitVector::numNonZeroChunks()
+   {
+   if (!_isDense)
+      return _numWords;
+   int32_t count = 0;
+   for (int32_t i = 0; i < _numChunks; i++)
+      {
+      if (_chunks[i])
+         count++;
+      }
+   return count;
+   }
+
+// Compare a dense set with a sparse one
+//
+static bool sameChunks(const chunk_t *chunks, int32_t numChunks, const int32_t *indices, const chunk_t *words, int32_t numWords)
+   {
+   int32_t j = 0;
+   for (int32_t c = 0; c < numChunks; c++)
+      {
+      chunk_t expected = 0;
+      if (j < numWords && indices[j] == c)
+         expected = words[j++];
+      if (chunks[c] != expected)
+         return false;
+      }
+   return j == numWords;
+   }
+
+bool TR_HybridBitVector::operator== (TR_HybridBitVector &v2)
+   {
+   if (!_isDense && !v2._isDense)
+      {
+      return _numWords == v2._numWords &&
+             memcmp(_indices, v2._indices, _numWords * sizeof(int32_t)) == 0 &&
+             memcmp(_words, v2._words, _numWords * sizeof(chunk_t)) == 0;
+      }
+   if (_isDense && v2._isDense)
+      {
+      int32_t n = _numChunks < v2._numChunks ? _numChunks : v2._numChunks;
+      if (memcmp(_chunks, v2._chunks, n * sizeof(chunk_t)) != 0)
+         return false;
+      if (_numChunks > n)
+         return !anyChunks(_chunks + n, NULL, _numChunks - n);
+      return !anyChunks(v2._chunks + n, NULL, v2._numChunks - n);
+      }
+   if (_isDense)
+      return sameChunks(_chunks, _numChunks, v2._indices, v2._words, v2._numWords);
+   return sameChunks(v2._chunks, v2._numChunks, _indices, _words, _numWords);
+   }
+
+bool TR_HybridBitVector::intersects(TR_HybridBitVector &v2)
+   {
+   if (_isDense && v2._isDense)
+      return anyChunks(_chunks, v2._chunks, _numChunks < v2._numChunks ? _numChunks : v2._numChunks);
+
+   if (!_isDense && !v2._isDense)
+      {
+      int32_t i = 0, j = 0;
+      while (i < _numWords && j < v2._numWords)
+         {
+         if (_indices[i] < v2._indices[j])
+            i++;
+         else if (_indices[i] > v2._indices[j])
+            j++;
+         else if (_words[i++] & v2._words[j++])
+            return true;
+         }
+      return false;
+      }
+
+   TR_HybridBitVector &dense = _isDense ? *this : v2;
+   TR_HybridBitVector &sparse = _isDense ? v2 : *this;
+   for (int32_t i = 0; i < sparse._numWords; i++)
+      {
+      if (sparse._indices[i] < dense._numChunks && (dense._chunks[sparse._indices[i]] & sparse._words[i]))
+         return true;
+      }
+   return false;
+   }
+
+void TR_HybridBitVector::operator= (TR_HybridBitVector &v2)
+   {
+   if (&v2 == this)
+      return;
+   ensureChunks(v2._numChunks);
+   if (v2._isDense)
+      {
+      if (_chunksCapacity < _numChunks)
+         {
+         _chunks = (chunk_t *)_region->allocate(_numChunks * sizeof(chunk_t));
+         _chunksCapacity = _numChunks;
+         }
+      memcpy(_chunks, v2._chunks, v2._numChunks * sizeof(chunk_t));
+      memset(_chunks + v2._numChunks, 0, (_numChunks - v2._numChunks) * sizeof(chunk_t));
+      _numWords = 0;
+      _isDense = true;
+      }
+   else
+      {
+      _isDense = false;
+      _numWords = 0;
+      ensureSparseCapacity(v2._numWords);
+      memcpy(_indices, v2._indices, v2._numWords * sizeof(int32_t));
+      memcpy(_words, v2._words, v2._numWords * sizeof(chunk_t));
+      _numWords = v2._numWords;
+      }
+   }
+
+void TR_HybridBitVector::operator|= (TR_HybridBitVector &v2)
+   {
+   if (&v2 == this)
+      return;
+   ensureChunks(v2._numChunks);
+   if (v2._isDense)
+      {
+      makeDense();
+      orChunks(_chunks, v2._chunks, v2._numChunks);
+      }
+   else if (_isDense)
+      {
+      for (int32_t i = 0; i < v2._numWords; i++)
+         _chunks[v2._indices[i]] |= v2._words[i];
+      }
+   else
+      {
+      orSparseChunks(TR_SparseChunks(v2._indices, v2._words, v2._numWords));
+      }
+   }
+
+void TR_HybridBitVector::operator&= (TR_HybridBitVector &v2)
+   {
+   if (&v2 == this)
+      return;
+   if (!_isDense)
+      {
+      if (v2._isDense)
+         {
+         andSparseChunks(v2._chunks, v2._numChunks, false);
+         }
+      else
+         {
+         int32_t i = 0, j = 0, k = 0;
+         while (i < _numWords && j < v2._numWords)
+            {
+            if (_indices[i] < v2._indices[j])
+               i++;
+            else if (_indices[i] > v2._indices[j])
+               j++;
+            else
+               {
+               chunk_t bits = _words[i] & v2._words[j++];
+               if (bits)
+                  {
+                  _indices[k] = _indices[i];
+                  _words[k++] = bits;
+                  }
+               i++;
+               }
+            }
+         _numWords = k;
+         }
+      }
+   else if (v2._isDense)
+      {
+      andDenseChunks(v2._chunks, v2._numChunks);
+      }
+   else
+      {
+      // The result has no more chunks than the sparse operand, so keep it sparse
+      //
+      ensureSparseCapacity(v2._numWords);
+      int32_t k = 0;
+      for (int32_t j = 0; j < v2._numWords; j++)
+         {
+         int32_t chunkIndex = v2._indices[j];
+         chunk_t bits = chunkIndex < _numChunks ? _chunks[chunkIndex] & v2._words[j] : 0;
+         if (bits)
+            {
+            _indices[k] = chunkIndex;
+            _words[k++] = bits;
+            }
+         }
+      _numWords = k;
+      _isDense = false;
+      }
+   }
+
+void TR_HybridBitVector::operator-= (TR_HybridBitVector &v2)
+   {
+   if (&v2 == this)
+      {
+      empty();
+      return;
+      }
+   if (_isDense)
+      {
+      if (v2._isDense)
+         {
+         andNotChunks(_chunks, v2._chunks, _numChunks < v2._numChunks ? _numChunks : v2._numChunks);
+         }
+      else
+         {
+         for (int32_t j = 0; j < v2._numWords && v2._indices[j] < _numChunks; j++)
+            _chunks[v2._indices[j]] &= ~v2._words[j];
+         }
+      }
+   else if (v2._isDense)
+      {
+      andSparseChunks(v2._chunks, v2._numChunks, true);
+      }
+   else
+      {
+      int32_t j = 0, k = 0;
+      for (int32_t i = 0; i < _numWords; i++)
+         {
+         chunk_t bits = _words[i];
+         while (j < v2._numWords && v2._indices[j] < _indices[i])
+            j++;
+         if (j < v2._numWords && v2._indices[j] == _indices[i])
+            bits &= ~v2._words[j];
+         if (bits)
+            {
+            _indices[k] = _indices[i];
+            _words[k++] = bits;
+            }
+         }
+      _numWords = k;
+      }
+   }
+
+void TR_HybridBitVector::operator|= (TR_BitVector &v2)
+   {
+   if (v2.isEmpty())
+      return;
+   int32_t first = v2._firstChunkWithNonZero;
+   int32_t last = v2._lastChunkWithNonZero;
+   ensureChunks(last + 1);
+   if (_isDense)
+      orChunks(_chunks + first, v2._chunks + first, last - first + 1);
+   else
+      orSparseChunks(TR_DenseChunks(v2._chunks, first, last));
+   }
+
+void TR_HybridBitVector::operator&= (TR_BitVector &v2)
+   {
+   if (_isDense)
+      andDenseChunks(v2._chunks, v2._numChunks);
+   else
+      andSparseChunks(v2._chunks, v2._numChunks, false);
+   }
+
+void TR_HybridBitVector::operator-= (TR_BitVector &v2)
+   {
+   if (v2.isEmpty())
+      return;
+   if (_isDense)
+      {
+      int32_t first = v2._firstChunkWithNonZero;
+      int32_t last = v2._lastChunkWithNonZero < _numChunks ? v2._lastChunkWithNonZero : _numChunks - 1;
+      if (first <= last)
+         andNotChunks(_chunks + first, v2._chunks + first, last - first + 1);
+      }
+   else
+      {
+      andSparseChunks(v2._chunks, v2._numChunks, true);
+      }
+   }
+
+void TR_BitVector::operator|= (TR_HybridBitVector &v2)
+   {
+   if (v2.isEmpty())
+      return;
+   ensureBits(TR_BitVector::getBitIndex(v2._numChunks) - 1);
+   if (v2._isDense)
+      {
+      orChunks(_chunks, v2._chunks, v2._numChunks);
+      resetLowAndHighChunks(0, _numChunks - 1);
+      }
+   else
+      {
+      for (int32_t i = 0; i < v2._numWords; i++)
+         _chunks[v2._indices[i]] |= v2._words[i];
+      if (v2._indices[0] < _firstChunkWithNonZero)
+         _firstChunkWithNonZero = v2._indices[0];
+      if (v2._indices[v2._numWords - 1] > _lastChunkWithNonZero)
+         _lastChunkWithNonZero = v2._indices[v2._numWords - 1];
+      }
+#if BV_SANITY_CHECK
+   sanityCheck("operator|=(hybrid)");
+#endif
+   }
+
+void TR_BitVector::operator&= (TR_HybridBitVector &v2)
+   {
+   if (isEmpty())
+      return;
+   int32_t low = _firstChunkWithNonZero;
+   int32_t high = _lastChunkWithNonZero;
+   if (v2._isDense)
+      {
+      int32_t n = v2._numChunks < high + 1 ? v2._numChunks : high + 1;
+      if (low < n)
+         andChunks(_chunks + low, v2._chunks + low, n - low);
+      for (int32_t c = n > low ? n : low; c <= high; c++)
+         _chunks[c] = 0;
+      }
+   else
+      {
+      int32_t j = v2.findWord(low);
+      for (int32_t c = low; c <= high; c++)
+         {
+         if (j < v2._numWords && v2._indices[j] == c)
+            _chunks[c] &= v2._words[j++];
+         else
+            _chunks[c] = 0;
+         }
+      }
+   resetLowAndHighChunks(low, high);
+#if BV_SANITY_CHECK
+   sanityCheck("operator&=(hybrid)");
+#endif
+   }
+
+void TR_HybridBitVector::print(TR::Compilation *comp, TR::FILE *file)
+   {
+   if (comp->getDebug())
+      {
+      if (file == NULL)
+         file = comp->getOutFile();
+      comp->getDebug()->print(file, this);
+      }
+   }
+
+void TR_HybridBitVectorIterator::reset()
+   {
+   _position = -1;
+   _chunkIndex = -1;
+   _bits = 0;
+   findNextChunk();
+   }
+
+void TR_HybridBitVectorIterator::findNextChunk()
+   {
+   TR_HybridBitVector &bv = *_bitVector;
+   if (bv._isDense)
+      {
+      while (++_position < bv._numChunks)
+         {
+         if (bv._chunks[_position])
+            {
+            _chunkIndex = _position;
+            _bits = bv._chunks[_position];
+            return;
+            }
+         }
+      }
+   else if (++_position < bv._numWords)
+      {
+      _chunkIndex = bv._indices[_position];
+      _bits = bv._words[_position];
+      return;
+      }
+   _bits = 0;
+   }
+
+int32_t TR_HybridBitVectorIterator::getNextElement()
+   {
+   TR_ASSERT(_bits, "No more elements in hybrid bit vector");
+   int32_t bitInChunk = firstBitInChunk(_bits);
+   _bits &= ~TR_BitVector::getBitMask(bitInChunk);
+   int32_t element = static_cast<int32_t>(TR_BitVector::getBitIndex(_chunkIndex)) + bitInChunk;
+   if (!_bits)
+      findNextChunk();
+   return element;
+   }
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef HYBRIDBITVECTOR_INCL
+#define HYBRIDBITVECTOR_INCL
+
+#include <stdint.h>
+#include "env/FilePointerDecl.hpp"
+#include "env/TRMemory.hpp"
+#include "infra/BitVector.hpp"
+
+class TR_HybridBitVectorIterator;
+namespace TR { class Compilation; }
+namespace TR { class Region; }
+
+/**
+ * A bit set that switches between a sparse and a dense representation.
+ *
+ * While few of its chunks are non-zero the set is kept as a sorted list of
+ * (chunk index, chunk) pairs, so that a set over tens of thousands of
+ * elements with a handful of members costs a few words rather than a chunk
+ * for every 64 possible elements. Once the fraction of non-zero chunks
+ * reaches 1/denseRatio the set switches to a plain chunk array and the bulk
+ * operations run through SIMD kernels where the host supports them. The
+ * chunk layout and bit numbering are identical to TR_BitVector, so the two
+ * can be combined chunk-at-a-time.
+ *
+ * The class implements the container interface used by the data flow
+ * engine, which lets an analysis pick it by instantiating the
+ * TR_*DFSetAnalysis templates over TR_HybridBitVector.
+ */
+class TR_HybridBitVector
+   {
+   public:
+   TR_ALLOC(TR_Memory::BitVector)
+
+   typedef TR_HybridBitVectorIterator Iterator;
+   typedef int32_t containerCharacteristic; // used by data flow
+   static const containerCharacteristic nullContainerCharacteristic = -1;
+
+   /// A set switches to dense once more than 1/defaultDenseRatio of its chunks are non-zero
+   static const int32_t defaultDenseRatio = 4;
+
+   /// Sets spanning no more than this many chunks are always dense
+   static const int32_t minSparseChunks = 4;
+
+   TR_HybridBitVector(int64_t initBits, TR_Memory *m, TR_AllocationKind allocKind = heapAlloc, int32_t denseRatio = defaultDenseRatio);
+   TR_HybridBitVector(int64_t initBits, TR::Region &region, int32_t denseRatio = defaultDenseRatio);
+
+   bool isDense() { return _isDense; }
+
+   int32_t get(int64_t n) { return isSet(n) ? 1 : 0; }
+   bool isSet(int64_t n);
+   void set(int64_t n);
+   void reset(int64_t n);
+
+   // Set the first n elements of the set
+   //
+   void setAll(int64_t n) { if (n > 0) setAll(0, n - 1); }
+
+   // Set elements m to n of the set
+   //
+   void setAll(int64_t m, int64_t n);
+
+   // Reset elements m to n of the set
+   //
+   void resetAll(int64_t m, int64_t n);
+
+   // Reset all elements of the set. This is constant time and leaves the set sparse.
+   //
+   void empty() { _isDense = false; _numWords = 0; }
+
+   bool isEmpty();
+   bool hasMoreThanOneElement();
+   int32_t elementCount();
+   int32_t numUsedChunks() { return _isDense ? _numChunks : _numWords; }
+   int32_t numNonZeroChunks();
+
+   bool intersects(TR_HybridBitVector &v2);
+   bool operator== (TR_HybridBitVector &v2);
+   bool operator!= (TR_HybridBitVector &v2) { return !operator==(v2); }
+
+   void operator= (TR_HybridBitVector &v2);
+   void operator|= (TR_HybridBitVector &v2);
+   void operator&= (TR_HybridBitVector &v2);
+   void operator-= (TR_HybridBitVector &v2);
+
+   // mixed type operations with dense bit vectors
+   void operator|= (TR_BitVector &v2);
+   void operator&= (TR_BitVector &v2);
+   void operator-= (TR_BitVector &v2);
+
+   void print(TR::Compilation *comp, TR::FILE *file = NULL);
+
+   private:
+
+   TR_HybridBitVector(const TR_HybridBitVector &);
+
+   void init(int64_t initBits, TR::Region *region, int32_t denseRatio);
+
+   void ensureChunks(int32_t numChunks);
+   void ensureSparseCapacity(int32_t numWords);
+   void makeDense();
+   bool shouldBeDense(int32_t numWords) { return _numChunks <= minSparseChunks || numWords * _denseRatio > _numChunks; }
+
+   static chunk_t rangeMask(int32_t chunkIndex, int64_t m, int64_t n);
+
+   /// Index of the first sparse entry whose chunk index is not below chunkIndex
+   int32_t findWord(int32_t chunkIndex);
+
+   /// OR a chunk into the set, keeping the sparse list sorted
+   void orChunk(int32_t chunkIndex, chunk_t bits);
+
+   /// Merge a descending sequence of chunks into this sparse set
+   template <class Chunks> void orSparseChunks(Chunks chunks);
+
+   /// Mask the chunks of this sparse set and drop the ones that become zero
+   void andSparseChunks(const chunk_t *chunks, int32_t numChunks, bool complement);
+
+   /// AND the chunks of this dense set, clearing the ones beyond numChunks
+   void andDenseChunks(const chunk_t *chunks, int32_t numChunks);
+
+   TR::Region *_region;
+   int32_t     _numChunks;
+   int32_t     _denseRatio;
+   bool        _isDense;
+
+   // Dense representation: _numChunks chunks, allocated on first use
+   chunk_t    *_chunks;
+   int32_t     _chunksCapacity;
+
+   // Sparse representation: _numWords non-zero chunks sorted by chunk index
+   int32_t    *_indices;
+   chunk_t    *_words;
+   int32_t     _numWords;
+   int32_t     _sparseCapacity;
+
+   friend class TR_BitVector;
+   friend class TR_HybridBitVectorIterator;
+   };
+
+class TR_HybridBitVectorIterator
+   {
+   public:
+
+   TR_HybridBitVectorIterator(TR_HybridBitVector &bv) : _bitVector(&bv) { reset(); }
+
+   void reset();
+
+   int hasMoreElements() { return _bits != 0; }
+
+   int32_t getNextElement();
+
+   private:
+
+   void findNextChunk();
+
+   TR_HybridBitVector *_bitVector;
+   int32_t             _position;
+   int32_t             _chunkIndex;
+   chunk_t             _bits;
+   };
+
+#endif
@@ -83,3 +83,4 @@ template<class Container>TR_DataFlowAnalysis::Kind TR_BackwardIntersectionDFSetA
    }
 
 template class TR_BackwardIntersectionDFSetAnalysis<TR_BitVector *>;
+template class TR_BackwardIntersectionDFSetAnalysis<TR_HybridBitVector *>;
@@ -725,6 +725,9 @@ int32_t TR_CopyPropagation::perform()
             dumpOptDetails(comp(), "%s   Use #%d[%p] is defined by:\n",OPT_DETAILS,i,useNode);
             dumpOptDetails(comp(), "%s      Def #%d[%p]\n",OPT_DETAILS, defIndex,useDefInfo->getNode(defIndex));
 
+            if (!equivalentDefNode->getOpCode().isStoreDirect())
+               _canMaintainUseDefs = false;
+
             comp()->incOrResetVisitCount();
             replaceCopySymbolReferenceByOriginalIn(copySymbolReference, equivalentDefNode, useNode, defNode);
             usesToBeFixed[useNode->getUseDefIndex()] = equivalentDefs[defIndex];
@@ -788,7 +791,10 @@ int32_t TR_CopyPropagation::perform()
       }
 
    if (_cleanupTemps)
+      {
+      _canMaintainUseDefs = false;
       rematerializeIndirectLoadsFromAutos();
+      }
 
    _lookForOriginalDefs = true;
    for (int32_t i = useDefInfo->getFirstUseIndex(); i <= lastUseIndex; i++)
@@ -868,8 +874,15 @@ int32_t TR_CopyPropagation::perform()
                anchorTree->insertBefore(TR::TreeTop::create(comp(), store));
 
                loadNode->setSymbolReference(newSymbolReference);
+               _canMaintainUseDefs = false;
                }
 
+            // The use/def info is only fixed up in place when a direct load
+            // is replaced by another direct load
+            //
+            if (_propagatingWholeExpression || isRegLoad || !rhsOfStoreDefNode->getOpCode().isLoadVarDirect())
+               _canMaintainUseDefs = false;
+
             donePropagation = true;
 
             if (_propagatingWholeExpression)
@@ -1020,7 +1033,8 @@ int32_t TR_CopyPropagation::perform()
       requestOpt(OMR::partialRedundancyElimination, true);
       }
 
-   optimizer()->setUseDefInfo(NULL);
+   if (!_canMaintainUseDefs)
+      optimizer()->setUseDefInfo(NULL);
 
    return 1; // actual cost
    }
@@ -34,6 +34,7 @@
 #include "infra/BitVector.hpp"
 #include "infra/Flags.hpp"
 #include "infra/HashTab.hpp"
+#include "infra/HybridBitVector.hpp"
 #include "infra/Link.hpp"
 #include "infra/List.hpp"
 #include "optimizer/Structure.hpp"
@@ -445,6 +446,17 @@ class TR_IntersectionBitVectorAnalysis : public TR_IntersectionDFSetAnalysis<TR_
       }
    };
 
+// Intersection analysis over hybrid sparse/dense sets, for analyses whose
+// sets are large and mostly empty
+//
+class TR_IntersectionHybridBitVectorAnalysis : public TR_IntersectionDFSetAnalysis<TR_HybridBitVector *>
+   {
+   public:
+   typedef TR_HybridBitVector ContainerType;
+   TR_IntersectionHybridBitVectorAnalysis(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer *optimizer, bool trace)
+      : TR_IntersectionDFSetAnalysis<TR_HybridBitVector *>(comp, cfg, optimizer, trace) {}
+   };
+
 // Forward union bit vector analysis
 //
 template<class Container>class TR_UnionDFSetAnalysis<Container *> : public TR_ForwardDFSetAnalysis<Container *>
@@ -480,7 +492,18 @@ class TR_UnionSingleBitContainerAnalysis : public TR_UnionDFSetAnalysis<TR_Singl
       TR_UnionDFSetAnalysis<TR_SingleBitContainer *>(comp, cfg, optimizer, trace) {}
   };
 
-class TR_ReachingDefinitions : public TR_UnionBitVectorAnalysis
+// Union analysis over hybrid sparse/dense sets, for analyses whose sets are
+// large and mostly empty
+//
+class TR_UnionHybridBitVectorAnalysis : public TR_UnionDFSetAnalysis<TR_HybridBitVector *>
+   {
+   public:
+   typedef TR_HybridBitVector ContainerType;
+   TR_UnionHybridBitVectorAnalysis(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer *optimizer, bool trace) :
+      TR_UnionDFSetAnalysis<TR_HybridBitVector *>(comp, cfg, optimizer, trace) {}
+   };
+
+class TR_ReachingDefinitions : public TR_UnionHybridBitVectorAnalysis
    {
    public:
 
@@ -585,6 +608,15 @@ class TR_BackwardIntersectionBitVectorAnalysis :
       : TR_BackwardIntersectionDFSetAnalysis<TR_BitVector *>(comp, cfg, optimizer, trace) { }
    };
 
+class TR_BackwardIntersectionHybridBitVectorAnalysis :
+   public TR_BackwardIntersectionDFSetAnalysis<TR_HybridBitVector *>
+   {
+   public:
+   typedef TR_HybridBitVector ContainerType;
+   TR_BackwardIntersectionHybridBitVectorAnalysis(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer *optimizer, bool trace)
+      : TR_BackwardIntersectionDFSetAnalysis<TR_HybridBitVector *>(comp, cfg, optimizer, trace) { }
+   };
+
 // Backward union bit vector analysis
 //
 template<class Container>class TR_BackwardUnionDFSetAnalysis<Container *> :
@@ -621,6 +653,15 @@ class TR_BackwardUnionSingleBitContainerAnalysis :
       : TR_BackwardUnionDFSetAnalysis<TR_SingleBitContainer *>(comp, cfg, optimizer, trace) { }
    };
 
+class TR_BackwardUnionHybridBitVectorAnalysis :
+   public TR_BackwardUnionDFSetAnalysis<TR_HybridBitVector *>
+   {
+   public:
+   typedef TR_HybridBitVector ContainerType;
+   TR_BackwardUnionHybridBitVectorAnalysis(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer *optimizer, bool trace)
+      : TR_BackwardUnionDFSetAnalysis<TR_HybridBitVector *>(comp, cfg, optimizer, trace) { }
+   };
+
 // First dataflow analysis in Partial Redundancy Elimination
 //
 class TR_GlobalAnticipatability
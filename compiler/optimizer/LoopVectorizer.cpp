@@ -0,0 +1,783 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/LoopVectorizer.hpp"
+
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/ILWalk.hpp"
+#include "optimizer/InductionVariable.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+#include "ras/Debug.hpp"
+
+// Upper bound on the number of runtime overlap checks guarding a vector loop
+#define MAX_OVERLAP_CHECKS 8
+
+TR_LoopVectorizer::TR_LoopVectorizer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager), _cfg(NULL)
+   {}
+
+int32_t
+TR_LoopVectorizer::perform()
+   {
+   if (!comp()->mayHaveLoops() || !comp()->target().is64Bit())
+      return 0;
+
+   _cfg = comp()->getFlowGraph();
+   TR_Structure *rootStructure = _cfg->getStructure();
+   if (!rootStructure)
+      return 0;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   TR::vector<TR_RegionStructure *, TR::Region&> innermostLoops(stackMemoryRegion);
+   collectInnermostLoops(rootStructure, innermostLoops);
+
+   // Analyze every loop before transforming any of them: the induction
+   // variable information hangs off the structure, which is discarded before
+   // the first transformation.
+   //
+   TR::vector<Loop *, TR::Region&> candidates(stackMemoryRegion);
+   for (auto it = innermostLoops.begin(); it != innermostLoops.end(); ++it)
+      {
+      Loop *loop = new (stackMemoryRegion) Loop(stackMemoryRegion);
+      if (analyzeLoop(*it, *loop) && chooseVectorLength(*loop))
+         candidates.push_back(loop);
+      }
+
+   int32_t numVectorized = 0;
+   for (auto it = candidates.begin(); it != candidates.end(); ++it)
+      {
+      Loop *loop = *it;
+      if (!performTransformation(comp(), "%sVectorizing loop %d using %d lanes of %s\n", optDetailString(),
+            loop->_body->getNumber(), loop->_lanes, TR::DataType::getName(loop->_elementType)))
+         continue;
+
+      // The new blocks do not fit the existing structure, so it is
+      // discarded rather than updated edge by edge
+      //
+      if (numVectorized == 0)
+         {
+         _cfg->setStructure(NULL);
+         optimizer()->setUseDefInfo(NULL);
+         optimizer()->setValueNumberInfo(NULL);
+         optimizer()->setAliasSetsAreValid(false);
+         }
+
+      vectorizeLoop(*loop);
+      numVectorized++;
+      }
+
+   return numVectorized;
+   }
+
+const char *
+TR_LoopVectorizer::optDetailString() const throw()
+   {
+   return "O^O LOOP VECTORIZER: ";
+   }
+
+void
+TR_LoopVectorizer::collectInnermostLoops(TR_Structure *structure, TR::vector<TR_RegionStructure *, TR::Region&> &loops)
+   {
+   TR_RegionStructure *region = structure->asRegion();
+   if (!region)
+      return;
+
+   bool containsLoop = false;
+   TR_RegionStructure::Cursor it(*region);
+   for (TR_StructureSubGraphNode *node = it.getFirst(); node; node = it.getNext())
+      {
+      TR_RegionStructure *subRegion = node->getStructure()->asRegion();
+      if (subRegion)
+         {
+         containsLoop = true;
+         collectInnermostLoops(subRegion, loops);
+         }
+      }
+
+   if (region->isNaturalLoop() && !containsLoop)
+      loops.push_back(region);
+   }
+
+bool
+TR_LoopVectorizer::isDefinedInLoop(Loop &loop, TR::SymbolReference *symRef)
+   {
+   for (auto it = loop._definedSymbols.begin(); it != loop._definedSymbols.end(); ++it)
+      {
+      if ((*it)->getReferenceNumber() == symRef->getReferenceNumber())
+         return true;
+      }
+   return false;
+   }
+
+bool
+TR_LoopVectorizer::isInductionVariableLoad(Loop &loop, TR::Node *node)
+   {
+   return node->getOpCode().isLoadVarDirect()
+      && node->getSymbolReference()->getReferenceNumber() == loop._ivSymRef->getReferenceNumber();
+   }
+
+/**
+ * A node is invariant in a candidate loop if it is a constant, the address
+ * of a local, or a load of an auto or parm that the loop does not store to.
+ * The candidate loops contain no calls and no direct stores other than the
+ * ones recorded in the loop's defined symbols, so nothing else can change
+ * such a value.
+ */
+bool
+TR_LoopVectorizer::isLoopInvariant(Loop &loop, TR::Node *node)
+   {
+   if (node->getOpCode().isLoadConst())
+      return true;
+
+   if (node->getOpCodeValue() == TR::loadaddr)
+      return node->getSymbol()->isAutoOrParm();
+
+   if (node->getOpCode().isLoadVarDirect())
+      return node->getSymbol()->isAutoOrParm() && !isDefinedInLoop(loop, node->getSymbolReference());
+
+   return false;
+   }
+
+bool
+TR_LoopVectorizer::setElementType(Loop &loop, TR::DataType type)
+   {
+   if (!type.isVectorElement())
+      return false;
+
+   if (loop._elementType == TR::NoType)
+      loop._elementType = type;
+
+   return loop._elementType == type;
+   }
+
+/**
+ * Match `aladd(base, lmul(i2l(iv), elementSize))`, or the equivalent shift,
+ * with a loop-invariant base, and return the base.
+ */
+TR::Node *
+TR_LoopVectorizer::getArrayBase(Loop &loop, TR::Node *address, int32_t elementSize)
+   {
+   if (address->getOpCodeValue() != TR::aladd)
+      return NULL;
+
+   TR::Node *base = address->getFirstChild();
+   TR::Node *offset = address->getSecondChild();
+   if (!base->getOpCode().hasSymbolReference() || !isLoopInvariant(loop, base))
+      return NULL;
+
+   TR::Node *index = NULL;
+   if (offset->getOpCodeValue() == TR::lmul)
+      {
+      TR::Node *scale = offset->getSecondChild();
+      if (scale->getOpCodeValue() == TR::lconst && scale->getLongInt() == elementSize)
+         index = offset->getFirstChild();
+      }
+   else if (offset->getOpCodeValue() == TR::lshl)
+      {
+      TR::Node *shift = offset->getSecondChild();
+      if (shift->getOpCodeValue() == TR::iconst && (1 << shift->getInt()) == elementSize)
+         index = offset->getFirstChild();
+      }
+   else if (elementSize == 1)
+      {
+      index = offset;
+      }
+
+   if (!index || index->getOpCodeValue() != TR::i2l)
+      return NULL;
+
+   if (!isInductionVariableLoad(loop, index->getFirstChild()))
+      return NULL;
+
+   return base;
+   }
+
+static bool
+isSameBase(TR::Node *a, TR::Node *b)
+   {
+   return a->getOpCodeValue() == b->getOpCodeValue()
+      && a->getSymbolReference()->getReferenceNumber() == b->getSymbolReference()->getReferenceNumber();
+   }
+
+void
+TR_LoopVectorizer::addBase(TR::vector<TR::Node *, TR::Region&> &bases, TR::Node *base)
+   {
+   for (auto it = bases.begin(); it != bases.end(); ++it)
+      {
+      if (isSameBase(*it, base))
+         return;
+      }
+   bases.push_back(base);
+   }
+
+static void
+addScalarOp(TR::vector<TR::ILOpCodes, TR::Region&> &ops, TR::ILOpCodes op)
+   {
+   for (auto it = ops.begin(); it != ops.end(); ++it)
+      {
+      if (*it == op)
+         return;
+      }
+   ops.push_back(op);
+   }
+
+bool
+TR_LoopVectorizer::isVectorizableAccess(Loop &loop, TR::Node *node)
+   {
+   if (node->getDataType() != loop._elementType
+       || node->getSymbolReference()->getOffset() != 0
+       || (node->getOpCode().isStore() && node->getOpCode().isWrtBar()))
+      return false;
+
+   TR::Node *base = getArrayBase(loop, node->getFirstChild(), TR::DataType::getSize(loop._elementType));
+   if (!base)
+      return false;
+
+   addBase(loop._bases, base);
+   if (node->getOpCode().isStore())
+      addBase(loop._storedBases, base);
+
+   addScalarOp(loop._scalarOps, node->getOpCodeValue());
+   return true;
+   }
+
+bool
+TR_LoopVectorizer::isVectorizableExpression(Loop &loop, TR::Node *node)
+   {
+   if (node->getDataType() != loop._elementType)
+      return false;
+
+   if (node->getOpCode().isLoadIndirect())
+      return isVectorizableAccess(loop, node);
+
+   if (isLoopInvariant(loop, node))
+      {
+      loop._needsSplats = true;
+      return true;
+      }
+
+   TR::ILOpCode &op = node->getOpCode();
+   bool isElementWise = op.isAdd() || op.isSub() || op.isMul() || op.isAnd() || op.isOr() || op.isXor() || op.isNeg()
+      || (op.isDiv() && node->getDataType().isFloatingPoint());
+   if (!isElementWise || TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), TR::VectorLength128) == TR::BadILOp)
+      return false;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!isVectorizableExpression(loop, node->getChild(i)))
+         return false;
+      }
+
+   addScalarOp(loop._scalarOps, node->getOpCodeValue());
+   return true;
+   }
+
+static bool
+isIncrementByOne(TR::Node *node, TR::SymbolReference *ivSymRef)
+   {
+   TR::Node *load = node->getFirstChild();
+   if (!load->getOpCode().isLoadVarDirect()
+       || load->getSymbolReference()->getReferenceNumber() != ivSymRef->getReferenceNumber())
+      return false;
+
+   TR::Node *step = node->getSecondChild();
+   if (step->getOpCodeValue() != TR::iconst)
+      return false;
+
+   return (node->getOpCodeValue() == TR::iadd && step->getInt() == 1)
+      || (node->getOpCodeValue() == TR::isub && step->getInt() == -1);
+   }
+
+bool
+TR_LoopVectorizer::analyzeLoop(TR_RegionStructure *region, Loop &loop)
+   {
+   TR::Block *body = region->getEntryBlock();
+   int32_t loopNumber = body->getNumber();
+
+   loop._region = region;
+   loop._body = body;
+   loop._elementType = TR::NoType;
+
+   if (region->numSubNodes() != 1 || body->isCold())
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: not a single warm block\n", loopNumber);
+      return false;
+      }
+
+   TR_PrimaryInductionVariable *piv = region->getPrimaryInductionVariable();
+   if (!piv
+       || piv->getBranchBlock() != body
+       || piv->getDeltaOnBackEdge() != 1
+       || piv->isUnsigned()
+       || piv->getSymRef()->getSymbol()->getDataType() != TR::Int32)
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: no int induction variable counting up by one\n", loopNumber);
+      return false;
+      }
+
+   loop._ivSymRef = piv->getSymRef();
+   loop._iterationCount = piv->getIterationCount();
+   loop._definedSymbols.push_back(loop._ivSymRef);
+
+   // The loop must be entered from a single pre-header and leave by falling
+   // through into the block that follows it.
+   //
+   if (!body->getExceptionSuccessors().empty() || !body->getExceptionPredecessors().empty())
+      return false;
+
+   loop._preheader = NULL;
+   for (auto edge = body->getPredecessors().begin(); edge != body->getPredecessors().end(); ++edge)
+      {
+      TR::Block *pred = toBlock((*edge)->getFrom());
+      if (pred == body)
+         continue;
+      if (loop._preheader || !pred->getEntry())
+         return false;
+      loop._preheader = pred;
+      }
+
+   loop._exit = body->getNextBlock();
+   if (!loop._preheader
+       || loop._preheader->getSuccessors().size() != 1
+       || !loop._exit
+       || body->getSuccessors().size() != 2
+       || !body->hasSuccessor(loop._exit))
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: no unique pre-header and fall-through exit\n", loopNumber);
+      return false;
+      }
+
+   loop._branchTree = body->getLastRealTreeTop();
+   TR::Node *branch = loop._branchTree->getNode();
+   if (branch->getOpCodeValue() != TR::ificmplt || branch->getBranchDestination() != body->getEntry())
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: loop test is not an ificmplt back edge\n", loopNumber);
+      return false;
+      }
+
+   // The induction variable must be incremented just before the loop test,
+   // so every other load of it in the body sees the value for the current
+   // iteration.
+   //
+   loop._ivStoreTree = loop._branchTree->getPrevTreeTop();
+   TR::Node *ivStore = loop._ivStoreTree->getNode();
+   if (!ivStore->getOpCode().isStoreDirect()
+       || ivStore->getSymbolReference()->getReferenceNumber() != loop._ivSymRef->getReferenceNumber()
+       || !isIncrementByOne(ivStore->getFirstChild(), loop._ivSymRef))
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: induction variable is not incremented just before the loop test\n", loopNumber);
+      return false;
+      }
+
+   TR::Node *tested = branch->getFirstChild();
+   if (tested != ivStore->getFirstChild()
+       && !(isInductionVariableLoad(loop, tested) && tested->getReferenceCount() == 1))
+      return false;
+
+   // The stores determine the element type and the symbols the loop defines
+   //
+   TR::TreeTop *firstTree = body->getFirstRealTreeTop();
+   for (TR::TreeTop *tt = firstTree; tt != loop._ivStoreTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCode().isStoreDirect())
+         {
+         if (isDefinedInLoop(loop, node->getSymbolReference()) || !node->getSymbol()->isAutoOrParm())
+            return false;
+         loop._definedSymbols.push_back(node->getSymbolReference());
+         }
+
+      if (node->getOpCode().isStore() && !setElementType(loop, node->getDataType()))
+         {
+         if (trace())
+            traceMsg(comp(), "Loop %d: stores of more than one vectorizable type\n", loopNumber);
+         return false;
+         }
+      }
+
+   loop._bound = branch->getSecondChild();
+   if (!isLoopInvariant(loop, loop._bound))
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: loop bound is not invariant\n", loopNumber);
+      return false;
+      }
+
+   for (TR::TreeTop *tt = firstTree; tt != loop._ivStoreTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      bool vectorizable = false;
+
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         TR::Node *child = node->getFirstChild();
+         vectorizable = isLoopInvariant(loop, child)
+            || isInductionVariableLoad(loop, child)
+            || isVectorizableExpression(loop, child);
+         }
+      else if (node->getOpCode().isStoreIndirect())
+         {
+         vectorizable = isVectorizableAccess(loop, node)
+            && isVectorizableExpression(loop, node->getSecondChild());
+         loop._hasVectorStore = true;
+         }
+      else if (node->getOpCode().isStoreDirect())
+         {
+         // Only integral add reductions: reassociating floating-point adds
+         // would change the result.
+         //
+         TR::Node *value = node->getFirstChild();
+         TR::ILOpCodes addOp = value->getOpCodeValue();
+         if (addOp == TR::iadd || addOp == TR::ladd)
+            {
+            for (int32_t i = 0; i < 2 && !vectorizable; i++)
+               {
+               TR::Node *accumulated = value->getChild(i);
+               TR::Node *expression = value->getChild(1 - i);
+               if (accumulated->getOpCode().isLoadVarDirect()
+                   && accumulated->getSymbolReference()->getReferenceNumber() == node->getSymbolReference()->getReferenceNumber()
+                   && accumulated->getReferenceCount() == 1
+                   && isVectorizableExpression(loop, expression))
+                  {
+                  Reduction reduction = { tt, node->getSymbolReference(), expression, NULL };
+                  loop._reductions.push_back(reduction);
+                  addScalarOp(loop._scalarOps, addOp);
+                  vectorizable = true;
+                  }
+               }
+            }
+         }
+
+      if (!vectorizable)
+         {
+         if (trace())
+            traceMsg(comp(), "Loop %d: cannot vectorize tree n%dn\n", loopNumber, node->getGlobalIndex());
+         return false;
+         }
+      }
+
+   if (!loop._hasVectorStore && loop._reductions.empty())
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: no array stores or reductions\n", loopNumber);
+      return false;
+      }
+
+   int32_t numOverlapChecks = 0;
+   for (auto stored = loop._storedBases.begin(); stored != loop._storedBases.end(); ++stored)
+      {
+      for (auto base = loop._bases.begin(); base != loop._bases.end(); ++base)
+         {
+         if (!isSameBase(*stored, *base))
+            numOverlapChecks++;
+         }
+      }
+   if (numOverlapChecks > MAX_OVERLAP_CHECKS)
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: too many overlap checks (%d)\n", loopNumber, numOverlapChecks);
+      return false;
+      }
+
+   return true;
+   }
+
+bool
+TR_LoopVectorizer::isSupported(TR::ILOpCodes scalarOp, TR::VectorLength length)
+   {
+   TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(scalarOp, length);
+   return vectorOp != TR::BadILOp && cg()->getSupportsOpCodeForAutoSIMD(vectorOp);
+   }
+
+/**
+ * Pick the widest vector length at which the target supports every vector
+ * opcode the loop needs.  When the trip count is known, lengths that would
+ * not run at least two full vectors are skipped.
+ */
+bool
+TR_LoopVectorizer::chooseVectorLength(Loop &loop)
+   {
+   static const TR::VectorLength lengths[] = { TR::VectorLength512, TR::VectorLength256, TR::VectorLength128 };
+
+   for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+      {
+      TR::VectorLength length = lengths[i];
+      if (length > TR::NumVectorLengths)
+         continue;
+
+      TR::DataType vectorType = TR::DataType::createVectorType(loop._elementType.getDataType(), length);
+      int32_t lanes = TR::DataType::getSize(vectorType) / TR::DataType::getSize(loop._elementType);
+      if (loop._iterationCount > 0 && loop._iterationCount < 2 * lanes)
+         continue;
+
+      bool supported = true;
+      for (auto op = loop._scalarOps.begin(); supported && op != loop._scalarOps.end(); ++op)
+         supported = isSupported(*op, length);
+
+      if (supported && (loop._needsSplats || !loop._reductions.empty()))
+         supported = cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType));
+
+      if (supported && !loop._reductions.empty())
+         supported = cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(TR::vload, vectorType))
+            && cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(TR::vstore, vectorType))
+            && cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(TR::vreductionAdd, vectorType));
+
+      if (supported)
+         {
+         loop._vectorLength = length;
+         loop._lanes = lanes;
+         return true;
+         }
+      }
+
+   if (trace())
+      traceMsg(comp(), "Loop %d: no supported vector length\n", loop._body->getNumber());
+   return false;
+   }
+
+TR::Block *
+TR_LoopVectorizer::appendBlock(TR::Node *originatingNode, int32_t frequency)
+   {
+   TR::Block *block = TR::Block::createEmptyBlock(originatingNode, comp(), frequency);
+   _cfg->addNode(block);
+   _cfg->findLastTreeTop()->join(block->getEntry());
+   return block;
+   }
+
+/**
+ * Create `(long)bound - (long)iv`, the number of iterations left before the
+ * loop test fails.  Computing it in 64 bits cannot overflow.
+ */
+TR::Node *
+TR_LoopVectorizer::createRemainingIterations(Loop &loop)
+   {
+   TR::Node *branch = loop._branchTree->getNode();
+   return TR::Node::create(branch, TR::lsub, 2,
+      TR::Node::create(branch, TR::i2l, 1, loop._bound->duplicateTree()),
+      TR::Node::create(branch, TR::i2l, 1, TR::Node::createLoad(branch, loop._ivSymRef)));
+   }
+
+/**
+ * Return the vector equivalent of \p node, one iteration's worth of which
+ * computes \p node for `_lanes` consecutive values of the induction variable.
+ * Nodes that are commoned in the scalar loop are commoned in the vector loop
+ * as well, so loads are evaluated at the same point relative to the stores.
+ */
+TR::Node *
+TR_LoopVectorizer::vectorize(Loop &loop, TR::Node *node, NodeMap &vectorNodes)
+   {
+   auto found = vectorNodes.find(node);
+   if (found != vectorNodes.end())
+      return found->second;
+
+   TR::DataType vectorType = TR::DataType::createVectorType(loop._elementType.getDataType(), loop._vectorLength);
+   TR::Node *vectorNode;
+   if (node->getOpCode().isLoadIndirect())
+      {
+      TR::SymbolReference *shadow = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, NULL);
+      TR::ILOpCodes loadOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), loop._vectorLength);
+      vectorNode = TR::Node::createWithSymRef(node, loadOp, 1, node->getFirstChild()->duplicateTree(), shadow);
+      }
+   else if (isLoopInvariant(loop, node))
+      {
+      vectorNode = TR::Node::create(node, TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType), 1, node->duplicateTree());
+      }
+   else
+      {
+      vectorNode = TR::Node::create(node, TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), loop._vectorLength), node->getNumChildren());
+      for (int32_t i = 0; i < node->getNumChildren(); i++)
+         vectorNode->setAndIncChild(i, vectorize(loop, node->getChild(i), vectorNodes));
+      }
+
+   vectorNodes[node] = vectorNode;
+   return vectorNode;
+   }
+
+/**
+ * Build, at the end of the method:
+ *
+ *   guard:   if (bound - iv < lanes) goto body
+ *   check*:  if (stored and other array overlap within a vector) goto body
+ *   init:    acc = splat(0) for every reduction
+ *   vector:  vector body; iv += lanes; if (bound - iv >= lanes) goto vector
+ *   fold:    s += reduce(acc) for every reduction; if (iv >= bound) goto exit
+ *            goto body
+ *
+ * and send the pre-header to the guard.  The original loop then runs the
+ * iterations left over after the vector loop, or all of them if the vector
+ * loop cannot be used.
+ */
+void
+TR_LoopVectorizer::vectorizeLoop(Loop &loop)
+   {
+   TR::Node *branch = loop._branchTree->getNode();
+   TR::Block *body = loop._body;
+   TR::DataType vectorType = TR::DataType::createVectorType(loop._elementType.getDataType(), loop._vectorLength);
+   int32_t vectorBytes = TR::DataType::getSize(vectorType);
+   int32_t outerFrequency = loop._preheader->getFrequency();
+
+   TR::Block *guard = appendBlock(branch, outerFrequency);
+   guard->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::iflcmplt, createRemainingIterations(loop), TR::Node::lconst(branch, loop._lanes), body->getEntry())));
+   _cfg->addEdge(guard, body);
+   TR::Block *previous = guard;
+
+   for (auto stored = loop._storedBases.begin(); stored != loop._storedBases.end(); ++stored)
+      {
+      for (auto base = loop._bases.begin(); base != loop._bases.end(); ++base)
+         {
+         if (isSameBase(*stored, *base))
+            continue;
+
+         // A pair of stored arrays needs to be checked only once
+         bool alreadyChecked = false;
+         for (auto other = loop._storedBases.begin(); other != stored; ++other)
+            alreadyChecked |= isSameBase(*other, *base);
+         if (alreadyChecked)
+            continue;
+
+         TR::Node *distance = TR::Node::create(branch, TR::lsub, 2,
+            TR::Node::create(branch, TR::a2l, 1, (*stored)->duplicateTree()),
+            TR::Node::create(branch, TR::a2l, 1, (*base)->duplicateTree()));
+         TR::Node *overlaps = TR::Node::create(branch, TR::iand, 2,
+            TR::Node::create(branch, TR::iand, 2,
+               TR::Node::create(branch, TR::lcmplt, 2, distance, TR::Node::lconst(branch, vectorBytes)),
+               TR::Node::create(branch, TR::lcmpgt, 2, distance, TR::Node::lconst(branch, -vectorBytes))),
+            TR::Node::create(branch, TR::lcmpne, 2, distance, TR::Node::lconst(branch, 0)));
+
+         TR::Block *check = appendBlock(branch, outerFrequency);
+         check->append(TR::TreeTop::create(comp(),
+            TR::Node::createif(TR::ificmpne, overlaps, TR::Node::iconst(branch, 0), body->getEntry())));
+         _cfg->addEdge(previous, check);
+         _cfg->addEdge(check, body);
+         previous = check;
+         }
+      }
+
+   if (!loop._reductions.empty())
+      {
+      TR::Block *init = appendBlock(branch, outerFrequency);
+      TR::ILOpCodes splatsOp = TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType);
+      for (auto reduction = loop._reductions.begin(); reduction != loop._reductions.end(); ++reduction)
+         {
+         reduction->_accumulator = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), vectorType);
+         TR::Node *zero = TR::Node::create(branch, splatsOp, 1, TR::Node::createConstZeroValue(branch, loop._elementType));
+         init->append(TR::TreeTop::create(comp(), TR::Node::createStore(branch, reduction->_accumulator, zero)));
+         }
+      _cfg->addEdge(previous, init);
+      previous = init;
+      }
+
+   TR::Block *vectorBody = appendBlock(branch, body->getFrequency());
+   NodeMap vectorNodes((NodeMapAllocator(trMemory()->currentStackRegion())));
+   Reduction *nextReduction = loop._reductions.empty() ? NULL : &loop._reductions[0];
+   for (TR::TreeTop *tt = body->getFirstRealTreeTop(); tt != loop._ivStoreTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      TR::Node *vectorTree;
+      if (node->getOpCode().isStoreIndirect())
+         {
+         TR::SymbolReference *shadow = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, NULL);
+         TR::ILOpCodes storeOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), loop._vectorLength);
+         vectorTree = TR::Node::createWithSymRef(storeOp, 2, 2,
+            node->getFirstChild()->duplicateTree(), vectorize(loop, node->getSecondChild(), vectorNodes), shadow);
+         }
+      else if (node->getOpCode().isStoreDirect())
+         {
+         TR_ASSERT_FATAL(nextReduction && nextReduction->_tree == tt, "Expecting reduction tree n%dn", node->getGlobalIndex());
+         TR::ILOpCodes addOp = TR::ILOpCode::convertScalarToVector(node->getFirstChild()->getOpCodeValue(), loop._vectorLength);
+         TR::Node *sum = TR::Node::create(branch, addOp, 2,
+            TR::Node::createLoad(branch, nextReduction->_accumulator),
+            vectorize(loop, nextReduction->_expression, vectorNodes));
+         vectorTree = TR::Node::createStore(branch, nextReduction->_accumulator, sum);
+         nextReduction = (nextReduction == &loop._reductions.back()) ? NULL : nextReduction + 1;
+         }
+      else
+         {
+         TR::Node *child = node->getFirstChild();
+         if (isLoopInvariant(loop, child) || isInductionVariableLoad(loop, child))
+            continue;
+         vectorTree = TR::Node::create(branch, TR::treetop, 1, vectorize(loop, child, vectorNodes));
+         }
+      vectorBody->append(TR::TreeTop::create(comp(), vectorTree));
+      }
+
+   TR::Node *step = TR::Node::create(branch, TR::iadd, 2,
+      TR::Node::createLoad(branch, loop._ivSymRef), TR::Node::iconst(branch, loop._lanes));
+   vectorBody->append(TR::TreeTop::create(comp(), TR::Node::createStore(branch, loop._ivSymRef, step)));
+   vectorBody->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::iflcmpge, createRemainingIterations(loop), TR::Node::lconst(branch, loop._lanes), vectorBody->getEntry())));
+   _cfg->addEdge(previous, vectorBody);
+   _cfg->addEdge(vectorBody, vectorBody);
+
+   TR::Block *fold = appendBlock(branch, outerFrequency);
+   TR::ILOpCodes reduceOp = TR::ILOpCode::createVectorOpCode(TR::vreductionAdd, vectorType);
+   for (auto reduction = loop._reductions.begin(); reduction != loop._reductions.end(); ++reduction)
+      {
+      TR::Node *sum = TR::Node::create(branch, reduction->_tree->getNode()->getFirstChild()->getOpCodeValue(), 2,
+         TR::Node::createLoad(branch, reduction->_symRef),
+         TR::Node::create(branch, reduceOp, 1, TR::Node::createLoad(branch, reduction->_accumulator)));
+      fold->append(TR::TreeTop::create(comp(), TR::Node::createStore(branch, reduction->_symRef, sum)));
+      }
+   fold->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::ificmpge, TR::Node::createLoad(branch, loop._ivSymRef), loop._bound->duplicateTree(), loop._exit->getEntry())));
+   _cfg->addEdge(vectorBody, fold);
+   _cfg->addEdge(fold, loop._exit);
+
+   TR::Block *epilogue = appendBlock(branch, outerFrequency);
+   epilogue->append(TR::TreeTop::create(comp(), TR::Node::create(branch, TR::Goto, 0, body->getEntry())));
+   _cfg->addEdge(fold, epilogue);
+   _cfg->addEdge(epilogue, body);
+
+   TR::CFGEdge *entryEdge = NULL;
+   for (auto edge = loop._preheader->getSuccessors().begin(); edge != loop._preheader->getSuccessors().end(); ++edge)
+      {
+      if ((*edge)->getTo() == body)
+         entryEdge = *edge;
+      }
+   TR::Block::redirectFlowToNewDestination(comp(), entryEdge, guard, true);
+
+   if (trace())
+      traceMsg(comp(), "Loop %d: guard block_%d, vector loop block_%d, reduction block_%d\n",
+         body->getNumber(), guard->getNumber(), vectorBody->getNumber(), fold->getNumber());
+   }
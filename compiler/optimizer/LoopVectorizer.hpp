@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef LOOPVECTORIZER_INCL
+#define LOOPVECTORIZER_INCL
+
+#include <stdint.h>
+#include <map>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_RegionStructure;
+class TR_Structure;
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+/**
+ * Loop vectorizer.
+ *
+ * Rewrites countable innermost loops over arrays into loops over the vector
+ * IL opcodes.  A candidate is a single-block loop, canonicalized by
+ * TR_LoopCanonicalizer, whose primary induction variable (as computed by
+ * TR_InductionVariableAnalysis) counts up by one towards a loop-invariant
+ * bound.  The body may contain only
+ *
+ *  - indirect stores to `base[iv]` of expressions built from loads of
+ *    `base[iv]`, loop invariants and element-wise arithmetic,
+ *  - integral add reductions `s = s + expr` into locals, and
+ *  - the induction variable increment and the loop test.
+ *
+ * The scalar loop is kept as the epilogue.  A guard in front of it enters a
+ * new vector loop when at least one full vector of iterations remains and no
+ * stored array overlaps another array in the loop closely enough to create a
+ * dependence within a vector.  After the vector loop, the reductions are
+ * folded back into their scalar locals and the remaining iterations run in
+ * the original loop.
+ *
+ * The widest vector length whose opcodes the code generator supports on the
+ * target CPU is used; loops that would not run at least two full vectors are
+ * left alone.
+ */
+class TR_LoopVectorizer : public TR::Optimization
+   {
+   public:
+
+   TR_LoopVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_LoopVectorizer(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   struct Reduction
+      {
+      TR::TreeTop *_tree;
+      TR::SymbolReference *_symRef;
+      TR::Node *_expression;
+      TR::SymbolReference *_accumulator;
+      };
+
+   struct Loop
+      {
+      Loop(TR::Region &region)
+         : _definedSymbols(region), _reductions(region), _storedBases(region), _bases(region), _scalarOps(region),
+           _needsSplats(false), _hasVectorStore(false)
+         {}
+
+      TR_RegionStructure *_region;
+      TR::Block *_preheader;
+      TR::Block *_body;
+      TR::Block *_exit;
+      TR::SymbolReference *_ivSymRef;
+      TR::Node *_bound;
+      int32_t _iterationCount;
+      TR::TreeTop *_ivStoreTree;
+      TR::TreeTop *_branchTree;
+      TR::DataType _elementType;
+      TR::VectorLength _vectorLength;
+      int32_t _lanes;
+      TR::vector<TR::SymbolReference *, TR::Region&> _definedSymbols;
+      TR::vector<Reduction, TR::Region&> _reductions;
+      TR::vector<TR::Node *, TR::Region&> _storedBases;
+      TR::vector<TR::Node *, TR::Region&> _bases;
+      TR::vector<TR::ILOpCodes, TR::Region&> _scalarOps;
+      bool _needsSplats;
+      bool _hasVectorStore;
+      };
+
+   typedef TR::typed_allocator<std::pair<TR::Node * const, TR::Node *>, TR::Region &> NodeMapAllocator;
+   typedef std::map<TR::Node *, TR::Node *, std::less<TR::Node *>, NodeMapAllocator> NodeMap;
+
+   void collectInnermostLoops(TR_Structure *structure, TR::vector<TR_RegionStructure *, TR::Region&> &loops);
+   bool analyzeLoop(TR_RegionStructure *region, Loop &loop);
+   bool isDefinedInLoop(Loop &loop, TR::SymbolReference *symRef);
+   bool isInductionVariableLoad(Loop &loop, TR::Node *node);
+   bool isLoopInvariant(Loop &loop, TR::Node *node);
+   bool setElementType(Loop &loop, TR::DataType type);
+   TR::Node *getArrayBase(Loop &loop, TR::Node *address, int32_t elementSize);
+   bool isVectorizableAccess(Loop &loop, TR::Node *node);
+   bool isVectorizableExpression(Loop &loop, TR::Node *node);
+   void addBase(TR::vector<TR::Node *, TR::Region&> &bases, TR::Node *base);
+   bool chooseVectorLength(Loop &loop);
+   bool isSupported(TR::ILOpCodes scalarOp, TR::VectorLength length);
+
+   void vectorizeLoop(Loop &loop);
+   TR::Block *appendBlock(TR::Node *originatingNode, int32_t frequency);
+   TR::Node *createRemainingIterations(Loop &loop);
+   TR::Node *vectorize(Loop &loop, TR::Node *node, NodeMap &vectorNodes);
+
+   TR::CFG *_cfg;
+   };
+
+#endif
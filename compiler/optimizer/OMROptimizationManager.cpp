@@ -93,6 +93,12 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
       case OMR::loopReduction:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
+      case OMR::slpVectorizer:
+         _flags.set(canAddSymbolReference);
+         break;
+      case OMR::loopVectorizer:
+         _flags.set(requiresStructure | checkStructure | dumpStructure | canAddSymbolReference);
+         break;
       case OMR::loopReplicator:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
@@ -103,14 +109,19 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
       case OMR::partialRedundancyElimination:
          _flags.set(requiresStructure | canAddSymbolReference);
          break;
+      case OMR::localCSE:
+         _flags.set(maintainsUseDefInfo | maintainsValueNumberInfo);
+         break;
       case OMR::globalCopyPropagation:
          _flags.set(requiresStructure | requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs);
+         _flags.set(maintainsUseDefInfo | maintainsValueNumberInfo);
          break;
       case OMR::globalDeadStoreElimination:
          _flags.set(requiresStructure);
          _flags.set(requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs);
          break;
       case OMR::deadTreesElimination:
+         _flags.set(maintainsUseDefInfo | maintainsValueNumberInfo);
          break;
       case OMR::tacticalGlobalRegisterAllocator:
          _flags.set(requiresStructure);
@@ -157,6 +157,7 @@ class OMR_EXTENSIBLE OptimizationManager
       maintainsUseDefInfo                  = 0x00400000,
       requiresAccurateNodeCount            = 0x00800000,
       doNotSetFrequencies                  = 0x01000000,
+      maintainsValueNumberInfo             = 0x02000000,
       dummyLastEnum
       };
 
@@ -186,6 +187,7 @@ class OMR_EXTENSIBLE OptimizationManager
    bool getLastRun()                     { return _flags.testAny(lastRun); }
    bool getCannotOmitTrivialDefs()       { return _flags.testAny(cannotOmitTrivialDefs); }
    bool getMaintainsUseDefInfo()         { return _flags.testAny(maintainsUseDefInfo); }
+   bool getMaintainsValueNumberInfo()    { return _flags.testAny(maintainsValueNumberInfo); }
    bool getDoNotSetFrequencies()         { return _flags.testAny(doNotSetFrequencies); }
 
    void setRequiresStructure(bool b)           { _flags.set(requiresStructure, b); }
@@ -211,6 +213,7 @@ class OMR_EXTENSIBLE OptimizationManager
    void setLastRun(bool b)                     { _flags.set(lastRun,b); }
    void setCannotOmitTrivialDefs(bool b)       { _flags.set(cannotOmitTrivialDefs, b); }
    void setMaintainsUseDefInfo(bool b)         { _flags.set(maintainsUseDefInfo, b); }
+   void setMaintainsValueNumberInfo(bool b)    { _flags.set(maintainsValueNumberInfo, b); }
    void setDoNotSetFrequencies(bool b)         { _flags.set(doNotSetFrequencies, b); }
 
    protected:
@@ -27,6 +27,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <map>
 #include "codegen/CodeGenerator.hpp"
 #include "env/FrontEnd.hpp"
 #include "compile/Compilation.hpp"
@@ -44,6 +45,7 @@
 #include "env/PersistentInfo.hpp"
 #include "env/StackMemoryRegion.hpp"
 #include "env/TRMemory.hpp"
+#include "env/VerboseLog.hpp"
 #include "env/jittypes.h"
 #include "il/Block.hpp"
 #include "il/DataTypes.hpp"
@@ -60,6 +62,8 @@
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
 #include "infra/Cfg.hpp"
+#include "infra/Checklist.hpp"
+#include "infra/ILWalk.hpp"
 #include "infra/List.hpp"
 #include "infra/SimpleRegex.hpp"
 #include "infra/CfgNode.hpp"
@@ -90,9 +94,11 @@
 #include "optimizer/LoopCanonicalizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/LoopVersioner.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/RedundantAsyncCheckRemoval.hpp"
+#include "optimizer/SLPVectorizer.hpp"
 #include "optimizer/Simplifier.hpp"
 #include "optimizer/VirtualGuardCoalescer.hpp"
 #include "optimizer/VirtualGuardHeadMerger.hpp"
@@ -601,9 +607,11 @@ static const OptimizationStrategy omrHotStrategyOpts[] =
    { OMR::inductionVariableAnalysis,                         },
    { OMR::loopSpecializerGroup,                              },
    { OMR::inductionVariableAnalysis,                         },
+   { OMR::loopVectorizer,                                    }, // vectorize innermost loops before unrolling them
    { OMR::generalLoopUnroller,                               }, // unroll Loops
    { OMR::blockSplitter,            OMR::MarkLastRun         },
    { OMR::blockManipulationGroup                             },
+   { OMR::slpVectorizer,                                     }, // pack isomorphic statements left behind by unrolling
    { OMR::lateLocalGroup                                     },
    { OMR::redundantAsyncCheckRemoval                         }, // optimize async check placement
 #ifdef J9_PROJECT_SPECIFIC
@@ -721,7 +729,10 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
      _successorBitsGRA(NULL),
      _stackedOptimizer(false),
      _firstTimeStructureIsBuilt(true),
-     _disableLoopOptsThatCanCreateLoops(false)
+     _disableLoopOptsThatCanCreateLoops(false),
+     _runningDowngradedOpt(false),
+     _currentOptManager(NULL),
+     _budget(comp->getOptions()->getOptimizerNodeBudget(), comp->getOptions()->getOptimizerTimeBudget())
    {
    // zero opts table
    memset(_opts, 0, sizeof(_opts));
@@ -801,6 +812,10 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopReducer::create, OMR::loopReduction);
    _opts[OMR::loopReplicator] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopReplicator::create, OMR::loopReplicator);
+   _opts[OMR::loopVectorizer] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopVectorizer::create, OMR::loopVectorizer);
+   _opts[OMR::slpVectorizer] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_SLPVectorizer::create, OMR::slpVectorizer);
    _opts[OMR::profiledNodeVersioning] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_ProfiledNodeVersioning::create, OMR::profiledNodeVersioning);
    _opts[OMR::redundantAsyncCheckRemoval] =
@@ -1131,6 +1146,12 @@ void OMR::Optimizer::optimize()
          {
          setValueNumberInfo(NULL);
          }
+
+      // No traversal of the compilation's containers spans two top-level
+      // optimizations, so memory returned during one can be reused after it
+      //
+      if (!isIlGenOpt() && comp()->isOutermostMethod())
+         comp()->region().recycleReturnedMemory();
       }
 
    if (comp()->getOption(TR_EnableDeterministicOrientedCompilation) &&
@@ -1148,6 +1169,9 @@ void OMR::Optimizer::optimize()
 
    dumpPostOptTrees();
 
+   if (!isIlGenOpt() && comp()->isOutermostMethod() && TR::Options::isAnyVerboseOptionSet(TR_VerboseOptimizer))
+      reportOptimizationCosts();
+
    if (comp()->getOption(TR_TraceOpts))
       {
       if (comp()->isOutermostMethod())
@@ -1164,6 +1188,51 @@ void OMR::Optimizer::optimize()
    _stackedOptimizer = false;
    }
 
+void OMR::Optimizer::reportOverBudget(OMR::Optimizations optNum, TR::OptimizerBudget::Action action, OMR::Optimizations replacement, int32_t nodeCount)
+   {
+   const char *optName = getOptimizationName(optNum);
+   const char *replacementName = action == TR::OptimizerBudget::Downgrade ? getOptimizationName(replacement) : NULL;
+
+   if (action == TR::OptimizerBudget::Downgrade)
+      dumpOptDetails(comp(), "Over the optimizer budget: running %s instead of %s\n", replacementName, optName);
+   else
+      dumpOptDetails(comp(), "Over the optimizer budget: skipping %s\n", optName);
+
+   if (TR::Options::isAnyVerboseOptionSet(TR_VerboseOptimizer))
+      {
+      unsigned long long elapsedTime = (unsigned long long)_budget.getTotalElapsedTime();
+      if (action == TR::OptimizerBudget::Downgrade)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_OPTIMIZER, "%s: running %s instead of %s: %d nodes after %llu usec of optimization",
+            comp()->signature(), replacementName, optName, nodeCount, elapsedTime);
+      else
+         TR_VerboseLog::writeLineLocked(TR_Vlog_OPTIMIZER, "%s: skipping %s: %d nodes after %llu usec of optimization",
+            comp()->signature(), optName, nodeCount, elapsedTime);
+      }
+   }
+
+/**
+ * Write the total time spent optimizing the method and the most expensive
+ * optimizations to the verbose log.
+ */
+void OMR::Optimizer::reportOptimizationCosts()
+   {
+   static const int32_t MAX_REPORTED_OPTS = 5;
+   OMR::Optimizations opts[MAX_REPORTED_OPTS];
+   int32_t numOpts = _budget.getMostExpensive(opts, MAX_REPORTED_OPTS);
+
+   TR_VerboseLog::CriticalSection vlogLock;
+   TR_VerboseLog::write(TR_Vlog_OPTIMIZER, "%s: %llu usec of optimization, %d nodes",
+      comp()->signature(), (unsigned long long)_budget.getTotalElapsedTime(), (int32_t)comp()->getAccurateNodeCount());
+   for (int32_t i = 0; i < numOpts; i++)
+      {
+      TR_VerboseLog::write("%s %s %llu usec %llu KB (%u runs)", i == 0 ? ";" : ",", getOptimizationName(opts[i]),
+         (unsigned long long)_budget.getElapsedTime(opts[i]),
+         (unsigned long long)(_budget.getSegmentBytesAllocated(opts[i]) / 1024),
+         _budget.getNumRuns(opts[i]));
+      }
+   TR_VerboseLog::write("\n");
+   }
+
 void OMR::Optimizer::dumpPostOptTrees()
    {
    // do nothing for IlGen optimizer
@@ -1571,6 +1640,41 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
    if (doThisOptimizationIfEnabled && manager->getRequestedBlocks()->isEmpty())
       doThisOptimization = false;
 
+   // Once the method is over the compile-time budget, skip the expensive
+   // optimizations or run cheaper ones in their place. The optimizations a
+   // replacement runs are left alone: it is already the cheaper choice.
+   //
+   if (doThisOptimization && !mustBeDone && !isIlGenOpt() && !_runningDowngradedOpt && _budget.isEnabled())
+      {
+      OMR::Optimizations replacement = optNum;
+      TR::OptimizerBudget::Action action = TR::OptimizerBudget::getActionOverBudget(optNum, replacement);
+      int32_t nodeCount = 0;
+      if (action != TR::OptimizerBudget::Run)
+         nodeCount = (int32_t)comp()->getAccurateNodeCount();
+
+      if (action != TR::OptimizerBudget::Run && _budget.isExceeded(nodeCount))
+         {
+         if (action == TR::OptimizerBudget::Downgrade && getOptimization(replacement) == NULL)
+            action = TR::OptimizerBudget::Skip;
+
+         reportOverBudget(optNum, action, replacement, nodeCount);
+
+         if (action == TR::OptimizerBudget::Skip)
+            {
+            doThisOptimization = false;
+            }
+         else
+            {
+            manager->setRequested(false);
+            OptimizationStrategy downgraded = { replacement, Always };
+            _runningDowngradedOpt = true;
+            int32_t downgradedCost = performOptimization(&downgraded, firstOptIndex, lastOptIndex, doTiming);
+            _runningDowngradedOpt = false;
+            return downgradedCost;
+            }
+         }
+      }
+
    int32_t actualCost = 0;
    static int32_t optDepth = 1;
 
@@ -1703,6 +1807,9 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
          return 0;
          }
 
+      // The cost of an optimization includes the analyses built for it
+      uint64_t optStartTime = TR::Compiler->vm.getUSecClock();
+
       if (comp()->getOption(TR_TraceOptDetails))
          {
          if (comp()->isOutermostMethod())
@@ -2038,6 +2145,9 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
          }
 
 
+      TR::OptimizationManager *enclosingOptManager = _currentOptManager;
+      _currentOptManager = manager;
+
       comp()->reportOptimizationPhase(optNum);
       breakForTesting(optNum);
       if (!doThisOptimizationIfEnabled ||
@@ -2089,6 +2199,9 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
          }
 
       delete opt;
+      _currentOptManager = enclosingOptManager;
+      _budget.recordCost(optNum, TR::Compiler->vm.getUSecClock() - optStartTime, rp.regionBytesAllocated(), rp.segmentBytesAllocated());
+
       // we cannot easily invalidate during IL gen since we could be peeking and we cannot destroy our
       // caller's alias sets
       if (!isIlGenOpt())
@@ -2109,13 +2222,22 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
 
       if (comp()->getNodeCount() > unsigned(origNodeCount))
          {
-         // If nodes were added, invalidate
+         // If nodes were added, invalidate whatever the optimization does not
+         // maintain, and bring what it does maintain up to date with the new
+         // nodes
          //
-         setValueNumberInfo(NULL);
+         if (!manager->getMaintainsValueNumberInfo())
+            setValueNumberInfo(NULL);
          if (!manager->getMaintainsUseDefInfo())
             setUseDefInfo(NULL);
+         if (getUseDefInfo() || getValueNumberInfo())
+            updateInfoForNewNodes(origNodeCount);
          }
 
+      if (comp()->getOption(TR_VerifyIncrementalUseDefs) &&
+          (manager->getMaintainsUseDefInfo() || manager->getMaintainsValueNumberInfo()))
+         verifyMaintainedInfo(manager);
+
       if ((comp()->getSymRefCount() != origSymRefCount) /* || manager->getCanAddSymbolReference()*/)
          {
          setSymReferencesTable(NULL);
@@ -2285,7 +2407,19 @@ bool OMR::Optimizer::prepareForNodeRemoval(TR::Node *node , bool deferInvalidati
    if (udInfo)
       {
       index = node->getUseDefIndex();
-      if (udInfo->isUseIndex(index))
+      if (_currentOptManager && _currentOptManager->getMaintainsUseDefInfo())
+         {
+         // The info can't be repaired if the node is a def that still reaches
+         // uses, other than a load whose own defs can take its place
+         //
+         if (!udInfo->nodeRemoved(node))
+            {
+            if (!deferInvalidatingUseDefInfo)
+               setUseDefInfo(NULL);
+            useDefInfoAreInvalid = true;
+            }
+         }
+      else if (udInfo->isUseIndex(index))
          {
          //udInfo->setUseDefInfoToNull(index);
          udInfo->resetDefUseInfo();
@@ -2320,6 +2454,261 @@ bool OMR::Optimizer::prepareForNodeRemoval(TR::Node *node , bool deferInvalidati
    return useDefInfoAreInvalid;
    }
 
+void OMR::Optimizer::nodeAdded(TR::Node *node)
+   {
+   TR::NodeChecklist visited(comp());
+   nodeAdded(node, visited);
+   }
+
+void OMR::Optimizer::nodeAdded(TR::Node *node, TR::NodeChecklist &visited)
+   {
+   if (visited.contains(node))
+      return;
+   visited.add(node);
+
+   TR_UseDefInfo *udInfo = getUseDefInfo();
+   if (udInfo && !udInfo->nodeAdded(node))
+      setUseDefInfo(NULL);
+
+   TR_ValueNumberInfo *vnInfo = getValueNumberInfo();
+   if (vnInfo && !vnInfo->nodeAdded(node))
+      setValueNumberInfo(NULL);
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      nodeAdded(node->getChild(i), visited);
+   }
+
+void OMR::Optimizer::storeChanged(TR::Node *store)
+   {
+   TR_UseDefInfo *udInfo = getUseDefInfo();
+   if (udInfo && !udInfo->storeChanged(store))
+      setUseDefInfo(NULL);
+
+   TR_ValueNumberInfo *vnInfo = getValueNumberInfo();
+   if (vnInfo && !vnInfo->storeChanged(store))
+      setValueNumberInfo(NULL);
+   }
+
+void OMR::Optimizer::blockSplit(TR::Block *original, TR::Block *newBlock)
+   {
+   TR_UseDefInfo *udInfo = getUseDefInfo();
+   if (udInfo && !udInfo->blockSplit(original, newBlock))
+      setUseDefInfo(NULL);
+
+   TR_ValueNumberInfo *vnInfo = getValueNumberInfo();
+   if (vnInfo && !vnInfo->blockSplit(original, newBlock))
+      setValueNumberInfo(NULL);
+   }
+
+void OMR::Optimizer::blocksMerged(TR::Block *into, TR::Block *removed)
+   {
+   TR_UseDefInfo *udInfo = getUseDefInfo();
+   if (udInfo && !udInfo->blocksMerged(into, removed))
+      setUseDefInfo(NULL);
+
+   TR_ValueNumberInfo *vnInfo = getValueNumberInfo();
+   if (vnInfo && !vnInfo->blocksMerged(into, removed))
+      setValueNumberInfo(NULL);
+   }
+
+void OMR::Optimizer::updateInfoForNewNodes(ncount_t firstNewNodeIndex)
+   {
+   TR::NodeChecklist visited(comp());
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt && (getUseDefInfo() || getValueNumberInfo()); tt = tt->getNextTreeTop())
+      updateInfoForNewNodes(tt->getNode(), firstNewNodeIndex, visited);
+   }
+
+void OMR::Optimizer::updateInfoForNewNodes(TR::Node *node, ncount_t firstNewNodeIndex, TR::NodeChecklist &visited)
+   {
+   if (visited.contains(node))
+      return;
+
+   // New nodes can hang below old ones, but every node reached from a new
+   // node that has not been visited yet is reported with it
+   //
+   if (node->getGlobalIndex() >= firstNewNodeIndex)
+      {
+      nodeAdded(node, visited);
+      return;
+      }
+   visited.add(node);
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      updateInfoForNewNodes(node->getChild(i), firstNewNodeIndex, visited);
+   }
+
+void OMR::Optimizer::verifyMaintainedInfo(TR::OptimizationManager *manager)
+   {
+   TR_UseDefInfo *useDefInfo = _useDefInfo;
+   TR_ValueNumberInfo *valueNumberInfo = _valueNumberInfo;
+   bool verifyUseDefs = useDefInfo && manager->getMaintainsUseDefInfo();
+   bool verifyValueNumbers = valueNumberInfo && manager->getMaintainsValueNumberInfo();
+   if (!verifyUseDefs && !verifyValueNumbers)
+      return;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   // Building the info again renumbers the nodes and symbols, so record what
+   // the maintained use/def info says in terms of nodes, along with the
+   // indices to put back afterwards. The def nodes reaching the use at
+   // nodes[i] are defNodes[firstDef[i]] to defNodes[firstDef[i+1]-1], with
+   // NULL standing for the defs on entry.
+   //
+   TR::vector<TR::Node *, TR::Region&> nodes(stackMemoryRegion);
+   TR::vector<uint16_t, TR::Region&> useDefIndices(stackMemoryRegion);
+   TR::vector<scount_t, TR::Region&> localIndices(stackMemoryRegion);
+   TR::NodeChecklist maintainedUses(comp());
+   TR::vector<int32_t, TR::Region&> firstDef(stackMemoryRegion);
+   TR::vector<TR::Node *, TR::Region&> defNodes(stackMemoryRegion);
+
+   for (TR::PreorderNodeIterator iter(comp()->getStartTree(), comp()); iter.currentTree() != NULL; ++iter)
+      {
+      TR::Node *node = iter.currentNode();
+      int32_t index = node->getUseDefIndex();
+      nodes.push_back(node);
+      useDefIndices.push_back(index);
+      localIndices.push_back(node->getLocalIndex());
+      firstDef.push_back(defNodes.size());
+      if (!verifyUseDefs || !useDefInfo->isUseIndex(index) || useDefInfo->getNode(index) != node)
+         continue;
+      maintainedUses.add(node);
+
+      bool reachedFromEntry = false;
+      TR_UseDefInfo::BitVector defs(comp()->allocator());
+      useDefInfo->getUseDef(defs, index);
+      TR_UseDefInfo::BitVector::Cursor cursor(defs);
+      for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne())
+         {
+         int32_t defIndex = cursor;
+         if (defIndex < useDefInfo->getFirstRealDefIndex())
+            reachedFromEntry = true;
+         else
+            defNodes.push_back(useDefInfo->getNode(defIndex));
+         }
+      if (reachedFromEntry)
+         defNodes.push_back(NULL);
+      }
+   firstDef.push_back(defNodes.size());
+
+   TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+   TR::vector<uint16_t, TR::Region&> symbolLocalIndices(stackMemoryRegion);
+   for (int32_t i = 0; i < symRefTab->getNumSymRefs(); i++)
+      {
+      TR::SymbolReference *symRef = symRefTab->getSymRef(i);
+      symbolLocalIndices.push_back((symRef && symRef->getSymbol()) ? symRef->getSymbol()->getLocalIndex() : 0);
+      }
+
+   bool cantBuildGlobalsUseDefInfo = _cantBuildGlobalsUseDefInfo;
+   bool cantBuildLocalsUseDefInfo = _cantBuildLocalsUseDefInfo;
+   bool cantBuildGlobalsValueNumberInfo = _cantBuildGlobalsValueNumberInfo;
+   bool cantBuildLocalsValueNumberInfo = _cantBuildLocalsValueNumberInfo;
+
+   // Build the info from scratch with the maintained copies set aside
+   //
+   _useDefInfo = NULL;
+   _valueNumberInfo = NULL;
+
+   if (useDefInfo)
+      {
+      TR_UseDefInfo *freshUseDefInfo = createUseDefInfo(comp(), useDefInfo->hasGlobalsUseDefs(), false, useDefInfo->hasLoadsAsDefs());
+      if (freshUseDefInfo->infoIsValid())
+         _useDefInfo = freshUseDefInfo;
+      else
+         delete freshUseDefInfo;
+      }
+
+   if (verifyValueNumbers)
+      {
+      TR_ValueNumberInfo *freshValueNumberInfo = createValueNumberInfo(valueNumberInfo->hasGlobalsValueNumbers(), false);
+      if (freshValueNumberInfo->infoIsValid())
+         _valueNumberInfo = freshValueNumberInfo;
+      else
+         delete freshValueNumberInfo;
+      }
+
+   // Every def that reaches a use must be known to the maintained info,
+   // which may only err by keeping defs that no longer reach it
+   //
+   if (verifyUseDefs && _useDefInfo)
+      {
+      for (size_t i = 0; i < nodes.size(); i++)
+         {
+         TR::Node *node = nodes[i];
+         int32_t index = node->getUseDefIndex();
+         if (!maintainedUses.contains(node) || !_useDefInfo->isUseIndex(index))
+            continue;
+
+         TR_UseDefInfo::BitVector defs(comp()->allocator());
+         _useDefInfo->getUseDef(defs, index);
+         TR_UseDefInfo::BitVector::Cursor cursor(defs);
+         for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne())
+            {
+            int32_t defIndex = cursor;
+            TR::Node *defNode = defIndex < _useDefInfo->getFirstRealDefIndex() ? NULL : _useDefInfo->getNode(defIndex);
+            bool found = false;
+            for (int32_t j = firstDef[i]; j < firstDef[i+1] && !found; j++)
+               found = (defNodes[j] == defNode);
+
+            if (!found)
+               {
+               dumpOptDetails(comp(), "%s left use n%dn without its def %s%d\n", manager->name(), node->getGlobalIndex(),
+                     defNode ? "n" : "on entry #", defNode ? defNode->getGlobalIndex() : defIndex);
+               TR_ASSERT_FATAL(false, "%s did not maintain the use/def info: use n%dn is missing a def", manager->name(), node->getGlobalIndex());
+               }
+            }
+         }
+      }
+
+   // Nodes the maintained info calls congruent must still be congruent,
+   // though it may miss equivalences
+   //
+   if (verifyValueNumbers && _valueNumberInfo)
+      {
+      typedef TR::typed_allocator<std::pair<int32_t const, TR::Node *>, TR::Region&> VNMapAllocator;
+      typedef std::map<int32_t, TR::Node *, std::less<int32_t>, VNMapAllocator> VNMap;
+      VNMap nodeForValueNumber((std::less<int32_t>()), VNMapAllocator(stackMemoryRegion));
+
+      for (size_t i = 0; i < nodes.size(); i++)
+         {
+         TR::Node *node = nodes[i];
+         std::pair<VNMap::iterator, bool> entry = nodeForValueNumber.insert(std::make_pair(valueNumberInfo->getValueNumber(node), node));
+         TR::Node *other = entry.first->second;
+         if (!entry.second && _valueNumberInfo->getValueNumber(node) != _valueNumberInfo->getValueNumber(other))
+            {
+            dumpOptDetails(comp(), "%s left n%dn and n%dn with the same value number\n", manager->name(), other->getGlobalIndex(), node->getGlobalIndex());
+            TR_ASSERT_FATAL(false, "%s did not maintain the value number info: n%dn and n%dn are not congruent", manager->name(), other->getGlobalIndex(), node->getGlobalIndex());
+            }
+         }
+      }
+
+   // Put the maintained info back as it was
+   //
+   if (_valueNumberInfo)
+      delete _valueNumberInfo;
+   if (_useDefInfo)
+      delete _useDefInfo;
+   _useDefInfo = useDefInfo;
+   _valueNumberInfo = valueNumberInfo;
+
+   _cantBuildGlobalsUseDefInfo = cantBuildGlobalsUseDefInfo;
+   _cantBuildLocalsUseDefInfo = cantBuildLocalsUseDefInfo;
+   _cantBuildGlobalsValueNumberInfo = cantBuildGlobalsValueNumberInfo;
+   _cantBuildLocalsValueNumberInfo = cantBuildLocalsValueNumberInfo;
+
+   for (size_t i = 0; i < nodes.size(); i++)
+      {
+      nodes[i]->setUseDefIndex(useDefIndices[i]);
+      nodes[i]->setLocalIndex(localIndices[i]);
+      }
+
+   for (int32_t i = 0; i < symRefTab->getNumSymRefs(); i++)
+      {
+      TR::SymbolReference *symRef = symRefTab->getSymRef(i);
+      if (symRef && symRef->getSymbol())
+         symRef->getSymbol()->setLocalIndex(symbolLocalIndices[i]);
+      }
+   }
+
 void OMR::Optimizer::getStaticFrequency(TR::Block *block, int32_t *currentWeight)
    {
    if (comp()->getUsesBlockFrequencyInGRA())
@@ -42,6 +42,7 @@ namespace OMR { typedef OMR::Optimizer OptimizerConnector; }
 #include "infra/List.hpp"
 #include "optimizer/Optimizations.hpp"
 #include "optimizer/OptimizationStrategies.hpp"
+#include "optimizer/OptimizerBudget.hpp"
 
 class TR_BitVector;
 class TR_Debug;
@@ -51,6 +52,7 @@ class TR_ValueNumberInfo;
 namespace TR { class Block; }
 namespace TR { class CodeGenerator; }
 namespace TR { class Compilation; }
+namespace TR { class NodeChecklist; }
 namespace TR { class OptimizationManager; }
 namespace TR { class Optimizer; }
 namespace TR { class ResolvedMethodSymbol; }
@@ -251,6 +253,26 @@ class Optimizer
    bool prepareForNodeRemoval(TR::Node *node , bool deferInvalidatingUseDefInfo = false);
    void prepareForTreeRemoval(TR::TreeTop *treeTop) { prepareForNodeRemoval(treeTop->getNode()); }
 
+   /**
+    * Incremental maintenance of the use/def and value number info.
+    *
+    * An optimization that declares maintainsUseDefInfo or
+    * maintainsValueNumberInfo reports its changes through these calls and
+    * prepareForNodeRemoval, and the info is discarded only when it cannot be
+    * brought up to date. New nodes need not be reported one by one: after
+    * such an optimization, nodes it created are found in the trees and
+    * reported together. The info is still invalidated as before when any
+    * other optimization removes a def or adds nodes.
+    *
+    * The verifyIncrementalUseDefs option rebuilds the info after each
+    * optimization that maintains it and checks the maintained copy against
+    * it.
+    */
+   void nodeAdded(TR::Node *node);
+   void storeChanged(TR::Node *store);
+   void blockSplit(TR::Block *original, TR::Block *newBlock);
+   void blocksMerged(TR::Block *into, TR::Block *removed);
+
    bool cachedExtendedBBInfoValid()                { return _cachedExtendedBBInfoValid; }
    void setCachedExtendedBBInfoValid(bool b);
 
@@ -291,6 +313,11 @@ class Optimizer
 
    bool optsThatCanCreateLoopsDisabled() { return _disableLoopOptsThatCanCreateLoops; }
 
+   /**
+    * The cost of the optimizations run so far, and the compile-time budget.
+    */
+   const TR::OptimizerBudget &getBudget() { return _budget; }
+
    // allowBCDSignPromotion -- if true and node1 has conservatively 'better' sign state then node2 then also consider
    // nodes equivalent (used only by certain optimizations such as CSE)
    static bool areNodesEquivalent(TR::Node *, TR::Node *, TR::Compilation *, bool allowBCDSignPromotion=false);
@@ -352,6 +379,14 @@ class Optimizer
 
    void dumpStrategy(const OptimizationStrategy *);
 
+   void reportOverBudget(OMR::Optimizations optNum, TR::OptimizerBudget::Action action, OMR::Optimizations replacement, int32_t nodeCount);
+   void reportOptimizationCosts();
+
+   void nodeAdded(TR::Node *node, TR::NodeChecklist &visited);
+   void updateInfoForNewNodes(ncount_t firstNewNodeIndex);
+   void updateInfoForNewNodes(TR::Node *node, ncount_t firstNewNodeIndex, TR::NodeChecklist &visited);
+   void verifyMaintainedInfo(TR::OptimizationManager *manager);
+
 
    TR::Compilation *            _compilation;
    TR_Memory *                   _trMemory;
@@ -406,6 +441,10 @@ class Optimizer
    bool                          _firstTimeStructureIsBuilt;
    bool                          _disableLoopOptsThatCanCreateLoops;
 
+   bool                          _runningDowngradedOpt;
+   TR::OptimizationManager *     _currentOptManager;
+   TR::OptimizerBudget           _budget;
+
    TR_BitVector *                _seenBlocksGRA; // used during the GRA as a global
    TR_BitVector *                _resetExitsGRA; // used during the GRA as a global
    TR_BitVector *                _successorBitsGRA; // used during the GRA as a global
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/OptimizerBudget.hpp"
+
+#include <string.h>
+
+TR::OptimizerBudget::OptimizerBudget(int32_t nodeBudget, int32_t timeBudget)
+   : _nodeBudget(nodeBudget),
+     _timeBudget(timeBudget),
+     _exceeded(false),
+     _totalElapsedTime(0)
+   {
+   memset(_costs, 0, sizeof(_costs));
+   }
+
+bool
+TR::OptimizerBudget::isExceeded(int32_t nodeCount)
+   {
+   if (!_exceeded)
+      {
+      _exceeded = (_nodeBudget > 0 && nodeCount > _nodeBudget)
+         || (_timeBudget > 0 && _totalElapsedTime > (uint64_t)_timeBudget * 1000);
+      }
+   return _exceeded;
+   }
+
+TR::OptimizerBudget::Action
+TR::OptimizerBudget::getActionOverBudget(OMR::Optimizations opt, OMR::Optimizations &replacement)
+   {
+   switch (opt)
+      {
+      case OMR::partialRedundancyElimination:
+      case OMR::partialRedundancyEliminationGroup:
+      case OMR::loopVersioner:
+      case OMR::loopVersionerGroup:
+      case OMR::lastLoopVersionerGroup:
+      case OMR::generalLoopUnroller:
+         return Skip;
+
+      case OMR::expensiveGlobalValuePropagationGroup:
+      case OMR::eachExpensiveGlobalValuePropagationGroup:
+      case OMR::veryExpensiveGlobalValuePropagationGroup:
+         replacement = OMR::veryCheapGlobalValuePropagationGroup;
+         return Downgrade;
+
+      case OMR::globalValuePropagation:
+         replacement = OMR::localValuePropagation;
+         return Downgrade;
+
+      default:
+         return Run;
+      }
+   }
+
+void
+TR::OptimizerBudget::recordCost(OMR::Optimizations opt, uint64_t elapsedTime, size_t regionBytes, size_t segmentBytes)
+   {
+   Cost &cost = _costs[opt];
+   cost._numRuns++;
+   cost._elapsedTime += elapsedTime;
+   cost._regionBytes += regionBytes;
+   cost._segmentBytes += segmentBytes;
+   _totalElapsedTime += elapsedTime;
+   }
+
+int32_t
+TR::OptimizerBudget::getMostExpensive(OMR::Optimizations *opts, int32_t maxOpts) const
+   {
+   // Insertion into a short sorted list: maxOpts is a handful
+   int32_t numFound = 0;
+   for (int32_t i = 0; i < OMR::numOpts; i++)
+      {
+      if (_costs[i]._numRuns == 0)
+         continue;
+
+      int32_t position = numFound;
+      while (position > 0 && _costs[opts[position - 1]]._elapsedTime < _costs[i]._elapsedTime)
+         position--;
+      if (position >= maxOpts)
+         continue;
+
+      for (int32_t j = (numFound < maxOpts ? numFound : maxOpts - 1); j > position; j--)
+         opts[j] = opts[j - 1];
+      opts[position] = static_cast<OMR::Optimizations>(i);
+      if (numFound < maxOpts)
+         numFound++;
+      }
+   return numFound;
+   }
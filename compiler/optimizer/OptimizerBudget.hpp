@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OPTIMIZERBUDGET_INCL
+#define OPTIMIZERBUDGET_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include "optimizer/Optimizations.hpp"
+
+namespace TR {
+
+/**
+ * Per-optimization cost accounting and the compile-time budget of the
+ * optimizer.
+ *
+ * The optimizer records the time every optimization takes, including the
+ * analyses built for it, and the bytes it allocates from the compilation's
+ * heap region and segment provider.  When a budget is configured and the
+ * method being optimized has grown past the node budget, or the optimizer has
+ * spent more than the time budget, the expensive optimizations are skipped or
+ * replaced with cheaper ones:
+ *
+ *  - partial redundancy elimination, loop versioning and loop unrolling are
+ *    skipped,
+ *  - the expensive global value propagation groups are downgraded to a single
+ *    pass of global value propagation, and
+ *  - global value propagation is downgraded to local value propagation.
+ *
+ * The optimizations run in place of a downgraded one are not downgraded
+ * again, so the global value propagation run by a downgraded group stays
+ * global.
+ *
+ * Once exceeded, the budget stays exceeded for the rest of the compilation so
+ * that later decisions do not depend on how much a pass managed to shrink
+ * the trees.
+ */
+class OptimizerBudget
+   {
+   public:
+
+   enum Action
+      {
+      Run,
+      Skip,
+      Downgrade
+      };
+
+   /**
+    * @param nodeBudget Number of IL nodes above which the budget is exceeded,
+    *                   or 0 for no limit
+    * @param timeBudget Milliseconds of optimization after which the budget is
+    *                   exceeded, or 0 for no limit
+    */
+   OptimizerBudget(int32_t nodeBudget, int32_t timeBudget);
+
+   bool isEnabled() const { return _nodeBudget > 0 || _timeBudget > 0; }
+
+   /**
+    * Whether a method of the given number of nodes is over budget, given the
+    * time recorded so far.
+    */
+   bool isExceeded(int32_t nodeCount);
+
+   /**
+    * The action to take for an optimization once the budget is exceeded.
+    * For a downgrade, \p replacement is set to the cheaper optimization.
+    */
+   static Action getActionOverBudget(OMR::Optimizations opt, OMR::Optimizations &replacement);
+
+   /**
+    * Record one run of an optimization.
+    *
+    * @param elapsedTime  Microseconds taken by the optimization
+    * @param regionBytes  Bytes it allocated from the heap region
+    * @param segmentBytes Growth of the segment provider's high water mark
+    */
+   void recordCost(OMR::Optimizations opt, uint64_t elapsedTime, size_t regionBytes, size_t segmentBytes);
+
+   uint32_t getNumRuns(OMR::Optimizations opt) const        { return _costs[opt]._numRuns; }
+   uint64_t getElapsedTime(OMR::Optimizations opt) const    { return _costs[opt]._elapsedTime; }
+   size_t getRegionBytesAllocated(OMR::Optimizations opt) const  { return _costs[opt]._regionBytes; }
+   size_t getSegmentBytesAllocated(OMR::Optimizations opt) const { return _costs[opt]._segmentBytes; }
+
+   uint64_t getTotalElapsedTime() const { return _totalElapsedTime; }
+
+   /**
+    * Fill \p opts with up to \p maxOpts optimizations that took the most
+    * time, most expensive first, and return how many there are.
+    */
+   int32_t getMostExpensive(OMR::Optimizations *opts, int32_t maxOpts) const;
+
+   private:
+
+   struct Cost
+      {
+      uint32_t _numRuns;
+      uint64_t _elapsedTime;
+      size_t _regionBytes;
+      size_t _segmentBytes;
+      };
+
+   int32_t _nodeBudget;
+   int32_t _timeBudget;
+   bool _exceeded;
+   uint64_t _totalElapsedTime;
+   Cost _costs[OMR::numOpts];
+   };
+
+}
+
+#endif
@@ -0,0 +1,699 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/SLPVectorizer.hpp"
+
+#include <algorithm>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "ras/Debug.hpp"
+
+// Most lanes in any vector: 512 bits of bytes
+#define MAX_LANES 64
+
+// Cost of splatting a value that is not a constant, which has to be moved
+// into a vector register before it is broadcast
+#define SPLAT_COST 2
+
+TR_SLPVectorizer::TR_SLPVectorizer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager)
+   {}
+
+int32_t
+TR_SLPVectorizer::perform()
+   {
+   int32_t numPacks = 0;
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      TR::TreeTop *vectorTree = packStores(tt);
+      if (vectorTree)
+         {
+         tt = vectorTree;
+         numPacks++;
+         }
+      }
+
+   if (numPacks > 0)
+      {
+      optimizer()->setUseDefInfo(NULL);
+      optimizer()->setValueNumberInfo(NULL);
+      optimizer()->setAliasSetsAreValid(false);
+      }
+
+   return numPacks;
+   }
+
+const char *
+TR_SLPVectorizer::optDetailString() const throw()
+   {
+   return "O^O SLP VECTORIZER: ";
+   }
+
+/**
+ * Whether a tree only computes a value from constants and locals, so it can
+ * be evaluated anywhere among the statements of a pack.
+ */
+static bool
+isPure(TR::Node *node)
+   {
+   TR::ILOpCode &op = node->getOpCode();
+   if (op.isLoadConst())
+      return true;
+
+   if (op.hasSymbolReference())
+      {
+      if (!op.isLoadVarDirect() || !node->getSymbol()->isAutoOrParm())
+         return false;
+      }
+   else if (op.isCall() || op.isStore() || op.isCheck() || op.isTreeTop() || ((op.isDiv() || op.isRem()) && !node->getDataType().isFloatingPoint()))
+      {
+      return false;
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!isPure(node->getChild(i)))
+         return false;
+      }
+   return true;
+   }
+
+/**
+ * Whether two trees compute the same value among the statements of a pack:
+ * they are the same node, or equal trees over constants and locals, which no
+ * indirect store in the pack can change.
+ */
+static bool
+isSameTree(TR::Node *a, TR::Node *b)
+   {
+   if (a == b)
+      return true;
+
+   if (a->getOpCodeValue() != b->getOpCodeValue() || a->getNumChildren() != b->getNumChildren())
+      return false;
+
+   TR::ILOpCode &op = a->getOpCode();
+   if (op.isLoadConst())
+      {
+      switch (a->getDataType())
+         {
+         case TR::Float:
+            return a->getFloatBits() == b->getFloatBits();
+         case TR::Double:
+            return a->getDoubleBits() == b->getDoubleBits();
+         case TR::Address:
+            return a->getAddress() == b->getAddress();
+         default:
+            return a->get64bitIntegralValue() == b->get64bitIntegralValue();
+         }
+      }
+
+   if (op.hasSymbolReference())
+      {
+      if (!op.isLoadVarDirect()
+          || !a->getSymbol()->isAutoOrParm()
+          || a->getSymbolReference()->getReferenceNumber() != b->getSymbolReference()->getReferenceNumber())
+         return false;
+      }
+   else if (!isPure(a))
+      {
+      return false;
+      }
+
+   for (int32_t i = 0; i < a->getNumChildren(); i++)
+      {
+      if (!isSameTree(a->getChild(i), b->getChild(i)))
+         return false;
+      }
+   return true;
+   }
+
+/**
+ * Compute `distance` such that `a == b + distance`, for address and index
+ * arithmetic that differs only in constants.  Index arithmetic is assumed not
+ * to overflow, as is the case for array indices.
+ */
+static bool
+getDistance(TR::Node *a, TR::Node *b, int64_t &distance)
+   {
+   if (isSameTree(a, b))
+      {
+      distance = 0;
+      return true;
+      }
+
+   if (a->getOpCode().isLoadConst() && b->getOpCode().isLoadConst() && a->getDataType() == b->getDataType()
+       && (a->getDataType() == TR::Int32 || a->getDataType() == TR::Int64))
+      {
+      distance = a->get64bitIntegralValue() - b->get64bitIntegralValue();
+      return true;
+      }
+
+   if (a->getOpCodeValue() != b->getOpCodeValue())
+      return false;
+
+   int64_t first, second;
+   switch (a->getOpCodeValue())
+      {
+      case TR::aladd:
+      case TR::aiadd:
+      case TR::ladd:
+      case TR::iadd:
+         if (!getDistance(a->getFirstChild(), b->getFirstChild(), first) || !getDistance(a->getSecondChild(), b->getSecondChild(), second))
+            return false;
+         distance = first + second;
+         return true;
+
+      case TR::lsub:
+      case TR::isub:
+         if (!getDistance(a->getFirstChild(), b->getFirstChild(), first) || !getDistance(a->getSecondChild(), b->getSecondChild(), second))
+            return false;
+         distance = first - second;
+         return true;
+
+      case TR::lmul:
+      case TR::imul:
+         if (!a->getSecondChild()->getOpCode().isLoadConst() || !isSameTree(a->getSecondChild(), b->getSecondChild())
+             || !getDistance(a->getFirstChild(), b->getFirstChild(), first))
+            return false;
+         distance = first * a->getSecondChild()->get64bitIntegralValue();
+         return true;
+
+      case TR::lshl:
+      case TR::ishl:
+         if (!a->getSecondChild()->getOpCode().isLoadConst() || !isSameTree(a->getSecondChild(), b->getSecondChild())
+             || !getDistance(a->getFirstChild(), b->getFirstChild(), first))
+            return false;
+         distance = first << (a->getSecondChild()->get64bitIntegralValue() & 63);
+         return true;
+
+      case TR::i2l:
+         return getDistance(a->getFirstChild(), b->getFirstChild(), distance);
+
+      default:
+         return false;
+      }
+   }
+
+/**
+ * Compute the distance in bytes between the locations accessed by two
+ * indirect loads or stores.
+ */
+static bool
+getAccessDistance(TR::Node *a, TR::Node *b, int64_t &distance)
+   {
+   if (!getDistance(a->getFirstChild(), b->getFirstChild(), distance))
+      return false;
+   distance += a->getSymbolReference()->getOffset() - b->getSymbolReference()->getOffset();
+   return true;
+   }
+
+static bool
+isPackableAccess(TR::Node *node)
+   {
+   TR::SymbolReference *symRef = node->getSymbolReference();
+   return !symRef->isUnresolved()
+      && !symRef->getSymbol()->isVolatile()
+      && !(node->getOpCode().isStore() && node->getOpCode().isWrtBar());
+   }
+
+TR::TreeTop *
+TR_SLPVectorizer::nextTree(TR::TreeTop *tt)
+   {
+   TR::TreeTop *next = tt->getNextTreeTop();
+   if (next && next->getNode()->getOpCodeValue() == TR::BBEnd)
+      {
+      // Statements can be packed across the fall through into an extension
+      // of the block, which has no other predecessor
+      //
+      TR::Block *following = next->getNode()->getBlock()->getNextBlock();
+      if (!following || !following->isExtensionOfPreviousBlock())
+         return NULL;
+      next = following->getEntry()->getNextTreeTop();
+      }
+   return next;
+   }
+
+bool
+TR_SLPVectorizer::isCandidateStore(TR::Node *node, TR::DataType elementType)
+   {
+   return node->getOpCode().isStoreIndirect()
+      && node->getDataType() == elementType
+      && isPackableAccess(node);
+   }
+
+/**
+ * Try to pack the run of stores that starts at the given tree, using the
+ * widest vector length that works.  Returns the vector store tree, or NULL.
+ */
+TR::TreeTop *
+TR_SLPVectorizer::packStores(TR::TreeTop *first)
+   {
+   TR::Node *firstStore = first->getNode();
+   TR::DataType elementType = firstStore->getDataType();
+   if (!firstStore->getOpCode().isStoreIndirect() || !elementType.isVectorElement() || !isCandidateStore(firstStore, elementType))
+      return NULL;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   TR::vector<TR::TreeTop *, TR::Region&> run(stackMemoryRegion);
+   run.push_back(first);
+   for (TR::TreeTop *tt = nextTree(first); tt && run.size() < MAX_LANES; tt = nextTree(tt))
+      {
+      int64_t distance;
+      if (!isCandidateStore(tt->getNode(), elementType) || !getAccessDistance(tt->getNode(), firstStore, distance))
+         break;
+      run.push_back(tt);
+      }
+
+   if (run.size() < 2)
+      return NULL;
+
+   static const TR::VectorLength lengths[] = { TR::VectorLength512, TR::VectorLength256, TR::VectorLength128 };
+   for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+      {
+      if (lengths[i] > TR::NumVectorLengths)
+         continue;
+
+      Pack *pack = new (stackMemoryRegion) Pack(stackMemoryRegion);
+      if (formPack(*pack, run, lengths[i])
+          && performTransformation(comp(), "%sPacking %d %s stores starting at n%dn into a %d byte vector store\n", optDetailString(),
+                pack->_numLanes, TR::DataType::getName(elementType), firstStore->getGlobalIndex(),
+                pack->_numLanes * TR::DataType::getSize(elementType)))
+         return transform(*pack);
+      }
+
+   return NULL;
+   }
+
+/**
+ * Form a pack from the first stores of the run, which must store one full
+ * vector at the given length, and check that it is legal and profitable.
+ */
+bool
+TR_SLPVectorizer::formPack(Pack &pack, TR::vector<TR::TreeTop *, TR::Region&> &run, TR::VectorLength length)
+   {
+   pack._elementType = run[0]->getNode()->getDataType();
+   pack._vectorLength = length;
+
+   int32_t elementSize = TR::DataType::getSize(pack._elementType);
+   TR::DataType vectorType = TR::DataType::createVectorType(pack._elementType.getDataType(), length);
+   pack._numLanes = TR::DataType::getSize(vectorType) / elementSize;
+   if (pack._numLanes > (int32_t)run.size())
+      return false;
+
+   // Place every store in the lane given by its offset from the lowest one
+   //
+   TR::vector<int64_t, TR::Region&> offsets(pack._region);
+   int64_t lowestOffset = 0;
+   for (int32_t i = 0; i < pack._numLanes; i++)
+      {
+      int64_t distance = 0;
+      getAccessDistance(run[i]->getNode(), run[0]->getNode(), distance);
+      offsets.push_back(distance);
+      lowestOffset = std::min(lowestOffset, distance);
+      }
+
+   pack._stores.assign(pack._numLanes, NULL);
+   pack._treeIndex.assign(pack._numLanes, -1);
+   for (int32_t i = 0; i < pack._numLanes; i++)
+      {
+      int64_t distance = offsets[i] - lowestOffset;
+      int64_t lane = distance / elementSize;
+      if (distance % elementSize != 0 || lane >= pack._numLanes || pack._stores[lane])
+         {
+         if (trace())
+            traceMsg(comp(), "Stores starting at n%dn do not fill a %d lane vector\n", run[0]->getNode()->getGlobalIndex(), pack._numLanes);
+         return false;
+         }
+      pack._stores[lane] = run[i]->getNode();
+      pack._treeIndex[lane] = i;
+      pack._trees.push_back(run[i]);
+      }
+
+   pack._scalarCost += pack._numLanes;
+   pack._vectorCost += 1;
+   addScalarOp(pack, pack._stores[0]->getOpCodeValue());
+
+   Lanes values(pack._region);
+   for (int32_t i = 0; i < pack._numLanes; i++)
+      values.push_back(pack._stores[i]->getSecondChild());
+
+   if (!analyze(pack, values))
+      return false;
+
+   // The vector statement replaces the first store in tree order, so the
+   // addresses it takes from the lowest lane must not depend on anything
+   // the stores before it could change
+   //
+   if (pack._treeIndex[0] != 0)
+      {
+      bool hoistable = isPure(pack._stores[0]->getFirstChild());
+      for (auto loads = pack._loads.begin(); hoistable && loads != pack._loads.end(); ++loads)
+         hoistable = isPure((**loads)[0]->getFirstChild());
+      if (!hoistable)
+         {
+         if (trace())
+            traceMsg(comp(), "Stores starting at n%dn: lowest lane address cannot be moved\n", run[0]->getNode()->getGlobalIndex());
+         return false;
+         }
+      }
+
+   if (hasDependence(pack) || !isSupported(pack))
+      return false;
+
+   if (pack._vectorCost >= pack._scalarCost)
+      {
+      if (trace())
+         traceMsg(comp(), "Stores starting at n%dn: vector cost %d is not below scalar cost %d\n",
+            run[0]->getNode()->getGlobalIndex(), pack._vectorCost, pack._scalarCost);
+      return false;
+      }
+
+   return true;
+   }
+
+void
+TR_SLPVectorizer::addScalarOp(Pack &pack, TR::ILOpCodes op)
+   {
+   if (std::find(pack._scalarOps.begin(), pack._scalarOps.end(), op) == pack._scalarOps.end())
+      pack._scalarOps.push_back(op);
+   }
+
+/**
+ * Decide how the given nodes, one per lane, are combined into a vector.
+ */
+TR_SLPVectorizer::PackKind
+TR_SLPVectorizer::classify(Pack &pack, Lanes &lanes)
+   {
+   TR::Node *first = lanes[0];
+
+   bool sameValue = true;
+   for (int32_t i = 1; sameValue && i < pack._numLanes; i++)
+      sameValue = first == lanes[i] || (isPure(first) && isSameTree(first, lanes[i]));
+   if (sameValue)
+      return Splat;
+
+   TR::ILOpCode &op = first->getOpCode();
+   for (int32_t i = 0; i < pack._numLanes; i++)
+      {
+      // Every lane's node is replaced, so none may be used anywhere else
+      if (lanes[i]->getOpCodeValue() != first->getOpCodeValue() || lanes[i]->getReferenceCount() != 1)
+         return NotPackable;
+      }
+
+   if (op.isLoadIndirect())
+      {
+      int32_t elementSize = TR::DataType::getSize(pack._elementType);
+      for (int32_t i = 0; i < pack._numLanes; i++)
+         {
+         int64_t distance;
+         if (!isPackableAccess(lanes[i])
+             || !getAccessDistance(lanes[i], first, distance)
+             || distance != i * elementSize)
+            return NotPackable;
+         }
+      return VectorLoad;
+      }
+
+   bool isElementWise = op.isAdd() || op.isSub() || op.isMul() || op.isAnd() || op.isOr() || op.isXor() || op.isNeg()
+      || (op.isDiv() && first->getDataType().isFloatingPoint());
+   if (isElementWise && TR::ILOpCode::convertScalarToVector(first->getOpCodeValue(), pack._vectorLength) != TR::BadILOp)
+      return VectorOperation;
+
+   return NotPackable;
+   }
+
+bool
+TR_SLPVectorizer::analyze(Pack &pack, Lanes &lanes)
+   {
+   for (int32_t i = 0; i < pack._numLanes; i++)
+      {
+      if (lanes[i]->getDataType() != pack._elementType)
+         return false;
+      }
+
+   switch (classify(pack, lanes))
+      {
+      case Splat:
+         pack._needsSplats = true;
+         pack._vectorCost += lanes[0]->getOpCode().isLoadConst() ? 1 : SPLAT_COST;
+         return true;
+
+      case VectorLoad:
+         pack._loads.push_back(new (pack._region) Lanes(lanes));
+         pack._scalarCost += pack._numLanes;
+         pack._vectorCost += 1;
+         addScalarOp(pack, lanes[0]->getOpCodeValue());
+         return true;
+
+      case VectorOperation:
+         {
+         pack._scalarCost += pack._numLanes;
+         pack._vectorCost += 1;
+         addScalarOp(pack, lanes[0]->getOpCodeValue());
+
+         Lanes children(pack._region);
+         for (int32_t c = 0; c < lanes[0]->getNumChildren(); c++)
+            {
+            children.clear();
+            for (int32_t i = 0; i < pack._numLanes; i++)
+               children.push_back(lanes[i]->getChild(c));
+            if (!analyze(pack, children))
+               return false;
+            }
+         return true;
+         }
+
+      default:
+         if (trace())
+            traceMsg(comp(), "Cannot pack n%dn with the other lanes\n", lanes[0]->getGlobalIndex());
+         return false;
+      }
+   }
+
+/**
+ * The vector statement runs all loads of the pack before all of its stores.
+ * That is wrong if a load could read a location written by a store that came
+ * before it in tree order.
+ */
+bool
+TR_SLPVectorizer::hasDependence(Pack &pack)
+   {
+   int32_t elementSize = TR::DataType::getSize(pack._elementType);
+   for (auto loads = pack._loads.begin(); loads != pack._loads.end(); ++loads)
+      {
+      for (int32_t j = 0; j < pack._numLanes; j++)
+         {
+         TR::Node *load = (**loads)[j];
+         for (int32_t i = 0; i < pack._numLanes; i++)
+            {
+            if (pack._treeIndex[i] >= pack._treeIndex[j])
+               continue;
+
+            TR::Node *store = pack._stores[i];
+            int64_t distance;
+            bool mayOverlap;
+            if (getAccessDistance(load, store, distance))
+               mayOverlap = distance > -elementSize && distance < elementSize;
+            else
+               mayOverlap = store->getSymbolReference()->getReferenceNumber() == load->getSymbolReference()->getReferenceNumber()
+                  || store->getSymbolReference()->getUseDefAliases().contains(load->getSymbolReference(), comp());
+
+            if (mayOverlap)
+               {
+               if (trace())
+                  traceMsg(comp(), "Load n%dn may read the location stored by n%dn\n", load->getGlobalIndex(), store->getGlobalIndex());
+               return true;
+               }
+            }
+         }
+      }
+   return false;
+   }
+
+bool
+TR_SLPVectorizer::isSupported(Pack &pack)
+   {
+   for (auto op = pack._scalarOps.begin(); op != pack._scalarOps.end(); ++op)
+      {
+      TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(*op, pack._vectorLength);
+      if (vectorOp == TR::BadILOp || !cg()->getSupportsOpCodeForAutoSIMD(vectorOp))
+         {
+         if (trace())
+            traceMsg(comp(), "%s is not supported on %d lanes of %s\n", TR::ILOpCode(*op).getName(), pack._numLanes, TR::DataType::getName(pack._elementType));
+         return false;
+         }
+      }
+
+   if (pack._needsSplats)
+      {
+      TR::DataType vectorType = TR::DataType::createVectorType(pack._elementType.getDataType(), pack._vectorLength);
+      if (!cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType)))
+         return false;
+      }
+
+   return true;
+   }
+
+/**
+ * Pick the symbol reference for a vector access replacing the given scalar
+ * accesses.  Vector array shadows alias the array shadows of their element
+ * type; any other kind of shadow is covered by a generic int shadow, with
+ * generic int shadows made to alias every shadow.
+ */
+TR::SymbolReference *
+TR_SLPVectorizer::getVectorShadow(Pack &pack, Lanes &lanes)
+   {
+   TR::SymbolReference *lowest = lanes[0]->getSymbolReference();
+   bool arrayShadows = lowest->getOffset() == 0;
+   for (int32_t i = 0; arrayShadows && i < pack._numLanes; i++)
+      arrayShadows = lanes[i]->getSymbol()->isArrayShadowSymbol();
+
+   TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+   if (arrayShadows)
+      return symRefTab->findOrCreateArrayShadowSymbolRef(TR::DataType::createVectorType(pack._elementType.getDataType(), pack._vectorLength), NULL);
+
+   symRefTab->aliasBuilder.setConservativeGenericIntShadowAliasing(true);
+   return symRefTab->findOrCreateGenericIntShadowSymbolReference(lowest->getOffset());
+   }
+
+TR::Node *
+TR_SLPVectorizer::build(Pack &pack, Lanes &lanes)
+   {
+   TR::Node *first = lanes[0];
+   TR::DataType vectorType = TR::DataType::createVectorType(pack._elementType.getDataType(), pack._vectorLength);
+
+   switch (classify(pack, lanes))
+      {
+      case Splat:
+         return TR::Node::create(first, TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType), 1, first);
+
+      case VectorLoad:
+         return TR::Node::createWithSymRef(first, TR::ILOpCode::convertScalarToVector(first->getOpCodeValue(), pack._vectorLength), 1,
+            first->getFirstChild(), getVectorShadow(pack, lanes));
+
+      case VectorOperation:
+         {
+         TR::Node *vectorNode = TR::Node::create(first, TR::ILOpCode::convertScalarToVector(first->getOpCodeValue(), pack._vectorLength), first->getNumChildren());
+         Lanes children(pack._region);
+         for (int32_t c = 0; c < first->getNumChildren(); c++)
+            {
+            children.clear();
+            for (int32_t i = 0; i < pack._numLanes; i++)
+               children.push_back(lanes[i]->getChild(c));
+            vectorNode->setAndIncChild(c, build(pack, children));
+            }
+         return vectorNode;
+         }
+
+      default:
+         TR_ASSERT_FATAL(false, "Lanes starting with n%dn were analyzed as packable", first->getGlobalIndex());
+         return NULL;
+      }
+   }
+
+static void
+markTree(TR::Node *node, vcount_t visitCount)
+   {
+   if (node->getVisitCount() == visitCount)
+      return;
+   node->setVisitCount(visitCount);
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      markTree(node->getChild(i), visitCount);
+   }
+
+/**
+ * Drop one reference to a node of a replaced statement.  Nodes that are still
+ * referenced, other than from the vector statement, are collected so they
+ * can be anchored where the statements used to be.
+ */
+void
+TR_SLPVectorizer::removeReference(TR::Node *node, vcount_t vectorTreeVisitCount, Lanes &survivors)
+   {
+   if (node->decReferenceCount() > 0)
+      {
+      if (node->getVisitCount() != vectorTreeVisitCount)
+         survivors.push_back(node);
+      return;
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      removeReference(node->getChild(i), vectorTreeVisitCount, survivors);
+   }
+
+/**
+ * Replace the statements of the pack with one vector store, placed where the
+ * first of them was.
+ */
+TR::TreeTop *
+TR_SLPVectorizer::transform(Pack &pack)
+   {
+   TR::Node *lowest = pack._stores[0];
+
+   Lanes values(pack._region);
+   for (int32_t i = 0; i < pack._numLanes; i++)
+      values.push_back(pack._stores[i]->getSecondChild());
+
+   TR::Node *vectorStore = TR::Node::createWithSymRef(TR::ILOpCode::convertScalarToVector(lowest->getOpCodeValue(), pack._vectorLength), 2, 2,
+      lowest->getFirstChild(), build(pack, values), getVectorShadow(pack, pack._stores));
+   TR::TreeTop *vectorTree = TR::TreeTop::create(comp(), pack._trees[0]->getPrevTreeTop(), vectorStore);
+
+   vcount_t visitCount = comp()->incVisitCount();
+   markTree(vectorStore, visitCount);
+
+   Lanes survivors(pack._region);
+   for (auto tree = pack._trees.begin(); tree != pack._trees.end(); ++tree)
+      {
+      TR::Node *store = (*tree)->getNode();
+      for (int32_t i = 0; i < store->getNumChildren(); i++)
+         removeReference(store->getChild(i), visitCount, survivors);
+      (*tree)->unlink(false);
+      }
+
+   // Anything still referenced after the pack may have been evaluated first
+   // by one of the removed statements
+   //
+   for (auto node = survivors.begin(); node != survivors.end(); ++node)
+      {
+      if ((*node)->getReferenceCount() > 0 && (*node)->getVisitCount() != visitCount)
+         {
+         TR::TreeTop::create(comp(), vectorTree->getPrevTreeTop(), TR::Node::create(TR::treetop, 1, *node));
+         (*node)->setVisitCount(visitCount);
+         }
+      }
+
+   return vectorTree;
+   }
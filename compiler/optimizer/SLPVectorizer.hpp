@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef SLPVECTORIZER_INCL
+#define SLPVECTORIZER_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR { class Node; }
+namespace TR { class TreeTop; }
+
+/**
+ * Superword level parallelism (SLP) vectorizer.
+ *
+ * Packs isomorphic scalar statements within an extended basic block into the
+ * vector IL opcodes.  The seeds are runs of consecutive indirect stores of
+ * one element type to contiguous offsets from a common base, such as the
+ * copies of a loop body left by TR_GeneralLoopUnroller or the field by field
+ * update of a small struct.  The stored values are packed lane by lane:
+ *
+ *  - indirect loads from contiguous offsets of a common base become a vector
+ *    load,
+ *  - the same element-wise operation in every lane becomes the vector
+ *    operation over the packed operands, and
+ *  - a value that is the same in every lane, such as a constant or a local,
+ *    becomes a splat.
+ *
+ * All the loads of a pack run before all of its stores, so a pack is rejected
+ * when a load could read a location stored by an earlier statement of the
+ * pack.  Accesses from a common base are compared by offset; otherwise the
+ * alias sets decide.
+ *
+ * A simple cost model counts one unit for every scalar node that is replaced
+ * and every vector node that replaces them, with splats of non-constant values
+ * costing two.  A pack is only made when the vector form is cheaper.
+ */
+class TR_SLPVectorizer : public TR::Optimization
+   {
+   public:
+
+   TR_SLPVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_SLPVectorizer(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   typedef TR::vector<TR::Node *, TR::Region&> Lanes;
+
+   struct Pack
+      {
+      Pack(TR::Region &region)
+         : _region(region), _trees(region), _stores(region), _treeIndex(region), _loads(region), _scalarOps(region),
+           _needsSplats(false), _scalarCost(0), _vectorCost(0)
+         {}
+
+      TR::Region &_region;
+      TR::DataType _elementType;
+      TR::VectorLength _vectorLength;
+      int32_t _numLanes;
+      TR::vector<TR::TreeTop *, TR::Region&> _trees;    // in tree order
+      Lanes _stores;                                    // in lane order
+      TR::vector<int32_t, TR::Region&> _treeIndex;      // tree order position of each lane
+      TR::vector<Lanes *, TR::Region&> _loads;          // packed loads, in lane order
+      TR::vector<TR::ILOpCodes, TR::Region&> _scalarOps;
+      bool _needsSplats;
+      int32_t _scalarCost;
+      int32_t _vectorCost;
+      };
+
+   enum PackKind
+      {
+      NotPackable,
+      Splat,
+      VectorLoad,
+      VectorOperation
+      };
+
+   TR::TreeTop *nextTree(TR::TreeTop *tt);
+   bool isCandidateStore(TR::Node *node, TR::DataType elementType);
+   TR::TreeTop *packStores(TR::TreeTop *first);
+   bool formPack(Pack &pack, TR::vector<TR::TreeTop *, TR::Region&> &run, TR::VectorLength length);
+   void addScalarOp(Pack &pack, TR::ILOpCodes op);
+   PackKind classify(Pack &pack, Lanes &lanes);
+   bool analyze(Pack &pack, Lanes &lanes);
+   bool hasDependence(Pack &pack);
+   bool isSupported(Pack &pack);
+   TR::SymbolReference *getVectorShadow(Pack &pack, Lanes &lanes);
+   TR::Node *build(Pack &pack, Lanes &lanes);
+   TR::TreeTop *transform(Pack &pack);
+   void removeReference(TR::Node *node, vcount_t vectorTreeVisitCount, Lanes &survivors);
+   };
+
+#endif
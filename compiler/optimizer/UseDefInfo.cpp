@@ -114,7 +114,8 @@ TR_UseDefInfo::TR_UseDefInfo(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer
      _valueNumbersToMemorySymbolsMap(0, static_cast<MemorySymbolList *>(NULL), _region),
      _sideTableToSymRefNumMap(comp->getSymRefCount(), _region),
      _cfg(cfg),
-     _valueNumberInfo(NULL)
+     _valueNumberInfo(NULL),
+     _firstNewNodeIndex(comp->getNodeCount())
    {
    if (doCompletion)
       prepareUseDefInfo(requiresGlobals, prefersGlobals, cannotOmitTrivialDefs, conversionRegsOnly);
@@ -1896,7 +1897,7 @@ void TR_UseDefInfo::buildUseDefs(void *vblockInfo, AuxiliaryData &aux)
 
       int32_t i, ii;
       TR::Method *method = comp()->getMethodSymbol()->getMethod();
-      TR_BitVectorIterator bvi(*analysisInfo);
+      TR_ReachingDefinitions::ContainerType::Iterator bvi(*analysisInfo);
       while (bvi.hasMoreElements())
          {
          // Convert from expanded index to normal index
@@ -2843,6 +2844,8 @@ void TR_UseDefInfo::setUseDef(int32_t useIndex, int32_t defIndex)
    {
    int32_t realIndex = useIndex - getFirstUseIndex();
    _useDefInfo[realIndex][defIndex] = true;
+   if (_loadDefUseInfo.size() > 0)
+      _loadDefUseInfo[defIndex][realIndex] = true;
 
    //   traceMsg(comp(), "UDI: setUseDef _useDefInfo[realIndex=%d][defIndex=%d] to true\n",realIndex,defIndex);
 
@@ -2858,6 +2861,8 @@ void TR_UseDefInfo::resetUseDef(int32_t useIndex, int32_t defIndex)
    {
    int32_t realIndex = useIndex - getFirstUseIndex();
    _useDefInfo[realIndex][defIndex] = false;
+   if (_loadDefUseInfo.size() > 0)
+      _loadDefUseInfo[defIndex][realIndex] = false;
 
    if (_hasLoadsAsDefs && _useDerefDefInfo[realIndex])
       _useDerefDefInfo[realIndex] = NULL;
@@ -2866,6 +2871,12 @@ void TR_UseDefInfo::resetUseDef(int32_t useIndex, int32_t defIndex)
 void TR_UseDefInfo::clearUseDef(int32_t useIndex)
    {
    int32_t realIndex = useIndex - getFirstUseIndex();
+   if (_loadDefUseInfo.size() > 0)
+      {
+      TR_UseDefInfo::BitVector::Cursor cursor(_useDefInfo[realIndex]);
+      for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne())
+         _loadDefUseInfo[(int32_t)cursor][realIndex] = false;
+      }
    _useDefInfo[realIndex].Clear();
 
    if (_hasLoadsAsDefs && _useDerefDefInfo[realIndex])
@@ -2874,6 +2885,110 @@ void TR_UseDefInfo::clearUseDef(int32_t useIndex)
       }
    }
 
+bool TR_UseDefInfo::nodeAdded(TR::Node *node)
+   {
+   if (node->getGlobalIndex() < _firstNewNodeIndex)
+      return true;
+
+   // A copy carries the index of the node it was copied from, which still
+   // belongs to that node
+   //
+   if (node->getUseDefIndex() != 0)
+      node->setUseDefIndex(0);
+
+   TR::ILOpCode &opCode = node->getOpCode();
+   if (_useDefForRegs && (opCode.isLoadReg() || opCode.isStoreReg()))
+      return false;
+
+   return !opCode.hasSymbolReference();
+   }
+
+bool TR_UseDefInfo::nodeRemoved(TR::Node *node)
+   {
+   int32_t index = node->getUseDefIndex();
+   if (index == 0 || index > getLastUseIndex() || getNode(index) != node)
+      return true;
+
+   if (_loadDefUseInfo.size() == 0)
+      buildLoadDefUseInfo();
+
+   if (isDefIndex(index))
+      {
+      // A load acting as a def only stands in for the defs that reach it, so
+      // the uses it reaches can be given those defs instead
+      //
+      bool forwardDefs = isUseIndex(index) &&
+                         _hasLoadsAsDefs &&
+                         node->getOpCode().isLoadVarDirect() &&
+                         !node->getSymbolReference()->isUnresolved();
+
+      TR_UseDefInfo::BitVector &uses = _loadDefUseInfo[index];
+      if (isUseIndex(index))
+         uses[index - getFirstUseIndex()] = false;
+
+      if (!uses.IsZero())
+         {
+         if (!forwardDefs)
+            {
+            if (trace())
+               {
+               TR_UseDefInfo::BitVector::Cursor cursor(uses);
+               cursor.SetToFirstOne();
+               traceMsg(comp(), "Use #%d is still reached by removed def #%d\n", (int32_t)cursor + getFirstUseIndex(), index);
+               }
+            return false;
+            }
+
+         TR_UseDefInfo::BitVector loadDefs(comp()->allocator());
+         loadDefs.Or(_useDefInfo[index - getFirstUseIndex()]);
+         loadDefs[index] = false;
+
+         TR_UseDefInfo::BitVector::Cursor cursor(uses);
+         for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne())
+            {
+            int32_t realIndex = cursor;
+            if (trace())
+               traceMsg(comp(), "Use #%d: replacing removed def #%d by its defs\n", realIndex + getFirstUseIndex(), index);
+
+            TR_UseDefInfo::BitVector &defs = _useDefInfo[realIndex];
+            defs[index] = false;
+            defs |= loadDefs;
+            if (_useDerefDefInfo[realIndex])
+               _useDerefDefInfo[realIndex] = NULL;
+
+            TR_UseDefInfo::BitVector::Cursor defCursor(loadDefs);
+            for (defCursor.SetToFirstOne(); defCursor.Valid(); defCursor.SetToNextOne())
+               _loadDefUseInfo[(int32_t)defCursor][realIndex] = true;
+            }
+         uses.Clear();
+
+         // The defs these uses were dereferenced to have changed
+         _defUseInfo.clear();
+         }
+      }
+
+   if (isUseIndex(index))
+      {
+      if (_defUseInfo.size() > 0)
+         {
+         const TR_UseDefInfo::BitVector &defs = getUseDef_ref(index);
+         TR_UseDefInfo::BitVector::Cursor cursor(defs);
+         for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne())
+            _defUseInfo[(int32_t)cursor][index - getFirstUseIndex()] = false;
+         }
+      clearUseDef(index);
+      }
+
+   node->setUseDefIndex(0);
+   return true;
+   }
+
+bool TR_UseDefInfo::storeChanged(TR::Node *store)
+   {
+   int32_t index = store->getUseDefIndex();
+   return index == 0 || !isDefIndex(index) || getNode(index) == store;
+   }
+
 TR::Node *TR_UseDefInfo::getNode(int32_t index)
    {
    TR_ASSERT(index < getTotalNodes(), "TR_UseDefInfo::getNode index(%d) is bigger than total(%d)\n", index, getTotalNodes());
@@ -2927,9 +3042,6 @@ void TR_UseDefInfo::buildDefUseInfo(bool loadAsDef)
 
    _defUseInfo.resize(getNumDefNodes(), TR_UseDefInfo::BitVector(comp()->allocator()));
 
-   if (loadAsDef)
-      _loadDefUseInfo.resize(getNumDefNodes(), TR_UseDefInfo::BitVector(allocator()));
-
    for (int32_t i = getFirstUseIndex(); i <= getLastUseIndex(); i++)
       {
       const TR_UseDefInfo::BitVector &defs = getUseDef_ref(i);
@@ -2947,18 +3059,30 @@ void TR_UseDefInfo::buildDefUseInfo(bool loadAsDef)
             }
          }
 
-      if (loadAsDef)
+      }
+
+   if (loadAsDef && (_loadDefUseInfo.size() == 0))
+      buildLoadDefUseInfo();
+   }
+
+// Build the uses reached by each def, loads included, from the use/def info
+// as it is, without dereferencing loads that act as defs
+//
+void TR_UseDefInfo::buildLoadDefUseInfo()
+   {
+   _loadDefUseInfo.resize(getNumDefNodes(), TR_UseDefInfo::BitVector(allocator()));
+
+   for (int32_t i = getFirstUseIndex(); i <= getLastUseIndex(); i++)
+      {
+      const TR_UseDefInfo::BitVector &loadDefs = _useDefInfo[i - getFirstUseIndex()];
+      if (!loadDefs.IsZero())
          {
-         const TR_UseDefInfo::BitVector &loadDefs = _useDefInfo[i - getFirstUseIndex()];
-         if (!loadDefs.IsZero())
+         TR_UseDefInfo::BitVector::Cursor cursor(loadDefs);
+         for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne())
             {
-            TR_UseDefInfo::BitVector::Cursor cursor(loadDefs);
-            for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne())
-               {
-               int32_t defIndex = cursor;
-               //TR_ASSERT((defIndex < getNumDefNodes()), "USEDEF: found def which is not store or call %d", defIndex);
-               _loadDefUseInfo[defIndex][i - getFirstUseIndex()] = true;
-               }
+            int32_t defIndex = cursor;
+            //TR_ASSERT((defIndex < getNumDefNodes()), "USEDEF: found def which is not store or call %d", defIndex);
+            _loadDefUseInfo[defIndex][i - getFirstUseIndex()] = true;
             }
          }
       }
@@ -230,7 +230,58 @@ class TR_UseDefInfo
    public:
 
    TR::Node      *getSingleDefiningLoad(TR::Node *node);
-   void          resetDefUseInfo() {_defUseInfo.clear();}
+   void          resetDefUseInfo() {_defUseInfo.clear(); _loadDefUseInfo.clear();}
+
+   /**
+    * @name Incremental maintenance
+    *
+    * Optimizations that keep the use/def info across their transformations
+    * report each change through these calls instead of discarding the info.
+    * Each returns false if the info can no longer be trusted, in which case
+    * the caller must invalidate it.
+    */
+   ///@{
+
+   /**
+    * @brief A node created after this info was built has been linked into the
+    * trees.
+    *
+    * Nodes that neither define nor reference a symbol leave the info as it
+    * is. New definitions and new uses of symbols cannot be indexed without
+    * recomputing reaching definitions, so they make the info invalid.
+    */
+   bool          nodeAdded(TR::Node *node);
+
+   /**
+    * @brief \p node is about to be removed from the trees.
+    *
+    * A removed use simply drops out. A load that acts as a def for later
+    * loads is replaced in their def sets by its own defs. Removing any other
+    * def that still reaches a use makes the info invalid.
+    *
+    * The uses each def reaches are found through the def/use info for loads
+    * as defs, which is built by the first removal and kept up to date by it
+    * and the other changes made through this class.
+    */
+   bool          nodeRemoved(TR::Node *node);
+
+   /**
+    * @brief The value stored by \p store has changed but it still stores to
+    * the same symbol, so the defs reaching each use are unchanged.
+    */
+   bool          storeChanged(TR::Node *store);
+
+   /**
+    * @brief A block has been split in two, or two blocks merged into one.
+    *
+    * Reaching definitions do not depend on block boundaries, so only the
+    * global register deps moved by the change matter, and only when
+    * registers are tracked.
+    */
+   bool          blockSplit(TR::Block *original, TR::Block *newBlock) { return !_useDefForRegs; }
+   bool          blocksMerged(TR::Block *into, TR::Block *removed) { return !_useDefForRegs; }
+
+   ///@}
 
    bool          skipAnalyzingForCompileTime(TR::Node *node, TR::Block *block, TR::Compilation *comp, AuxiliaryData &aux);
 
@@ -316,6 +367,9 @@ class TR_UseDefInfo
    public:
    void dereferenceDef(BitVector &useDefInfo, int32_t defIndex, BitVector &nodesLookedAt);
    void buildDefUseInfo(bool loadAsDef = false);
+   private:
+   void buildLoadDefUseInfo();
+   public:
    int32_t getSymRefIndexFromUseDefIndex(int32_t udIndex);
 
    public:
@@ -431,6 +485,9 @@ class TR_UseDefInfo
    TR::vector<MemorySymbolList *, TR::Region&> _valueNumbersToMemorySymbolsMap;
    TR_ValueNumberInfo *_valueNumberInfo;
    TR::CFG                   *_cfg;
+
+   /// Nodes with this global index or above were created after the info was built
+   ncount_t                   _firstNewNodeIndex;
    };
 
 #endif
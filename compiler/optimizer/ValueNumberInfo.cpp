@@ -1378,6 +1378,23 @@ void TR_ValueNumberInfo::removeNodeInfo(TR::Node *node)
       }
    }
 
+bool TR_ValueNumberInfo::nodeAdded(TR::Node *node)
+   {
+   int32_t index = node->getGlobalIndex();
+   if (index < _numberOfNodes && _nodes.ElementAt(index) == node)
+      return true;
+
+   setUniqueValueNumber(node);
+   _nodes.ElementAt(index) = node;
+   return true;
+   }
+
+bool TR_ValueNumberInfo::storeChanged(TR::Node *store)
+   {
+   TR::Node *valueChild = store->getChild(store->getOpCode().isIndirect() ? 1 : 0);
+   return getValueNumber(valueChild) == getValueNumber(store);
+   }
+
 void TR_ValueNumberInfo::growTo(int32_t index)
    {
    _nodes.GrowTo(index+1);
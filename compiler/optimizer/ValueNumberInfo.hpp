@@ -31,6 +31,7 @@
 #include "infra/Array.hpp"
 
 class TR_UseDefInfo;
+namespace TR { class Block; }
 namespace TR { class Optimizer; }
 namespace TR { class ParameterSymbol; }
 
@@ -120,6 +121,41 @@ class TR_ValueNumberInfo
    /** Clean up information for a node that is about to be removed. */
    void removeNodeInfo(TR::Node *node);
 
+   /**
+    * @name Incremental maintenance
+    *
+    * Optimizations that keep the value numbers across their transformations
+    * report each change through these calls. They may rewrite the trees
+    * only in ways that leave every existing node computing the value it
+    * computed before. Each call returns false if the info can no longer be
+    * trusted, in which case the caller must invalidate it.
+    */
+   ///@{
+
+   /**
+    * @brief A node created after the info was built has been linked into
+    * the trees. It gets a value number of its own, which may miss an
+    * equivalence but never claims a false one.
+    */
+   bool nodeAdded(TR::Node *node);
+
+   /** @brief \p node is about to be removed from the trees. */
+   bool nodeRemoved(TR::Node *node) { removeNodeInfo(node); return true; }
+
+   /**
+    * @brief The value stored by \p store has changed. Loads reached by the
+    * store, and everything computed from them, took their value numbers from
+    * the old value, so the info survives only if the new value is already
+    * known to be equivalent.
+    */
+   bool storeChanged(TR::Node *store);
+
+   /** @brief Value numbers do not depend on block boundaries. */
+   bool blockSplit(TR::Block *original, TR::Block *newBlock) { return true; }
+   bool blocksMerged(TR::Block *into, TR::Block *removed) { return true; }
+
+   ///@}
+
    void printValueNumberInfo(TR::Node *);
 
    bool congruentNodes(TR::Node * , TR::Node *);
@@ -83,6 +83,7 @@
 #include "infra/Array.hpp"
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
+#include "infra/HybridBitVector.hpp"
 #include "infra/List.hpp"
 #include "infra/SimpleRegex.hpp"
 #include "infra/CfgNode.hpp"
@@ -853,6 +854,34 @@ TR_Debug::print(TR::FILE *pOutFile, TR_SingleBitContainer *sbc)
       trfprintf(pOutFile,"{0}");
    }
 
+void
+TR_Debug::print(TR::FILE *pOutFile, TR_HybridBitVector * bv)
+   {
+   if (pOutFile == NULL) return;
+
+   trfprintf(pOutFile,"{");
+   bool firstOne = true;
+   TR_HybridBitVectorIterator bvi(*bv);
+   int32_t num = 0;
+   while (bvi.hasMoreElements())
+      {
+      if (!firstOne)
+         trfprintf(pOutFile,", ");
+      else
+         firstOne = false;
+      trfprintf(pOutFile,"%d",bvi.getNextElement());
+
+      if (num > 30)
+         {
+         trfprintf(pOutFile,"\n");
+         num = 0;
+         }
+      num++;
+
+      }
+   trfprintf(pOutFile,"}");
+   }
+
 void
 TR_Debug::print(TR::FILE *pOutFile, TR::BitVector * bv)
    {
@@ -157,13 +157,29 @@ struct CodeCacheMethodHeader
 CodeCacheMethodHeader *getCodeCacheMethodHeader(char *p, int searchLimit, MethodExceptionData *metaData);
 
 
+// A reclaimed block of code cache memory. Free blocks are kept on an
+// address-ordered list through _next. Blocks big enough to hold the remaining
+// links are also indexed by size class and by address, so allocation and
+// coalescing avoid walking the list; smaller fragments are only on the list.
+//
 struct CodeCacheFreeCacheBlock
    {
    size_t _size;
-   CodeCacheFreeCacheBlock *_next;
+   CodeCacheFreeCacheBlock *_next;     // next free block by address
+   CodeCacheFreeCacheBlock *_binNext;  // next free block in the same size class
+   CodeCacheFreeCacheBlock *_binPrev;  // previous free block in the same size class
+   CodeCacheFreeCacheBlock *_left;     // address tree: blocks at lower addresses
+   CodeCacheFreeCacheBlock *_right;    // address tree: blocks at higher addresses
    };
 #define MIN_SIZE_BLOCK (sizeof(CodeCacheFreeCacheBlock) > 96 ? sizeof(CodeCacheFreeCacheBlock) : 96)
 
+// Space needed for a free block on the address-ordered list. Smaller gaps
+// between free blocks are absorbed when the blocks are coalesced.
+#define CODECACHE_FREE_BLOCK_LIST_HEADER_SIZE offsetof(CodeCacheFreeCacheBlock, _binNext)
+
+// Number of size classes for each of the warm and cold free block indexes
+#define CODECACHE_FREE_BLOCK_BINS 64
+
 
 struct FaintCacheBlock
    {
@@ -36,6 +36,7 @@
 #include "env/VerboseLog.hpp"
 #include "il/DataTypes.hpp"
 #include "infra/Assert.hpp"
+#include "infra/Bit.hpp"
 #include "infra/CriticalSection.hpp"
 #include "infra/Monitor.hpp"
 #include "omrformatconsts.h"
@@ -307,6 +308,11 @@ OMR::CodeCache::initialize(TR::CodeCacheManager *manager,
    _almostFull = TR_no;
    _sizeOfLargestFreeColdBlock = 0;
    _sizeOfLargestFreeWarmBlock = 0;
+   memset(_warmFreeBlockBins, 0, sizeof(_warmFreeBlockBins));
+   memset(_coldFreeBlockBins, 0, sizeof(_coldFreeBlockBins));
+   _warmFreeBlockBinMap = 0;
+   _coldFreeBlockBinMap = 0;
+   _freeBlockTree = NULL;
    _lastAllocatedBlock = NULL; // MP
 
    omrthread_jit_write_protect_disable();
@@ -962,7 +968,7 @@ OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start,
    start = (uint8_t *)align((size_t)start, round);
 
    // make sure aligning start didn't push it past end
-   if (end <= (start+sizeof(CodeCacheFreeCacheBlock)))
+   if (end <= (start+CODECACHE_FREE_BLOCK_LIST_HEADER_SIZE))
       {
       if (config.verboseReclamation())
          {
@@ -984,99 +990,69 @@ OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start,
    //fprintf(stderr, "--ccr-- newFreeBlock size %d at %p\n", size, start);
    CodeCacheFreeCacheBlock *mergedBlock = NULL;
    CodeCacheFreeCacheBlock *link = NULL;
-   if (_freeBlockList)
-      {
-      CodeCacheFreeCacheBlock *curr;
-      // find the insertion point
-      for (curr = _freeBlockList; curr->_next && (uint8_t *)(curr->_next) < start; curr = curr->_next)
-         {}
 
-      if (start < (uint8_t *)curr && (uint8_t *)curr - end < sizeof(CodeCacheFreeCacheBlock))
+   // find the insertion point
+   CodeCacheFreeCacheBlock *prev = self()->findPrecedingFreeBlock(start);
+   CodeCacheFreeCacheBlock *next = prev ? prev->_next : _freeBlockList;
+   TR_ASSERT(!next || end <= (uint8_t *)next, "assertion failure"); // check for no overlap of blocks
+
+   // merge with the neighbouring blocks, but don't merge warm blocks with cold blocks
+   bool mergeWithPrev = prev &&
+                        (size_t)(start - ((uint8_t *)prev + prev->_size)) < CODECACHE_FREE_BLOCK_LIST_HEADER_SIZE &&
+                        !((uint8_t *)prev < _warmCodeAlloc && start >= _coldCodeAlloc);
+   bool mergeWithNext = next &&
+                        (size_t)((uint8_t *)next - end) < CODECACHE_FREE_BLOCK_LIST_HEADER_SIZE &&
+                        !(start < _warmCodeAlloc && (uint8_t *)next >= _coldCodeAlloc);
+
+   if (mergeWithNext && self()->isIndexedFreeBlock(next))
+      self()->unindexFreeBlock(next);
+
+   if (mergeWithPrev)
+      {
+      // merge with the previous block, and with the next block too if it is adjacent
+      mergedBlock = prev;
+      if (mergeWithNext)
          {
-         // merge with the curr block ahead, which is also the first block
-         TR_ASSERT(end <= (uint8_t *)curr, "assertion failure"); // check for no overlap of blocks
-         // we should not merge warm block with cold blocks
-         if (!(start < _warmCodeAlloc && (uint8_t *)curr >= _coldCodeAlloc))
-            {
-            // which is also the first block
-            link = (CodeCacheFreeCacheBlock *) start;
-            mergedBlock = curr;
-            //fprintf(stderr, "--ccr-- merging new free block of the size %d with a block of the size %d at %p\n", size, curr->size, link);
-            link->_size = (uint8_t *)curr + curr->_size - start;
-            link->_next = curr->_next;
-            _freeBlockList = link;
-            //fprintf(stderr, "--ccr-- new merged free block's size is %d\n", link->size);
-            }
+         prev->_next = next->_next;
+         self()->growFreeBlock(prev, (uint8_t *)next + next->_size - (uint8_t *)prev);
          }
-      else if (curr->_next && ((uint8_t *)curr->_next - end < sizeof(CodeCacheFreeCacheBlock)) &&
-         !(start < _warmCodeAlloc && (uint8_t *)curr->_next >= _coldCodeAlloc))
+      else
          {
-         // merge with the next block, but don't merge warm blocks with cold blocks
-         if ((start - ((uint8_t *)curr + curr->_size) < sizeof(CodeCacheFreeCacheBlock)) &&
-             !((uint8_t *)curr < _warmCodeAlloc && start >= _coldCodeAlloc))
-            {
-            // merge with the previous and the next blocks
-            mergedBlock = curr;
-            //fprintf(stderr, "--ccr-- merging new free block of the size %d with blocks of the size %d and %d at %p\n", size, curr->_size, curr->_next->_size, curr);
-            curr->_size = (uint8_t *)curr->_next + curr->_next->_size - (uint8_t *)curr;
-            curr->_next = curr->_next->_next;
-            //fprintf(stderr, "--ccr-- new merged free block's size is %d\n", curr->_size);
-            link = curr;
-#ifdef DEBUG
-            start = (uint8_t *)curr;
-#endif
-            }
-         else
-            {
-            mergedBlock = curr->_next;
-            link = (CodeCacheFreeCacheBlock *) start;
-            //fprintf(stderr, "--ccr-- merging new free block of the size %d with a block of the size %d at %p\n", size, curr->next->size, link);
-            link->_size = (uint8_t *)curr->_next + curr->_next->_size - start;
-            link->_next = curr->_next->_next;
-            curr->_next = link;
-            //fprintf(stderr, "--ccr-- new merged free block's size is %d\n", link->_size);
-            }
+         self()->growFreeBlock(prev, end - (uint8_t *)prev);
          }
-      else if ((uint8_t *)curr < start && start - ((uint8_t *)curr + curr->_size) < sizeof(CodeCacheFreeCacheBlock))
-         {
-         // merge with the previous block
-         if (!((uint8_t *)curr < _warmCodeAlloc && start >= _coldCodeAlloc))
-            {
-            mergedBlock = curr;
-            curr->_size = start + size - (uint8_t *)curr;
-            //fprintf(stderr, "--ccr-- new merged free block's size is %d\n", curr->_size);
-            link = curr;
+      link = prev;
 #ifdef DEBUG
-            start = (uint8_t *)curr;
+      start = (uint8_t *)prev;
 #endif
-            }
+      }
+   else
+      {
+      link = (CodeCacheFreeCacheBlock *) start;
+      if (mergeWithNext)
+         {
+         // merge with the next block; the new block takes its place
+         mergedBlock = next;
+         link->_size = (uint8_t *)next + next->_size - start;
+         link->_next = next->_next;
          }
-      if (!link) // no merging happened
+      else // no merging happened
          {
-         link = (CodeCacheFreeCacheBlock *) start;
          link->_size = size;
-         if (start < (uint8_t *)curr)
-            {
-            link->_next = _freeBlockList;
-            _freeBlockList = link;
-            }
-         else
-            {
-            link->_next = curr->_next;
-            curr->_next = link;
-            }
+         link->_next = next;
          }
-      }
-   else // This is the first block in the list
-      {
-      _freeBlockList = (CodeCacheFreeCacheBlock *) start;
-      _freeBlockList->_size = size;
-      _freeBlockList->_next = NULL;
-      //updateMaxSizeOfFreeBlocks(_freeBlockList, _freeBlockList->_size);
-      link = _freeBlockList;
+
+      if (prev)
+         prev->_next = link;
+      else
+         _freeBlockList = link;
+
+      if (self()->isIndexedFreeBlock(link))
+         self()->indexFreeBlock(link);
       }
 
-   self()->updateMaxSizeOfFreeBlocks(link, link->_size);
+   // Only indexed blocks can be found for reuse
+   if (self()->isIndexedFreeBlock(link))
+      self()->updateMaxSizeOfFreeBlocks(link, link->_size);
 
    _manager->decreaseCurrTotalUsedInBytes(size);
 
@@ -1125,107 +1101,58 @@ OMR::CodeCache::updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, siz
 //
 // isCold indicates whether a warm or cold block of memory is required.
 //
+// Free blocks are binned by size class. Blocks in the request's own class may
+// be too small, so that class is searched for the smallest block that fits;
+// failing that, every block in the next non-empty class fits and the smallest
+// of those is used.
+//
 uint8_t *
 OMR::CodeCache::findFreeBlock(size_t size, bool isCold, bool isMethodHeaderNeeded)
    {
+   CodeCacheFreeCacheBlock **bins = isCold ? _coldFreeBlockBins : _warmFreeBlockBins;
+   uint64_t binMap = isCold ? _coldFreeBlockBinMap : _warmFreeBlockBinMap;
+   uint32_t bin = freeBlockBin(size);
    CodeCacheFreeCacheBlock *currLink;
-   CodeCacheFreeCacheBlock *prevLink;
-   CodeCacheFreeCacheBlock *bestFitLink = NULL, *bestFitLinkPrev = NULL;
-   CodeCacheFreeCacheBlock *biggestLink = NULL;
-   CodeCacheFreeCacheBlock *secondBiggestLink = NULL;
+   CodeCacheFreeCacheBlock *bestFitLink = NULL;
 
    TR_ASSERT(_freeBlockList, "Because we first checked that a freeBlockExists, freeBlockList cannot be null");
 
-   // Find the smallest free link to fit the requested blockSize
-   for (currLink = _freeBlockList, prevLink = NULL; currLink; prevLink = currLink, currLink = currLink->_next)
+   for (currLink = bins[bin]; currLink; currLink = currLink->_binNext)
       {
-      if (isCold)
-         {
-         if ((void*)currLink < (void*)_coldCodeAlloc)
-            continue;
-         }
-      else
-         {
-         if ((void*)currLink >= (void*)_warmCodeAlloc)
-            continue;
-         // curLink is warm code
-         }
-
-      //fprintf(stderr, "cache %p findFreeBlock bs=%u\n", this, currLink->size);
-      if (!biggestLink)
-         {
-         biggestLink = currLink;
-         }
-      else
-         {
-         if (currLink->_size >= biggestLink->_size) // >= is important; do not use > only as secondBiggestLink may be wrong
-            {
-            secondBiggestLink = biggestLink;
-            biggestLink = currLink;
-            }
-         else
-            {
-            if (secondBiggestLink)
-               {
-               if (currLink->_size >= secondBiggestLink->_size)
-                  secondBiggestLink = currLink;
-               }
-            else
-               {
-               secondBiggestLink = currLink;
-               }
-            }
-         }
+      if (currLink->_size >= size && (!bestFitLink || currLink->_size < bestFitLink->_size))
+         bestFitLink = currLink;
+      }
 
-      if (currLink->_size >= size)
+   if (!bestFitLink && bin + 1 < CODECACHE_FREE_BLOCK_BINS)
+      {
+      uint64_t largerBins = binMap & ~(((uint64_t)2 << bin) - 1);
+      if (largerBins)
          {
-         if (!bestFitLink)
-            {
-            bestFitLink = currLink;
-            bestFitLinkPrev = prevLink;
-            }
-         else if (bestFitLink->_size > currLink->_size)
+         for (currLink = bins[trailingZeroes(largerBins)]; currLink; currLink = currLink->_binNext)
             {
-            bestFitLink = currLink;
-            bestFitLinkPrev = prevLink;
+            if (!bestFitLink || currLink->_size < bestFitLink->_size)
+               bestFitLink = currLink;
             }
          }
-      } // end for
-
-   // safety net
-   TR_ASSERT(biggestLink, "There must be a biggestLink");
-   TR_ASSERT(bestFitLink, "There must be a bestFitLink");
-
-   TR::CodeCacheConfig & config = _manager->codeCacheConfig();
-   if (!isCold)
-      {
-      TR_ASSERT(!config.codeCacheFreeBlockRecylingEnabled() ||
-              _sizeOfLargestFreeWarmBlock == biggestLink->_size, "_sizeOfLargestFreeWarmBlock=%d  biggestLink->_size=%d",
-           _sizeOfLargestFreeWarmBlock, (int32_t)biggestLink->_size);
-      }
-   else
-      {
-      TR_ASSERT(!config.codeCacheFreeBlockRecylingEnabled() ||
-         _sizeOfLargestFreeColdBlock == biggestLink->_size, "assertion failure");
       }
 
+   TR::CodeCacheConfig & config = _manager->codeCacheConfig();
    if (bestFitLink)
       {
       // Fix the linked list by removing the allocated block AND if there is any unused
       // space left in the currLink chunk, reclaim it and put back on the freeList
-      CodeCacheFreeCacheBlock *leftBlock = self()->removeFreeBlock(size, bestFitLinkPrev, bestFitLink);
+      size_t bestFitSize = bestFitLink->_size;
+      CodeCacheFreeCacheBlock *leftBlock = self()->removeFreeBlock(size, self()->findPrecedingFreeBlock((uint8_t *)bestFitLink), bestFitLink);
 
-      if (bestFitLink == biggestLink)  // Size of biggest might have changed
+      if (!isCold)
          {
-         uint64_t leftBlockSize     = leftBlock ? leftBlock->_size : 0;
-         uint64_t secondBiggestSize = secondBiggestLink ? secondBiggestLink->_size : 0;
-         uint64_t biggestSize       = leftBlockSize > secondBiggestSize ? leftBlockSize : secondBiggestSize;
-         if (!isCold)
-            {
-            _sizeOfLargestFreeWarmBlock = (size_t)biggestSize;
-            }
-         else
-            _sizeOfLargestFreeColdBlock = (size_t)biggestSize;
+         if (bestFitSize >= _sizeOfLargestFreeWarmBlock)  // Size of biggest might have changed
+            _sizeOfLargestFreeWarmBlock = self()->largestIndexedFreeBlock(false);
+         }
+      else
+         {
+         if (bestFitSize >= _sizeOfLargestFreeColdBlock)
+            _sizeOfLargestFreeColdBlock = self()->largestIndexedFreeBlock(true);
          }
      //fprintf(stderr, "--ccr-- reallocate free'd block of size %d\n", size);
      if (config.verboseReclamation())
@@ -1262,12 +1189,14 @@ OMR::CodeCache::removeFreeBlock(size_t blockSize,
    {
    CodeCacheFreeCacheBlock *next = curr->_next;
 
+   omrthread_jit_write_protect_disable();
+
+   self()->unindexFreeBlock(curr);
+
    // Is there any left over space in the current link? Save it as a
    // separate link and adjust the sizes of the two split resulting blocks
    if (curr->_size - blockSize >= MIN_SIZE_BLOCK)
       {
-      omrthread_jit_write_protect_disable();
-
       size_t splitSize = curr->_size - blockSize; // remaining portion
       curr->_size = blockSize;
       curr = (CodeCacheFreeCacheBlock *) ((uint8_t *) curr + blockSize);
@@ -1279,14 +1208,14 @@ OMR::CodeCache::removeFreeBlock(size_t blockSize,
       else
          _freeBlockList = curr;
 
+      self()->indexFreeBlock(curr);
+
       omrthread_jit_write_protect_enable();
 
       return curr;
       }
    else // Use the entire block
       {
-      omrthread_jit_write_protect_disable();
-
       if (prev)
          prev->_next = next;
       else
@@ -1299,6 +1228,268 @@ OMR::CodeCache::removeFreeBlock(size_t blockSize,
    }
 
 
+uint32_t
+OMR::CodeCache::freeBlockBin(size_t size)
+   {
+   if (size < 64)
+      return 0;
+
+   int32_t log2 = 63 - leadingZeroes((uint64_t)size);
+   uint32_t bin = ((uint32_t)(log2 - 6) << 2) | (uint32_t)((size >> (log2 - 2)) & 3);
+   return std::min(bin, (uint32_t)(CODECACHE_FREE_BLOCK_BINS - 1));
+   }
+
+
+// The warm or cold bins are chosen by address like updateMaxSizeOfFreeBlocks
+// does; warm blocks stay below _warmCodeAlloc since it only grows.
+void
+OMR::CodeCache::binFreeBlock(CodeCacheFreeCacheBlock *block)
+   {
+   bool isCold = (uint8_t *)block >= _warmCodeAlloc;
+   CodeCacheFreeCacheBlock **bins = isCold ? _coldFreeBlockBins : _warmFreeBlockBins;
+   uint32_t bin = freeBlockBin(block->_size);
+
+   block->_binPrev = NULL;
+   block->_binNext = bins[bin];
+   if (bins[bin])
+      bins[bin]->_binPrev = block;
+   bins[bin] = block;
+
+   if (isCold)
+      _coldFreeBlockBinMap |= (uint64_t)1 << bin;
+   else
+      _warmFreeBlockBinMap |= (uint64_t)1 << bin;
+   }
+
+
+void
+OMR::CodeCache::unbinFreeBlock(CodeCacheFreeCacheBlock *block)
+   {
+   if (block->_binNext)
+      block->_binNext->_binPrev = block->_binPrev;
+
+   if (block->_binPrev)
+      {
+      block->_binPrev->_binNext = block->_binNext;
+      }
+   else
+      {
+      // The block heads its bin; find out which region it was binned in
+      uint32_t bin = freeBlockBin(block->_size);
+      bool isCold = _warmFreeBlockBins[bin] != block;
+      CodeCacheFreeCacheBlock **bins = isCold ? _coldFreeBlockBins : _warmFreeBlockBins;
+
+      TR_ASSERT(bins[bin] == block, "free block %p is not in its size class", block);
+      bins[bin] = block->_binNext;
+      if (!bins[bin])
+         {
+         if (isCold)
+            _coldFreeBlockBinMap &= ~((uint64_t)1 << bin);
+         else
+            _warmFreeBlockBinMap &= ~((uint64_t)1 << bin);
+         }
+      }
+   }
+
+
+// Treap priority of a free block. It is derived from the address so it does
+// not need to be stored, and is well mixed because blocks are aligned.
+static inline uint64_t
+freeBlockPriority(OMR::CodeCacheFreeCacheBlock *block)
+   {
+   uint64_t key = (uint64_t)(uintptr_t)block;
+   key ^= key >> 33;
+   key *= 0xff51afd7ed558ccdULL;
+   key ^= key >> 33;
+   return key;
+   }
+
+
+static void
+insertFreeBlockTree(OMR::CodeCacheFreeCacheBlock *&root, OMR::CodeCacheFreeCacheBlock *block)
+   {
+   if (!root)
+      {
+      block->_left = NULL;
+      block->_right = NULL;
+      root = block;
+      }
+   else if (block < root)
+      {
+      insertFreeBlockTree(root->_left, block);
+      if (freeBlockPriority(root->_left) > freeBlockPriority(root))
+         {
+         // rotate right
+         OMR::CodeCacheFreeCacheBlock *left = root->_left;
+         root->_left = left->_right;
+         left->_right = root;
+         root = left;
+         }
+      }
+   else
+      {
+      insertFreeBlockTree(root->_right, block);
+      if (freeBlockPriority(root->_right) > freeBlockPriority(root))
+         {
+         // rotate left
+         OMR::CodeCacheFreeCacheBlock *right = root->_right;
+         root->_right = right->_left;
+         right->_left = root;
+         root = right;
+         }
+      }
+   }
+
+
+static void
+removeFreeBlockTree(OMR::CodeCacheFreeCacheBlock *&root, OMR::CodeCacheFreeCacheBlock *block)
+   {
+   TR_ASSERT_FATAL(root, "free block %p is missing from the address index", block);
+
+   if (block < root)
+      {
+      removeFreeBlockTree(root->_left, block);
+      }
+   else if (block > root)
+      {
+      removeFreeBlockTree(root->_right, block);
+      }
+   else if (!root->_left)
+      {
+      root = root->_right;
+      }
+   else if (!root->_right)
+      {
+      root = root->_left;
+      }
+   else if (freeBlockPriority(root->_left) > freeBlockPriority(root->_right))
+      {
+      // rotate the block down on the side of its lower priority child
+      OMR::CodeCacheFreeCacheBlock *left = root->_left;
+      root->_left = left->_right;
+      left->_right = root;
+      root = left;
+      removeFreeBlockTree(root->_right, block);
+      }
+   else
+      {
+      OMR::CodeCacheFreeCacheBlock *right = root->_right;
+      root->_right = right->_left;
+      right->_left = root;
+      root = right;
+      removeFreeBlockTree(root->_left, block);
+      }
+   }
+
+
+void
+OMR::CodeCache::indexFreeBlock(CodeCacheFreeCacheBlock *block)
+   {
+   self()->binFreeBlock(block);
+   insertFreeBlockTree(_freeBlockTree, block);
+   }
+
+
+void
+OMR::CodeCache::unindexFreeBlock(CodeCacheFreeCacheBlock *block)
+   {
+   self()->unbinFreeBlock(block);
+   removeFreeBlockTree(_freeBlockTree, block);
+   }
+
+
+void
+OMR::CodeCache::growFreeBlock(CodeCacheFreeCacheBlock *block, size_t size)
+   {
+   bool wasIndexed = self()->isIndexedFreeBlock(block);
+   if (wasIndexed)
+      self()->unbinFreeBlock(block);
+
+   block->_size = size;
+
+   if (wasIndexed)
+      self()->binFreeBlock(block);
+   else if (self()->isIndexedFreeBlock(block))
+      self()->indexFreeBlock(block);
+   }
+
+
+OMR::CodeCacheFreeCacheBlock *
+OMR::CodeCache::findPrecedingIndexedFreeBlock(uint8_t *address)
+   {
+   CodeCacheFreeCacheBlock *preceding = NULL;
+   CodeCacheFreeCacheBlock *node = _freeBlockTree;
+   while (node)
+      {
+      if ((uint8_t *)node < address)
+         {
+         preceding = node;
+         node = node->_right;
+         }
+      else
+         {
+         node = node->_left;
+         }
+      }
+   return preceding;
+   }
+
+
+// Fragments too small to be indexed may lie between the preceding indexed
+// block and the address; they are rare and are stepped over on the list.
+OMR::CodeCacheFreeCacheBlock *
+OMR::CodeCache::findPrecedingFreeBlock(uint8_t *address)
+   {
+   CodeCacheFreeCacheBlock *preceding = self()->findPrecedingIndexedFreeBlock(address);
+   CodeCacheFreeCacheBlock *curr = preceding ? preceding->_next : _freeBlockList;
+   while (curr && (uint8_t *)curr < address)
+      {
+      preceding = curr;
+      curr = curr->_next;
+      }
+   return preceding;
+   }
+
+
+size_t
+OMR::CodeCache::largestIndexedFreeBlock(bool isCold)
+   {
+   uint64_t binMap = isCold ? _coldFreeBlockBinMap : _warmFreeBlockBinMap;
+   if (!binMap)
+      return 0;
+
+   CodeCacheFreeCacheBlock **bins = isCold ? _coldFreeBlockBins : _warmFreeBlockBins;
+   size_t largest = 0;
+   for (CodeCacheFreeCacheBlock *currLink = bins[63 - leadingZeroes(binMap)]; currLink; currLink = currLink->_binNext)
+      {
+      if (currLink->_size > largest)
+         largest = currLink->_size;
+      }
+   return largest;
+   }
+
+
+void
+OMR::CodeCache::rebuildFreeBlockIndex()
+   {
+   memset(_warmFreeBlockBins, 0, sizeof(_warmFreeBlockBins));
+   memset(_coldFreeBlockBins, 0, sizeof(_coldFreeBlockBins));
+   _warmFreeBlockBinMap = 0;
+   _coldFreeBlockBinMap = 0;
+   _freeBlockTree = NULL;
+
+   omrthread_jit_write_protect_disable();
+
+   for (CodeCacheFreeCacheBlock *currLink = _freeBlockList; currLink; currLink = currLink->_next)
+      {
+      if (self()->isIndexedFreeBlock(currLink))
+         self()->indexFreeBlock(currLink);
+      }
+
+   omrthread_jit_write_protect_enable();
+   }
+
+
 void
 OMR::CodeCache::dumpCodeCache()
    {
@@ -1382,8 +1573,18 @@ OMR::CodeCache::checkForErrors()
          {
          CacheCriticalSection walkFreeList(self());
 
+         size_t numIndexedBlocks = 0;
          for (CodeCacheFreeCacheBlock *currLink = _freeBlockList; currLink; currLink = currLink->_next)
             {
+            // Is the block indexed if it should be?
+            bool isIndexed = self()->isIndexedFreeBlock(currLink);
+            if (isIndexed)
+               numIndexedBlocks++;
+            if (isIndexed && self()->findPrecedingIndexedFreeBlock((uint8_t *)currLink + 1) != currLink)
+               {
+               fprintf(stderr, "checkForErrors cache %p: Error: free block %p is missing from the address index\n", this, currLink);
+               doCrash = true;
+               }
             // Does the size look right?
             uint64_t cacheSize = _segment->segmentTop() - _segment->segmentBase();
             if (currLink->_size > cacheSize)
@@ -1436,6 +1637,8 @@ OMR::CodeCache::checkForErrors()
                      }
                   }
                }
+            if (!isIndexed) // fragments are not available for reuse
+               continue;
             if ((uint8_t*)currLink < _warmCodeAlloc) // warm block
                {
                if (currLink->_size > maxFreeWarmSize)
@@ -1458,6 +1661,20 @@ OMR::CodeCache::checkForErrors()
             doCrash = true;
             }
 
+         size_t numBinnedBlocks = 0;
+         for (uint32_t bin = 0; bin < CODECACHE_FREE_BLOCK_BINS; bin++)
+            {
+            for (CodeCacheFreeCacheBlock *currLink = _warmFreeBlockBins[bin]; currLink; currLink = currLink->_binNext)
+               numBinnedBlocks++;
+            for (CodeCacheFreeCacheBlock *currLink = _coldFreeBlockBins[bin]; currLink; currLink = currLink->_binNext)
+               numBinnedBlocks++;
+            }
+         if (numBinnedBlocks != numIndexedBlocks)
+            {
+            fprintf(stderr, "checkForErrors cache %p: Error: %" OMR_PRIuSIZE " free blocks are binned but %" OMR_PRIuSIZE " should be\n", this, numBinnedBlocks, numIndexedBlocks);
+            doCrash = true;
+            }
+
          // Blocks must come one after another;
          // 1. A free block must be followed by a used block;
          //    The only exception is when we make transition from warm to cold section
@@ -226,6 +226,71 @@ private:
                                               CodeCacheFreeCacheBlock *prev,
                                               CodeCacheFreeCacheBlock *curr);
 
+   /**
+    * @brief Size class of a free block of the given size. There are four
+    *        classes per power of two from 64 bytes; the last class holds
+    *        every larger block.
+    */
+   static uint32_t            freeBlockBin(size_t size);
+
+   /**
+    * @brief Add a free block to the list of its size class
+    */
+   void                       binFreeBlock(CodeCacheFreeCacheBlock *block);
+
+   /**
+    * @brief Remove a free block from the list of its size class. This must
+    *        happen before the size of the block changes.
+    */
+   void                       unbinFreeBlock(CodeCacheFreeCacheBlock *block);
+
+   /**
+    * @brief Whether a free block is big enough to be in the size class and
+    *        address indexes
+    */
+   static bool                isIndexedFreeBlock(CodeCacheFreeCacheBlock *block) { return block->_size >= sizeof(CodeCacheFreeCacheBlock); }
+
+   /**
+    * @brief Add a free block to the size class and address indexes. The
+    *        block must already be linked into the address-ordered list.
+    */
+   void                       indexFreeBlock(CodeCacheFreeCacheBlock *block);
+
+   /**
+    * @brief Remove a free block from the size class and address indexes
+    */
+   void                       unindexFreeBlock(CodeCacheFreeCacheBlock *block);
+
+   /**
+    * @brief Grow a free block in place, moving it to its new size class
+    *        and indexing it if it has become big enough
+    */
+   void                       growFreeBlock(CodeCacheFreeCacheBlock *block, size_t size);
+
+   /**
+    * @brief Find the indexed free block with the highest address below the given one
+    *
+    * @return the preceding indexed free block, or NULL if there is none
+    */
+   CodeCacheFreeCacheBlock *  findPrecedingIndexedFreeBlock(uint8_t *address);
+
+   /**
+    * @brief Find the free block with the highest address below the given one
+    *
+    * @return the preceding free block, or NULL if there is none
+    */
+   CodeCacheFreeCacheBlock *  findPrecedingFreeBlock(uint8_t *address);
+
+   /**
+    * @brief Size of the largest free block in the warm or cold region
+    */
+   size_t                     largestIndexedFreeBlock(bool isCold);
+
+   /**
+    * @brief Rebuild the free block indexes from the address-ordered list
+    */
+   void                       rebuildFreeBlockIndex();
+
 public:
    bool                       addFreeBlock2WithCallSite(uint8_t *start,
                                                         uint8_t *end,
@@ -296,11 +361,12 @@ public:
    CodeCacheFreeCacheBlock *freeBlockList() { return _freeBlockList; }
 
    /**
-    * @brief Setter for freeBlockList
+    * @brief Setter for freeBlockList. The free block indexes are rebuilt
+    *        from the new list.
     *
     * @param[in] : The new head of the CodeCacheFreeCacheBlock list
     */
-   void setFreeBlockList(CodeCacheFreeCacheBlock *fcb) { _freeBlockList = fcb; }
+   void setFreeBlockList(CodeCacheFreeCacheBlock *fcb) { _freeBlockList = fcb; rebuildFreeBlockIndex(); }
 
    /**
     * @brief Getter for the base address of temporary trampolines
@@ -416,6 +482,17 @@ public:
 
    CodeCacheFreeCacheBlock *_freeBlockList;
 
+   // Free blocks indexed by size class, separately for the warm and cold
+   // regions. Bit i of a bin map is set when bin i is not empty.
+   CodeCacheFreeCacheBlock *_warmFreeBlockBins[CODECACHE_FREE_BLOCK_BINS];
+   CodeCacheFreeCacheBlock *_coldFreeBlockBins[CODECACHE_FREE_BLOCK_BINS];
+   uint64_t _warmFreeBlockBinMap;
+   uint64_t _coldFreeBlockBinMap;
+
+   // Root of a treap of all free blocks ordered by address, used to find
+   // coalescing neighbours
+   CodeCacheFreeCacheBlock *_freeBlockTree;
+
    // This is used in an attempt to enforce mutually exclusive ownership.
    // flag accessed under mutex <== This is deceiving! There are two different monitors we may hold (not at the same time!) when we write to this.
    // We can either be holding the code cache monitor *OR* the manager's code cache list monitor.
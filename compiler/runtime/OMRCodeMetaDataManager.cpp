@@ -23,10 +23,8 @@
 
 #include <stdint.h>
 #include <string.h>
-#include "avl_api.h"
 #include "env/TRMemory.hpp"
 #include "infra/Assert.hpp"
-#include "j9nongenerated.h"
 #include "runtime/CodeCache.hpp"
 #include "runtime/CodeCacheMemorySegment.hpp"
 #include "runtime/CodeMetaDataManager.hpp"
@@ -40,15 +38,52 @@
 namespace OMR
 {
 
+static inline void
+metaDataWriteBarrier()
+   {
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+   VM_AtomicSupport::writeBarrier();
+#else
+   __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+   }
+
+static inline void
+metaDataReadBarrier()
+   {
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+   VM_AtomicSupport::readBarrier();
+#else
+   __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif
+   }
+
+static inline void
+metaDataYield()
+   {
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+   VM_AtomicSupport::yieldCPU();
+#endif
+   }
+
+// Read the modification count of a table with a volatile load, ordered
+// before any read of the table that follows it.
+//
+static inline uintptr_t
+loadModificationCount(TR::MetaDataHashTable *table)
+   {
+   uintptr_t modificationCount = *static_cast<volatile uintptr_t *>(&table->modificationCount);
+   metaDataReadBarrier();
+   return modificationCount;
+   }
+
+
 TR::CodeMetaDataManager *CodeMetaDataManager::_codeMetaDataManager = NULL;
 
 
 CodeMetaDataManager::CodeMetaDataManager() :
-   _cachedPC(0),
-   _cachedHashTable(NULL),
-   _retrievedMetaDataCache(NULL)
+   _rangeTable(NULL)
    {
-   _metaDataAVL = self()->allocateMetaDataAVL();
    }
 
 
@@ -75,31 +110,6 @@ CodeMetaDataManager::initializeCodeMetaDataManager()
    }
 
 
-// First allocation
-//
-J9AVLTree *
-CodeMetaDataManager::allocateMetaDataAVL()
-   {
-   J9AVLTree *metaDataAVLTree;
-
-   metaDataAVLTree = (J9AVLTree *) TR_Memory::jitPersistentAlloc(sizeof(J9AVLTree), TR_Memory::CodeMetaDataAVL);
-
-   if (!metaDataAVLTree)
-      return NULL;
-
-   metaDataAVLTree->insertionComparator = (intptr_t (*)(J9AVLTree *, J9AVLTreeNode *, J9AVLTreeNode *))OMR::avl_jit_metadata_insertionCompare;
-   metaDataAVLTree->searchComparator = (intptr_t (*)(J9AVLTree *, uintptr_t, J9AVLTreeNode *))OMR::avl_jit_metadata_searchCompare;
-   metaDataAVLTree->genericActionHook = NULL;
-   metaDataAVLTree->flags = 0;
-   metaDataAVLTree->rootNode = 0;
-
-   // Use the OMR AVL structure but TR will manage its own memory
-   //
-   metaDataAVLTree->portLibrary = NULL;
-
-   return metaDataAVLTree;
-   }
-
 /**
  * Insert metadata into the MetaDataManager.
  *
@@ -137,8 +147,6 @@ CodeMetaDataManager::removeMetaData(const TR::MethodMetaDataPOD *metaData)
       removeSuccess = self()->removeRange(metaData, metaData->startPC, metaData->endPC);
       }
 
-   _retrievedMetaDataCache = NULL;
-
    return removeSuccess;
    }
 
@@ -147,16 +155,25 @@ const TR::MethodMetaDataPOD *
 CodeMetaDataManager::findMetaDataForPC(uintptr_t pc)
    {
    TR_ASSERT(pc != 0, "attempting to query existing MetaData for a NULL PC");
-   self()->updateCache(pc);
-   if (!_retrievedMetaDataCache)
+   TR::MetaDataHashTable *table = self()->findHashTable(pc);
+   if (!table)
+      return NULL;
+
+   // The table may be modified while it is searched. Metadata that is found
+   // contains the PC and can be trusted regardless, but a miss only counts if
+   // the table was not being modified before or during the search.
+   //
+   for (;;)
       {
-      if (_cachedHashTable)
-         {
-         _retrievedMetaDataCache = self()->findMetaDataInHash(_cachedHashTable, pc);
-         }
+      uintptr_t modificationCount = loadModificationCount(table);
+      TR::MethodMetaDataPOD *metaData = self()->findMetaDataInHash(table, pc);
+      if (metaData)
+         return metaData;
+      metaDataReadBarrier();
+      if (!(modificationCount & 1) && loadModificationCount(table) == modificationCount)
+         return NULL;
+      metaDataYield();
       }
-
-   return _retrievedMetaDataCache;
    }
 
 
@@ -168,10 +185,15 @@ CodeMetaDataManager::insertRange(
       uintptr_t endPC)
    {
    bool insertSuccess = false;
-   self()->updateCache(metaData->startPC);
-   if (_cachedHashTable)
+   TR::MetaDataHashTable *table = self()->findHashTable(metaData->startPC);
+   TR_ASSERT(table, "Attempted to insert metadata for a non-code cache startPC: %p", metaData->startPC);
+   if (table)
       {
-      insertSuccess = (self()->insertMetaDataRangeInHash(_cachedHashTable, metaData, startPC, endPC) == 0);
+      table->modificationCount += 1;
+      metaDataWriteBarrier();
+      insertSuccess = (self()->insertMetaDataRangeInHash(table, metaData, startPC, endPC) == 0);
+      metaDataWriteBarrier();
+      table->modificationCount += 1;
       }
 
    return insertSuccess;
@@ -186,10 +208,14 @@ CodeMetaDataManager::removeRange(
       uintptr_t endPC)
    {
    bool removeSuccess = false;
-   self()->updateCache(metaData->startPC);
-   if (_cachedHashTable)
+   TR::MetaDataHashTable *table = self()->findHashTable(metaData->startPC);
+   if (table)
       {
-      removeSuccess = (self()->removeMetaDataRangeFromHash(_cachedHashTable, metaData, startPC, endPC) == 0);
+      table->modificationCount += 1;
+      metaDataWriteBarrier();
+      removeSuccess = (self()->removeMetaDataRangeFromHash(table, metaData, startPC, endPC) == 0);
+      metaDataWriteBarrier();
+      table->modificationCount += 1;
       }
 
    return removeSuccess;
@@ -197,19 +223,84 @@ CodeMetaDataManager::removeRange(
 
 
 // protected
-void
-CodeMetaDataManager::updateCache(uintptr_t currentPC)
+TR::MetaDataHashTable *
+CodeMetaDataManager::findHashTable(uintptr_t pc)
+   {
+   TR_ASSERT(pc > 0, "Attempting to find a code cache's metaData hash table for a NULL PC.");
+   MetaDataRangeTable *rangeTable = _rangeTable;
+   if (!rangeTable)
+      return NULL;
+
+   // Pairs with the write barrier before the snapshot was published
+   metaDataReadBarrier();
+
+   uintptr_t low = 0;
+   uintptr_t high = rangeTable->numRanges;
+   while (low < high)
+      {
+      uintptr_t middle = low + (high - low) / 2;
+      const MetaDataRange &range = rangeTable->ranges[middle];
+      if (pc < range.start)
+         high = middle;
+      else if (pc >= range.end)
+         low = middle + 1;
+      else
+         return range.table;
+      }
+
+   return NULL;
+   }
+
+
+// protected
+bool
+CodeMetaDataManager::publishRange(TR::MetaDataHashTable *table)
    {
-   TR_ASSERT(currentPC > 0, "Attempting to find a code cache's metaData hash table for a NULL PC.");
-   if (currentPC != _cachedPC)
+   MetaDataRangeTable *oldRangeTable = _rangeTable;
+   uintptr_t numRanges = oldRangeTable ? oldRangeTable->numRanges : 0;
+
+   MetaDataRangeTable *newRangeTable = (MetaDataRangeTable *) TR_Memory::jitPersistentAlloc(
+      sizeof(MetaDataRangeTable) + numRanges * sizeof(MetaDataRange),
+      TR_Memory::CodeMetaDataAVL);
+
+   if (!newRangeTable)
+      return false;
+
+   // Copy the old snapshot, inserting the new range in address order
+   //
+   uintptr_t to = 0;
+   for (uintptr_t from = 0; from < numRanges; from++)
       {
-      _retrievedMetaDataCache = NULL;
-      _cachedPC = currentPC;
-      _cachedHashTable =
-         static_cast<TR::MetaDataHashTable *>(static_cast<void *>(avl_search(_metaDataAVL, currentPC) ) );
+      const MetaDataRange &range = oldRangeTable->ranges[from];
+      if (to == from && range.start >= table->end)
+         {
+         newRangeTable->ranges[to].start = table->start;
+         newRangeTable->ranges[to].end = table->end;
+         newRangeTable->ranges[to].table = table;
+         to++;
+         }
+      else if (range.end > table->start && range.start < table->end)
+         {
+         TR_Memory::jitPersistentFree(newRangeTable);
+         return false;
+         }
+      newRangeTable->ranges[to++] = range;
+      }
 
-      TR_ASSERT(_cachedHashTable, "Either we lost a code cache or we attempted to find a hash table for a non-code cache startPC: Searched for %p", currentPC);
+   if (to == numRanges)
+      {
+      newRangeTable->ranges[to].start = table->start;
+      newRangeTable->ranges[to].end = table->end;
+      newRangeTable->ranges[to].table = table;
       }
+
+   newRangeTable->numRanges = numRanges + 1;
+   newRangeTable->retired = oldRangeTable;
+
+   metaDataWriteBarrier();
+   _rangeTable = newRangeTable;
+
+   return true;
    }
 
 #undef LOW_BIT_SET
@@ -264,6 +355,12 @@ CodeMetaDataManager::findMetaDataInHash(
                {
                entry = *bucket;
 
+               // A concurrent removal is compacting the chain; the caller
+               // will retry the search.
+               //
+               if (!entry)
+                  return NULL;
+
                if (LOW_BIT_SET(entry))
                   break;
 
@@ -537,7 +634,6 @@ CodeMetaDataManager::removeMetaDataArrayFromHash(
    {
    TR::MethodMetaDataPOD **index;
    uintptr_t count= 0;
-   uintptr_t size;
    uintptr_t removeSpot = 0;
 
    index = array;
@@ -550,16 +646,19 @@ CodeMetaDataManager::removeMetaDataArrayFromHash(
       ++index;
       }
 
+   /* Lookups may be walking the array, so it must stay terminated by a tagged entry throughout. */
    if ((TR::MethodMetaDataPOD*) REMOVE_LOW_BIT(*index) == dataToRemove)
       {
-      *index=0;                              /* dataToRemove is last pointer in the array. */
-      --index;
-      *index = (TR::MethodMetaDataPOD*)SET_LOW_BIT(*index);
+      *(index-1) = (TR::MethodMetaDataPOD*)SET_LOW_BIT(*(index-1));     /* dataToRemove is last pointer in the array. */
+      metaDataWriteBarrier();
+      *index=0;
       }
    else if(removeSpot)
       {
-      size = (count-removeSpot+1)*sizeof(uintptr_t);      /* dataToRemove is in middle (or start) of the array. */
-      memmove((void*)(array+removeSpot-1),(void*)(array+removeSpot),size);
+      TR::MethodMetaDataPOD **slot;                /* dataToRemove is in middle (or start) of the array. */
+      for (slot = array+removeSpot-1; slot < index; slot++)
+         *slot = *(slot+1);                         /* shift a pointer at a time; memmove may copy bytes */
+      metaDataWriteBarrier();
       *index = 0;
       }
    else
@@ -590,13 +689,24 @@ CodeMetaDataManager::addCodeCache(
 
    TR_ASSERT(codeCache->segment(), "missing code cache segment");
 
-   TR::MetaDataHashTable *newTable = self()->allocateCodeMetaDataHash(
+   return self()->addCodeRange(
          (uintptr_t) (codeCache->segment()->segmentBase()),
          (uintptr_t) (codeCache->segment()->segmentTop()) );
+   }
+
+
+// protected
+TR::MetaDataHashTable *
+CodeMetaDataManager::addCodeRange(uintptr_t start, uintptr_t end)
+   {
+   TR::MetaDataHashTable *newTable = self()->allocateCodeMetaDataHash(start, end);
 
-   if (newTable)
+   if (newTable && !self()->publishRange(newTable))
       {
-      avl_insert(_metaDataAVL, (J9AVLTreeNode *) newTable);
+      TR_Memory::jitPersistentFree(newTable->methodStoreStart);
+      TR_Memory::jitPersistentFree(newTable->buckets);
+      TR_Memory::jitPersistentFree(newTable);
+      newTable = NULL;
       }
 
    return newTable;
@@ -642,38 +752,4 @@ CodeMetaDataManager::allocateCodeMetaDataHash(uintptr_t start, uintptr_t end)
    return table;
    }
 
-extern "C"
-{
-
-intptr_t
-avl_jit_metadata_insertionCompare(J9AVLTree *tree, TR::MetaDataHashTable *insertNode, TR::MetaDataHashTable *walkNode)
-   {
-   if (walkNode->start > insertNode->start)
-      {
-      return 1;
-      }
-   else if (walkNode->start < insertNode->start)
-      {
-      return -1;
-      }
-
-   return 0;
-   }
-
-
-intptr_t
-avl_jit_metadata_searchCompare(J9AVLTree *tree, uintptr_t searchValue, TR::MetaDataHashTable *walkNode)
-   {
-   if (searchValue >= walkNode->end)
-      return -1;
-
-   if (searchValue < walkNode->start)
-      return 1;
-
-   return 0;
-   }
-
-} // extern "C"
-
-
 }
@@ -40,7 +40,6 @@ namespace OMR { typedef OMR::MetaDataHashTable MetaDataHashTableConnector; }
 #include <stdint.h>
 #include "env/TRMemory.hpp"
 #include "infra/Annotations.hpp"
-#include "j9nongenerated.h"
 
 namespace TR { class CodeCache; }
 namespace TR { class CodeMetaDataManager; }
@@ -49,6 +48,31 @@ namespace TR { struct MethodMetaDataPOD; }
 
 namespace OMR
 {
+
+/**
+ * The code range covered by one registered code cache.
+ */
+struct MetaDataRange
+   {
+   uintptr_t start;
+   uintptr_t end;
+   TR::MetaDataHashTable *table;
+   };
+
+/**
+ * An immutable, address-ordered snapshot of the registered code ranges.
+ *
+ * Registering a code cache publishes a new snapshot. Earlier snapshots are
+ * kept on the retired chain since lookups may still be reading them; code
+ * caches are registered rarely, so they stay small.
+ */
+struct MetaDataRangeTable
+   {
+   MetaDataRangeTable *retired;
+   uintptr_t numRanges;
+   MetaDataRange ranges[1];
+   };
+
 /**
  * Manages metadata about code produced by the compiler.
  *
@@ -60,6 +84,12 @@ namespace OMR
  *
  * The CodeMetaDataManager only manages pointers; It takes no ownership of the
  * POD pointers provided to it.
+ *
+ * Lookups by PC never take a lock: the code cache is found by binary search
+ * of the published range snapshot, and the metadata in that cache's direct
+ * mapped table, which is guarded by a sequence count so that a lookup racing
+ * with an insertion or removal retries rather than blocking it. Insertions,
+ * removals and code cache registration must still be serialized by the caller.
  */
 class OMR_EXTENSIBLE CodeMetaDataManager
    {
@@ -76,7 +106,7 @@ class OMR_EXTENSIBLE CodeMetaDataManager
 
    /**
     * @brief For a given method's MethodMetaDataPOD, finds the appropriate
-    * hashtable in the AVL tree and inserts the data pointer.
+    * code cache's hashtable and inserts the data pointer.
 
     * Note, insertMetaData does not check to verify that an metadata's given range
     * is not already occupied by an existing metadata.  This is because metadata  
@@ -121,10 +151,9 @@ class OMR_EXTENSIBLE CodeMetaDataManager
 
    /**
     * @brief Attempts to find a registered metadata for a given metadata's startPC.
-    * 
-    * Note: findMetaDataForPC does not locally acquire the JIT metadata monitor.
-    * Users must first manually acquire the monitor or go through another function
-    * that does.
+    *
+    * Note: findMetaDataForPC is lock-free and may be called from any number of
+    * threads while metadata is being inserted or removed.
     *
     * @param pc The PC for which we require the JIT metadata .
     * @return If an metadata for a given startPC is successfully found, returns
@@ -144,6 +173,16 @@ class OMR_EXTENSIBLE CodeMetaDataManager
 
    protected:
 
+   /**
+    * @brief Register a range of code memory with the metadata manager.
+    *
+    * @param start The beginning of the code range.
+    * @param end The end of the code range.
+    * @return The hash table for the range, or NULL if it could not be allocated
+    * or overlaps a range that is already registered.
+    */
+   TR::MetaDataHashTable *addCodeRange(uintptr_t start, uintptr_t end);
+
    /**
     * @brief Initializes the translation metadata manager's members.
     *
@@ -187,16 +226,25 @@ class OMR_EXTENSIBLE CodeMetaDataManager
 
 
    /**
-    * @brief Determines if the current metadataManager query is using the same
-    * metadata as the previous query, and if not, searches for and retrieves the
-    * new metadata's code cache's hash table.
+    * @brief Finds the hash table of the code cache containing a PC.
     *
-    * Note this method expects to be called via another method in the metadata  
-    * manager and thus does not acquire the metadata manager's monitor.
+    * This is lock-free; it searches the most recently published range
+    * snapshot.
     *
-    * @param currentPC The PC we are currently inquiring about.
+    * @param pc The PC we are currently inquiring about.
+    * @return The hash table of the code cache containing pc, or NULL if pc is
+    * not in a registered code cache.
     */
-   void updateCache(uintptr_t currentPC);
+   TR::MetaDataHashTable *findHashTable(uintptr_t pc);
+
+   /**
+    * @brief Publishes a new range snapshot that includes a new hash table.
+    *
+    * @param table The hash table of the code cache to add.
+    * @return Returns true if successful, and false if the snapshot could not
+    * be allocated or the range overlaps a registered one.
+    */
+   bool publishRange(TR::MetaDataHashTable *table);
 
    TR::MethodMetaDataPOD *findMetaDataInHash(
       TR::MetaDataHashTable *table,
@@ -230,27 +278,17 @@ class OMR_EXTENSIBLE CodeMetaDataManager
       uintptr_t start,
       uintptr_t end);
 
-   J9AVLTree *allocateMetaDataAVL();
-
    // Singleton: Protected to allow manipulation of singleton pointer 
    // in test cases. 
    static TR::CodeMetaDataManager *_codeMetaDataManager;
 
-   J9AVLTree *_metaDataAVL;
-
-   private:
-
-   mutable uintptr_t _cachedPC;
-   mutable TR::MetaDataHashTable *_cachedHashTable;
-   mutable TR::MethodMetaDataPOD *_retrievedMetaDataCache;
-
+   MetaDataRangeTable * volatile _rangeTable;
 
    };
 
 
 struct OMR_EXTENSIBLE MetaDataHashTable
    {
-   J9AVLTreeNode parentAVLTreeNode;
    uintptr_t *buckets;
    uintptr_t start;
    uintptr_t end;
@@ -258,17 +296,10 @@ struct OMR_EXTENSIBLE MetaDataHashTable
    uintptr_t *methodStoreStart;
    uintptr_t *methodStoreEnd;
    uintptr_t *currentAllocate;
+   volatile uintptr_t modificationCount; // odd while the table is being modified
    };
 
 
-extern "C"
-{
-intptr_t avl_jit_metadata_insertionCompare(J9AVLTree *tree, TR::MetaDataHashTable *insertNode, TR::MetaDataHashTable *walkNode);
-
-intptr_t avl_jit_metadata_searchCompare(J9AVLTree *tree, uintptr_t searchValue, TR::MetaDataHashTable *walkNode);
-}
-
-
 }
 
 #endif
@@ -30,6 +30,7 @@
 #include "codegen/RegisterConstants.hpp"
 #include "codegen/Relocation.hpp"
 #include "codegen/ScratchRegisterManager.hpp"
+#include "codegen/StaticRelocation.hpp"
 #include "codegen/UnresolvedDataSnippet.hpp"
 #include "compile/Compilation.hpp"
 #include "control/Options.hpp"
@@ -39,6 +40,7 @@
 #include "env/TRMemory.hpp"
 #include "env/jittypes.h"
 #include "il/Node.hpp"
+#include "il/StaticSymbol.hpp"
 #include "il/Symbol.hpp"
 #include "il/SymbolReference.hpp"
 #include "infra/Assert.hpp"
@@ -156,6 +158,18 @@ OMR::X86::AMD64::MemoryReference::MemoryReference(TR::MemoryReference& mr, intpt
    self()->finishInitialization(cg, srm);
    }
 
+// When compiled code is to be moved, the address of a named static is loaded
+// as a 64-bit immediate, where a static relocation can find it
+//
+static bool
+needsStaticRelocation(TR::SymbolReference &sr, TR::CodeGenerator *cg)
+   {
+   return cg->comp()->getOption(TR_RecordStaticRelocations) &&
+          sr.getSymbol() != NULL &&
+          !sr.isUnresolved() &&
+          sr.getSymbol()->isNamed();
+   }
+
 void OMR::X86::AMD64::MemoryReference::finishInitialization(
       TR::CodeGenerator *cg,
       TR_ScratchRegisterManager *srm)
@@ -190,6 +204,12 @@ void OMR::X86::AMD64::MemoryReference::finishInitialization(
       {
       mightNeedAddressRegister = true;
       }
+   else if (!self()->getBaseRegister()  &&
+            !self()->getIndexRegister() &&
+            needsStaticRelocation(sr, cg))
+      {
+      mightNeedAddressRegister = true;
+      }
    else if (sr.getSymbol() != NULL && (sr.isUnresolved() || (sr.stackAllocatedArrayAccess() && !IS_32BIT_SIGNED(self()->getDisplacement()))))
       {
       // Once resolved, the address could be anything, so be conservative.
@@ -286,6 +306,8 @@ bool OMR::X86::AMD64::MemoryReference::needsAddressLoadInstruction(intptr_t next
       }
    else if (_baseRegister || _indexRegister)
       return !IS_32BIT_SIGNED(displacement);
+   else if (needsStaticRelocation(sr, cg))
+      return true;
    else if (cg->needClassAndMethodPointerRelocations())
       return true;
    else if (sr.getSymbol() && sr.getSymbol()->isRecompilationCounter() && cg->needRelocationsForBodyInfoData())
@@ -564,6 +586,15 @@ OMR::X86::AMD64::MemoryReference::addMetaDataForCodeAddressWithLoad(
                                                  counter);
             }
          }
+      else if (needsStaticRelocation(sr, cg))
+         {
+         cg->addStaticRelocation(
+            TR::StaticRelocation(
+               displacementLocation,
+               sr.getSymbol()->castToStaticSymbol()->getName(),
+               TR::StaticRelocationSize::word64,
+               TR::StaticRelocationType::Absolute));
+         }
       }
    else
       {
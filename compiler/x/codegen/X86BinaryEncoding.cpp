@@ -72,6 +72,20 @@
 class TR_OpaqueClassBlock;
 class TR_OpaqueMethodBlock;
 
+/**
+ * EVEX encodings scale an 8-bit displacement by the operand size, so a small
+ * displacement that is not a multiple of it needs a 32-bit field.  Memory
+ * reference estimates assume the legacy encoding; this returns the extra
+ * bytes an EVEX encoded instruction may need.
+ */
+static int32_t
+estimateEVEXDisplacementPadding(TR::Instruction *instr)
+   {
+   if ((instr->getOpCode().isEvexInstruction() && instr->getEncodingMethod() != OMR::X86::Legacy) || instr->getEncodingMethod() >= OMR::X86::EVEX_L128)
+      return 3;
+   return 0;
+   }
+
 int32_t memoryBarrierRequired(
       TR::InstOpCode &op,
       TR::MemoryReference *mr,
@@ -2259,7 +2273,7 @@ int32_t TR::X86MemInstruction::estimateBinaryLength(int32_t currentEstimate)
    if (getOpCode().needsLockPrefix() || (barrier & LockPrefix))
       length++;
 
-   length += getMemoryReference()->estimateBinaryLength(cg());
+   length += getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(self());
 
    if (barrier & NeedsExplicitBarrier)
       length += estimateMemoryBarrierBinaryLength(barrier, cg());
@@ -2445,7 +2459,7 @@ uint8_t TR::X86MemImmInstruction::getBinaryLengthLowerBound()
 
 int32_t TR::X86MemImmInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
-   int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+   int32_t length = getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(self());
 
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
@@ -2725,7 +2739,7 @@ uint8_t TR::X86MemRegImmInstruction::getBinaryLengthLowerBound()
 
 int32_t TR::X86MemRegImmInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
-   int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+   int32_t length = getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(self());
 
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
@@ -2795,7 +2809,7 @@ int32_t TR::X86RegMemInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
-   int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+   int32_t length = getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(self());
 
    if (barrier & LockPrefix)
       length++;
@@ -2948,7 +2962,7 @@ int32_t TR::X86RegMemImmInstruction::estimateBinaryLength(int32_t currentEstimat
    {
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
-   int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+   int32_t length = getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(self());
 
    if (barrier & LockPrefix)
       length++;
@@ -3411,7 +3425,7 @@ TR::AMD64RegImm64SymInstruction::addMetaDataForCodeAddress(uint8_t *cursor)
             }
          case TR_NativeMethodAbsolute:
             {
-            if (cg()->comp()->getOption(TR_EmitRelocatableELFFile))
+            if (cg()->comp()->getOption(TR_EmitRelocatableELFFile) || cg()->comp()->getOption(TR_RecordStaticRelocations))
                {
                TR_ResolvedMethod *target = getSymbolReference()->getSymbol()->castToResolvedMethodSymbol()->getResolvedMethod();
                cg()->addStaticRelocation(TR::StaticRelocation(cursor, target->externalName(cg()->trMemory()), TR::StaticRelocationSize::word64, TR::StaticRelocationType::Absolute));
@@ -119,6 +119,7 @@ static const PoolInputData poolParams[] = {
 	{"POOL_ALWAYS_KEEP_SORTED flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ALWAYS_KEEP_SORTED},
 	{"POOL_ROUND_TO_PAGE_SIZE flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ROUND_TO_PAGE_SIZE},
 	{"POOL_NEVER_FREE_PUDDLES flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_NEVER_FREE_PUDDLES},
+	{"POOL_CONCURRENT flag",								32,		10,		sizeof(uintptr_t),		0,		POOL_CONCURRENT},
 };
 
 static const uintptr_t data1[] = {1, 2, 3, 4, 5, 6, 7, 17, 18, 19, 20, 21, 22, 23, 24, 25};
@@ -187,6 +188,11 @@ TEST(OmrAlgoTest, PoolTestPuddleSharing)
 	ASSERT_EQ(0, testPoolPuddleListSharing(omrTestEnv->getPortLibrary()));
 }
 
+TEST(OmrAlgoTest, PoolTestMagazines)
+{
+	ASSERT_EQ(0, testPoolMagazines(omrTestEnv->getPortLibrary(), 8, 5000));
+}
+
 TEST(OmrAlgoTest, hookabletest)
 {
 	uintptr_t passCount = 0;
@@ -208,6 +214,8 @@ TEST_P(HashtableTest, Force)
 	HashtableInputData params = GetParam();
 	params.forceCollisions = TRUE;
 	params.collisionResistant = FALSE;
+	params.concurrent = FALSE;
+	params.openAddressing = FALSE;
 
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
 }
@@ -217,12 +225,80 @@ TEST_P(HashtableTest, NoForce)
 	HashtableInputData params = GetParam();
 	params.forceCollisions = FALSE;
 	params.collisionResistant = FALSE;
+	params.concurrent = FALSE;
+	params.openAddressing = FALSE;
 
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
 }
 
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, HashtableTest, ::testing::ValuesIn(hastableParams));
 
+class ConcurrentHashtableTest: public ::testing::TestWithParam<HashtableInputData>
+{
+};
+
+TEST_P(ConcurrentHashtableTest, Force)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+	params.collisionResistant = FALSE;
+	params.concurrent = TRUE;
+	params.openAddressing = FALSE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(ConcurrentHashtableTest, NoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+	params.collisionResistant = FALSE;
+	params.concurrent = TRUE;
+	params.openAddressing = FALSE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, ConcurrentHashtableTest, ::testing::ValuesIn(hastableParams));
+
+class OpenAddressingHashtableTest: public ::testing::TestWithParam<HashtableInputData>
+{
+};
+
+TEST_P(OpenAddressingHashtableTest, Force)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+	params.collisionResistant = FALSE;
+	params.concurrent = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(OpenAddressingHashtableTest, NoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+	params.collisionResistant = FALSE;
+	params.concurrent = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, OpenAddressingHashtableTest, ::testing::ValuesIn(hastableParams));
+
+TEST(OmrAlgoTest, OpenAddressingHashtableChurn)
+{
+	ASSERT_EQ(0, verifyOpenAddressingHashtable(omrTestEnv->getPortLibrary(), 20000));
+}
+
+TEST(OmrAlgoTest, ConcurrentHashtableStress)
+{
+	ASSERT_EQ(0, verifyConcurrentHashtable(omrTestEnv->getPortLibrary(), 8, 2000));
+}
+
 class CollisionResilientHashtableTest: public ::testing::TestWithParam< ::testing::tuple<HashtableInputData, uint32_t> >
 {
 };
@@ -232,6 +308,8 @@ TEST_P(CollisionResilientHashtableTest, Force)
 	HashtableInputData params = ::testing::get<0>(GetParam());
 	params.forceCollisions = TRUE;
 	params.collisionResistant = TRUE;
+	params.concurrent = FALSE;
+	params.openAddressing = FALSE;
 	params.listToTreeThreshold = ::testing::get<1>(GetParam());
 
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
@@ -242,6 +320,8 @@ TEST_P(CollisionResilientHashtableTest, NoForce)
 	HashtableInputData params = ::testing::get<0>(GetParam());
 	params.forceCollisions = FALSE;
 	params.collisionResistant = TRUE;
+	params.concurrent = FALSE;
+	params.openAddressing = FALSE;
 	params.listToTreeThreshold = ::testing::get<1>(GetParam());
 
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
@@ -50,6 +50,8 @@ typedef struct HashtableInputData {
 	uint32_t listToTreeThreshold;
 	BOOLEAN forceCollisions;
 	BOOLEAN collisionResistant;
+	BOOLEAN concurrent;
+	BOOLEAN openAddressing;
 } HashtableInputData;
 
 /* ---------------- avltest.c ---------------- */
@@ -82,6 +84,16 @@ createAndVerifyPool(OMRPortLibrary *portLib, PoolInputData *input);
 int32_t
 testPoolPuddleListSharing(OMRPortLibrary *portLib);
 
+/**
+* @brief Allocate and free elements of a POOL_CONCURRENT pool through per-thread magazines
+* @param *portLib
+* @param threadCount
+* @param iterations
+* @return int32_t
+*/
+int32_t
+testPoolMagazines(OMRPortLibrary *portLib, uint32_t threadCount, uint32_t iterations);
+
 /* ---------------- hooktest.c ---------------- */
 
 /**
@@ -110,6 +122,25 @@ verifyHashtable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCo
 int32_t
 buildAndVerifyHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData);
 
+/**
+* @brief Grow, shrink and refill a J9HASH_TABLE_OPEN_ADDRESSING table of pointer-like keys
+* @param *portLib
+* @param keyCount
+* @return int32_t
+*/
+int32_t
+verifyOpenAddressingHashtable(OMRPortLibrary *portLib, uint32_t keyCount);
+
+/**
+* @brief Add, find and remove entries of a J9HASH_TABLE_CONCURRENT table from several threads at once
+* @param *portLib
+* @param threadCount
+* @param keysPerThread
+* @return int32_t
+*/
+int32_t
+verifyConcurrentHashtable(OMRPortLibrary *portLib, uint32_t threadCount, uint32_t keysPerThread);
+
 #ifdef __cplusplus
 }
 #endif
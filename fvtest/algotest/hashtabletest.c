@@ -25,6 +25,8 @@
 #include "avl_api.h"
 #include "hashtable_api.h"
 #include "omrport.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
 /*
  * Testing the following functions of J9HashTable using the J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION flag:
  * 		hashTableAdd()
@@ -216,6 +218,12 @@ allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 				NULL,
 				userData);
 	} else {
+		if (TRUE == inputData->concurrent) {
+			flags |= J9HASH_TABLE_CONCURRENT;
+		}
+		if (TRUE == inputData->openAddressing) {
+			flags |= J9HASH_TABLE_OPEN_ADDRESSING;
+		}
 		hashtable = hashTableNew(portLib,
 				tableName,
 				tableSize,
@@ -259,3 +267,256 @@ fail:
 	hashTableFree(table);
 	return result;
 }
+
+/* Key values look like 16 byte aligned addresses, which leave the low bits of the hash unused */
+#define OPEN_ADDRESSING_KEY(i) (((uintptr_t)(i) + 1) << 4)
+
+static uintptr_t
+removeEveryThirdKey(void *entry, void *userData)
+{
+	return 0 == (((*(uintptr_t *)entry) >> 4) % 3);
+}
+
+int32_t
+verifyOpenAddressingHashtable(OMRPortLibrary *portLib, uint32_t keyCount)
+{
+	J9HashTable *table = NULL;
+	uint32_t round = 0;
+	uint32_t i = 0;
+	int32_t result = 0;
+
+	table = hashTableNew(portLib, "openAddressingHashtableTest", 0, sizeof(uintptr_t), sizeof(uintptr_t),
+			J9HASH_TABLE_OPEN_ADDRESSING, OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, (void *)(uintptr_t)FALSE);
+	if (NULL == table) {
+		return -1;
+	}
+
+	/* refilling after removals reuses deleted slots and forces tombstone purges as well as growth */
+	for (round = 0; round < 3; round++) {
+		uint32_t expected = 0;
+		uint32_t walked = 0;
+		J9HashTableState walkState;
+		uintptr_t *node = NULL;
+
+		for (i = 0; i < keyCount; i++) {
+			uintptr_t key = OPEN_ADDRESSING_KEY(i);
+
+			node = hashTableAdd(table, &key);
+			if ((NULL == node) || (*node != key)) {
+				result = -2;
+				goto done;
+			}
+		}
+		if (hashTableGetCount(table) != keyCount) {
+			result = -3;
+			goto done;
+		}
+
+		hashTableForEachDo(table, removeEveryThirdKey, NULL);
+		for (i = 0; i < keyCount; i++) {
+			uintptr_t key = OPEN_ADDRESSING_KEY(i);
+			BOOLEAN present = (0 != (((uintptr_t)i + 1) % 3));
+
+			node = hashTableFind(table, &key);
+			if (present != (NULL != node)) {
+				result = -4;
+				goto done;
+			}
+			if (present) {
+				expected += 1;
+			}
+		}
+		if (hashTableGetCount(table) != expected) {
+			result = -5;
+			goto done;
+		}
+
+		/* rehashing places the entries again without new arrays, dropping the tombstones */
+		hashTableRehash(table);
+		for (i = 0; i < keyCount; i++) {
+			uintptr_t key = OPEN_ADDRESSING_KEY(i);
+			BOOLEAN present = (0 != (((uintptr_t)i + 1) % 3));
+
+			if (present != (NULL != hashTableFind(table, &key))) {
+				result = -11;
+				goto done;
+			}
+		}
+		if (0 != table->numberOfDeletedSlots) {
+			result = -12;
+			goto done;
+		}
+		node = hashTableStartDo(table, &walkState);
+		while (NULL != node) {
+			walked += 1;
+			if (0 == (walked & 1)) {
+				if (0 != hashTableDoRemove(&walkState)) {
+					result = -6;
+					goto done;
+				}
+				expected -= 1;
+			}
+			node = hashTableNextDo(&walkState);
+		}
+		if (hashTableGetCount(table) != expected) {
+			result = -7;
+			goto done;
+		}
+
+		for (i = 0; i < keyCount; i++) {
+			uintptr_t key = OPEN_ADDRESSING_KEY(i);
+
+			if (NULL != hashTableFind(table, &key)) {
+				if (0 != hashTableRemove(table, &key)) {
+					result = -8;
+					goto done;
+				}
+			} else if (0 == hashTableRemove(table, &key)) {
+				result = -9;
+				goto done;
+			}
+		}
+		if (0 != hashTableGetCount(table)) {
+			result = -10;
+			goto done;
+		}
+	}
+
+done:
+	hashTableFree(table);
+	return result;
+}
+
+typedef struct ConcurrentHashtableThreadData {
+	J9HashTable *table;
+	uint32_t threadIndex;
+	uint32_t threadCount;
+	uint32_t keysPerThread;
+	volatile uintptr_t *failures;
+} ConcurrentHashtableThreadData;
+
+/*
+ * Each thread owns the keys congruent to its index modulo threadCount. It adds, finds and removes
+ * its own keys, which must always behave as in a single threaded table, while probing keys owned
+ * by other threads, which may or may not be present but must never be returned for the wrong key.
+ * Every thread finishes with the even numbered half of its keys in the table.
+ */
+static int J9THREAD_PROC
+concurrentHashtableThread(void *arg)
+{
+	ConcurrentHashtableThreadData *data = (ConcurrentHashtableThreadData *)arg;
+	uint32_t round = 0;
+	uint32_t i = 0;
+	uintptr_t failures = 0;
+	uint32_t totalKeys = data->threadCount * data->keysPerThread;
+
+	for (round = 0; round < 4; round++) {
+		for (i = 0; i < data->keysPerThread; i++) {
+			uintptr_t key = data->threadIndex + (i * data->threadCount);
+			uintptr_t other = (key * 7 + round) % totalKeys;
+			uintptr_t *node = hashTableAdd(data->table, &key);
+
+			if ((NULL == node) || (*node != key)) {
+				failures += 1;
+			}
+			node = hashTableFind(data->table, &other);
+			if ((NULL != node) && (*node != other)) {
+				failures += 1;
+			}
+		}
+		for (i = 0; i < data->keysPerThread; i++) {
+			uintptr_t key = data->threadIndex + (i * data->threadCount);
+			uintptr_t *node = hashTableFind(data->table, &key);
+
+			if ((NULL == node) || (*node != key)) {
+				failures += 1;
+			}
+			if ((round == 3) && (0 == (i & 1))) {
+				continue;
+			}
+			if (0 != hashTableRemove(data->table, &key)) {
+				failures += 1;
+			}
+			if (NULL != hashTableFind(data->table, &key)) {
+				failures += 1;
+			}
+		}
+	}
+
+	addAtomic((volatile uintptr_t *)data->failures, failures);
+	return 0;
+}
+
+int32_t
+verifyConcurrentHashtable(OMRPortLibrary *portLib, uint32_t threadCount, uint32_t keysPerThread)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9HashTable *table = NULL;
+	ConcurrentHashtableThreadData *threadData = NULL;
+	omrthread_t *threads = NULL;
+	omrthread_attr_t attr = NULL;
+	volatile uintptr_t failures = 0;
+	uint32_t started = 0;
+	uint32_t i = 0;
+	int32_t result = 0;
+
+	table = hashTableNew(portLib, "concurrentHashtableTest", 1, sizeof(uintptr_t), sizeof(char *),
+			J9HASH_TABLE_CONCURRENT, OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, (void *)(uintptr_t)FALSE);
+	threadData = omrmem_allocate_memory(sizeof(ConcurrentHashtableThreadData) * threadCount, OMRMEM_CATEGORY_VM);
+	threads = omrmem_allocate_memory(sizeof(omrthread_t) * threadCount, OMRMEM_CATEGORY_VM);
+	if ((NULL == table) || (NULL == threadData) || (NULL == threads)) {
+		result = -1;
+		goto done;
+	}
+	if ((0 != omrthread_attr_init(&attr)) || (0 != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))) {
+		result = -2;
+		goto done;
+	}
+
+	for (started = 0; started < threadCount; started++) {
+		threadData[started].table = table;
+		threadData[started].threadIndex = started;
+		threadData[started].threadCount = threadCount;
+		threadData[started].keysPerThread = keysPerThread;
+		threadData[started].failures = &failures;
+		if (0 != omrthread_create_ex(&threads[started], &attr, 0, concurrentHashtableThread, &threadData[started])) {
+			result = -3;
+			break;
+		}
+	}
+	for (i = 0; i < started; i++) {
+		omrthread_join(threads[i]);
+	}
+	omrthread_attr_destroy(&attr);
+	if (0 != result) {
+		goto done;
+	}
+
+	if (0 != failures) {
+		result = -4;
+		goto done;
+	}
+	if (hashTableGetCount(table) != (threadCount * ((keysPerThread + 1) / 2))) {
+		result = -5;
+		goto done;
+	}
+	/* all threads have been joined, so nothing can still be walking the retired nodes */
+	hashTableReclaimRetired(table);
+	for (i = 0; i < (threadCount * keysPerThread); i++) {
+		uintptr_t key = i;
+		BOOLEAN expected = (0 == ((i / threadCount) & 1));
+
+		if (expected != (NULL != hashTableFind(table, &key))) {
+			result = -6;
+			break;
+		}
+	}
+
+done:
+	if (NULL != table) {
+		hashTableFree(table);
+	}
+	omrmem_free_memory(threads);
+	omrmem_free_memory(threadData);
+	return result;
+}
@@ -21,7 +21,9 @@
 
 #include <string.h>
 #include "omrport.h"
+#include "omrthread.h"
 #include "omrutil.h"
+#include "omrutilbase.h"
 #include "pool_api.h"
 #include "algorithm_test_internal.h"
 
@@ -401,3 +403,145 @@ error:
 
 	return result;
 }
+
+#define MAGAZINE_TEST_LIVE_ELEMENTS 64
+
+typedef struct PoolMagazineThreadData {
+	J9Pool *pool;
+	uintptr_t threadIndex;
+	uint32_t iterations;
+	volatile uintptr_t *failures;
+	void *kept[MAGAZINE_TEST_LIVE_ELEMENTS];
+} PoolMagazineThreadData;
+
+/*
+ * Each thread keeps a window of live elements stamped with its index, replacing them in turn
+ * through its own magazine while also using the locked pool_newElement()/pool_removeElement()
+ * path. A stamp that changes means two threads were handed the same element. The last
+ * MAGAZINE_TEST_LIVE_ELEMENTS elements stay allocated for the caller to walk.
+ */
+static int J9THREAD_PROC
+poolMagazineThread(void *arg)
+{
+	PoolMagazineThreadData *data = (PoolMagazineThreadData *)arg;
+	J9PoolMagazine magazine;
+	uintptr_t failures = 0;
+	uint32_t i = 0;
+
+	pool_initMagazine(data->pool, &magazine);
+	memset(data->kept, 0, sizeof(data->kept));
+	for (i = 0; i < data->iterations; i++) {
+		uint32_t index = i % MAGAZINE_TEST_LIVE_ELEMENTS;
+		uintptr_t *element = NULL;
+
+		if (NULL != data->kept[index]) {
+			if (*(uintptr_t *)data->kept[index] != data->threadIndex) {
+				failures += 1;
+			}
+			if (0 == (i & 7)) {
+				pool_removeElement(data->pool, data->kept[index]);
+			} else {
+				pool_removeElementCached(data->pool, &magazine, data->kept[index]);
+			}
+		}
+		element = (0 == (i & 3)) ? pool_newElement(data->pool) : pool_newElementCached(data->pool, &magazine);
+		if ((NULL == element) || (0 != *element)) {
+			failures += 1;
+			data->kept[index] = NULL;
+		} else {
+			*element = data->threadIndex;
+			data->kept[index] = element;
+		}
+	}
+	pool_flushMagazine(data->pool, &magazine);
+
+	addAtomic((volatile uintptr_t *)data->failures, failures);
+	return 0;
+}
+
+int32_t
+testPoolMagazines(OMRPortLibrary *portLib, uint32_t threadCount, uint32_t iterations)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9Pool *pool = NULL;
+	PoolMagazineThreadData *threadData = NULL;
+	omrthread_t *threads = NULL;
+	omrthread_attr_t attr = NULL;
+	volatile uintptr_t failures = 0;
+	uintptr_t walked = 0;
+	uint32_t started = 0;
+	uint32_t i = 0;
+	pool_state state;
+	uintptr_t *element = NULL;
+	int32_t result = 0;
+
+	pool = pool_new(sizeof(uintptr_t) * 2, 16, 0, POOL_CONCURRENT, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+	threadData = omrmem_allocate_memory(sizeof(PoolMagazineThreadData) * threadCount, OMRMEM_CATEGORY_VM);
+	threads = omrmem_allocate_memory(sizeof(omrthread_t) * threadCount, OMRMEM_CATEGORY_VM);
+	if ((NULL == pool) || (NULL == threadData) || (NULL == threads)) {
+		result = -1;
+		goto done;
+	}
+	if ((0 != omrthread_attr_init(&attr)) || (0 != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))) {
+		result = -2;
+		goto done;
+	}
+
+	for (started = 0; started < threadCount; started++) {
+		/* thread indices start at 1 so that a zeroed element is never mistaken for a stamped one */
+		threadData[started].pool = pool;
+		threadData[started].threadIndex = started + 1;
+		threadData[started].iterations = iterations;
+		threadData[started].failures = &failures;
+		if (0 != omrthread_create_ex(&threads[started], &attr, 0, poolMagazineThread, &threadData[started])) {
+			result = -3;
+			break;
+		}
+	}
+	for (i = 0; i < started; i++) {
+		omrthread_join(threads[i]);
+	}
+	omrthread_attr_destroy(&attr);
+	if (0 != result) {
+		goto done;
+	}
+
+	if (0 != failures) {
+		result = -4;
+		goto done;
+	}
+	/* flushed magazine slots must not be reported as live elements */
+	if (pool_numElements(pool) != (uintptr_t)threadCount * MAGAZINE_TEST_LIVE_ELEMENTS) {
+		result = -5;
+		goto done;
+	}
+	element = pool_startDo(pool, &state);
+	while (NULL != element) {
+		if ((*element < 1) || (*element > threadCount)) {
+			result = -6;
+			goto done;
+		}
+		walked += 1;
+		element = pool_nextDo(&state);
+	}
+	if (walked != pool_numElements(pool)) {
+		result = -7;
+		goto done;
+	}
+	for (i = 0; i < threadCount; i++) {
+		uint32_t j = 0;
+
+		for (j = 0; j < MAGAZINE_TEST_LIVE_ELEMENTS; j++) {
+			if (!pool_includesElement(pool, threadData[i].kept[j])) {
+				result = -8;
+				goto done;
+			}
+		}
+	}
+
+done:
+	pool_kill(pool);
+	omrmem_free_memory(threads);
+	omrmem_free_memory(threadData);
+	return result;
+}
@@ -33,6 +33,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/infra/BitVector.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/Checklist.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/HashTab.cpp \
+    $(JIT_OMR_DIRTY_DIR)/infra/HybridBitVector.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/STLUtils.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/IGBase.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/IGNode.cpp \
@@ -140,6 +141,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopCanonicalizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopReducer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopReplicator.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/LoopVectorizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopVersioner.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRLocalCSE.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LocalDeadStoreElimination.cpp \
@@ -148,6 +150,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMROptimizationManager.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRTransformUtil.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMROptimizer.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/OptimizerBudget.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OrderBlocks.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OSRDefAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/PartialRedundancy.cpp \
@@ -171,6 +174,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/VirtualGuardHeadMerger.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/RegDepCopyRemoval.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/ReorderIndexExpr.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/SLPVectorizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/SinkStores.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/StripMiner.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/VPConstraint.cpp \
@@ -277,6 +281,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheManager.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheMemorySegment.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheConfig.cpp \
+    $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeMetaDataManager.cpp \
     $(JIT_PRODUCT_DIR)/compile/ResolvedMethod.cpp \
     $(JIT_PRODUCT_DIR)/control/TestJit.cpp \
     $(JIT_PRODUCT_DIR)/env/FrontEnd.cpp \
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+
+#include <string>
+#include <tuple>
+
+/**
+ * Runs optimizations that keep the use/def and value number info up to date
+ * back to back, so that each one after the first works on info that was
+ * maintained rather than rebuilt. The info is checked against a rebuilt copy
+ * after each of them.
+ */
+class IncrementalUseDefTest : public TRTest::JitOptTest
+   {
+   public:
+   IncrementalUseDefTest() :
+      TRTest::JitOptTest("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,paranoidoptcheck,verifyIncrementalUseDefs")
+      {
+      addOptimization(OMR::globalCopyPropagation);
+      addOptimization(OMR::localCSE);
+      addOptimization(OMR::deadTreesElimination);
+      addOptimization(OMR::globalCopyPropagation);
+      addOptimization(OMR::globalDeadStoreElimination);
+      }
+   };
+
+class ParameterizedIncrementalUseDefTest : public IncrementalUseDefTest, public ::testing::WithParamInterface<std::tuple<int32_t, int32_t> > {};
+
+/*
+ * x = a; y = x; z = (y > b) ? y - b : y + y; return z + x * y;
+ */
+static const char *copiesAcrossBlocksTrees =
+   "(method return=Int32 args=[Int32, Int32]"
+   "  (block"
+   "    (istore temp=\"x\" (iload parm=0))"
+   "    (istore temp=\"y\" (iload temp=\"x\"))"
+   "    (ificmpgt target=\"big\" (iload temp=\"y\") (iload parm=1)))"
+   "  (block"
+   "    (istore temp=\"z\" (iadd (iload temp=\"y\") (iload temp=\"y\")))"
+   "    (goto target=\"join\"))"
+   "  (block name=\"big\""
+   "    (istore temp=\"z\" (isub (iload temp=\"y\") (iload parm=1))))"
+   "  (block name=\"join\""
+   "    (ireturn (iadd (iload temp=\"z\") (imul (iload temp=\"x\") (iload temp=\"y\"))))))";
+
+TEST_P(ParameterizedIncrementalUseDefTest, CopiesAcrossBlocks) {
+    int32_t a = std::get<0>(GetParam());
+    int32_t b = std::get<1>(GetParam());
+
+    auto trees = parseString(copiesAcrossBlocksTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << copiesAcrossBlocksTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t, int32_t)>();
+
+    int32_t z = (a > b) ? a - b : a + a;
+    EXPECT_EQ(z + a * a, entry_point(a, b));
+}
+
+/*
+ * x = a + b; y = x; if (y < 0) x = 0; return x + y + (a + b);
+ */
+static const char *redefinedCopyTrees =
+   "(method return=Int32 args=[Int32, Int32]"
+   "  (block"
+   "    (istore temp=\"x\" (iadd (iload parm=0) (iload parm=1)))"
+   "    (istore temp=\"y\" (iload temp=\"x\"))"
+   "    (ificmpge target=\"join\" (iload temp=\"y\") (iconst 0)))"
+   "  (block"
+   "    (istore temp=\"x\" (iconst 0)))"
+   "  (block name=\"join\""
+   "    (ireturn (iadd (iadd (iload temp=\"x\") (iload temp=\"y\")) (iadd (iload parm=0) (iload parm=1))))))";
+
+TEST_P(ParameterizedIncrementalUseDefTest, RedefinedCopy) {
+    int32_t a = std::get<0>(GetParam());
+    int32_t b = std::get<1>(GetParam());
+
+    auto trees = parseString(redefinedCopyTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << redefinedCopyTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t, int32_t)>();
+
+    int32_t x = a + b;
+    int32_t y = x;
+    if (y < 0)
+        x = 0;
+    EXPECT_EQ(x + y + (a + b), entry_point(a, b));
+}
+
+INSTANTIATE_TEST_CASE_P(IncrementalUseDefTest, ParameterizedIncrementalUseDefTest, ::testing::Values(
+    std::make_tuple(3, 5),
+    std::make_tuple(5, 3),
+    std::make_tuple(-7, 2),
+    std::make_tuple(0, 0)));
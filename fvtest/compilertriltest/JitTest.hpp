@@ -138,9 +138,17 @@ class JitTest : public TestWithPortLib
    {
    public:
 
-   JitTest()
+   JitTest() :
+      JitTest("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,paranoidoptcheck")
       {
-      auto initSuccess = initializeJitWithOptions((char*)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,paranoidoptcheck");
+      }
+
+   /**
+    * @param options The JIT options to initialize the JIT with, replacing the defaults.
+    */
+   explicit JitTest(const char *options)
+      {
+      auto initSuccess = initializeJitWithOptions(const_cast<char *>(options));
       if (!initSuccess)
          throw std::runtime_error("Failed to initialize jit");
       }
@@ -167,6 +175,11 @@ class JitOptTest : public JitTest
       {
       }
 
+   explicit JitOptTest(const char *options) :
+      JitTest(options), _optimizations(), _strategy(NULL)
+      {
+      }
+
    virtual void SetUp()
       {
       JitTest::SetUp();
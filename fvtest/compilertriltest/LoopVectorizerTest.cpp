@@ -0,0 +1,339 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "codegen/CodeGenerator.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+/**
+ * Records whether the optimized trees contain any vector operation.
+ */
+class VectorOpcodeVerifier : public TR::IlVerifier
+   {
+   public:
+   VectorOpcodeVerifier() : _hasVectorOpcodes(false) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         if (iter.currentNode()->getOpCode().isVectorOpCode())
+            _hasVectorOpcodes = true;
+         }
+      return 0;
+      }
+
+   bool hasVectorOpcodes() { return _hasVectorOpcodes; }
+
+   private:
+   bool _hasVectorOpcodes;
+   };
+
+/**
+ * Runs the loop vectorizer together with the analyses it depends on.
+ */
+class LoopVectorizerTest : public TRTest::JitOptTest
+   {
+   public:
+   LoopVectorizerTest()
+      {
+      addOptimization(OMR::loopCanonicalization);
+      addOptimization(OMR::inductionVariableAnalysis);
+      addOptimization(OMR::loopVectorizer);
+      }
+
+   /**
+    * Whether the target can execute 128-bit vectors of \p elementType for
+    * the loads and stores of a loop and its \p scalarOp.
+    */
+   bool platformSupports(TR::DataTypes elementType, TR::ILOpCodes scalarOp)
+      {
+      TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+      TR::DataType vectorType = TR::DataType::createVectorType(elementType, TR::VectorLength128);
+      TR::ILOpCode vectorOp = TR::ILOpCode::convertScalarToVector(scalarOp, TR::VectorLength128);
+      return TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType))
+         && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType))
+         && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, vectorOp);
+      }
+   };
+
+class ParameterizedLoopVectorizerTest : public LoopVectorizerTest, public ::testing::WithParamInterface<int32_t> {};
+
+/*
+ * for (i = 0; i < n; i++) c[i] = a[i] + b[i];
+ */
+static const char *addArraysTrees =
+   "(method return=NoType args=[Address, Address, Address, Int32]"
+   "  (block"
+   "    (istore temp=\"i\" (iconst 0))"
+   "    (ificmple target=\"exit\" (iload parm=3) (iconst 0)))"
+   "  (block name=\"loop\""
+   "    (istorei"
+   "      (aladd (aload parm=2) (lmul (i2l (iload temp=\"i\")) (lconst 4)))"
+   "      (iadd"
+   "        (iloadi (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 4))))"
+   "        (iloadi (aladd (aload parm=1) (lmul (i2l (iload temp=\"i\")) (lconst 4))))))"
+   "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))"
+   "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=3)))"
+   "  (block name=\"exit\""
+   "    (return)))";
+
+typedef void (*AddArraysFunction)(int32_t *, int32_t *, int32_t *, int32_t);
+
+TEST_P(ParameterizedLoopVectorizerTest, AddInt32Arrays) {
+    int32_t n = GetParam();
+
+    auto trees = parseString(addArraysTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorOpcodeVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << addArraysTrees;
+    if (platformSupports(TR::Int32, TR::iadd))
+        EXPECT_TRUE(verifier.hasVectorOpcodes()) << "Loop was not vectorized";
+
+    auto entry_point = compiler.getEntryPoint<AddArraysFunction>();
+
+    // One sentinel element past the end checks that the vector loop does not
+    // write beyond the trip count.
+    std::vector<int32_t> a(n + 1), b(n + 1), c(n + 1, -1);
+    for (int32_t i = 0; i < n; i++)
+        {
+        a[i] = i;
+        b[i] = 3 * i - 7;
+        }
+
+    entry_point(&a[0], &b[0], &c[0], n);
+
+    for (int32_t i = 0; i < n; i++)
+        ASSERT_EQ(4 * i - 7, c[i]) << "Wrong result at index " << i << " of " << n;
+    EXPECT_EQ(-1, c[n]);
+}
+
+TEST_P(ParameterizedLoopVectorizerTest, AddOverlappingInt32Arrays) {
+    int32_t n = GetParam();
+
+    auto trees = parseString(addArraysTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << addArraysTrees;
+    auto entry_point = compiler.getEntryPoint<AddArraysFunction>();
+
+    // c[i] = c[i - 1] + c[i - 1] carries a dependence from each iteration to
+    // the next, which the vector loop must not break.
+    std::vector<int32_t> shifted(n + 1, 1);
+    entry_point(&shifted[0], &shifted[0], &shifted[1], n);
+    uint32_t expected = 1;
+    for (int32_t i = 0; i <= n; i++, expected *= 2)
+        ASSERT_EQ(static_cast<int32_t>(expected), shifted[i]) << "Wrong result at index " << i << " of " << n;
+
+    // Updating an array in place has no dependence between iterations
+    std::vector<int32_t> inPlace(n);
+    for (int32_t i = 0; i < n; i++)
+        inPlace[i] = i;
+    if (n > 0)
+        entry_point(&inPlace[0], &inPlace[0], &inPlace[0], n);
+    for (int32_t i = 0; i < n; i++)
+        ASSERT_EQ(2 * i, inPlace[i]) << "Wrong result at index " << i << " of " << n;
+}
+
+/*
+ * for (i = 0; i < n; i++) y[i] = a * x[i] + y[i];
+ */
+static const char *daxpyTrees =
+   "(method return=NoType args=[Double, Address, Address, Int32]"
+   "  (block"
+   "    (istore temp=\"i\" (iconst 0))"
+   "    (ificmple target=\"exit\" (iload parm=3) (iconst 0)))"
+   "  (block name=\"loop\""
+   "    (dstorei"
+   "      (aladd (aload parm=2) (lmul (i2l (iload temp=\"i\")) (lconst 8)))"
+   "      (dadd"
+   "        (dmul"
+   "          (dload parm=0)"
+   "          (dloadi (aladd (aload parm=1) (lmul (i2l (iload temp=\"i\")) (lconst 8)))))"
+   "        (dloadi (aladd (aload parm=2) (lmul (i2l (iload temp=\"i\")) (lconst 8))))))"
+   "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))"
+   "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=3)))"
+   "  (block name=\"exit\""
+   "    (return)))";
+
+TEST_P(ParameterizedLoopVectorizerTest, Daxpy) {
+    int32_t n = GetParam();
+
+    auto trees = parseString(daxpyTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorOpcodeVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << daxpyTrees;
+    if (platformSupports(TR::Double, TR::dmul) && platformSupports(TR::Double, TR::dadd))
+        EXPECT_TRUE(verifier.hasVectorOpcodes()) << "Loop was not vectorized";
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double, double *, double *, int32_t)>();
+
+    std::vector<double> x(n + 1), y(n + 1, -1.0);
+    for (int32_t i = 0; i < n; i++)
+        {
+        x[i] = i * 0.5;
+        y[i] = i;
+        }
+
+    entry_point(2.0, &x[0], &y[0], n);
+
+    for (int32_t i = 0; i < n; i++)
+        ASSERT_EQ(2.0 * i, y[i]) << "Wrong result at index " << i << " of " << n;
+    EXPECT_EQ(-1.0, y[n]);
+}
+
+/*
+ * s = 0; for (i = 0; i < n; i++) s = s + a[i] * b[i]; return s;
+ */
+static const char *dotProductTrees =
+   "(method return=Int32 args=[Address, Address, Int32]"
+   "  (block"
+   "    (istore temp=\"s\" (iconst 0))"
+   "    (istore temp=\"i\" (iconst 0))"
+   "    (ificmple target=\"exit\" (iload parm=2) (iconst 0)))"
+   "  (block name=\"loop\""
+   "    (istore temp=\"s\""
+   "      (iadd"
+   "        (iload temp=\"s\")"
+   "        (imul"
+   "          (iloadi (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 4))))"
+   "          (iloadi (aladd (aload parm=1) (lmul (i2l (iload temp=\"i\")) (lconst 4)))))))"
+   "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))"
+   "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=2)))"
+   "  (block name=\"exit\""
+   "    (ireturn (iload temp=\"s\"))))";
+
+TEST_P(ParameterizedLoopVectorizerTest, Int32DotProduct) {
+    int32_t n = GetParam();
+
+    auto trees = parseString(dotProductTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << dotProductTrees;
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *, int32_t *, int32_t)>();
+
+    std::vector<int32_t> a(n + 1), b(n + 1);
+    int32_t expected = 0;
+    for (int32_t i = 0; i < n; i++)
+        {
+        a[i] = i - 50;
+        b[i] = 2 * i + 1;
+        expected += a[i] * b[i];
+        }
+
+    EXPECT_EQ(expected, entry_point(&a[0], &b[0], n));
+}
+
+INSTANTIATE_TEST_CASE_P(LoopVectorizerTest, ParameterizedLoopVectorizerTest,
+    ::testing::Values(0, 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 1001));
+
+/*
+ * The loop stores to a[i + 1], which does not match the a[iv] access pattern
+ * the vectorizer handles; the loop must be left scalar.
+ */
+TEST_F(LoopVectorizerTest, UnsupportedAccessIsNotVectorized) {
+    auto *inputTrees =
+       "(method return=NoType args=[Address, Int32]"
+       "  (block"
+       "    (istore temp=\"i\" (iconst 0))"
+       "    (ificmple target=\"exit\" (iload parm=1) (iconst 0)))"
+       "  (block name=\"loop\""
+       "    (istorei"
+       "      (aladd (aload parm=0) (lmul (i2l (iadd (iload temp=\"i\") (iconst 1))) (lconst 4)))"
+       "      (iloadi (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 4)))))"
+       "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))"
+       "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=1)))"
+       "  (block name=\"exit\""
+       "    (return)))";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorOpcodeVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+    EXPECT_FALSE(verifier.hasVectorOpcodes());
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int32_t *, int32_t)>();
+    std::vector<int32_t> a(65, 0);
+    a[0] = 42;
+    entry_point(&a[0], 64);
+    for (int32_t i = 0; i < 65; i++)
+        ASSERT_EQ(42, a[i]) << "Wrong result at index " << i;
+}
+
+/*
+ * Compare the time taken by the scalar and the vectorized versions of the
+ * array addition loop.
+ */
+TEST_F(LoopVectorizerTest, AddInt32ArraysPerformance) {
+    SKIP_IF(!platformSupports(TR::Int32, TR::iadd), MissingImplementation) << "Int32 vectors are not supported by the target platform";
+
+    static const OptimizationStrategy scalarOpts[] =
+       {
+       { OMR::loopCanonicalization, OMR::MustBeDone },
+       { OMR::inductionVariableAnalysis, OMR::MustBeDone },
+       { OMR::endOpts }
+       };
+
+    auto trees = parseString(addArraysTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler vectorCompiler(trees);
+    ASSERT_EQ(0, vectorCompiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << addArraysTrees;
+
+    // TearDown restores the default strategy
+    TR::Optimizer::setMockStrategy(scalarOpts);
+    Tril::DefaultCompiler scalarCompiler(trees);
+    ASSERT_EQ(0, scalarCompiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << addArraysTrees;
+
+    const int32_t n = 4096;
+    const int32_t repetitions = 2000;
+    std::vector<int32_t> a(n, 1), b(n, 2), c(n);
+
+    AddArraysFunction functions[] = { scalarCompiler.getEntryPoint<AddArraysFunction>(), vectorCompiler.getEntryPoint<AddArraysFunction>() };
+    int64_t elapsed[2];
+    for (int32_t f = 0; f < 2; f++)
+        {
+        auto start = std::chrono::steady_clock::now();
+        for (int32_t r = 0; r < repetitions; r++)
+            functions[f](&a[0], &b[0], &c[0], n);
+        elapsed[f] = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(3, c[n - 1]);
+        }
+
+    std::printf("%d additions of %d ints: %lld us scalar, %lld us vectorized\n",
+        repetitions, n, (long long)elapsed[0], (long long)elapsed[1]);
+}
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "compile/Compilation.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "ras/IlVerifier.hpp"
+
+#include <stdexcept>
+
+/**
+ * Records how many times the optimizations of interest ran.
+ */
+class OptimizationRunsVerifier : public TR::IlVerifier
+   {
+   public:
+   OptimizationRunsVerifier() : _unrollerRuns(0), _globalVPRuns(0), _localVPRuns(0) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      const TR::OptimizerBudget &budget = sym->comp()->getOptimizer()->getBudget();
+      _unrollerRuns = budget.getNumRuns(OMR::generalLoopUnroller);
+      _globalVPRuns = budget.getNumRuns(OMR::globalValuePropagation);
+      _localVPRuns = budget.getNumRuns(OMR::localValuePropagation);
+      return 0;
+      }
+
+   uint32_t _unrollerRuns;
+   uint32_t _globalVPRuns;
+   uint32_t _localVPRuns;
+   };
+
+static const OptimizationStrategy budgetedStrategy[] =
+   {
+   { OMR::veryExpensiveGlobalValuePropagationGroup },
+   { OMR::generalLoopUnroller },
+   { OMR::globalValuePropagation },
+   { OMR::endOpts }
+   };
+
+/**
+ * Compiles with budgetedStrategy and the given JIT options.
+ */
+class OptimizerBudgetTest : public TRTest::TestWithPortLib
+   {
+   public:
+   OptimizerBudgetTest(const char *options)
+      {
+      if (!initializeJitWithOptions(const_cast<char *>(options)))
+         throw std::runtime_error("Failed to initialize jit");
+      TR::Optimizer::setMockStrategy(budgetedStrategy);
+      }
+
+   ~OptimizerBudgetTest()
+      {
+      TR::Optimizer::setMockStrategy(NULL);
+      shutdownJit();
+      }
+   };
+
+class WithinBudgetTest : public OptimizerBudgetTest
+   {
+   public:
+   WithinBudgetTest() : OptimizerBudgetTest("-Xjit:acceptHugeMethods,useILValidator") {}
+   };
+
+class OverBudgetTest : public OptimizerBudgetTest
+   {
+   public:
+   OverBudgetTest() : OptimizerBudgetTest("-Xjit:acceptHugeMethods,useILValidator,optimizerNodeBudget=1") {}
+   };
+
+/*
+ * for (i = 0; i < n; i++) sum += i;
+ */
+static const char *sumTrees =
+   "(method return=Int32 args=[Int32]"
+   "  (block"
+   "    (istore temp=\"sum\" (iconst 0))"
+   "    (istore temp=\"i\" (iconst 0))"
+   "    (ificmple target=\"exit\" (iload parm=0) (iconst 0)))"
+   "  (block name=\"loop\""
+   "    (istore temp=\"sum\" (iadd (iload temp=\"sum\") (iload temp=\"i\")))"
+   "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))"
+   "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=0)))"
+   "  (block name=\"exit\""
+   "    (ireturn (iload temp=\"sum\"))))";
+
+TEST_F(WithinBudgetTest, RunsEveryOptimization) {
+    auto trees = parseString(sumTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    OptimizationRunsVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << sumTrees;
+
+    EXPECT_EQ(1, verifier._unrollerRuns);
+    EXPECT_EQ(2, verifier._globalVPRuns);
+    EXPECT_EQ(0, verifier._localVPRuns);
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(45, entry_point(10));
+}
+
+TEST_F(OverBudgetTest, SkipsAndDowngradesExpensiveOptimizations) {
+    auto trees = parseString(sumTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    OptimizationRunsVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << sumTrees;
+
+    // The loop unroller is skipped. The expensive GVP group runs the very
+    // cheap one, whose GVP is not downgraded again, and GVP on its own is
+    // replaced with local VP.
+    EXPECT_EQ(0, verifier._unrollerRuns);
+    EXPECT_EQ(1, verifier._globalVPRuns);
+    EXPECT_EQ(1, verifier._localVPRuns);
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(45, entry_point(10));
+}
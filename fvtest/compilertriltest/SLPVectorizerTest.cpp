@@ -0,0 +1,229 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "codegen/CodeGenerator.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+
+#include <string>
+#include <vector>
+
+/**
+ * Records whether the optimized trees contain any vector operation.
+ */
+class SLPVectorOpcodeVerifier : public TR::IlVerifier
+   {
+   public:
+   SLPVectorOpcodeVerifier() : _hasVectorOpcodes(false) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         if (iter.currentNode()->getOpCode().isVectorOpCode())
+            _hasVectorOpcodes = true;
+         }
+      return 0;
+      }
+
+   bool hasVectorOpcodes() { return _hasVectorOpcodes; }
+
+   private:
+   bool _hasVectorOpcodes;
+   };
+
+class SLPVectorizerTest : public TRTest::JitOptTest
+   {
+   public:
+   SLPVectorizerTest()
+      {
+      addOptimization(OMR::slpVectorizer);
+      }
+
+   /**
+    * Whether the target can execute 128-bit vectors of \p elementType for
+    * the loads, stores and splats of a pack and its \p scalarOp.
+    */
+   bool platformSupports(TR::DataTypes elementType, TR::ILOpCodes scalarOp)
+      {
+      TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+      TR::DataType vectorType = TR::DataType::createVectorType(elementType, TR::VectorLength128);
+      TR::ILOpCode vectorOp = TR::ILOpCode::convertScalarToVector(scalarOp, TR::VectorLength128);
+      return TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType))
+         && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType))
+         && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType))
+         && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, vectorOp);
+      }
+   };
+
+/*
+ * p->x = p->x * s + q->x; ... for the four float fields x, y, z and w, with
+ * the statements in the given order of field offsets.
+ */
+static std::string
+updateFloatFieldsTrees(const int32_t (&offsets)[4])
+   {
+   std::string trees = "(method return=NoType args=[Address, Address, Float] (block";
+   for (int32_t i = 0; i < 4; i++)
+      {
+      std::string offset = std::to_string(offsets[i]);
+      trees += " (fstorei offset=" + offset + " (aload parm=0)"
+               " (fadd (fmul (floadi offset=" + offset + " (aload parm=0)) (fload parm=2))"
+               " (floadi offset=" + offset + " (aload parm=1))))";
+      }
+   return trees + " (return)))";
+   }
+
+class ParameterizedSLPVectorizerTest : public SLPVectorizerTest, public ::testing::WithParamInterface<std::vector<int32_t> > {};
+
+TEST_P(ParameterizedSLPVectorizerTest, UpdateFloatFields) {
+    int32_t offsets[4];
+    std::copy(GetParam().begin(), GetParam().end(), offsets);
+    std::string inputTrees = updateFloatFieldsTrees(offsets);
+
+    auto trees = parseString(inputTrees.c_str());
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    SLPVectorOpcodeVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+    if (platformSupports(TR::Float, TR::fmul) && platformSupports(TR::Float, TR::fadd))
+        EXPECT_TRUE(verifier.hasVectorOpcodes()) << "Statements were not packed";
+
+    auto entry_point = compiler.getEntryPoint<void (*)(float *, float *, float)>();
+
+    // A sentinel after the fields checks that the vector store is not too wide
+    float p[5] = { 1.0f, 2.0f, 3.0f, 4.0f, -1.0f };
+    float q[4] = { 0.5f, 0.25f, 0.125f, 8.0f };
+    entry_point(p, q, 3.0f);
+
+    EXPECT_EQ(3.5f, p[0]);
+    EXPECT_EQ(6.25f, p[1]);
+    EXPECT_EQ(9.125f, p[2]);
+    EXPECT_EQ(20.0f, p[3]);
+    EXPECT_EQ(-1.0f, p[4]);
+}
+
+INSTANTIATE_TEST_CASE_P(SLPVectorizerTest, ParameterizedSLPVectorizerTest, ::testing::Values(
+    std::vector<int32_t>{ 0, 4, 8, 12 },
+    std::vector<int32_t>{ 12, 8, 4, 0 },
+    std::vector<int32_t>{ 8, 0, 12, 4 }));
+
+/*
+ * a[i] = b[i] + c[i] for i in 0..7, written out as straight-line code the way
+ * a fully unrolled loop is.
+ */
+TEST_F(SLPVectorizerTest, AddUnrolledInt32Arrays) {
+    std::string inputTrees = "(method return=NoType args=[Address, Address, Address] (block";
+    for (int32_t i = 0; i < 8; i++)
+        {
+        std::string offset = "(lconst " + std::to_string(4 * i) + ")";
+        inputTrees += " (istorei (aladd (aload parm=0) " + offset + ")"
+                      " (iadd (iloadi (aladd (aload parm=1) " + offset + "))"
+                      " (iloadi (aladd (aload parm=2) " + offset + "))))";
+        }
+    inputTrees += " (return)))";
+
+    auto trees = parseString(inputTrees.c_str());
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    SLPVectorOpcodeVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+    if (platformSupports(TR::Int32, TR::iadd))
+        EXPECT_TRUE(verifier.hasVectorOpcodes()) << "Statements were not packed";
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int32_t *, int32_t *, int32_t *)>();
+
+    std::vector<int32_t> a(9, -1), b(8), c(8);
+    for (int32_t i = 0; i < 8; i++)
+        {
+        b[i] = i * 1000;
+        c[i] = 7 - i;
+        }
+    entry_point(&a[0], &b[0], &c[0]);
+
+    for (int32_t i = 0; i < 8; i++)
+        ASSERT_EQ(999 * i + 7, a[i]) << "Wrong result at index " << i;
+    EXPECT_EQ(-1, a[8]);
+}
+
+/*
+ * p[i + 1] = p[i] + p[i] for i in 0..3: every statement reads the location
+ * the previous one stored, so running all the loads first would be wrong.
+ */
+TEST_F(SLPVectorizerTest, DependentStatementsAreNotPacked) {
+    std::string inputTrees = "(method return=NoType args=[Address] (block";
+    for (int32_t i = 0; i < 4; i++)
+        {
+        std::string load = "(iloadi offset=" + std::to_string(4 * i) + " (aload parm=0))";
+        inputTrees += " (istorei offset=" + std::to_string(4 * (i + 1)) + " (aload parm=0) (iadd " + load + " " + load + "))";
+        }
+    inputTrees += " (return)))";
+
+    auto trees = parseString(inputTrees.c_str());
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    SLPVectorOpcodeVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+    EXPECT_FALSE(verifier.hasVectorOpcodes());
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int32_t *)>();
+    int32_t p[5] = { 3, 0, 0, 0, 0 };
+    entry_point(p);
+    EXPECT_EQ(3, p[0]);
+    EXPECT_EQ(6, p[1]);
+    EXPECT_EQ(12, p[2]);
+    EXPECT_EQ(24, p[3]);
+    EXPECT_EQ(48, p[4]);
+}
+
+/*
+ * Storing one local to two fields is cheaper as two scalar stores than as a
+ * splat and a vector store.
+ */
+TEST_F(SLPVectorizerTest, UnprofitablePackIsNotMade) {
+    auto *inputTrees =
+       "(method return=NoType args=[Address, Double]"
+       "  (block"
+       "    (dstorei offset=0 (aload parm=0) (dload parm=1))"
+       "    (dstorei offset=8 (aload parm=0) (dload parm=1))"
+       "    (return)))";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    SLPVectorOpcodeVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+    EXPECT_FALSE(verifier.hasVectorOpcodes());
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double *, double)>();
+    double p[2] = { 0.0, 0.0 };
+    entry_point(p, 2.5);
+    EXPECT_EQ(2.5, p[0]);
+    EXPECT_EQ(2.5, p[1]);
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "compile/Compilation.hpp"
+#include "env/Region.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "ras/IlVerifier.hpp"
+
+/**
+ * Records how much of the compilation's memory was served from recycled
+ * blocks by the end of optimization.
+ */
+class BytesRecycledVerifier : public TR::IlVerifier
+   {
+   public:
+   BytesRecycledVerifier() : _bytesRecycled(0) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      _bytesRecycled = sym->comp()->region().bytesRecycled();
+      return 0;
+      }
+
+   size_t _bytesRecycled;
+   };
+
+class ScratchMemoryRecyclingTest : public TRTest::JitTest
+   {
+   public:
+   ScratchMemoryRecyclingTest() :
+      TRTest::JitTest("-Xjit:acceptHugeMethods,useILValidator,enableScratchMemoryRecycling")
+      {
+      }
+   };
+
+/*
+ * for (i = 0; i < n; i++) sum += (i < 5) ? i : 2 * i;
+ */
+static const char *sumTrees =
+   "(method return=Int32 args=[Int32]"
+   "  (block"
+   "    (istore temp=\"sum\" (iconst 0))"
+   "    (istore temp=\"i\" (iconst 0))"
+   "    (ificmple target=\"exit\" (iload parm=0) (iconst 0)))"
+   "  (block name=\"loop\""
+   "    (ificmpge target=\"large\" (iload temp=\"i\") (iconst 5)))"
+   "  (block"
+   "    (istore temp=\"sum\" (iadd (iload temp=\"sum\") (iload temp=\"i\")))"
+   "    (goto target=\"next\"))"
+   "  (block name=\"large\""
+   "    (istore temp=\"sum\" (iadd (iload temp=\"sum\") (imul (iload temp=\"i\") (iconst 2)))))"
+   "  (block name=\"next\""
+   "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))"
+   "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=0)))"
+   "  (block name=\"exit\""
+   "    (ireturn (iload temp=\"sum\"))))";
+
+TEST_F(ScratchMemoryRecyclingTest, ReusesMemoryReturnedDuringOptimization) {
+    auto trees = parseString(sumTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    BytesRecycledVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << sumTrees;
+
+    EXPECT_GT(verifier._bytesRecycled, 0u);
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(0 + 1 + 2 + 3 + 4 + 2 * (5 + 6 + 7 + 8 + 9), entry_point(10));
+}
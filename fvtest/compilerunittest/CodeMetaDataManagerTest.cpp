@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "CompilerUnitTest.hpp"
+#include "runtime/CodeMetaDataManager.hpp"
+#include "runtime/CodeMetaDataManager_inlines.hpp"
+#include "runtime/CodeMetaDataPOD.hpp"
+
+namespace {
+
+class TestCodeMetaDataManager : public TR::CodeMetaDataManager
+   {
+   public:
+   using OMR::CodeMetaDataManager::addCodeRange;
+   };
+
+const uintptr_t CACHE_BASE = 0x10000000;
+const uintptr_t CACHE_STRIDE = 0x01000000;
+const uintptr_t CACHE_SIZE = 0x00100000;
+const int NUM_CACHES = 4;
+
+class CodeMetaDataManagerTest : public ::testing::Test
+   {
+   public:
+
+   CodeMetaDataManagerTest() : _jitInit(), _random(0x9e3779b97f4a7c15ULL) {}
+
+   // Register the code caches out of address order, then lay out methods of
+   // assorted sizes, with gaps, through each of them.
+   void SetUp()
+      {
+      static const int cacheOrder[NUM_CACHES] = { 2, 0, 3, 1 };
+      for (int i = 0; i < NUM_CACHES; i++)
+         {
+         uintptr_t start = CACHE_BASE + cacheOrder[i] * CACHE_STRIDE;
+         ASSERT_TRUE(_manager.addCodeRange(start, start + CACHE_SIZE) != NULL);
+         }
+
+      for (int cache = 0; cache < NUM_CACHES; cache++)
+         {
+         uintptr_t pc = CACHE_BASE + cache * CACHE_STRIDE;
+         uintptr_t end = pc + CACHE_SIZE;
+         for (;;)
+            {
+            uintptr_t size = 64 + next() % 1024;
+            uintptr_t gap = (next() % 4 == 0) ? 16 * (next() % 32) : 0;
+            if (pc + gap + size > end)
+               break;
+            TR::MethodMetaDataPOD method;
+            method.startPC = pc + gap;
+            method.endPC = pc + gap + size;
+            _methods.push_back(method);
+            pc += gap + size;
+            }
+         }
+      }
+
+   uint64_t next()
+      {
+      _random ^= _random << 13;
+      _random ^= _random >> 7;
+      _random ^= _random << 17;
+      return _random;
+      }
+
+   protected:
+   TRTest::JitInitializer _jitInit;
+   TestCodeMetaDataManager _manager;
+   std::vector<TR::MethodMetaDataPOD> _methods;
+   uint64_t _random;
+   };
+
+}
+
+TEST_F(CodeMetaDataManagerTest, findsContainingMethod)
+   {
+   for (size_t i = 0; i < _methods.size(); i++)
+      ASSERT_TRUE(_manager.insertMetaData(&_methods[i]));
+
+   for (size_t i = 0; i < _methods.size(); i++)
+      {
+      const TR::MethodMetaDataPOD *method = &_methods[i];
+      EXPECT_EQ(method, _manager.findMetaDataForPC(method->startPC));
+      EXPECT_EQ(method, _manager.findMetaDataForPC((method->startPC + method->endPC) / 2));
+      EXPECT_EQ(method, _manager.findMetaDataForPC(method->endPC - 1));
+      if (i + 1 < _methods.size() && _methods[i + 1].startPC > method->endPC)
+         EXPECT_EQ(NULL, _manager.findMetaDataForPC(method->endPC));
+      }
+
+   // Outside of every code cache
+   EXPECT_EQ(NULL, _manager.findMetaDataForPC(CACHE_BASE - 1));
+   EXPECT_EQ(NULL, _manager.findMetaDataForPC(CACHE_BASE + CACHE_SIZE));
+   EXPECT_EQ(NULL, _manager.findMetaDataForPC(CACHE_BASE + NUM_CACHES * CACHE_STRIDE));
+
+   for (size_t i = 0; i < _methods.size(); i += 3)
+      ASSERT_TRUE(_manager.removeMetaData(&_methods[i]));
+
+   for (size_t i = 0; i < _methods.size(); i++)
+      {
+      const TR::MethodMetaDataPOD *method = &_methods[i];
+      const TR::MethodMetaDataPOD *expected = (i % 3 == 0) ? NULL : method;
+      EXPECT_EQ(expected, _manager.findMetaDataForPC(method->startPC));
+      EXPECT_EQ(expected, _manager.findMetaDataForPC(method->endPC - 1));
+      EXPECT_EQ(i % 3 != 0, _manager.containsMetaData(method));
+      }
+   }
+
+TEST_F(CodeMetaDataManagerTest, rejectsOverlappingCodeRange)
+   {
+   EXPECT_EQ(NULL, _manager.addCodeRange(CACHE_BASE + CACHE_SIZE / 2, CACHE_BASE + CACHE_SIZE * 2));
+   EXPECT_EQ(NULL, _manager.addCodeRange(CACHE_BASE - CACHE_SIZE / 2, CACHE_BASE + CACHE_SIZE / 2));
+   EXPECT_TRUE(_manager.addCodeRange(CACHE_BASE + CACHE_SIZE, CACHE_BASE + CACHE_SIZE * 2) != NULL);
+   }
+
+// Readers look up PCs on their own, and then while a writer keeps removing
+// and reinserting every odd method. Even methods must always be found, and a
+// lookup must never return a method that does not contain the PC.
+TEST_F(CodeMetaDataManagerTest, concurrentLookupBenchmark)
+   {
+   const int lookupsPerThread = 1000000;
+
+   for (size_t i = 0; i < _methods.size(); i++)
+      ASSERT_TRUE(_manager.insertMetaData(&_methods[i]));
+
+   for (int withWriter = 0; withWriter <= 1; withWriter++)
+      {
+      for (int numThreads = 1; numThreads <= 4; numThreads *= 2)
+         {
+         std::atomic<bool> stop(false);
+         std::atomic<uint64_t> errors(0);
+         std::atomic<uint64_t> writerRounds(0);
+
+         std::thread writer([&]()
+            {
+            while (withWriter && !stop.load())
+               {
+               for (size_t i = 1; i < _methods.size(); i += 2)
+                  {
+                  if (!_manager.removeMetaData(&_methods[i]))
+                     errors++;
+                  }
+               for (size_t i = 1; i < _methods.size(); i += 2)
+                  {
+                  if (!_manager.insertMetaData(&_methods[i]))
+                     errors++;
+                  }
+               writerRounds++;
+               std::this_thread::yield();
+               }
+            });
+
+         std::vector<std::thread> readers;
+         auto start = std::chrono::steady_clock::now();
+         for (int t = 0; t < numThreads; t++)
+            {
+            readers.push_back(std::thread([&, t]()
+               {
+               uint64_t random = 0x2545f4914f6cdd1dULL * (t + 1);
+               uint64_t localErrors = 0;
+               for (int n = 0; n < lookupsPerThread; n++)
+                  {
+                  random ^= random << 13;
+                  random ^= random >> 7;
+                  random ^= random << 17;
+                  size_t i = (size_t)(random % _methods.size());
+                  const TR::MethodMetaDataPOD *method = &_methods[i];
+                  uintptr_t pc = method->startPC + (uintptr_t)((random >> 32) % (method->endPC - method->startPC));
+                  const TR::MethodMetaDataPOD *found = _manager.findMetaDataForPC(pc);
+                  if (found != method && !(found == NULL && withWriter && (i & 1)))
+                     localErrors++;
+                  }
+               errors += localErrors;
+               }));
+            }
+         for (int t = 0; t < numThreads; t++)
+            readers[t].join();
+         auto elapsed = std::chrono::steady_clock::now() - start;
+
+         stop = true;
+         writer.join();
+
+         EXPECT_EQ(0, errors.load()) << numThreads << " reader threads, " << (withWriter ? "with" : "without") << " a writer";
+
+         double seconds = std::chrono::duration<double>(elapsed).count();
+         double lookups = (double)lookupsPerThread * numThreads;
+         printf("%d reader thread(s) %s a writer: %.1f ns per lookup, %.1f million lookups/s in total, %llu writer rounds\n",
+            numThreads, withWriter ? "with" : "without", seconds * 1e9 / lookups, lookups / seconds / 1e6,
+            (unsigned long long)writerRounds.load());
+         }
+      }
+   }
@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "env/Region.hpp"
+#include "env/SystemSegmentProvider.hpp"
+#include "env/RawAllocator.hpp"
+#include "infra/BitVector.hpp"
+#include "infra/HybridBitVector.hpp"
+
+namespace {
+
+class HybridBitVectorTest : public ::testing::Test {
+public:
+    HybridBitVectorTest() :
+        _rawAllocator(),
+        _segmentProvider(1 << 16, _rawAllocator),
+        _region(_segmentProvider, _rawAllocator) {}
+
+    TR::Region& region() { return _region; }
+
+    static std::vector<int32_t> elements(TR_HybridBitVector &bv) {
+        std::vector<int32_t> result;
+        TR_HybridBitVectorIterator bvi(bv);
+        while (bvi.hasMoreElements())
+            result.push_back(bvi.getNextElement());
+        return result;
+    }
+
+    static std::vector<int32_t> elements(TR_BitVector &bv) {
+        std::vector<int32_t> result;
+        TR_BitVectorIterator bvi(bv);
+        while (bvi.hasMoreElements())
+            result.push_back(bvi.getNextElement());
+        return result;
+    }
+
+    /**
+     * Fill a hybrid set and a reference dense set with the same random
+     * elements, about one in every `spacing` bits.
+     */
+    void fill(TR_HybridBitVector &hybrid, TR_BitVector &reference, int32_t numBits, int32_t spacing) {
+        for (int32_t i = rand() % spacing; i < numBits; i += 1 + rand() % (2 * spacing)) {
+            hybrid.set(i);
+            reference.set(i);
+        }
+    }
+
+protected:
+    TR::RawAllocator _rawAllocator;
+    TR::SystemSegmentProvider _segmentProvider;
+    TR::Region _region;
+};
+
+class HybridBitVectorRandomTest : public HybridBitVectorTest, public ::testing::WithParamInterface<int32_t> {};
+
+}
+
+TEST_F(HybridBitVectorTest, SparseSetOperations) {
+    TR_HybridBitVector bv(100000, region());
+
+    EXPECT_TRUE(bv.isEmpty());
+    bv.set(70000);
+    bv.set(5);
+    bv.set(64);
+    bv.set(63);
+    EXPECT_FALSE(bv.isDense());
+    EXPECT_EQ(4, bv.elementCount());
+    EXPECT_EQ(3, bv.numNonZeroChunks());
+    EXPECT_TRUE(bv.isSet(63));
+    EXPECT_FALSE(bv.isSet(62));
+    EXPECT_FALSE(bv.isSet(200000));
+
+    std::vector<int32_t> expected;
+    expected.push_back(5);
+    expected.push_back(63);
+    expected.push_back(64);
+    expected.push_back(70000);
+    EXPECT_EQ(expected, elements(bv));
+
+    bv.reset(64);
+    bv.reset(70000);
+    EXPECT_EQ(2, bv.elementCount());
+    EXPECT_EQ(1, bv.numNonZeroChunks());
+    EXPECT_TRUE(bv.hasMoreThanOneElement());
+
+    bv.empty();
+    EXPECT_TRUE(bv.isEmpty());
+    EXPECT_FALSE(bv.hasMoreThanOneElement());
+}
+
+TEST_F(HybridBitVectorTest, SwitchesToDenseAtThreshold) {
+    const int32_t numChunks = 64;
+    TR_HybridBitVector bv(numChunks * BITS_IN_CHUNK, region());
+
+    // One bit in each of the first numChunks/denseRatio chunks stays sparse
+    int32_t sparseLimit = numChunks / TR_HybridBitVector::defaultDenseRatio;
+    for (int32_t i = 0; i < sparseLimit; i++)
+        bv.set(i * BITS_IN_CHUNK);
+    EXPECT_FALSE(bv.isDense());
+    EXPECT_EQ(sparseLimit, bv.numUsedChunks());
+
+    bv.set(sparseLimit * BITS_IN_CHUNK);
+    EXPECT_TRUE(bv.isDense());
+    EXPECT_EQ(sparseLimit + 1, bv.elementCount());
+
+    bv.empty();
+    EXPECT_FALSE(bv.isDense());
+    EXPECT_TRUE(bv.isEmpty());
+}
+
+TEST_F(HybridBitVectorTest, SmallSetsAreDense) {
+    TR_HybridBitVector bv(TR_HybridBitVector::minSparseChunks * BITS_IN_CHUNK, region());
+    bv.set(1);
+    EXPECT_TRUE(bv.isDense());
+}
+
+TEST_F(HybridBitVectorTest, GrowsBeyondInitialSize) {
+    TR_HybridBitVector bv(64, region());
+    bv.set(10);
+    bv.set(10000);
+    EXPECT_TRUE(bv.isSet(10));
+    EXPECT_TRUE(bv.isSet(10000));
+    EXPECT_EQ(2, bv.elementCount());
+}
+
+TEST_F(HybridBitVectorTest, Ranges) {
+    TR_HybridBitVector bv(1000, region());
+    TR_BitVector reference(1000, region());
+
+    bv.setAll(10, 200);
+    reference.setAll(10, 200);
+    EXPECT_EQ(elements(reference), elements(bv));
+
+    bv.resetAll(60, 130);
+    reference.resetAll(60, 130);
+    EXPECT_EQ(elements(reference), elements(bv));
+
+    bv.setAll(5);
+    reference.setAll(5);
+    EXPECT_EQ(elements(reference), elements(bv));
+}
+
+/**
+ * Cross-check the bulk operations against TR_BitVector over sets of every
+ * density, so that each pairing of sparse and dense operands is covered.
+ */
+TEST_P(HybridBitVectorRandomTest, MatchesDenseBitVector) {
+    const int32_t numBits = 20000;
+    const int32_t spacings[] = { 2, 40, 300, 5000 };
+    const int32_t numSpacings = sizeof(spacings) / sizeof(spacings[0]);
+
+    srand(GetParam());
+    for (int32_t a = 0; a < numSpacings; a++) {
+        for (int32_t b = 0; b < numSpacings; b++) {
+            TR_HybridBitVector x(numBits, region()), y(numBits, region());
+            TR_BitVector rx(numBits, region()), ry(numBits, region());
+            fill(x, rx, numBits, spacings[a]);
+            fill(y, ry, numBits, spacings[b]);
+
+            EXPECT_EQ(rx.intersects(ry), x.intersects(y));
+            EXPECT_EQ(rx == ry, x == y);
+            EXPECT_EQ(rx.elementCount(), x.elementCount());
+
+            TR_HybridBitVector result(numBits, region());
+            TR_BitVector expected(numBits, region());
+
+            result = x; result |= y;
+            expected = rx; expected |= ry;
+            EXPECT_EQ(elements(expected), elements(result));
+
+            result = x; result &= y;
+            expected = rx; expected &= ry;
+            EXPECT_EQ(elements(expected), elements(result));
+
+            result = x; result -= y;
+            expected = rx; expected -= ry;
+            EXPECT_EQ(elements(expected), elements(result));
+
+            // Mixed operations with dense bit vectors
+            result = x; result |= ry;
+            expected = rx; expected |= ry;
+            EXPECT_EQ(elements(expected), elements(result));
+
+            result = x; result &= ry;
+            expected = rx; expected &= ry;
+            EXPECT_EQ(elements(expected), elements(result));
+
+            result = x; result -= ry;
+            expected = rx; expected -= ry;
+            EXPECT_EQ(elements(expected), elements(result));
+
+            TR_BitVector dense(numBits, region());
+            dense = rx; dense |= y;
+            expected = rx; expected |= ry;
+            EXPECT_EQ(elements(expected), elements(dense));
+
+            dense = rx; dense &= y;
+            expected = rx; expected &= ry;
+            EXPECT_EQ(elements(expected), elements(dense));
+
+            // Equality does not depend on the representation
+            TR_HybridBitVector copy(numBits, region());
+            copy = x;
+            EXPECT_TRUE(copy == x);
+            copy |= y;
+            copy -= y;
+            result = x;
+            result -= y;
+            EXPECT_TRUE(copy == result);
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(HybridBitVector, HybridBitVectorRandomTest, ::testing::Values(1, 2, 3));
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+
+#include "optimizer/OptimizerBudget.hpp"
+
+TEST(OptimizerBudgetTest, NoBudgetIsNeverExceeded) {
+    TR::OptimizerBudget budget(0, 0);
+    EXPECT_FALSE(budget.isEnabled());
+
+    budget.recordCost(OMR::globalValuePropagation, 60 * 1000 * 1000, 0, 0);
+    EXPECT_FALSE(budget.isExceeded(INT32_MAX));
+}
+
+TEST(OptimizerBudgetTest, NodeBudget) {
+    TR::OptimizerBudget budget(1000, 0);
+    EXPECT_TRUE(budget.isEnabled());
+
+    EXPECT_FALSE(budget.isExceeded(10));
+    EXPECT_FALSE(budget.isExceeded(1000));
+    EXPECT_TRUE(budget.isExceeded(1001));
+
+    // Shrinking the trees later does not bring the method back under budget
+    EXPECT_TRUE(budget.isExceeded(10));
+}
+
+TEST(OptimizerBudgetTest, TimeBudget) {
+    TR::OptimizerBudget budget(0, 2);
+    EXPECT_TRUE(budget.isEnabled());
+
+    budget.recordCost(OMR::localCSE, 1500, 0, 0);
+    EXPECT_FALSE(budget.isExceeded(INT32_MAX));
+
+    budget.recordCost(OMR::treeSimplification, 600, 0, 0);
+    EXPECT_EQ(2100, budget.getTotalElapsedTime());
+    EXPECT_TRUE(budget.isExceeded(0));
+}
+
+TEST(OptimizerBudgetTest, ActionsOverBudget) {
+    OMR::Optimizations replacement = OMR::endOpts;
+
+    EXPECT_EQ(TR::OptimizerBudget::Skip, TR::OptimizerBudget::getActionOverBudget(OMR::partialRedundancyEliminationGroup, replacement));
+    EXPECT_EQ(TR::OptimizerBudget::Skip, TR::OptimizerBudget::getActionOverBudget(OMR::partialRedundancyElimination, replacement));
+    EXPECT_EQ(TR::OptimizerBudget::Skip, TR::OptimizerBudget::getActionOverBudget(OMR::loopVersionerGroup, replacement));
+    EXPECT_EQ(TR::OptimizerBudget::Skip, TR::OptimizerBudget::getActionOverBudget(OMR::loopVersioner, replacement));
+    EXPECT_EQ(TR::OptimizerBudget::Skip, TR::OptimizerBudget::getActionOverBudget(OMR::generalLoopUnroller, replacement));
+    EXPECT_EQ(OMR::endOpts, replacement);
+
+    EXPECT_EQ(TR::OptimizerBudget::Downgrade, TR::OptimizerBudget::getActionOverBudget(OMR::veryExpensiveGlobalValuePropagationGroup, replacement));
+    EXPECT_EQ(OMR::veryCheapGlobalValuePropagationGroup, replacement);
+    EXPECT_EQ(TR::OptimizerBudget::Downgrade, TR::OptimizerBudget::getActionOverBudget(OMR::globalValuePropagation, replacement));
+    EXPECT_EQ(OMR::localValuePropagation, replacement);
+
+    EXPECT_EQ(TR::OptimizerBudget::Run, TR::OptimizerBudget::getActionOverBudget(OMR::localCSE, replacement));
+    EXPECT_EQ(TR::OptimizerBudget::Run, TR::OptimizerBudget::getActionOverBudget(OMR::veryCheapGlobalValuePropagationGroup, replacement));
+    EXPECT_EQ(TR::OptimizerBudget::Run, TR::OptimizerBudget::getActionOverBudget(OMR::localValuePropagation, replacement));
+}
+
+TEST(OptimizerBudgetTest, CostAccounting) {
+    TR::OptimizerBudget budget(0, 0);
+
+    budget.recordCost(OMR::localCSE, 100, 1024, 0);
+    budget.recordCost(OMR::globalValuePropagation, 700, 4096, 65536);
+    budget.recordCost(OMR::localCSE, 150, 2048, 0);
+    budget.recordCost(OMR::treeSimplification, 50, 512, 0);
+    budget.recordCost(OMR::deadTreesElimination, 400, 0, 0);
+
+    EXPECT_EQ(2, budget.getNumRuns(OMR::localCSE));
+    EXPECT_EQ(250, budget.getElapsedTime(OMR::localCSE));
+    EXPECT_EQ(3072, budget.getRegionBytesAllocated(OMR::localCSE));
+    EXPECT_EQ(65536, budget.getSegmentBytesAllocated(OMR::globalValuePropagation));
+    EXPECT_EQ(0, budget.getNumRuns(OMR::partialRedundancyElimination));
+    EXPECT_EQ(1400, budget.getTotalElapsedTime());
+
+    OMR::Optimizations opts[3];
+    ASSERT_EQ(3, budget.getMostExpensive(opts, 3));
+    EXPECT_EQ(OMR::globalValuePropagation, opts[0]);
+    EXPECT_EQ(OMR::deadTreesElimination, opts[1]);
+    EXPECT_EQ(OMR::localCSE, opts[2]);
+
+    OMR::Optimizations all[10];
+    ASSERT_EQ(4, budget.getMostExpensive(all, 10));
+    EXPECT_EQ(OMR::treeSimplification, all[3]);
+}
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <set>
+
+#include "env/Region.hpp"
+#include "env/SystemSegmentProvider.hpp"
+#include "env/RawAllocator.hpp"
+#include "infra/vector.hpp"
+
+namespace {
+
+class RegionTest : public ::testing::Test {
+public:
+    RegionTest() :
+        _rawAllocator(),
+        _segmentProvider(1 << 16, _rawAllocator),
+        _region(_segmentProvider, _rawAllocator) {}
+
+    TR::Region& region() { return _region; }
+
+    /**
+     * Build and throw away a vector of `size` integers, the way an
+     * optimization builds a temporary work list.
+     */
+    void buildTemporaryVector(TR::Region &region, int32_t size) {
+        TR::vector<int32_t, TR::Region&> v(region);
+        for (int32_t i = 0; i < size; i++)
+            v.push_back(i);
+    }
+
+    /** Allocate `size` bytes and hand them straight back. */
+    void *returnBlock(TR::Region &region, size_t size) {
+        void *block = region.allocate(size);
+        region.deallocate(block, size);
+        return block;
+    }
+
+protected:
+    TR::RawAllocator _rawAllocator;
+    TR::SystemSegmentProvider _segmentProvider;
+    TR::Region _region;
+};
+
+}
+
+TEST_F(RegionTest, DeallocateIsANoOpByDefault) {
+    EXPECT_FALSE(region().recyclesMemory());
+
+    void *first = returnBlock(region(), 48);
+    region().recycleReturnedMemory();
+    void *second = region().allocate(48);
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(0, region().bytesRecycled());
+}
+
+TEST_F(RegionTest, ReusesBlocksOfTheSameSizeClass) {
+    region().setRecyclesMemory(true);
+
+    void *first = region().allocate(40);
+    void *second = region().allocate(40);
+    region().deallocate(first, 40);
+    region().deallocate(second, 40);
+    region().recycleReturnedMemory();
+    size_t allocated = region().bytesAllocated();
+
+    // 33..48 bytes all round to the same class, and blocks come back LIFO
+    EXPECT_EQ(second, region().allocate(48));
+    EXPECT_EQ(first, region().allocate(33));
+    EXPECT_EQ(allocated, region().bytesAllocated());
+    EXPECT_EQ(96, region().bytesRecycled());
+
+    // The free list is empty again, so the next block is new
+    void *third = region().allocate(48);
+    EXPECT_NE(first, third);
+    EXPECT_NE(second, third);
+}
+
+TEST_F(RegionTest, ReturnedBlocksAreUntouchedUntilRecycled) {
+    region().setRecyclesMemory(true);
+
+    int64_t *block = static_cast<int64_t *>(region().allocate(2 * sizeof(int64_t)));
+    block[0] = 17;
+    block[1] = 42;
+    region().deallocate(block, 2 * sizeof(int64_t));
+
+    EXPECT_NE(block, region().allocate(2 * sizeof(int64_t)));
+    EXPECT_EQ(17, block[0]);
+    EXPECT_EQ(42, block[1]);
+
+    region().recycleReturnedMemory();
+    EXPECT_EQ(block, region().allocate(2 * sizeof(int64_t)));
+}
+
+TEST_F(RegionTest, OnlyReusesExactSizeClassesAndSizedDeallocations) {
+    region().setRecyclesMemory(true);
+
+    void *small = returnBlock(region(), 16);
+    void *unsized = region().allocate(64);
+    region().deallocate(unsized);
+    void *large = returnBlock(region(), 4096);
+    region().recycleReturnedMemory();
+
+    EXPECT_NE(small, region().allocate(32));
+    EXPECT_NE(unsized, region().allocate(64));
+    EXPECT_NE(large, region().allocate(4096));
+
+    EXPECT_EQ(small, region().allocate(16));
+    EXPECT_EQ(16, region().bytesRecycled());
+}
+
+TEST_F(RegionTest, DisablingDropsReturnedBlocks) {
+    region().setRecyclesMemory(true);
+    void *block = returnBlock(region(), 64);
+    region().recycleReturnedMemory();
+
+    region().setRecyclesMemory(false);
+    region().setRecyclesMemory(true);
+    EXPECT_NE(block, region().allocate(64));
+}
+
+TEST_F(RegionTest, ModeDoesNotCarryOverToRegionsFromAPrototype) {
+    region().setRecyclesMemory(true);
+    void *block = returnBlock(region(), 64);
+    region().recycleReturnedMemory();
+
+    TR::Region child(region());
+    EXPECT_FALSE(child.recyclesMemory());
+    child.setRecyclesMemory(true);
+
+    // Blocks returned to the prototype stay with it
+    void *childBlock = child.allocate(64);
+    EXPECT_NE(block, childBlock);
+    child.deallocate(childBlock, 64);
+    child.recycleReturnedMemory();
+    EXPECT_EQ(childBlock, child.allocate(64));
+    EXPECT_EQ(block, region().allocate(64));
+}
+
+TEST_F(RegionTest, RecordsMoreReturnedBlocksThanOneChunkHolds) {
+    region().setRecyclesMemory(true);
+
+    std::set<void *> blocks;
+    for (int32_t i = 0; i < 1000; i++)
+        blocks.insert(returnBlock(region(), 32));
+    ASSERT_EQ(1000, blocks.size());
+    region().recycleReturnedMemory();
+
+    for (int32_t i = 0; i < 1000; i++)
+        ASSERT_EQ(1, blocks.erase(region().allocate(32))) << "Allocation " << i << " did not reuse a returned block";
+    EXPECT_EQ(1000 * 32, region().bytesRecycled());
+}
+
+TEST_F(RegionTest, RecyclingBoundsTemporaryContainers) {
+    TR::Region plain(_segmentProvider, _rawAllocator);
+    TR::Region recycling(_segmentProvider, _rawAllocator);
+    recycling.setRecyclesMemory(true);
+
+    for (int32_t i = 0; i < 100; i++) {
+        buildTemporaryVector(plain, 200);
+        buildTemporaryVector(recycling, 200);
+        recycling.recycleReturnedMemory();
+    }
+
+    // Without recycling every vector's storage is new. With it, each vector
+    // after the first grows into the blocks its predecessors returned.
+    EXPECT_GT(recycling.bytesRecycled(), 0);
+    EXPECT_LT(recycling.bytesAllocated() * 2, plain.bytesAllocated());
+}
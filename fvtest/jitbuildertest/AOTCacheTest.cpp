@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define AOT_METHODS 16
+#define AOT_VALUES 32
+
+typedef int32_t (*AOTFunctionType)(int32_t *, int32_t);
+
+static int32_t
+aotCacheSquare(int32_t value)
+   {
+   return value * value;
+   }
+
+/* Sums values[i] * scale over non-negative values and subtracts the squares of negative ones */
+class AOTCacheMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   AOTCacheMethod(OMR::JitBuilder::TypeDictionary *types, int32_t scale)
+      : OMR::JitBuilder::MethodBuilder(types), _scale(scale)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("aotCacheMethod");
+      DefineParameter("values", types->PointerTo(Int32));
+      DefineParameter("count", Int32);
+      DefineReturnType(Int32);
+      DefineFunction((char *)"aotCacheSquare",
+                     (char *)__FILE__,
+                     (char *)LINETOSTR(__LINE__),
+                     (void *)&aotCacheSquare,
+                     Int32,
+                     1,
+                     Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      OMR::JitBuilder::IlType *pInt32 = typeDictionary()->PointerTo(Int32);
+      Store("sum", ConstInt32(0));
+
+      OMR::JitBuilder::IlBuilder *loop = NULL;
+      ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("count"), ConstInt32(1));
+
+      OMR::JitBuilder::IlValue *value = loop->LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("values"), loop->Load("i")));
+      OMR::JitBuilder::IlBuilder *negative = NULL;
+      OMR::JitBuilder::IlBuilder *positive = NULL;
+      loop->IfThenElse(&negative, &positive, loop->LessThan(value, loop->ConstInt32(0)));
+      negative->Store("sum", negative->Sub(negative->Load("sum"), negative->Call("aotCacheSquare", 1, value)));
+      positive->Store("sum", positive->Add(positive->Load("sum"), positive->Mul(value, positive->ConstInt32(_scale))));
+
+      Return(Load("sum"));
+      return true;
+      }
+
+   int32_t scale() const { return _scale; }
+
+   private:
+
+   int32_t _scale;
+   };
+
+class AOTCacheTest : public JitBuilderTest
+   {
+   public:
+
+   AOTCacheTest()
+      {
+      strcpy(_fileName, "/tmp/jitbuilderAOTCacheXXXXXX");
+      int fd = mkstemp(_fileName);
+      if (fd >= 0)
+         close(fd);
+
+      for (int32_t i = 0; i < AOT_VALUES; i++)
+         _values[i] = (i * 7) - 100;
+      }
+
+   ~AOTCacheTest()
+      {
+      closeAOTCache();
+      unlink(_fileName);
+      }
+
+   int32_t expected(int32_t scale)
+      {
+      int32_t sum = 0;
+      for (int32_t i = 0; i < AOT_VALUES; i++)
+         sum += _values[i] < 0 ? -aotCacheSquare(_values[i]) : _values[i] * scale;
+      return sum;
+      }
+
+   off_t fileSize()
+      {
+      struct stat status;
+      if (0 != stat(_fileName, &status))
+         return -1;
+      return status.st_size;
+      }
+
+   /* Compiles and checks a method, returning how much the cache file grew */
+   void compileAndRun(int32_t scale, off_t *growth)
+      {
+      off_t before = fileSize();
+      OMR::JitBuilder::TypeDictionary types;
+      AOTCacheMethod method(&types, scale);
+      void *entry = NULL;
+      ASSERT_EQ(0, compileMethodBuilder(&method, &entry)) << "scale " << scale;
+      ASSERT_EQ(expected(scale), ((AOTFunctionType)entry)(_values, AOT_VALUES)) << "scale " << scale;
+      *growth = fileSize() - before;
+      }
+
+   protected:
+
+   char _fileName[64];
+   int32_t _values[AOT_VALUES];
+   };
+
+TEST_F(AOTCacheTest, reusesBodiesAfterReopening)
+   {
+   ASSERT_TRUE(openAOTCache(_fileName));
+   off_t growth = 0;
+   for (int32_t m = 0; m < AOT_METHODS; m++)
+      {
+      ASSERT_NO_FATAL_FAILURE(compileAndRun(m + 2, &growth));
+      ASSERT_GT(growth, 0) << "method " << m << " was not recorded";
+      }
+   closeAOTCache();
+
+   // Every method is found in the file, so nothing is added to it
+   ASSERT_TRUE(openAOTCache(_fileName));
+   for (int32_t m = 0; m < AOT_METHODS; m++)
+      {
+      ASSERT_NO_FATAL_FAILURE(compileAndRun(m + 2, &growth));
+      ASSERT_EQ(0, growth) << "method " << m << " was compiled again";
+      }
+   }
+
+TEST_F(AOTCacheTest, reusesBodiesWithinAProcess)
+   {
+   ASSERT_TRUE(openAOTCache(_fileName));
+   off_t growth = 0;
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(3, &growth));
+   ASSERT_GT(growth, 0);
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(3, &growth));
+   ASSERT_EQ(0, growth);
+
+   // A different constant is a different method
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(4, &growth));
+   ASSERT_GT(growth, 0);
+   }
+
+TEST_F(AOTCacheTest, leavesForeignFilesAlone)
+   {
+   // Other processes may be using a file this one cannot, so it is not
+   // rewritten
+   FILE *file = fopen(_fileName, "w");
+   ASSERT_TRUE(file != NULL);
+   fputs("not a JitBuilder AOT cache", file);
+   fclose(file);
+
+   ASSERT_FALSE(openAOTCache(_fileName));
+   ASSERT_EQ((off_t)strlen("not a JitBuilder AOT cache"), fileSize());
+
+   // A file written for another environment is not used either
+   ASSERT_EQ(0, truncate(_fileName, 0));
+   ASSERT_TRUE(openAOTCache(_fileName));
+   off_t growth = 0;
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(5, &growth));
+   ASSERT_GT(growth, 0);
+   closeAOTCache();
+   off_t size = fileSize();
+
+   // The environment hash follows the eye catcher, version and header size
+   file = fopen(_fileName, "r+");
+   ASSERT_TRUE(file != NULL);
+   ASSERT_EQ(0, fseek(file, 16, SEEK_SET));
+   int byte = fgetc(file);
+   ASSERT_EQ(0, fseek(file, 16, SEEK_SET));
+   fputc(byte ^ 0xff, file);
+   fclose(file);
+
+   ASSERT_FALSE(openAOTCache(_fileName));
+   ASSERT_EQ(size, fileSize());
+   }
+
+TEST_F(AOTCacheTest, ignoresEntriesCutShort)
+   {
+   ASSERT_TRUE(openAOTCache(_fileName));
+   off_t growth = 0;
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(5, &growth));
+   ASSERT_GT(growth, 0);
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(6, &growth));
+   ASSERT_GT(growth, 0);
+   closeAOTCache();
+
+   // An entry cut short is ignored and compiled again, and the new entry is
+   // written over it rather than after it
+   off_t firstEntryEnd = fileSize() - growth;
+   ASSERT_EQ(0, truncate(_fileName, fileSize() - 8));
+   off_t truncatedSize = fileSize();
+   ASSERT_TRUE(openAOTCache(_fileName));
+   ASSERT_EQ(truncatedSize, fileSize());
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(5, &growth));
+   ASSERT_EQ(0, growth);
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(6, &growth));
+   ASSERT_GT(fileSize(), truncatedSize);
+   ASSERT_LT(fileSize(), truncatedSize + (truncatedSize - firstEntryEnd));
+   closeAOTCache();
+
+   ASSERT_TRUE(openAOTCache(_fileName));
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(5, &growth));
+   ASSERT_EQ(0, growth);
+   ASSERT_NO_FATAL_FAILURE(compileAndRun(6, &growth));
+   ASSERT_EQ(0, growth);
+   }
+
+TEST_F(AOTCacheTest, aotCacheBenchmark)
+   {
+   ASSERT_TRUE(openAOTCache(_fileName));
+   off_t growth = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (int32_t m = 0; m < AOT_METHODS; m++)
+      ASSERT_NO_FATAL_FAILURE(compileAndRun(m + 100, &growth));
+   auto coldElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+   closeAOTCache();
+
+   ASSERT_TRUE(openAOTCache(_fileName));
+   start = std::chrono::steady_clock::now();
+   for (int32_t m = 0; m < AOT_METHODS; m++)
+      ASSERT_NO_FATAL_FAILURE(compileAndRun(m + 100, &growth));
+   auto warmElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+   printf("%d methods: %lld us compiling, %lld us loading from the AOT cache\n",
+      AOT_METHODS, (long long)coldElapsed, (long long)warmElapsed);
+   }
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <chrono>
+#include <stdio.h>
+
+#define ASYNC_METHODS 48
+#define ASYNC_VALUES 64
+#define ASYNC_THREADS 4
+
+// Return code of a request the compilation threads were stopped before starting
+#define ASYNC_COMPILATION_REQUESTED 1
+
+typedef int32_t (*AsyncFunctionType)(int32_t *);
+
+/* Sums values[i] * (i + 5) over the first `terms` values */
+class AsyncMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   AsyncMethod(OMR::JitBuilder::TypeDictionary *types, int32_t terms)
+      : OMR::JitBuilder::MethodBuilder(types), _terms(terms)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("asyncMethod");
+      DefineParameter("values", types->PointerTo(Int32));
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      OMR::JitBuilder::IlType *pInt32 = typeDictionary()->PointerTo(Int32);
+      OMR::JitBuilder::IlValue *sum = ConstInt32(0);
+      for (int32_t i = 0; i < _terms; i++)
+         {
+         OMR::JitBuilder::IlValue *value = LoadAt(pInt32, IndexAt(pInt32, Load("values"), ConstInt32(i)));
+         sum = Add(sum, Mul(value, ConstInt32(i + 5)));
+         }
+      Return(sum);
+      return true;
+      }
+
+   int32_t terms() const { return _terms; }
+
+   private:
+
+   int32_t _terms;
+   };
+
+class AsyncCompileTest : public JitBuilderTest
+   {
+   public:
+
+   AsyncCompileTest()
+      {
+      for (int32_t i = 0; i < ASYNC_VALUES; i++)
+         _values[i] = (i * 11) - 200;
+      for (int32_t m = 0; m < ASYNC_METHODS; m++)
+         {
+         _types[m] = new OMR::JitBuilder::TypeDictionary();
+         _methods[m] = new AsyncMethod(_types[m], 1 + (m * 37) % ASYNC_VALUES);
+         }
+      }
+
+   ~AsyncCompileTest()
+      {
+      for (int32_t m = 0; m < ASYNC_METHODS; m++)
+         {
+         delete _methods[m];
+         delete _types[m];
+         }
+      }
+
+   int32_t expected(int32_t m)
+      {
+      int32_t sum = 0;
+      for (int32_t i = 0; i < _methods[m]->terms(); i++)
+         sum += _values[i] * (i + 5);
+      return sum;
+      }
+
+   protected:
+
+   int32_t _values[ASYNC_VALUES];
+   OMR::JitBuilder::TypeDictionary *_types[ASYNC_METHODS];
+   AsyncMethod *_methods[ASYNC_METHODS];
+   };
+
+TEST_F(AsyncCompileTest, compilesSubmittedMethods)
+   {
+   ASSERT_TRUE(startCompilationThreads(ASYNC_THREADS, 0));
+
+   void *requests[ASYNC_METHODS];
+   for (int32_t m = 0; m < ASYNC_METHODS; m++)
+      {
+      requests[m] = submitMethodBuilder(_methods[m], m % 3);
+      ASSERT_TRUE(requests[m] != NULL);
+      }
+
+   for (int32_t m = 0; m < ASYNC_METHODS; m++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, waitForMethodBuilder(requests[m], &entry)) << "method " << m;
+      ASSERT_EQ(expected(m), ((AsyncFunctionType)entry)(_values)) << "method " << m;
+      }
+
+   stopCompilationThreads();
+   EXPECT_TRUE(submitMethodBuilder(_methods[0], 0) == NULL);
+   }
+
+TEST_F(AsyncCompileTest, compilesOneAtATimeWithinMemoryLimit)
+   {
+   // Too little memory for even one compilation; one may always run
+   ASSERT_TRUE(startCompilationThreads(ASYNC_THREADS, 1));
+
+   void *requests[ASYNC_METHODS];
+   for (int32_t m = 0; m < ASYNC_METHODS; m++)
+      requests[m] = submitMethodBuilder(_methods[m], 0);
+
+   for (int32_t m = 0; m < ASYNC_METHODS; m++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, waitForMethodBuilder(requests[m], &entry)) << "method " << m;
+      ASSERT_EQ(expected(m), ((AsyncFunctionType)entry)(_values)) << "method " << m;
+      }
+
+   stopCompilationThreads();
+   }
+
+TEST_F(AsyncCompileTest, stopCompletesPendingRequests)
+   {
+   ASSERT_TRUE(startCompilationThreads(1, 0));
+
+   void *requests[ASYNC_METHODS];
+   for (int32_t m = 0; m < ASYNC_METHODS; m++)
+      requests[m] = submitMethodBuilder(_methods[m], 0);
+
+   stopCompilationThreads();
+
+   for (int32_t m = 0; m < ASYNC_METHODS; m++)
+      {
+      ASSERT_TRUE(isMethodBuilderCompiled(requests[m]));
+      void *entry = NULL;
+      int32_t rc = waitForMethodBuilder(requests[m], &entry);
+      if (0 == rc)
+         ASSERT_EQ(expected(m), ((AsyncFunctionType)entry)(_values)) << "method " << m;
+      else
+         ASSERT_EQ(ASYNC_COMPILATION_REQUESTED, rc) << "method " << m;
+      }
+   }
+
+TEST_F(AsyncCompileTest, requestsOutliveStoppedService)
+   {
+   // each stopped service is freed by whichever of its requests is
+   // finished with last, whether it is waited for or released
+   for (int32_t cycle = 0; cycle < 4; cycle++)
+      {
+      ASSERT_TRUE(startCompilationThreads(1, 0)) << "cycle " << cycle;
+      void *waited = submitMethodBuilder(_methods[cycle], 0);
+      void *released = submitMethodBuilder(_methods[cycle + 1], 0);
+      stopCompilationThreads();
+
+      void *entry = NULL;
+      if (cycle % 2)
+         {
+         EXPECT_TRUE(releaseMethodBuilderRequest(released));
+         int32_t rc = waitForMethodBuilder(waited, &entry);
+         EXPECT_TRUE(0 == rc || ASYNC_COMPILATION_REQUESTED == rc) << "cycle " << cycle;
+         }
+      else
+         {
+         int32_t rc = waitForMethodBuilder(waited, &entry);
+         EXPECT_TRUE(0 == rc || ASYNC_COMPILATION_REQUESTED == rc) << "cycle " << cycle;
+         EXPECT_TRUE(releaseMethodBuilderRequest(released));
+         }
+      }
+   }
+
+TEST_F(AsyncCompileTest, releasesUnwantedRequests)
+   {
+   ASSERT_TRUE(startCompilationThreads(1, 0));
+
+   void *requests[ASYNC_METHODS];
+   for (int32_t m = 0; m < ASYNC_METHODS; m++)
+      requests[m] = submitMethodBuilder(_methods[m], 0);
+
+   // the last requests cannot have been started yet; any that are being
+   // compiled are released when their compilation finishes
+   ASSERT_TRUE(releaseMethodBuilderRequest(requests[ASYNC_METHODS - 1]));
+   for (int32_t m = ASYNC_METHODS - 3; m > 0; m -= 2)
+      releaseMethodBuilderRequest(requests[m]);
+
+   for (int32_t m = 0; m < ASYNC_METHODS; m += 2)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, waitForMethodBuilder(requests[m], &entry)) << "method " << m;
+      ASSERT_EQ(expected(m), ((AsyncFunctionType)entry)(_values)) << "method " << m;
+      }
+
+   // a finished request can be released instead of waited for
+   void *request = submitMethodBuilder(_methods[1], 0);
+   while (!isMethodBuilderCompiled(request))
+      ;
+   EXPECT_TRUE(releaseMethodBuilderRequest(request));
+
+   stopCompilationThreads();
+   }
+
+TEST_F(AsyncCompileTest, asyncCompileBenchmark)
+   {
+   auto start = std::chrono::steady_clock::now();
+   for (int32_t m = 0; m < ASYNC_METHODS / 2; m++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, compileMethodBuilder(_methods[m], &entry));
+      }
+   auto syncElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+   ASSERT_TRUE(startCompilationThreads(ASYNC_THREADS, 0));
+   start = std::chrono::steady_clock::now();
+   void *requests[ASYNC_METHODS];
+   for (int32_t m = ASYNC_METHODS / 2; m < ASYNC_METHODS; m++)
+      requests[m] = submitMethodBuilder(_methods[m], 0);
+   auto submitElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+   for (int32_t m = ASYNC_METHODS / 2; m < ASYNC_METHODS; m++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, waitForMethodBuilder(requests[m], &entry));
+      }
+   auto asyncElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+   stopCompilationThreads();
+
+   printf("%d methods: %lld us compiling synchronously, %lld us on %d compilation threads (%lld us to submit)\n",
+      ASYNC_METHODS / 2, (long long)syncElapsed, (long long)asyncElapsed, ASYNC_THREADS, (long long)submitElapsed);
+   }
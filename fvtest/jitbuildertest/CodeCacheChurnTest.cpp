@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <chrono>
+#include <stdio.h>
+
+/*
+ * Compile methods of assorted sizes, release some of them and compile again,
+ * so code cache allocations are served from an increasingly fragmented set of
+ * reclaimed blocks.
+ */
+
+#define CHURN_ROUNDS 20
+#define CHURN_METHODS_PER_ROUND 32
+#define CHURN_VALUES 64
+
+typedef int32_t (*ChurnFunctionType)(int32_t *);
+
+/* Sums values[i] * (i + 3) over the first `terms` values */
+class ChurnMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   ChurnMethod(OMR::JitBuilder::TypeDictionary *types, int32_t terms)
+      : OMR::JitBuilder::MethodBuilder(types), _terms(terms)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("churnMethod");
+      DefineParameter("values", types->PointerTo(Int32));
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      OMR::JitBuilder::IlType *pInt32 = typeDictionary()->PointerTo(Int32);
+      OMR::JitBuilder::IlValue *sum = ConstInt32(0);
+      for (int32_t i = 0; i < _terms; i++)
+         {
+         OMR::JitBuilder::IlValue *value = LoadAt(pInt32, IndexAt(pInt32, Load("values"), ConstInt32(i)));
+         sum = Add(sum, Mul(value, ConstInt32(i + 3)));
+         }
+      Return(sum);
+      return true;
+      }
+
+   private:
+
+   int32_t _terms;
+   };
+
+class CodeCacheChurnTest : public JitBuilderTest {};
+
+static int32_t
+expectedChurnResult(int32_t *values, int32_t terms)
+   {
+   int32_t sum = 0;
+   for (int32_t i = 0; i < terms; i++)
+      sum += values[i] * (i + 3);
+   return sum;
+   }
+
+// Entry points on AIX are function descriptors, which releaseCompiledMethod does not accept
+#if !defined(AIXPPC)
+TEST_F(CodeCacheChurnTest, compileAndReleaseBenchmark)
+   {
+   int32_t values[CHURN_VALUES];
+   for (int32_t i = 0; i < CHURN_VALUES; i++)
+      values[i] = (i * 7) - 100;
+
+   ChurnFunctionType live[CHURN_METHODS_PER_ROUND] = { NULL };
+   int32_t liveTerms[CHURN_METHODS_PER_ROUND] = { 0 };
+   uint32_t seed = 12345;
+
+   for (int32_t round = 0; round < CHURN_ROUNDS; round++)
+      {
+      auto start = std::chrono::steady_clock::now();
+      int32_t compiled = 0;
+      for (int32_t m = 0; m < CHURN_METHODS_PER_ROUND; m++)
+         {
+         if (live[m])
+            continue;
+         seed = seed * 1103515245 + 12345;
+         int32_t terms = 1 + (int32_t)((seed >> 16) % CHURN_VALUES);
+
+         OMR::JitBuilder::TypeDictionary types;
+         ChurnMethod method(&types, terms);
+         void *entry = NULL;
+         ASSERT_EQ(0, compileMethodBuilder(&method, &entry)) << "Failed to compile churn method with " << terms << " terms";
+         live[m] = (ChurnFunctionType)entry;
+         liveTerms[m] = terms;
+         compiled++;
+         }
+      auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+      // every method, including those compiled into reclaimed space, must still compute the right answer
+      for (int32_t m = 0; m < CHURN_METHODS_PER_ROUND; m++)
+         ASSERT_EQ(expectedChurnResult(values, liveTerms[m]), live[m](values)) << "round " << round << " method " << m;
+
+      if (0 == round || (CHURN_ROUNDS - 1) == round)
+         printf("round %2d: compiled %2d methods in %lld us\n", round, compiled, (long long)elapsed);
+
+      // release a pseudo-random half of the methods to fragment the code cache
+      for (int32_t m = 0; m < CHURN_METHODS_PER_ROUND; m++)
+         {
+         seed = seed * 1103515245 + 12345;
+         if (0 != ((seed >> 16) & 1))
+            {
+            ASSERT_TRUE(releaseCompiledMethod((void *)live[m])) << "round " << round << " method " << m;
+            // a method can only be released once
+            ASSERT_FALSE(releaseCompiledMethod((void *)live[m])) << "round " << round << " method " << m;
+            live[m] = NULL;
+            }
+         }
+      }
+
+   for (int32_t m = 0; m < CHURN_METHODS_PER_ROUND; m++)
+      {
+      if (live[m])
+         EXPECT_TRUE(releaseCompiledMethod((void *)live[m]));
+      }
+   }
+#endif /* !defined(AIXPPC) */
@@ -344,6 +344,45 @@ TEST_F(PortFileTest2, file_test0)
 		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_stat_filesystem is NULL\n");
 	}
 
+	/* omrfile_test41 */
+	if (NULL == OMRPORTLIB->file_preadv) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_preadv is NULL\n");
+	}
+
+	if (NULL == OMRPORTLIB->file_pwritev) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_pwritev is NULL\n");
+	}
+
+	/* omrfile_test42 */
+	if (NULL == OMRPORTLIB->file_fadvise) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_fadvise is NULL\n");
+	}
+
+	if (NULL == OMRPORTLIB->file_fallocate) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_fallocate is NULL\n");
+	}
+
+	if (NULL == OMRPORTLIB->file_readahead) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_readahead is NULL\n");
+	}
+
+	/* omrfile_test43 */
+	if (NULL == OMRPORTLIB->file_async_create) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_create is NULL\n");
+	}
+
+	if (NULL == OMRPORTLIB->file_async_destroy) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_destroy is NULL\n");
+	}
+
+	if (NULL == OMRPORTLIB->file_async_submit) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_submit is NULL\n");
+	}
+
+	if (NULL == OMRPORTLIB->file_async_complete) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_complete is NULL\n");
+	}
+
 	/* functions  available with standard configuration */
 	if (NULL == OMRPORTLIB->file_read_text) { /* TODO omrfiletext.c */
 		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_read_text is NULL\n");
@@ -4793,6 +4832,314 @@ exit:
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+/**
+ * Verify @ref omrfile.c::omrfile_pwritev "omrfile_pwritev()" and
+ * @ref omrfile.c::omrfile_preadv "omrfile_preadv()" transfer several buffers
+ * at an offset without moving the file pointer.
+ */
+TEST_F(PortFileTest2, file_test41)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_test41";
+	const char *fileName = "tfileTest41.tst";
+	char hello[] = "Hello, ";
+	char world[] = "world!";
+	char first[5];
+	char second[8];
+	OMRIOVec writeVec[2];
+	OMRIOVec readVec[2];
+	intptr_t fd = -1;
+	intptr_t rc = 0;
+	int64_t filePtr = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	writeVec[0].iov_base = hello;
+	writeVec[0].iov_len = sizeof(hello) - 1;
+	writeVec[1].iov_base = world;
+	writeVec[1].iov_len = sizeof(world) - 1;
+	readVec[0].iov_base = first;
+	readVec[0].iov_len = sizeof(first);
+	readVec[1].iov_base = second;
+	readVec[1].iov_len = sizeof(second);
+
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed\n");
+		goto exit;
+	}
+
+	rc = omrfile_pwritev(fd, writeVec, 2, 4);
+	if (13 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_pwritev() returned %zd expected 13\n", rc);
+		goto exit;
+	}
+
+	filePtr = omrfile_seek(fd, 0, EsSeekCur);
+	if (0 != filePtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_pwritev() moved the file pointer to %lld\n", filePtr);
+	}
+
+	if (17 != omrfile_flength(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "file length is %lld expected 17\n", omrfile_flength(fd));
+	}
+
+	rc = omrfile_preadv(fd, readVec, 2, 4);
+	if (13 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_preadv() returned %zd expected 13\n", rc);
+		goto exit;
+	}
+	if ((0 != memcmp(first, "Hello", sizeof(first))) || (0 != memcmp(second, ", world!", sizeof(second)))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_preadv() read \"%.5s%.8s\" expected \"Hello, world!\"\n", first, second);
+	}
+
+	/* a read that runs past the end of the file is short, and a read at the end reads nothing */
+	rc = omrfile_preadv(fd, readVec, 2, 10);
+	if (7 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_preadv() near the end of the file returned %zd expected 7\n", rc);
+	}
+	rc = omrfile_preadv(fd, readVec, 2, 17);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_preadv() at the end of the file returned %zd expected 0\n", rc);
+	}
+
+	rc = omrfile_preadv(fd, readVec, 2, -1);
+	if (rc >= 0) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_preadv() at a negative offset returned %zd, expected failure\n", rc);
+	}
+
+exit:
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	omrfile_unlink(fileName);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify @ref omrfile.c::omrfile_fallocate "omrfile_fallocate()",
+ * @ref omrfile.c::omrfile_fadvise "omrfile_fadvise()" and
+ * @ref omrfile.c::omrfile_readahead "omrfile_readahead()".
+ */
+TEST_F(PortFileTest2, file_test42)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_test42";
+	const char *fileName = "tfileTest42.tst";
+	intptr_t fd = -1;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed\n");
+		goto exit;
+	}
+
+	rc = omrfile_fallocate(fd, 0, 4096, 0);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_fallocate() returned %d expected 0\n", rc);
+		goto exit;
+	}
+	if (4096 != omrfile_flength(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_fallocate() left the file length at %lld expected 4096\n", omrfile_flength(fd));
+	}
+
+	/* reserving space past the end of the file isn't available everywhere, but must not extend it */
+	rc = omrfile_fallocate(fd, 4096, 4096, OMRPORT_FILE_FALLOCATE_KEEP_SIZE);
+	if ((0 != rc) && (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM != rc)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_fallocate(OMRPORT_FILE_FALLOCATE_KEEP_SIZE) returned %d\n", rc);
+	}
+	if (4096 != omrfile_flength(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_fallocate(OMRPORT_FILE_FALLOCATE_KEEP_SIZE) changed the file length to %lld\n", omrfile_flength(fd));
+	}
+
+	rc = omrfile_fadvise(fd, 0, 0, OMRPORT_FILE_ADVICE_SEQUENTIAL);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_fadvise() returned %d expected 0\n", rc);
+	}
+	rc = omrfile_fadvise(fd, 0, 0, OMRPORT_FILE_ADVICE_NOREUSE + 1);
+	if (rc >= 0) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_fadvise() with invalid advice returned %d, expected failure\n", rc);
+	}
+
+	rc = omrfile_readahead(fd, 0, 4096);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_readahead() returned %d expected 0\n", rc);
+	}
+
+exit:
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	omrfile_unlink(fileName);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+#define FILE_TEST43_REQUESTS 8
+#define FILE_TEST43_QUEUE_DEPTH 4
+#define FILE_TEST43_BLOCK 512
+
+/**
+ * Run the requests through a context, submitting as many as fit and collecting
+ * completions until all are done.
+ *
+ * @return FALSE if the context reported a failure.
+ */
+static BOOLEAN
+runAsyncRequests(struct OMRPortLibrary *portLibrary, const char *testName, OMRFileAsyncContext *context, OMRFileAsyncRequest *requests, intptr_t expected)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRFileAsyncRequest *pending[FILE_TEST43_REQUESTS];
+	OMRFileAsyncRequest *completed[FILE_TEST43_REQUESTS];
+	uint32_t submitted = 0;
+	uint32_t finished = 0;
+	uint32_t i = 0;
+
+	for (i = 0; i < FILE_TEST43_REQUESTS; i++) {
+		requests[i].result = -1;
+		pending[i] = &requests[i];
+	}
+
+	while (finished < FILE_TEST43_REQUESTS) {
+		int32_t rc = 0;
+		if (submitted < FILE_TEST43_REQUESTS) {
+			rc = omrfile_async_submit(context, &pending[submitted], FILE_TEST43_REQUESTS - submitted);
+			if (rc < 0) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() returned %d\n", rc);
+				return FALSE;
+			}
+			submitted += (uint32_t)rc;
+			if ((submitted - finished) > FILE_TEST43_QUEUE_DEPTH) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() accepted %u requests beyond the queue depth\n", submitted - finished - FILE_TEST43_QUEUE_DEPTH);
+				return FALSE;
+			}
+		}
+		rc = omrfile_async_complete(context, completed, FILE_TEST43_REQUESTS, 1);
+		if (rc <= 0) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_complete() returned %d with %u requests in flight\n", rc, submitted - finished);
+			return FALSE;
+		}
+		for (i = 0; i < (uint32_t)rc; i++) {
+			if (expected != completed[i]->result) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "request at offset %lld completed with %zd expected %zd\n", completed[i]->offset, completed[i]->result, expected);
+			}
+		}
+		finished += (uint32_t)rc;
+	}
+
+	/* nothing is left to wait for */
+	if (0 != omrfile_async_complete(context, completed, FILE_TEST43_REQUESTS, 1)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_complete() returned requests after all had completed\n");
+	}
+	return TRUE;
+}
+
+/**
+ * Verify @ref omrfile_async.c::omrfile_async_submit "omrfile_async_submit()" and
+ * @ref omrfile_async.c::omrfile_async_complete "omrfile_async_complete()" write and read
+ * back a file with both the platform backend and worker threads, without exceeding the queue depth.
+ */
+TEST_F(PortFileTest2, file_test43)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_test43";
+	const char *fileName = "tfileTest43.tst";
+	uint32_t flags[] = { 0, OMRPORT_FILE_ASYNC_FLAG_THREAD_POOL };
+	char writeBuffers[FILE_TEST43_REQUESTS][FILE_TEST43_BLOCK];
+	char readBuffers[FILE_TEST43_REQUESTS][FILE_TEST43_BLOCK];
+	OMRIOVec vecs[FILE_TEST43_REQUESTS];
+	OMRFileAsyncRequest requests[FILE_TEST43_REQUESTS];
+	OMRFileAsyncContext *context = NULL;
+	intptr_t fd = -1;
+	int32_t rc = 0;
+	uint32_t f = 0;
+	uint32_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	rc = omrfile_async_create(0, 0, &context);
+	if (rc >= 0) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_create() with no queue depth returned %d, expected failure\n", rc);
+		omrfile_async_destroy(context);
+	}
+
+	for (f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+		fd = omrfile_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+		if (-1 == fd) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed\n");
+			goto exit;
+		}
+		rc = omrfile_async_create(FILE_TEST43_QUEUE_DEPTH, flags[f], &context);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_create(flags = %u) returned %d\n", flags[f], rc);
+			goto exit;
+		}
+
+		/* write the blocks in reverse so completions are not simply appends */
+		for (i = 0; i < FILE_TEST43_REQUESTS; i++) {
+			memset(writeBuffers[i], 'a' + i, FILE_TEST43_BLOCK);
+			vecs[i].iov_base = writeBuffers[i];
+			vecs[i].iov_len = FILE_TEST43_BLOCK;
+			requests[i].operation = OMRPORT_FILE_ASYNC_WRITE;
+			requests[i].iovcnt = 1;
+			requests[i].fd = fd;
+			requests[i].iov = &vecs[i];
+			requests[i].offset = (int64_t)(FILE_TEST43_REQUESTS - 1 - i) * FILE_TEST43_BLOCK;
+			requests[i].userData = NULL;
+		}
+		if (!runAsyncRequests(OMRPORTLIB, testName, context, requests, FILE_TEST43_BLOCK)) {
+			goto exit;
+		}
+		if ((FILE_TEST43_REQUESTS * FILE_TEST43_BLOCK) != omrfile_flength(fd)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "file length is %lld expected %d\n", omrfile_flength(fd), FILE_TEST43_REQUESTS * FILE_TEST43_BLOCK);
+		}
+
+		for (i = 0; i < FILE_TEST43_REQUESTS; i++) {
+			memset(readBuffers[i], 0, FILE_TEST43_BLOCK);
+			vecs[i].iov_base = readBuffers[i];
+			requests[i].operation = OMRPORT_FILE_ASYNC_READ;
+		}
+		if (!runAsyncRequests(OMRPORTLIB, testName, context, requests, FILE_TEST43_BLOCK)) {
+			goto exit;
+		}
+		for (i = 0; i < FILE_TEST43_REQUESTS; i++) {
+			if (0 != memcmp(readBuffers[i], writeBuffers[i], FILE_TEST43_BLOCK)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "block %u read back different data (flags = %u)\n", i, flags[f]);
+			}
+		}
+
+		/* errors are reported in the result of the request */
+		{
+			OMRFileAsyncRequest *badRequest = &requests[0];
+			OMRFileAsyncRequest *completed = NULL;
+			badRequest->fd = -1;
+			rc = omrfile_async_submit(context, &badRequest, 1);
+			if (1 != rc) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() of a request on a closed file returned %d expected 1\n", rc);
+			} else {
+				rc = omrfile_async_complete(context, &completed, 1, 1);
+				if ((1 != rc) || (completed != badRequest) || (completed->result >= 0)) {
+					outputErrorMessage(PORTTEST_ERROR_ARGS, "request on a closed file did not complete with an error (flags = %u)\n", flags[f]);
+				}
+			}
+		}
+		omrfile_async_destroy(context);
+		context = NULL;
+		omrfile_close(fd);
+		fd = -1;
+	}
+
+exit:
+	omrfile_async_destroy(context);
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	omrfile_unlink(fileName);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /**
  * Verify omrfile_lastmod() returns -1 on an invalid file.
  * @ref omrfile.c::omrfile_lastmod "omrfile_lastmod()"
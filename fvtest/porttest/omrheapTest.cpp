@@ -80,6 +80,9 @@ static AllocListElement *getElementFromPool(struct OMRPortLibrary *portLibrary,
 static uintptr_t allocLargestChunkPossible(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, uintptr_t heapSize);
 static void freeRemainingElementsInPool(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, J9Pool *allocPool);
 static void verifyHeapOutofRegionWrite(struct OMRPortLibrary *portLibrary, uint8_t *memAllocStart, uint8_t *heapEnd, uintptr_t heapStartOffset, const char *testName);
+static uintptr_t walkBinnedHeap(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, uintptr_t firstBlockSlot, const char *testName);
+static uint32_t nextRandom(uint32_t *seed);
+static void churnHeap(struct OMRPortLibrary *portLibrary, uintptr_t heapSize, uint32_t heapFlags, const char *testName);
 
 /**
  * Verify port library heap sub-allocator.
@@ -1370,6 +1373,281 @@ walkHeap(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, const char *testN
 	portTestEnv->changeIndent(-1);
 }
 
+/*
+ * Walk a heap created with OMRPORT_HEAP_FLAG_BINNED, whose blocks start after the bin index at firstBlockSlot.
+ * Returns the number of free slots found.
+ */
+static uintptr_t
+walkBinnedHeap(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, uintptr_t firstBlockSlot, const char *testName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	int64_t *basePtr = (int64_t *)heapBase;
+	int64_t *lastSlot = &basePtr[heapBase->heapSize - 1];
+	int64_t *blockTopPaddingCursor = &basePtr[firstBlockSlot];
+	uintptr_t freeSlots = 0;
+	BOOLEAN previousFree = FALSE;
+
+	while (blockTopPaddingCursor < lastSlot) {
+		int64_t topBlockSize = *blockTopPaddingCursor;
+		int64_t absSize = (topBlockSize < 0) ? -topBlockSize : topBlockSize;
+
+		if (absSize < 2) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "\nBinned block size %lld is too small @ 0x%p\n", topBlockSize, blockTopPaddingCursor);
+			return 0;
+		}
+		if (topBlockSize != blockTopPaddingCursor[absSize + 1]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "\nsize in top and bottom block padding don't match @ 0x%p\n", blockTopPaddingCursor);
+			return 0;
+		}
+		if (topBlockSize > 0) {
+			if (previousFree) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "\nadjacent free blocks were not coalesced @ 0x%p\n", blockTopPaddingCursor);
+				return 0;
+			}
+			freeSlots += (uintptr_t)topBlockSize;
+		}
+		previousFree = (topBlockSize > 0);
+		blockTopPaddingCursor += absSize + 2;
+	}
+	if (blockTopPaddingCursor != &lastSlot[1]) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "\nheap walk ended @ 0x%p instead of the end of the heap\n", blockTopPaddingCursor);
+	}
+	return freeSlots;
+}
+
+static uint32_t
+nextRandom(uint32_t *seed)
+{
+	*seed = (*seed * 1103515245) + 12345;
+	return (*seed >> 16) & 0x7FFF;
+}
+
+/**
+ * Verify the size-binned heap sub-allocator.
+ *
+ * Randomly allocates, reallocates and frees blocks, checking their contents and the heap structure,
+ * then checks that freeing everything coalesces the heap back into a single block and that omrheap_grow
+ * extends it.
+ */
+TEST(PortHeapTest, heap_binned_test)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrheap_binned_test";
+	const uintptr_t heapAmount = 256 * 1024;
+	const uintptr_t growAmount = 64 * 1024;
+	const uintptr_t liveCount = 256;
+	uint8_t *allocPtr = NULL;
+	uint8_t *live[256];
+	uintptr_t liveSize[256];
+	uintptr_t firstBlockSlot = 0;
+	uintptr_t initialFreeSlots = 0;
+	uint32_t seed = 42;
+	J9Heap *heapBase = NULL;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(live, 0, sizeof(live));
+	memset(liveSize, 0, sizeof(liveSize));
+
+	allocPtr = (uint8_t *)omrmem_allocate_memory(heapAmount + growAmount, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == allocPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Failed to allocate %zu bytes for the heap\n", heapAmount + growAmount);
+		goto exit;
+	}
+
+	if (NULL != omrheap_create(allocPtr, 64, OMRPORT_HEAP_FLAG_BINNED)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_create() accepted a heap too small for its bins\n");
+		goto exit;
+	}
+
+	heapBase = omrheap_create(allocPtr, heapAmount, OMRPORT_HEAP_FLAG_BINNED);
+	if (NULL == heapBase) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_create() failed!\n");
+		goto exit;
+	}
+
+	/* a new heap is a single free block ending at the last slot */
+	initialFreeSlots = (uintptr_t)((int64_t *)heapBase)[heapBase->heapSize - 1];
+	firstBlockSlot = heapBase->heapSize - initialFreeSlots - 2;
+	if (initialFreeSlots != walkBinnedHeap(OMRPORTLIB, heapBase, firstBlockSlot, testName)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "new binned heap is not a single free block\n");
+		goto exit;
+	}
+
+	for (i = 0; i < 20000; i++) {
+		uintptr_t index = nextRandom(&seed) % liveCount;
+		uintptr_t size = nextRandom(&seed) % ((0 == (i % 16)) ? 8192 : 256);
+
+		if (NULL != live[index]) {
+			for (j = 0; j < liveSize[index]; j++) {
+				if ((uint8_t)(index + j) != live[index][j]) {
+					outputErrorMessage(PORTTEST_ERROR_ARGS, "block %p was corrupted at offset %zu\n", live[index], j);
+					goto exit;
+				}
+			}
+			if (0 == (i % 3)) {
+				uint8_t *resized = (uint8_t *)omrheap_reallocate(heapBase, live[index], size);
+				if (NULL != resized) {
+					for (j = 0; j < OMR_MIN(size, liveSize[index]); j++) {
+						if ((uint8_t)(index + j) != resized[j]) {
+							outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_reallocate() did not preserve contents of %p\n", resized);
+							goto exit;
+						}
+					}
+					live[index] = resized;
+					liveSize[index] = size;
+				}
+			} else {
+				omrheap_free(heapBase, live[index]);
+				live[index] = NULL;
+			}
+		} else {
+			live[index] = (uint8_t *)omrheap_allocate(heapBase, size);
+			liveSize[index] = size;
+		}
+		if (NULL != live[index]) {
+			if (omrheap_query_size(heapBase, live[index]) < liveSize[index]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_query_size() returned less than the requested %zu bytes\n", liveSize[index]);
+				goto exit;
+			}
+			for (j = 0; j < liveSize[index]; j++) {
+				live[index][j] = (uint8_t)(index + j);
+			}
+		}
+		if (0 == (i % 1000)) {
+			walkBinnedHeap(OMRPORTLIB, heapBase, firstBlockSlot, testName);
+		}
+	}
+
+	for (i = 0; i < liveCount; i++) {
+		omrheap_free(heapBase, live[i]);
+		live[i] = NULL;
+	}
+	if (initialFreeSlots != walkBinnedHeap(OMRPORTLIB, heapBase, firstBlockSlot, testName)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "freeing every block did not restore the initial free space\n");
+		goto exit;
+	}
+
+	if (TRUE != omrheap_grow(heapBase, growAmount)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_grow() failed!\n");
+		goto exit;
+	}
+	if ((initialFreeSlots + (growAmount / sizeof(uint64_t))) != walkBinnedHeap(OMRPORTLIB, heapBase, firstBlockSlot, testName)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_grow() did not merge the new slots with the free tail block\n");
+		goto exit;
+	}
+
+	/* the whole heap is one free block again, so it can be handed out in one piece */
+	live[0] = (uint8_t *)omrheap_allocate(heapBase, (initialFreeSlots + (growAmount / sizeof(uint64_t))) * sizeof(uint64_t));
+	if (NULL == live[0]) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not allocate the entire coalesced heap\n");
+		goto exit;
+	}
+	if (NULL != omrheap_allocate(heapBase, 0)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_allocate() succeeded on a full heap\n");
+		goto exit;
+	}
+	omrheap_free(heapBase, live[0]);
+
+exit:
+	omrmem_free_memory(allocPtr);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/*
+ * Churn a heap of heapSize bytes with a mix of small and occasional large blocks, then report the time per
+ * operation, the number of failed allocations and the largest block still available.
+ */
+static void
+churnHeap(struct OMRPortLibrary *portLibrary, uintptr_t heapSize, uint32_t heapFlags, const char *testName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	const uintptr_t liveCount = 4096;
+	const uintptr_t operations = 200000;
+	void **live = NULL;
+	void *heapMemory = NULL;
+	J9Heap *heapBase = NULL;
+	uintptr_t failedAllocations = 0;
+	uintptr_t largestAvailable = 0;
+	uintptr_t low = 0;
+	uintptr_t high = heapSize;
+	uint32_t seed = 1234;
+	uint64_t startTime = 0;
+	uint64_t elapsed = 0;
+	uintptr_t i = 0;
+
+	live = (void **)omrmem_allocate_memory(liveCount * sizeof(void *), OMRMEM_CATEGORY_PORT_LIBRARY);
+	heapMemory = omrmem_allocate_memory(heapSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == live) || (NULL == heapMemory)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Failed to allocate memory for the benchmark\n");
+		goto exit;
+	}
+	memset(live, 0, liveCount * sizeof(void *));
+
+	heapBase = omrheap_create(heapMemory, heapSize, heapFlags);
+	if (NULL == heapBase) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_create() failed!\n");
+		goto exit;
+	}
+
+	startTime = omrtime_hires_clock();
+	for (i = 0; i < operations; i++) {
+		uintptr_t index = nextRandom(&seed) % liveCount;
+
+		if (NULL != live[index]) {
+			omrheap_free(heapBase, live[index]);
+			live[index] = NULL;
+		} else {
+			uintptr_t size = 16 + (nextRandom(&seed) % ((0 == (i % 32)) ? 16384 : 512));
+
+			live[index] = omrheap_allocate(heapBase, size);
+			if (NULL == live[index]) {
+				failedAllocations += 1;
+			}
+		}
+	}
+	elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+	/* binary search for the largest block that can still be allocated */
+	while (low < high) {
+		uintptr_t mid = low + ((high - low + 1) / 2);
+		void *probe = omrheap_allocate(heapBase, mid);
+
+		if (NULL != probe) {
+			omrheap_free(heapBase, probe);
+			low = mid;
+		} else {
+			high = mid - 1;
+		}
+	}
+	largestAvailable = low;
+
+	portTestEnv->log("%s heap: %llu ns/op, %zu failed allocations, largest free block %zu bytes\n",
+			(0 == heapFlags) ? "first-fit" : "binned", (unsigned long long)(elapsed / operations), failedAllocations, largestAvailable);
+
+exit:
+	omrmem_free_memory(heapMemory);
+	omrmem_free_memory(live);
+}
+
+/**
+ * Compare allocation latency and fragmentation of the first-fit and the size-binned heap sub-allocators.
+ */
+TEST(PortHeapTest, heap_binned_benchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrheap_binned_benchmark";
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	churnHeap(OMRPORTLIB, 4 * 1024 * 1024, 0, testName);
+	churnHeap(OMRPORTLIB, 4 * 1024 * 1024, OMRPORT_HEAP_FLAG_BINNED, testName);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /**
  * Verify port library heap operations.
  *
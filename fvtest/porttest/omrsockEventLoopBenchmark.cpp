@@ -0,0 +1,251 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrporterror.h"
+#include "omrportsock.h"
+#include "omrportsocktypes.h"
+#include "testHelpers.hpp"
+
+/* loopback connections, fewer if the file descriptor limit is lower */
+#define EVENTLOOP_BENCH_MAX_CONNECTIONS 4000
+#define EVENTLOOP_BENCH_ROUNDS 50
+/* one connection in every stride sends a byte in each round, as in a server with mostly idle clients */
+#define EVENTLOOP_BENCH_ACTIVE_STRIDE 32
+#define EVENTLOOP_BENCH_PORT 4931
+
+typedef struct EventLoopBenchConnections {
+	omrsock_socket_t serverSocket;
+	omrsock_socket_t *clients;
+	omrsock_socket_t *accepted;
+	uint32_t count;
+} EventLoopBenchConnections;
+
+/**
+ * Open count loopback connections; the accepted ends are non-blocking.
+ */
+static void
+openConnections(struct OMRPortLibrary *portLibrary, EventLoopBenchConnections *connections, uint32_t count)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRSockAddrStorage serverSockAddr;
+	OMRSockAddrStorage acceptedSockAddr;
+	uint8_t loopbackAddr[4] = { 127, 0, 0, 1 };
+	int32_t flag = 1;
+
+	connections->count = 0;
+	connections->clients = (omrsock_socket_t *)omrmem_allocate_memory(count * sizeof(omrsock_socket_t), OMRMEM_CATEGORY_PORT_LIBRARY);
+	connections->accepted = (omrsock_socket_t *)omrmem_allocate_memory(count * sizeof(omrsock_socket_t), OMRMEM_CATEGORY_PORT_LIBRARY);
+	ASSERT_NE(connections->clients, (void *)NULL);
+	ASSERT_NE(connections->accepted, (void *)NULL);
+
+	ASSERT_EQ(omrsock_sockaddr_init(&serverSockAddr, OMRSOCK_AF_INET, loopbackAddr, omrsock_htons(EVENTLOOP_BENCH_PORT)), 0);
+	ASSERT_EQ(omrsock_socket(&connections->serverSocket, OMRSOCK_AF_INET, OMRSOCK_STREAM, OMRSOCK_IPPROTO_DEFAULT), 0);
+	EXPECT_EQ(omrsock_setsockopt_int(connections->serverSocket, OMRSOCK_SOL_SOCKET, OMRSOCK_SO_REUSEADDR, &flag), 0);
+	ASSERT_EQ(omrsock_bind(connections->serverSocket, &serverSockAddr), 0);
+	ASSERT_EQ(omrsock_listen(connections->serverSocket, OMRSOCK_MAXCONN), 0);
+
+	for (uint32_t i = 0; i < count; i++) {
+		ASSERT_EQ(omrsock_socket(&connections->clients[i], OMRSOCK_AF_INET, OMRSOCK_STREAM, OMRSOCK_IPPROTO_DEFAULT), 0);
+		ASSERT_EQ(omrsock_connect(connections->clients[i], &serverSockAddr), 0);
+		ASSERT_EQ(omrsock_accept(connections->serverSocket, &acceptedSockAddr, &connections->accepted[i]), 0);
+		ASSERT_EQ(omrsock_fcntl(connections->accepted[i], OMRSOCK_O_NONBLOCK), 0);
+		connections->count += 1;
+	}
+}
+
+static void
+closeConnections(struct OMRPortLibrary *portLibrary, EventLoopBenchConnections *connections)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	for (uint32_t i = 0; i < connections->count; i++) {
+		EXPECT_EQ(omrsock_close(&connections->clients[i]), 0);
+		EXPECT_EQ(omrsock_close(&connections->accepted[i]), 0);
+	}
+	if (NULL != connections->serverSocket) {
+		EXPECT_EQ(omrsock_close(&connections->serverSocket), 0);
+	}
+	omrmem_free_memory(connections->clients);
+	omrmem_free_memory(connections->accepted);
+}
+
+/**
+ * Send one byte on each active client connection of a round.
+ * @return the number of bytes sent
+ */
+static uint32_t
+sendRound(struct OMRPortLibrary *portLibrary, EventLoopBenchConnections *connections, uint32_t round)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint8_t byte = (uint8_t)round;
+	uint32_t sent = 0;
+
+	for (uint32_t i = round % EVENTLOOP_BENCH_ACTIVE_STRIDE; i < connections->count; i += EVENTLOOP_BENCH_ACTIVE_STRIDE) {
+		EXPECT_EQ(omrsock_send(connections->clients[i], &byte, 1, 0), 1);
+		sent += 1;
+	}
+	return sent;
+}
+
+/**
+ * Read what is available on a non-blocking socket.
+ * @return the number of bytes read
+ */
+static uint32_t
+drainSocket(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint8_t buf[64];
+	uint32_t received = 0;
+	int32_t rc = 0;
+
+	while ((rc = omrsock_recv(sock, buf, sizeof(buf), 0)) > 0) {
+		received += (uint32_t)rc;
+	}
+	return received;
+}
+
+/**
+ * Receive each round with an edge triggered event loop.
+ * @return the elapsed time in microseconds
+ */
+static uint64_t
+runEventLoopRounds(struct OMRPortLibrary *portLibrary, EventLoopBenchConnections *connections)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	omrsock_eventloop_t loop = NULL;
+	OMRSockEvent events[256];
+
+	EXPECT_EQ(omrsock_eventloop_create(&loop), 0);
+	for (uint32_t i = 0; i < connections->count; i++) {
+		EXPECT_EQ(omrsock_eventloop_add(loop, connections->accepted[i], OMRSOCK_EVENT_READ | OMRSOCK_EVENT_EDGE_TRIGGERED, (void *)(uintptr_t)i), 0);
+	}
+
+	uint64_t start = omrtime_hires_clock();
+	for (uint32_t round = 0; round < EVENTLOOP_BENCH_ROUNDS; round++) {
+		uint32_t expected = sendRound(OMRPORTLIB, connections, round);
+		uint32_t received = 0;
+		while (received < expected) {
+			int32_t ready = omrsock_eventloop_wait(loop, events, 256, 5000);
+			if (ready <= 0) {
+				ADD_FAILURE() << "omrsock_eventloop_wait returned " << ready << " with " << (expected - received) << " bytes outstanding";
+				break;
+			}
+			for (int32_t i = 0; i < ready; i++) {
+				uintptr_t index = (uintptr_t)events[i].userData;
+				EXPECT_EQ(events[i].socket, connections->accepted[index]);
+				received += drainSocket(OMRPORTLIB, events[i].socket);
+			}
+		}
+		EXPECT_EQ(received, expected);
+	}
+	uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	for (uint32_t i = 0; i < connections->count; i++) {
+		EXPECT_EQ(omrsock_eventloop_remove(loop, connections->accepted[i]), 0);
+	}
+	EXPECT_EQ(omrsock_eventloop_destroy(&loop), 0);
+	return elapsed;
+}
+
+/**
+ * Receive each round with omrsock_poll over every connection.
+ * @return the elapsed time in microseconds
+ */
+static uint64_t
+runPollRounds(struct OMRPortLibrary *portLibrary, EventLoopBenchConnections *connections)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRPollFd *pollArray = (OMRPollFd *)omrmem_allocate_memory(connections->count * sizeof(OMRPollFd), OMRMEM_CATEGORY_PORT_LIBRARY);
+
+	EXPECT_NE(pollArray, (void *)NULL);
+	if (NULL == pollArray) {
+		return 0;
+	}
+	for (uint32_t i = 0; i < connections->count; i++) {
+		EXPECT_EQ(omrsock_pollfd_init(&pollArray[i], connections->accepted[i], OMRSOCK_POLLIN), 0);
+	}
+
+	uint64_t start = omrtime_hires_clock();
+	for (uint32_t round = 0; round < EVENTLOOP_BENCH_ROUNDS; round++) {
+		uint32_t expected = sendRound(OMRPORTLIB, connections, round);
+		uint32_t received = 0;
+		while (received < expected) {
+			int32_t ready = omrsock_poll(pollArray, connections->count, 5000);
+			if (ready <= 0) {
+				ADD_FAILURE() << "omrsock_poll returned " << ready << " with " << (expected - received) << " bytes outstanding";
+				break;
+			}
+			for (uint32_t i = 0; i < connections->count; i++) {
+				omrsock_socket_t sock = NULL;
+				int16_t revents = 0;
+				omrsock_get_pollfd_info(&pollArray[i], &sock, &revents);
+				if (0 != (revents & OMRSOCK_POLLIN)) {
+					received += drainSocket(OMRPORTLIB, sock);
+				}
+			}
+		}
+		EXPECT_EQ(received, expected);
+	}
+	uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	omrmem_free_memory(pollArray);
+	return elapsed;
+}
+
+/**
+ * Compare the time the event loop and omrsock_poll take to find the few active
+ * connections among thousands of idle loopback connections.
+ */
+TEST(PortSockTest, eventloop_benchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	EventLoopBenchConnections connections;
+	omrsock_eventloop_t loop = NULL;
+	uint64_t limit = 0;
+	uint32_t count = EVENTLOOP_BENCH_MAX_CONNECTIONS;
+
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == omrsock_eventloop_create(&loop)) {
+		return;
+	}
+	EXPECT_EQ(omrsock_eventloop_destroy(&loop), 0);
+
+	/* each connection takes two descriptors, leave some for the rest of the test */
+	if (OMRPORT_LIMIT_LIMITED == omrsysinfo_get_limit(OMRPORT_RESOURCE_FILE_DESCRIPTORS, &limit)) {
+		count = (uint32_t)OMR_MIN((uint64_t)count, (limit > 128) ? ((limit - 128) / 2) : 0);
+	}
+	if (count < EVENTLOOP_BENCH_ACTIVE_STRIDE) {
+		return;
+	}
+
+	memset(&connections, 0, sizeof(connections));
+	openConnections(OMRPORTLIB, &connections, count);
+	if (!HasFatalFailure()) {
+		uint64_t eventLoopMicros = runEventLoopRounds(OMRPORTLIB, &connections);
+		uint64_t pollMicros = runPollRounds(OMRPORTLIB, &connections);
+		omrtty_printf("eventloop: %u connections, %u rounds in %llu us\n", connections.count, EVENTLOOP_BENCH_ROUNDS, (unsigned long long)eventLoopMicros);
+		omrtty_printf("poll:      %u connections, %u rounds in %llu us\n", connections.count, EVENTLOOP_BENCH_ROUNDS, (unsigned long long)pollMicros);
+	}
+	closeConnections(OMRPORTLIB, &connections);
+}
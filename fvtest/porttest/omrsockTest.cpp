@@ -157,6 +157,18 @@ TEST(PortSockTest, library_function_pointers_not_null)
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_int, (void *)NULL);
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_linger, (void *)NULL);
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_timeval, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_create, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_destroy, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_add, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_modify, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_remove, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_timer_add, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_timer_cancel, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_wait, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_sendmsg, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_recvmsg, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_sendfile, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_get_zerocopy_completion, (void *)NULL);
 }
 
 /**
@@ -1324,3 +1336,339 @@ TEST(PortSockTest, poll_functionality_many_sockets)
 		EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &sockets[i]), 0);
 	}
 }
+
+/**
+ * Test the event loop with an edge triggered socket, @ref omrsock_eventloop_add,
+ * @ref omrsock_eventloop_modify, @ref omrsock_eventloop_remove and @ref omrsock_eventloop_wait.
+ *
+ * An edge triggered socket is reported once when data arrives, and not again until more data arrives.
+ */
+TEST(PortSockTest, eventloop_edge_triggered)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	OMRSockAddrStorage clientSockAddr;
+	omrsock_socket_t clientSocket = NULL;
+	OMRSockAddrStorage connectedServerSockAddr;
+	omrsock_socket_t connectedServerSocket = NULL;
+	omrsock_eventloop_t loop = NULL;
+	OMRSockEvent events[4];
+	uint16_t port = 4930;
+	uint32_t inaddrAny;
+	uint8_t serverAddr[4];
+	int32_t userData = 0;
+	uint8_t buf[16];
+	int32_t rc = 0;
+
+	rc = OMRPORTLIB->sock_eventloop_create(OMRPORTLIB, &loop);
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc) {
+		return;
+	}
+	ASSERT_EQ(rc, 0);
+
+	inaddrAny = OMRPORTLIB->sock_htonl(OMRPORTLIB, OMRSOCK_INADDR_ANY);
+	memcpy(serverAddr, &inaddrAny, 4);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, &serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_STREAM, &serverSocket, &serverSockAddr);
+	connect_client_to_server(OMRPORTLIB, "localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_STREAM, &clientSocket, &clientSockAddr, &serverSockAddr);
+	ASSERT_EQ(OMRPORTLIB->sock_accept(OMRPORTLIB, serverSocket, &connectedServerSockAddr, &connectedServerSocket), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_fcntl(OMRPORTLIB, connectedServerSocket, OMRSOCK_O_NONBLOCK), 0);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_EVENT_READ | OMRSOCK_EVENT_EDGE_TRIGGERED, &userData), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 0), 0);
+
+	/* Data arriving is reported once, with the socket and its userData. */
+	ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, clientSocket, (uint8_t *)"ping", 4, 0), 4);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 5000), 1);
+	EXPECT_EQ(events[0].socket, connectedServerSocket);
+	EXPECT_EQ(events[0].userData, (void *)&userData);
+	EXPECT_NE(events[0].events & OMRSOCK_EVENT_READ, (uint32_t)0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 0), 0);
+
+	/* Drain the socket until it would block, then more data is reported again. */
+	EXPECT_EQ(OMRPORTLIB->sock_recv(OMRPORTLIB, connectedServerSocket, buf, sizeof(buf), 0), 4);
+	EXPECT_LT(OMRPORTLIB->sock_recv(OMRPORTLIB, connectedServerSocket, buf, sizeof(buf), 0), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, clientSocket, (uint8_t *)"pong", 4, 0), 4);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 5000), 1);
+	EXPECT_EQ(events[0].socket, connectedServerSocket);
+
+	/* A level triggered socket waiting to write is reported on every wait. */
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_modify(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_EVENT_WRITE, NULL), 0);
+	for (int32_t i = 0; i < 2; i++) {
+		ASSERT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 5000), 1);
+		EXPECT_EQ(events[0].socket, connectedServerSocket);
+		EXPECT_EQ(events[0].userData, (void *)NULL);
+		EXPECT_NE(events[0].events & OMRSOCK_EVENT_WRITE, (uint32_t)0);
+	}
+
+	/* The peer closing is reported as a hangup. */
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_modify(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_EVENT_READ, NULL), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 5000), 1);
+	EXPECT_NE(events[0].events & OMRSOCK_EVENT_HANGUP, (uint32_t)0);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 0), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_destroy(OMRPORTLIB, &loop), 0);
+	EXPECT_EQ(loop, (void *)NULL);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+}
+
+/**
+ * Test the timers of an event loop, @ref omrsock_eventloop_timer_add and
+ * @ref omrsock_eventloop_timer_cancel.
+ *
+ * A one-shot timer fires once, a periodic timer fires repeatedly and a cancelled timer never fires.
+ */
+TEST(PortSockTest, eventloop_timers)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	omrsock_eventloop_t loop = NULL;
+	omrsock_timer_t onceTimer = NULL;
+	omrsock_timer_t periodicTimer = NULL;
+	omrsock_timer_t cancelledTimer = NULL;
+	OMRSockEvent events[4];
+	int32_t once = 0;
+	int32_t periodic = 0;
+	int32_t cancelled = 0;
+	int32_t rc = 0;
+
+	rc = OMRPORTLIB->sock_eventloop_create(OMRPORTLIB, &loop);
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc) {
+		return;
+	}
+	ASSERT_EQ(rc, 0);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_timer_add(OMRPORTLIB, loop, 20, 0, &once, &onceTimer), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_timer_add(OMRPORTLIB, loop, 5, 5, &periodic, &periodicTimer), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_timer_add(OMRPORTLIB, loop, 10, 0, &cancelled, &cancelledTimer), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_timer_cancel(OMRPORTLIB, loop, &cancelledTimer), 0);
+	EXPECT_EQ(cancelledTimer, (void *)NULL);
+
+	int32_t onceCount = 0;
+	int32_t periodicCount = 0;
+	int64_t start = OMRPORTLIB->time_current_time_millis(OMRPORTLIB);
+	/* The wait returns when the next timer expires, not after the 10 second timeout. */
+	while ((periodicCount < 5) || (0 == onceCount)) {
+		ASSERT_LT(OMRPORTLIB->time_current_time_millis(OMRPORTLIB) - start, 10000);
+		rc = OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 10000);
+		ASSERT_GE(rc, 0);
+		for (int32_t i = 0; i < rc; i++) {
+			EXPECT_EQ(events[i].events, (uint32_t)OMRSOCK_EVENT_TIMER);
+			EXPECT_EQ(events[i].socket, (void *)NULL);
+			if (&once == events[i].userData) {
+				onceCount += 1;
+			} else if (&periodic == events[i].userData) {
+				periodicCount += 1;
+			} else {
+				ADD_FAILURE() << "unexpected timer userData " << events[i].userData;
+			}
+		}
+	}
+	EXPECT_EQ(onceCount, 1);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_timer_cancel(OMRPORTLIB, loop, &periodicTimer), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 20), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_destroy(OMRPORTLIB, &loop), 0);
+}
+
+/**
+ * Create a connected pair of stream sockets on the loopback interface.
+ *
+ * @param[in] portLibrary
+ * @param[out] serverSocket The listening socket.
+ * @param[out] clientSocket The client end of the connection.
+ * @param[out] connectedSocket The server end of the connection.
+ */
+static void
+connect_stream_pair(struct OMRPortLibrary *portLibrary, omrsock_socket_t *serverSocket, omrsock_socket_t *clientSocket, omrsock_socket_t *connectedSocket)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRSockAddrStorage serverSockAddr;
+	OMRSockAddrStorage clientSockAddr;
+	OMRSockAddrStorage connectedSockAddr;
+	uint16_t port = 4930;
+	uint8_t serverAddr[4];
+
+	uint32_t inaddrAny = OMRPORTLIB->sock_htonl(OMRPORTLIB, OMRSOCK_INADDR_ANY);
+	memcpy(serverAddr, &inaddrAny, 4);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, &serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_STREAM, serverSocket, &serverSockAddr);
+	connect_client_to_server(OMRPORTLIB, "localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_STREAM, clientSocket, &clientSockAddr, &serverSockAddr);
+	ASSERT_EQ(OMRPORTLIB->sock_accept(OMRPORTLIB, *serverSocket, &connectedSockAddr, connectedSocket), 0);
+}
+
+/**
+ * Test scatter-gather I/O with @ref omrsock_sendmsg and @ref omrsock_recvmsg.
+ *
+ * A message gathered from three buffers is received into two buffers of different sizes.
+ */
+TEST(PortSockTest, sendmsg_recvmsg)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSocket = NULL;
+	omrsock_socket_t connectedSocket = NULL;
+	char part1[] = "Scatter";
+	char part2[] = "-gather ";
+	char part3[] = "sockets.";
+	char head[10];
+	char tail[13];
+	OMRIOVec sendIov[3];
+	OMRIOVec recvIov[2];
+
+	ASSERT_NO_FATAL_FAILURE(connect_stream_pair(OMRPORTLIB, &serverSocket, &clientSocket, &connectedSocket));
+
+	sendIov[0].iov_base = part1;
+	sendIov[0].iov_len = strlen(part1);
+	sendIov[1].iov_base = part2;
+	sendIov[1].iov_len = strlen(part2);
+	sendIov[2].iov_base = part3;
+	sendIov[2].iov_len = strlen(part3);
+	recvIov[0].iov_base = head;
+	recvIov[0].iov_len = sizeof(head);
+	recvIov[1].iov_base = tail;
+	recvIov[1].iov_len = sizeof(tail);
+
+	EXPECT_EQ(OMRPORTLIB->sock_sendmsg(OMRPORTLIB, connectedSocket, NULL, 1, 0), OMRPORT_ERROR_INVALID_ARGUMENTS);
+	EXPECT_EQ(OMRPORTLIB->sock_sendmsg(OMRPORTLIB, connectedSocket, sendIov, 0, 0), OMRPORT_ERROR_INVALID_ARGUMENTS);
+
+	ASSERT_EQ(OMRPORTLIB->sock_sendmsg(OMRPORTLIB, connectedSocket, sendIov, 3, 0), 23);
+	ASSERT_EQ(OMRPORTLIB->sock_recvmsg(OMRPORTLIB, clientSocket, recvIov, 2, OMRSOCK_MSG_WAITALL), 23);
+	EXPECT_EQ(memcmp(head, "Scatter-ga", sizeof(head)), 0);
+	EXPECT_EQ(memcmp(tail, "ther sockets.", sizeof(tail)), 0);
+
+	/* The peer closing the connection is reported by a 0 byte receive. */
+	ASSERT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_recvmsg(OMRPORTLIB, clientSocket, recvIov, 2, 0), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+}
+
+/**
+ * Test @ref omrsock_sendfile, sending part of a file and then the end of the file.
+ *
+ * The offset is advanced by the bytes sent, and sending stops at the end of the file.
+ */
+TEST(PortSockTest, sendfile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *fileName = "omrsockTest_sendfile.tmp";
+	const intptr_t fileSize = 100000;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSocket = NULL;
+	omrsock_socket_t connectedSocket = NULL;
+	uint8_t *contents = NULL;
+	uint8_t *received = NULL;
+	OMRIOVec recvIov;
+	int64_t offset = 0;
+	intptr_t fd = -1;
+
+	contents = (uint8_t *)omrmem_allocate_memory(2 * fileSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	ASSERT_NE(contents, (void *)NULL);
+	received = contents + fileSize;
+	for (intptr_t i = 0; i < fileSize; i++) {
+		contents[i] = (uint8_t)(i * 7 + (i >> 8));
+	}
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenWrite | EsOpenRead | EsOpenTruncate, 0666);
+	ASSERT_NE(fd, -1);
+	ASSERT_EQ(omrfile_write(fd, contents, fileSize), fileSize);
+
+	ASSERT_NO_FATAL_FAILURE(connect_stream_pair(OMRPORTLIB, &serverSocket, &clientSocket, &connectedSocket));
+
+	offset = -1;
+	EXPECT_EQ(OMRPORTLIB->sock_sendfile(OMRPORTLIB, connectedSocket, fd, &offset, 10), OMRPORT_ERROR_INVALID_ARGUMENTS);
+	EXPECT_EQ(OMRPORTLIB->sock_sendfile(OMRPORTLIB, connectedSocket, fd, NULL, 10), OMRPORT_ERROR_INVALID_ARGUMENTS);
+
+	/* The file position is not used, the data comes from the given offset. */
+	offset = 1000;
+	ASSERT_EQ(OMRPORTLIB->sock_sendfile(OMRPORTLIB, connectedSocket, fd, &offset, 50000), 50000);
+	EXPECT_EQ(offset, 51000);
+	recvIov.iov_base = received;
+	recvIov.iov_len = 50000;
+	ASSERT_EQ(OMRPORTLIB->sock_recvmsg(OMRPORTLIB, clientSocket, &recvIov, 1, OMRSOCK_MSG_WAITALL), 50000);
+	EXPECT_EQ(memcmp(received, contents + 1000, 50000), 0);
+
+	/* Only the bytes up to the end of the file are sent. */
+	offset = fileSize - 1000;
+	ASSERT_EQ(OMRPORTLIB->sock_sendfile(OMRPORTLIB, connectedSocket, fd, &offset, 5000), 1000);
+	EXPECT_EQ(offset, fileSize);
+	recvIov.iov_len = 1000;
+	ASSERT_EQ(OMRPORTLIB->sock_recvmsg(OMRPORTLIB, clientSocket, &recvIov, 1, OMRSOCK_MSG_WAITALL), 1000);
+	EXPECT_EQ(memcmp(received, contents + fileSize - 1000, 1000), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_sendfile(OMRPORTLIB, connectedSocket, fd, &offset, 5000), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(omrfile_close(fd), 0);
+	omrfile_unlink(fileName);
+	omrmem_free_memory(contents);
+}
+
+/**
+ * Test zero-copy sends with @ref omrsock_sendmsg and their completion notifications,
+ * @ref omrsock_get_zerocopy_completion.
+ *
+ * Loopback connections copy the data, but the completions are still reported.
+ */
+TEST(PortSockTest, sendmsg_zerocopy)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSocket = NULL;
+	omrsock_socket_t connectedSocket = NULL;
+	uint8_t payload[2][4096];
+	uint8_t received[2 * 4096];
+	OMRIOVec iov;
+	uint32_t firstSend = 0;
+	uint32_t lastSend = 0;
+	uint32_t completedSends = 0;
+	BOOLEAN copied = FALSE;
+	int32_t enable = 1;
+	int32_t rc = 0;
+
+	ASSERT_NO_FATAL_FAILURE(connect_stream_pair(OMRPORTLIB, &serverSocket, &clientSocket, &connectedSocket));
+	memset(payload[0], 'a', sizeof(payload[0]));
+	memset(payload[1], 'b', sizeof(payload[1]));
+
+	rc = OMRPORTLIB->sock_setsockopt_int(OMRPORTLIB, connectedSocket, OMRSOCK_SOL_SOCKET, OMRSOCK_SO_ZEROCOPY, &enable);
+	if (0 != rc) {
+		/* The platform or kernel has no zero-copy sends. */
+		portTestEnv->log("Zero-copy sends are not available, rc=%d\n", rc);
+	} else {
+		for (int32_t i = 0; i < 2; i++) {
+			iov.iov_base = payload[i];
+			iov.iov_len = sizeof(payload[i]);
+			ASSERT_EQ(OMRPORTLIB->sock_sendmsg(OMRPORTLIB, connectedSocket, &iov, 1, OMRSOCK_MSG_ZEROCOPY), (intptr_t)sizeof(payload[i]));
+		}
+		iov.iov_base = received;
+		iov.iov_len = sizeof(received);
+		ASSERT_EQ(OMRPORTLIB->sock_recvmsg(OMRPORTLIB, clientSocket, &iov, 1, OMRSOCK_MSG_WAITALL), (intptr_t)sizeof(received));
+		EXPECT_EQ(memcmp(received, payload, sizeof(received)), 0);
+
+		/* Sends 0 and 1 complete, possibly reported together in one notification. */
+		for (int32_t attempts = 0; (completedSends < 2) && (attempts < 500); attempts++) {
+			rc = OMRPORTLIB->sock_get_zerocopy_completion(OMRPORTLIB, connectedSocket, &firstSend, &lastSend, &copied);
+			ASSERT_GE(rc, 0);
+			if (1 == rc) {
+				EXPECT_EQ(firstSend, completedSends);
+				EXPECT_GE(lastSend, firstSend);
+				completedSends = lastSend + 1;
+			} else {
+				omrthread_sleep(10);
+			}
+		}
+		EXPECT_EQ(completedSends, (uint32_t)2);
+		EXPECT_EQ(OMRPORTLIB->sock_get_zerocopy_completion(OMRPORTLIB, connectedSocket, &firstSend, &lastSend, &copied), 0);
+	}
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "testHelpers.hpp"
+
+#define TIME_BENCH_CALLS 2000000
+
+typedef int64_t (*TimeBenchClock)(struct OMRPortLibrary *portLibrary);
+
+static int64_t
+hiresClock(struct OMRPortLibrary *portLibrary)
+{
+	return (int64_t)portLibrary->time_hires_clock(portLibrary);
+}
+
+/**
+ * Call a clock TIME_BENCH_CALLS times.
+ * @return the average cost of a call in nanoseconds
+ */
+static double
+timeClockCalls(struct OMRPortLibrary *portLibrary, TimeBenchClock clock)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	volatile int64_t sink = 0;
+
+	uint64_t start = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < TIME_BENCH_CALLS; i++) {
+		sink += clock(portLibrary);
+	}
+	uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+	return (double)elapsed / TIME_BENCH_CALLS;
+}
+
+/**
+ * Compare the cost per call of omrtime_fast_nano_time with the clocks it is meant to
+ * replace on hot paths.
+ */
+TEST(PortTimeTest, time_fast_nano_time_benchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	/* warm up the code and the vDSO pages */
+	timeClockCalls(OMRPORTLIB, OMRPORTLIB->time_fast_nano_time);
+
+	double nanoTimeCost = timeClockCalls(OMRPORTLIB, OMRPORTLIB->time_nano_time);
+	double hiresClockCost = timeClockCalls(OMRPORTLIB, hiresClock);
+	double fastNanoTimeCost = timeClockCalls(OMRPORTLIB, OMRPORTLIB->time_fast_nano_time);
+
+	omrtty_printf("omrtime_nano_time:      %.1f ns per call\n", nanoTimeCost);
+	omrtty_printf("omrtime_hires_clock:    %.1f ns per call\n", hiresClockCost);
+	omrtty_printf("omrtime_fast_nano_time: %.1f ns per call\n", fastNanoTimeCost);
+}
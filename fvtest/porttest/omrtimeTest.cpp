@@ -126,6 +126,11 @@ TEST(PortTimeTest, time_test0)
 		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_hires_delta is NULL\n");
 	}
 
+	/* omrtime_test_fast_nano_time */
+	if (NULL == OMRPORTLIB->time_fast_nano_time) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_fast_nano_time is NULL\n");
+	}
+
 	reportTestExit(OMRPORTLIB, testName);
 }
 
@@ -760,3 +765,50 @@ TEST(PortTimeTest, time_test_hires_delta_rounding)
 exit:
 	reportTestExit(OMRPORTLIB, testName);
 }
+
+/**
+ * Verify that omrtime_fast_nano_time() moves forward and measures intervals to within 1%
+ * of omrtime_nano_time().
+ *
+ * Functions verified by this test:
+ * @arg @ref omrtime.c::omrtime_fast_nano_time "omrtime_fast_nano_time()"
+ */
+TEST(PortTimeTest, time_test_fast_nano_time)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrtime_test_fast_nano_time";
+	int64_t previous = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	previous = omrtime_fast_nano_time();
+	for (i = 0; i < 100000; i++) {
+		int64_t now = omrtime_fast_nano_time();
+		if (now < previous) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_fast_nano_time went backwards, previous=%lld, now=%lld\n", previous, now);
+			break;
+		}
+		previous = now;
+	}
+
+	for (i = 0; i < J9TIME_REPEAT_TEST; i++) {
+		int64_t fastStart = omrtime_fast_nano_time();
+		int64_t nanoStart = omrtime_nano_time();
+		int64_t nanoElapsed = 0;
+		int64_t fastElapsed = 0;
+		double error = 0.0;
+
+		omrthread_sleep(100);
+		nanoElapsed = omrtime_nano_time() - nanoStart;
+		fastElapsed = omrtime_fast_nano_time() - fastStart;
+
+		error = omrtime_test_compute_error_pct((double)nanoElapsed, (double)fastElapsed);
+		portTestEnv->log("fast: %lld ns    nano: %lld ns    error: %lf\n", fastElapsed, nanoElapsed, error);
+		if (error > 0.01) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_fast_nano_time measured %lld ns where omrtime_nano_time measured %lld ns\n", fastElapsed, nanoElapsed);
+		}
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
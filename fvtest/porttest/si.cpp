@@ -3080,6 +3080,63 @@ TEST_F(CgroupTest, sysinfo_cgroup_subsystem_iterator)
 	reportTestExit(OMRPORTLIB, testName);
 	return;
 }
+
+/**
+ * Test omrsysinfo_get_resource_snapshot and omrsysinfo_refresh_resource_snapshot.
+ *
+ * The cached snapshot must agree with the values read directly, and a refresh must
+ * publish a new generation.
+ */
+TEST_F(CgroupTest, sysinfo_get_resource_snapshot)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRResourceSnapshot snapshot;
+	OMRResourceSnapshot refreshed;
+	int32_t rc = 0;
+
+	rc = omrsysinfo_get_resource_snapshot(&snapshot);
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc) {
+		return;
+	}
+	ASSERT_EQ(rc, 0);
+	EXPECT_GE(snapshot.generation, (uint64_t)1);
+	EXPECT_EQ(omrsysinfo_get_resource_snapshot(NULL), OMRPORT_ERROR_INVALID_ARGUMENTS);
+
+#if defined(LINUX) && !defined(OMRZTPF)
+	omrsysinfo_cgroup_enable_subsystems(OMR_CGROUP_SUBSYSTEM_ALL);
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+	ASSERT_EQ(omrsysinfo_refresh_resource_snapshot(), 0);
+	ASSERT_EQ(omrsysinfo_get_resource_snapshot(&refreshed), 0);
+	EXPECT_GT(refreshed.generation, snapshot.generation);
+
+	EXPECT_EQ(refreshed.onlineCPUs, (uint64_t)omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE));
+	EXPECT_EQ(refreshed.boundCPUs, (uint64_t)omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_BOUND));
+
+#if defined(LINUX) && !defined(OMRZTPF)
+	uint64_t memLimit = 0;
+	if (0 == omrsysinfo_cgroup_get_memlimit(&memLimit)) {
+		EXPECT_TRUE(OMR_ARE_ANY_BITS_SET(refreshed.flags, OMRPORT_RESOURCE_SNAPSHOT_MEMORY_LIMIT_SET));
+		EXPECT_EQ(refreshed.memoryLimit, memLimit);
+	} else {
+		EXPECT_FALSE(OMR_ARE_ANY_BITS_SET(refreshed.flags, OMRPORT_RESOURCE_SNAPSHOT_MEMORY_LIMIT_SET));
+	}
+	if (OMR_ARE_ANY_BITS_SET(refreshed.flags, OMRPORT_RESOURCE_SNAPSHOT_CPU_QUOTA_SET)) {
+		EXPECT_GT(refreshed.cpuQuotaMillicores, (uint64_t)0);
+	}
+	if (OMR_ARE_ANY_BITS_SET(refreshed.flags, OMRPORT_RESOURCE_SNAPSHOT_MEMORY_PRESSURE_AVAILABLE)) {
+		/* hundredths of a percent */
+		EXPECT_LE(refreshed.memoryPressureSome, (uint32_t)10000);
+		EXPECT_LE(refreshed.memoryPressureFull, refreshed.memoryPressureSome);
+	}
+	portTestEnv->log("resource snapshot: generation %llu, online CPUs %llu, bound CPUs %llu, CPU quota %llu, memory limit %llu, memory pressure %u/%u, flags 0x%x\n",
+			refreshed.generation, refreshed.onlineCPUs, refreshed.boundCPUs, refreshed.cpuQuotaMillicores,
+			refreshed.memoryLimit, refreshed.memoryPressureSome, refreshed.memoryPressureFull, refreshed.flags);
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+	/* the background refresher only ever moves the generation forward */
+	ASSERT_EQ(omrsysinfo_get_resource_snapshot(&snapshot), 0);
+	EXPECT_GE(snapshot.generation, refreshed.generation);
+}
 #else /* !defined(LINUX) || (GTEST_GCC_VER_ >= 40900) */
 #pragma message("Cgroup tests are disabled due to an unsupported compiler.")
 #endif /* !defined(LINUX) || (GTEST_GCC_VER_ >= 40900) */
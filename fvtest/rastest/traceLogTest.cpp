@@ -27,7 +27,9 @@
 #include "omrTest.h"
 #include "omrTestHelpers.h"
 #include "omrtrace.h"
+#include "omrtraceformat.h"
 #include "omrvm.h"
+#include "ute_dataformat.h"
 #include "ut_omr_test.h"
 
 #include "AtomicSupport.hpp"
@@ -59,6 +61,13 @@ typedef struct TestChildThreadData {
 	PerThreadWrapBuffer wrapBuffer;
 } TestChildThreadData;
 
+typedef struct FormattedTracePoints {
+	uintptr_t count;
+	uint64_t checksum;
+	uint64_t lastTimeStamp;
+	BOOLEAN ordered;
+} FormattedTracePoints;
+
 typedef struct FailingSubscriberData {
 	uint32_t callCount;
 	uint32_t alarmCount;
@@ -73,7 +82,12 @@ static omr_error_t countTracepointsIter(void *userData, const char *tpMod, const
 										const UtTraceRecord *record, uint32_t firstParameterOffset, uint32_t parameterDataLength,
 										int32_t isBigEndian);
 static omr_error_t failOnSecondCall(UtSubscription *subscriptionID);
+static omr_error_t slowSubscriber(UtSubscription *subscriptionID);
 static void failOnSecondCallAlarm(UtSubscription *subscriptionID);
+static char *getUnknownFormatString(const char *componentName, int32_t tracepoint);
+static omr_error_t collectFormattedTracePoint(void *userData, const char *threadName, uint64_t threadId, uint64_t timeStamp, const char *formattedTracePoint);
+static uint64_t hashString(const char *string);
+static void formatTraceFileBuffers(OMRPortLibrary *portLib, char *fileName, uintptr_t *bufferCount, uintptr_t *tracePointCount, uint64_t *tracePointChecksum);
 
 static const char *lowercaseAlpha = "abcdefghijklmnopqrstuvwxyz";
 static const char *uppercaseAlpha = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
@@ -139,7 +153,12 @@ static const char *ibmText2[] = {
 	"the essence of what sets IBM apart."
 };
 
-TEST(TraceLogTest, stressTraceBufferManagement)
+/*
+ * Run the stress test with the given trace options.
+ * When lossless is FALSE the publish policy may discard buffers, so only upper bounds of the counts are checked.
+ */
+static void
+stressTraceBufferManagement(const char *trcOpts, BOOLEAN lossless)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
 	OMRTestVM testVM;
@@ -181,7 +200,7 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 	 * is fired from unblock_spinlock_threads() via omrthread_monitor_exit(omrVM->_vmThreadListMutex) in
 	 * OMR_Thread_FirstInit().
 	 */
-	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "buffers=1k:maximal=all:maximal=!j9thr", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, trcOpts, NULL));
 	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "stressBufferManagement"));
 
 	/* load traceagent */
@@ -194,13 +213,22 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 
 	OMRTEST_ASSERT_ERROR_NONE(
 		ti->RegisterRecordSubscriber(vmthread, "fail", failOnSecondCall, failOnSecondCallAlarm, (void *)&failData, &failedSubscription));
+	if (NULL != strstr(trcOpts, "publish=async")) {
+		/* Back up the publish queue so that the back-pressure policy is applied */
+		UtSubscription *slowSubscription = NULL;
+		OMRTEST_ASSERT_ERROR_NONE(ti->RegisterRecordSubscriber(vmthread, "slow", slowSubscriber, NULL, NULL, &slowSubscription));
+	}
 
 	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
 		ASSERT_NO_FATAL_FAILURE(startChildThread(&testVM, &childThread[i], childThreadMain, &childData[i]));
 
-		/* Create a subscription for each thread */
-		OMRTEST_ASSERT_ERROR_NONE(
-			ti->RegisterRecordSubscriber(vmthread, "child", countTracepoints, NULL, (void *)&childData[i], &subscriptionID[i]));
+		/* Create a subscription for each thread. Tracepoints wrapping across a dropped buffer can't be
+		 * reassembled, so the tracepoints are only counted when no buffers are dropped.
+		 */
+		if (lossless) {
+			OMRTEST_ASSERT_ERROR_NONE(
+				ti->RegisterRecordSubscriber(vmthread, "child", countTracepoints, NULL, (void *)&childData[i], &subscriptionID[i]));
+		}
 	}
 	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
 		ASSERT_EQ(1, omrthread_resume(childThread[i]));
@@ -210,6 +238,22 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 	}
 	/* All tracepoints from the child threads should have been published when they terminated */
 
+	/* Wait for asynchronously published buffers, then check the publish queue statistics */
+	OMRTEST_ASSERT_ERROR_NONE(testVM.omrVM._trcEngine->omrTraceIntfS.FlushTraceData(OMR_TRACE_THREAD_FROM_VMTHREAD(vmthread)));
+	OMR_TracePublishStatistics stats;
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_getPublishStatistics(&testVM.omrVM, &stats));
+	ASSERT_EQ((uintptr_t)0, stats.queueDepth);
+	if (NULL != strstr(trcOpts, "publish=async")) {
+		/* each child thread fills at least 5 buffers */
+		ASSERT_LE((uintptr_t)(5 * NUM_CHILD_THREADS), stats.publishedBuffers + stats.droppedBuffers);
+		ASSERT_LE((uintptr_t)1, stats.queueHighWater);
+	} else {
+		ASSERT_EQ((uintptr_t)0, stats.publishedBuffers);
+	}
+	if (lossless) {
+		ASSERT_EQ((uintptr_t)0, stats.droppedBuffers);
+	}
+
 	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
 
 	/* The failed subscriber should have deregistered itself */
@@ -227,23 +271,140 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 
 	/* Verify counts of logged tracepoints */
 	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
-		if (childData[i].expectedLoggedCount != childData[i].loggedCount) {
-			printf("Unexpected loggedCount for thread \'%s\'\n", childData[i].traceData[0]);
+		if (lossless) {
+			if (childData[i].expectedLoggedCount != childData[i].loggedCount) {
+				printf("Unexpected loggedCount for thread \'%s\'\n", childData[i].traceData[0]);
+			}
+			ASSERT_EQ(childData[i].expectedLoggedCount, childData[i].loggedCount);
+		} else {
+			ASSERT_GE(childData[i].expectedLoggedCount, childData[i].loggedCount);
 		}
-		ASSERT_EQ(childData[i].expectedLoggedCount, childData[i].loggedCount);
 		ASSERT_EQ(0, childData[i].unloggedCount);
 		freeWrapBuffer(&childData[i].wrapBuffer);
 	}
 
 	/* Verify failed subscriber call counts */
-	ASSERT_EQ((uint32_t)1, failData.alarmCount);
-	/* Implementation detail: The callCount is guaranteed because subscriber callbacks are invoked under mutex. */
-	ASSERT_EQ((uint32_t)2, failData.callCount);
+	if (lossless) {
+		ASSERT_EQ((uint32_t)1, failData.alarmCount);
+		/* Implementation detail: The callCount is guaranteed because subscriber callbacks are invoked under mutex. */
+		ASSERT_EQ((uint32_t)2, failData.callCount);
+	} else {
+		ASSERT_GE((uint32_t)1, failData.alarmCount);
+		ASSERT_GE((uint32_t)2, failData.callCount);
+	}
 
 	/* Clean up trace file */
 	omrfile_unlink("traceLogTest.trc");
 }
 
+TEST(TraceLogTest, stressTraceBufferManagement)
+{
+	stressTraceBufferManagement("buffers=1k:maximal=all:maximal=!j9thr", TRUE);
+}
+
+TEST(TraceLogTest, stressAsyncPublishBlock)
+{
+	/* A queue depth of 2 makes the child threads wait for the publisher thread */
+	stressTraceBufferManagement("buffers=1k:publish=async,block,2:maximal=all:maximal=!j9thr", TRUE);
+}
+
+TEST(TraceLogTest, stressAsyncPublishGrow)
+{
+	stressTraceBufferManagement("buffers=1k:publish=async,grow:maximal=all:maximal=!j9thr", TRUE);
+}
+
+TEST(TraceLogTest, stressAsyncPublishDropOldest)
+{
+	stressTraceBufferManagement("buffers=1k:publish=async,dropoldest,2:maximal=all:maximal=!j9thr", FALSE);
+}
+
+TEST(TraceLogTest, mappedOutputFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	char fileName[] = "traceLogTestOutput.trc";
+	UtTraceFileIterator *fileIterator = NULL;
+	UtTracePointIterator *bufferIterator = NULL;
+	uintptr_t bufferCount = 0;
+	uintptr_t tracePointCount = 0;
+	uint64_t tracePointChecksum = 0;
+	FormattedTracePoints merged = { 0, 0, 0, TRUE };
+
+	/* A 16k file holds fewer buffers than the child threads fill, so the file wraps around */
+	stressTraceBufferManagement("buffers=1k:output=traceLogTestOutput.trc,16k:maximal=all:maximal=!j9thr", TRUE);
+
+	ASSERT_NO_FATAL_FAILURE(formatTraceFileBuffers(OMRPORTLIB, fileName, &bufferCount, &tracePointCount, &tracePointChecksum));
+
+	/* Every slot of the file was written, and each 1k buffer holds several tracepoints */
+	ASSERT_LT((uintptr_t)8, bufferCount);
+	ASSERT_GE((uintptr_t)16, bufferCount);
+	ASSERT_LT(bufferCount, tracePointCount);
+
+	/* Formatting the buffers in parallel produces the same tracepoints, in timestamp order. */
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTraceFileIterator(OMRPORTLIB, fileName, &fileIterator, getUnknownFormatString));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_formatTraceFile(fileIterator, 4, collectFormattedTracePoint, &merged));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTraceFileIterator(fileIterator));
+	ASSERT_EQ(tracePointCount, merged.count);
+	ASSERT_EQ(tracePointChecksum, merged.checksum);
+	ASSERT_TRUE(merged.ordered);
+
+	/* Overwrite the sequence number after the record in the first slot, as if its write was cut short. The torn slot is skipped. */
+	{
+		UtTraceFileHdr header;
+		uint64_t tornSequence = ~(uint64_t)0;
+		uintptr_t remainingBufferCount = 0;
+		intptr_t fd = omrfile_open(fileName, EsOpenRead | EsOpenWrite, 0);
+
+		ASSERT_LE(0, fd);
+		ASSERT_EQ((intptr_t)sizeof(header), omrfile_read(fd, &header, sizeof(header)));
+		ASSERT_EQ((int64_t)(header.header.length + sizeof(uint64_t) + header.bufferSize),
+				omrfile_seek(fd, header.header.length + sizeof(uint64_t) + header.bufferSize, EsSeekSet));
+		ASSERT_EQ((intptr_t)sizeof(tornSequence), omrfile_write(fd, &tornSequence, sizeof(tornSequence)));
+		omrfile_close(fd);
+
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTraceFileIterator(OMRPORTLIB, fileName, &fileIterator, getUnknownFormatString));
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTracePointIteratorForNextBuffer(fileIterator, &bufferIterator));
+		while (NULL != bufferIterator) {
+			remainingBufferCount += 1;
+			OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTracePointIterator(bufferIterator));
+			OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTracePointIteratorForNextBuffer(fileIterator, &bufferIterator));
+		}
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTraceFileIterator(fileIterator));
+		ASSERT_EQ(bufferCount - 1, remainingBufferCount);
+	}
+
+	omrfile_unlink(fileName);
+}
+
+TEST(TraceLogTest, mappedOutputFileManyBatches)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	char fileName[] = "traceLogTestBatches.trc";
+	UtTraceFileIterator *fileIterator = NULL;
+	uintptr_t bufferCount = 0;
+	uintptr_t tracePointCount = 0;
+	uint64_t tracePointChecksum = 0;
+
+	/* A 128k file holds more buffers than a batch of 16 buffers per worker */
+	stressTraceBufferManagement("buffers=1k:output=traceLogTestBatches.trc,128k:maximal=all:maximal=!j9thr", TRUE);
+
+	ASSERT_NO_FATAL_FAILURE(formatTraceFileBuffers(OMRPORTLIB, fileName, &bufferCount, &tracePointCount, &tracePointChecksum));
+	ASSERT_LT((uintptr_t)(2 * 16), bufferCount);
+
+	/* The tracepoints of all the batches are merged in timestamp order, however many workers format them */
+	for (uint32_t workerCount = 1; workerCount <= 2; workerCount++) {
+		FormattedTracePoints merged = { 0, 0, 0, TRUE };
+
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTraceFileIterator(OMRPORTLIB, fileName, &fileIterator, getUnknownFormatString));
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_formatTraceFile(fileIterator, workerCount, collectFormattedTracePoint, &merged));
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTraceFileIterator(fileIterator));
+		ASSERT_EQ(tracePointCount, merged.count);
+		ASSERT_EQ(tracePointChecksum, merged.checksum);
+		ASSERT_TRUE(merged.ordered);
+	}
+
+	omrfile_unlink(fileName);
+}
+
 static void
 startChildThread(OMRTestVM *testVM, omrthread_t *childThread, omrthread_entrypoint_t entryProc, TestChildThreadData *childData)
 {
@@ -360,6 +521,16 @@ countTracepoints(UtSubscription *subscriptionID)
 	return OMR_ERROR_NONE;
 }
 
+/*
+ * Take a millisecond to consume each buffer
+ */
+static omr_error_t
+slowSubscriber(UtSubscription *subscriptionID)
+{
+	omrthread_sleep(1);
+	return OMR_ERROR_NONE;
+}
+
 /*
  * Fail on 2nd call
  * Count the number of calls
@@ -384,3 +555,63 @@ failOnSecondCallAlarm(UtSubscription *subscriptionID)
 
 	VM_AtomicSupport::addU32(&failData->alarmCount, 1);
 }
+
+static char *
+getUnknownFormatString(const char *componentName, int32_t tracepoint)
+{
+	return (char *)"UNKNOWN TRACEPOINT ID";
+}
+
+static omr_error_t
+collectFormattedTracePoint(void *userData, const char *threadName, uint64_t threadId, uint64_t timeStamp, const char *formattedTracePoint)
+{
+	FormattedTracePoints *merged = (FormattedTracePoints *)userData;
+
+	merged->count += 1;
+	merged->checksum += hashString(formattedTracePoint);
+	if (timeStamp < merged->lastTimeStamp) {
+		merged->ordered = FALSE;
+	}
+	merged->lastTimeStamp = timeStamp;
+	return OMR_ERROR_NONE;
+}
+
+/*
+ * Format every buffer of a trace file one at a time, in file order
+ */
+static void
+formatTraceFileBuffers(OMRPortLibrary *portLib, char *fileName, uintptr_t *bufferCount, uintptr_t *tracePointCount, uint64_t *tracePointChecksum)
+{
+	UtTraceFileIterator *fileIterator = NULL;
+	UtTracePointIterator *bufferIterator = NULL;
+	char formatted[1024];
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTraceFileIterator(portLib, fileName, &fileIterator, getUnknownFormatString));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTracePointIteratorForNextBuffer(fileIterator, &bufferIterator));
+	while (NULL != bufferIterator) {
+		*bufferCount += 1;
+		while (NULL != omr_trc_formatNextTracePoint(bufferIterator, formatted, sizeof(formatted))) {
+			*tracePointCount += 1;
+			*tracePointChecksum += hashString(formatted);
+		}
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTracePointIterator(bufferIterator));
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTracePointIteratorForNextBuffer(fileIterator, &bufferIterator));
+	}
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTraceFileIterator(fileIterator));
+}
+
+static uint64_t
+hashString(const char *string)
+{
+	/* FNV-1a, so that the checksum of a set of strings doesn't depend on their order. The wall clock
+	 * time is skipped because the formatter derives it from the clock at the time of formatting. */
+	uint64_t hash = J9CONST_U64(14695981039346656037);
+	const char *afterTime = strstr(string, " GMT ");
+	if (NULL != afterTime) {
+		string = afterTime;
+	}
+	for (; '\0' != *string; string++) {
+		hash = (hash ^ (uint8_t)*string) * J9CONST_U64(1099511628211);
+	}
+	return hash;
+}
@@ -106,6 +106,8 @@ bool Tril::TRLangBuilder::cfgFor(const ASTNode* const tree, IlGenState* state) {
       auto targetId = state->findBlockByName(targetName);
       cfg()->addEdge(_currentBlock, _blocks[targetId]);
       isFallthroughNeeded = isFallthroughNeeded && opcode.isIf();
+      if (targetId <= _currentBlockNumber)
+         _methodSymbol->setMayHaveLoops(true);
       TraceIL("Added CFG edge from block %d to block %d (\"%s\") -> %s\n", _currentBlockNumber, targetId, targetName, tree->getName());
    }
 
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <set>
+
+#include "omrTest.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "omrutil.h"
+
+/* size of the buffer used by the throughput benchmark */
+#define CHECKSUM_BENCH_BUFFER_SIZE (16 * 1024 * 1024)
+
+/**
+ * Bit at a time reference CRC for a reflected polynomial.
+ */
+static U_32
+referenceCrc(U_32 polynomial, U_32 crc, const U_8 *bytes, uintptr_t len)
+{
+	crc = ~crc;
+	for (uintptr_t i = 0; i < len; i++) {
+		crc ^= bytes[i];
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ ((0 != (crc & 1)) ? polynomial : 0);
+		}
+	}
+	return ~crc;
+}
+
+static void
+fillPattern(U_8 *bytes, uintptr_t len)
+{
+	U_32 state = 0x12345678;
+	for (uintptr_t i = 0; i < len; i++) {
+		state = (state * 1103515245) + 12345;
+		bytes[i] = (U_8)(state >> 16);
+	}
+}
+
+TEST(UtilChecksumTest, crc32KnownValues)
+{
+	U_8 check[] = "123456789";
+
+	EXPECT_EQ(0xCBF43926U, omrcrc32(0, check, 9));
+	EXPECT_EQ(0xE3069283U, omrcrc32c(0, check, 9));
+	EXPECT_EQ(0U, omrcrc32(0, check, 0));
+	EXPECT_EQ(0U, omrcrc32(0, NULL, 9));
+	EXPECT_EQ(0U, omrcrc32c(0, NULL, 9));
+}
+
+/*
+ * The hardware paths take over at different lengths and alignments, so compare
+ * every length and starting offset around those boundaries with the reference.
+ */
+TEST(UtilChecksumTest, crc32MatchesReference)
+{
+	U_8 buffer[1200];
+	fillPattern(buffer, sizeof(buffer));
+
+	for (uintptr_t offset = 0; offset < 16; offset++) {
+		for (uintptr_t len = 0; (offset + len) <= sizeof(buffer); len += ((len < 300) ? 1 : 37)) {
+			ASSERT_EQ(referenceCrc(0xEDB88320, 0, buffer + offset, len), omrcrc32(0, buffer + offset, (U_32)len))
+				<< "offset " << offset << " length " << len;
+			ASSERT_EQ(referenceCrc(0x82F63B78, 0, buffer + offset, len), omrcrc32c(0, buffer + offset, (U_32)len))
+				<< "offset " << offset << " length " << len;
+		}
+	}
+}
+
+TEST(UtilChecksumTest, crc32Incremental)
+{
+	U_8 buffer[1000];
+	fillPattern(buffer, sizeof(buffer));
+	U_32 whole = omrcrc32(0, buffer, sizeof(buffer));
+	U_32 wholeC = omrcrc32c(0, buffer, sizeof(buffer));
+
+	for (U_32 split = 0; split <= sizeof(buffer); split += 7) {
+		U_32 crc = omrcrc32(omrcrc32(0, buffer, split), buffer + split, sizeof(buffer) - split);
+		U_32 crcC = omrcrc32c(omrcrc32c(0, buffer, split), buffer + split, sizeof(buffer) - split);
+		ASSERT_EQ(whole, crc) << "split " << split;
+		ASSERT_EQ(wholeC, crcC) << "split " << split;
+	}
+}
+
+TEST(UtilChecksumTest, hash64Stable)
+{
+	U_8 buffer[300 + 16];
+	U_8 copy[300];
+	fillPattern(buffer, sizeof(buffer));
+
+	for (uintptr_t len = 0; len <= 300; len++) {
+		U_64 hash = omrhash64(buffer, len, 0);
+		/* the result must not depend on alignment */
+		for (uintptr_t offset = 1; offset < 16; offset += 5) {
+			memmove(buffer + offset, buffer, len);
+			ASSERT_EQ(hash, omrhash64(buffer + offset, len, 0)) << "length " << len;
+			memmove(buffer, buffer + offset, len);
+		}
+		memcpy(copy, buffer, len);
+		ASSERT_EQ(hash, omrhash64(copy, len, 0));
+		ASSERT_NE(hash, omrhash64(buffer, len, 1)) << "length " << len;
+	}
+}
+
+TEST(UtilChecksumTest, hash64Distribution)
+{
+	std::set<U_64> hashes;
+	std::set<U_64> lowBits;
+	U_8 buffer[64];
+	fillPattern(buffer, sizeof(buffer));
+
+	/* sequential integer keys, the common case for pointer and id keyed tables */
+	for (U_64 key = 0; key < 100000; key++) {
+		hashes.insert(omrhash64(&key, sizeof(key), 0));
+		lowBits.insert(omrhash64(&key, sizeof(key), 0) & 0xffff);
+	}
+	EXPECT_EQ((size_t)100000, hashes.size());
+	/* 100000 keys should touch nearly all of 65536 low 16 bit buckets */
+	EXPECT_LT((size_t)(65536 * 3 / 4), lowBits.size());
+
+	/* flipping any single input bit changes about half of the output bits */
+	for (uintptr_t len = 1; len <= sizeof(buffer); len += 7) {
+		U_64 base = omrhash64(buffer, len, 0);
+		uintptr_t flipped = 0;
+		for (uintptr_t bit = 0; bit < (len * 8); bit++) {
+			buffer[bit / 8] ^= (U_8)(1 << (bit % 8));
+			U_64 diff = base ^ omrhash64(buffer, len, 0);
+			buffer[bit / 8] ^= (U_8)(1 << (bit % 8));
+			ASSERT_NE(0U, diff) << "length " << len << " bit " << bit;
+			for (; 0 != diff; diff &= diff - 1) {
+				flipped += 1;
+			}
+		}
+		uintptr_t average = flipped / (len * 8);
+		EXPECT_LE((uintptr_t)24, average) << "length " << len;
+		EXPECT_GE((uintptr_t)40, average) << "length " << len;
+	}
+}
+
+TEST(UtilChecksumTest, checksumBenchmark)
+{
+	omrthread_t self = NULL;
+	OMRPortLibrary portLib;
+	ASSERT_EQ(0, omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT));
+	ASSERT_EQ(0, omrport_init_library(&portLib, sizeof(OMRPortLibrary)));
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLib);
+
+	U_8 *buffer = (U_8 *)malloc(CHECKSUM_BENCH_BUFFER_SIZE);
+	ASSERT_TRUE(NULL != buffer);
+	fillPattern(buffer, CHECKSUM_BENCH_BUFFER_SIZE);
+
+	volatile U_64 sink = 0;
+	uint64_t start = omrtime_nano_time();
+	sink += omrcrc32(0, buffer, CHECKSUM_BENCH_BUFFER_SIZE);
+	uint64_t crcNanos = omrtime_nano_time() - start;
+
+	start = omrtime_nano_time();
+	sink += omrcrc32c(0, buffer, CHECKSUM_BENCH_BUFFER_SIZE);
+	uint64_t crcCNanos = omrtime_nano_time() - start;
+
+	start = omrtime_nano_time();
+	sink += omrhash64(buffer, CHECKSUM_BENCH_BUFFER_SIZE, 0);
+	uint64_t hashNanos = omrtime_nano_time() - start;
+
+	start = omrtime_nano_time();
+	for (U_64 key = 0; key < 1000000; key++) {
+		sink += omrhash64(&key, sizeof(key), 0);
+	}
+	uint64_t keyNanos = omrtime_nano_time() - start;
+
+	omrtty_printf("omrcrc32:  %llu MB/s\n", (unsigned long long)((uint64_t)CHECKSUM_BENCH_BUFFER_SIZE * 1000 / (crcNanos + 1)));
+	omrtty_printf("omrcrc32c: %llu MB/s\n", (unsigned long long)((uint64_t)CHECKSUM_BENCH_BUFFER_SIZE * 1000 / (crcCNanos + 1)));
+	omrtty_printf("omrhash64: %llu MB/s, %llu ns per 8 byte key\n",
+			(unsigned long long)((uint64_t)CHECKSUM_BENCH_BUFFER_SIZE * 1000 / (hashNanos + 1)),
+			(unsigned long long)(keyNanos / 1000000));
+
+	free(buffer);
+	portLib.port_shutdown_library(&portLib);
+	omrthread_detach(self);
+}
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "hookable_api.h"
+#include "hookbench_internal.h"
+
+/* dispatches issued by each benchmark thread */
+#define HOOK_BENCH_DISPATCHES_PER_THREAD 20000
+
+typedef struct HookBenchThreadData {
+	BenchHookInterface *hookInterface;
+	omrthread_monitor_t startMonitor;
+	volatile uintptr_t *started;
+	volatile uintptr_t *go;
+	uintptr_t dispatches;
+} HookBenchThreadData;
+
+static void
+benchListener(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData)
+{
+	((BenchHookEvent *)voidEventData)->value += 1;
+}
+
+static int J9THREAD_PROC
+benchThreadProc(void *arg)
+{
+	HookBenchThreadData *data = (HookBenchThreadData *)arg;
+
+	omrthread_monitor_enter(data->startMonitor);
+	*data->started += 1;
+	omrthread_monitor_notify_all(data->startMonitor);
+	while (0 == *data->go) {
+		omrthread_monitor_wait(data->startMonitor);
+	}
+	omrthread_monitor_exit(data->startMonitor);
+
+	for (uintptr_t i = 0; i < data->dispatches; i++) {
+		uintptr_t value = 0;
+		ALWAYS_TRIGGER_BENCHHOOK_EVENT(*data->hookInterface, value);
+	}
+	return 0;
+}
+
+/**
+ * Dispatch one event from threadCount threads at once and report the dispatch throughput.
+ * @return the total dispatch count reported by the aggregated statistics
+ */
+static uintptr_t
+runDispatchBenchmark(OMRPortLibrary *portLib, BenchHookInterface *hookInterface, uintptr_t threadCount, uintptr_t samplingInterval, const char *mode)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	omrthread_t threads[64];
+	HookBenchThreadData data;
+	omrthread_attr_t attr = NULL;
+	omrthread_monitor_t startMonitor = NULL;
+	volatile uintptr_t started = 0;
+	volatile uintptr_t go = 0;
+	J9HookInterface **hook = J9_HOOK_INTERFACE(*hookInterface);
+
+	EXPECT_EQ(0, J9HookInitializeInterface(hook, portLib, sizeof(*hookInterface)));
+	(*hook)->J9HookSetSamplingInterval(hook, samplingInterval);
+	EXPECT_EQ(0, (*hook)->J9HookRegisterWithCallSite(hook, BENCHHOOK_EVENT, benchListener, OMR_GET_CALLSITE(), NULL));
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&startMonitor, 0, "hook bench start"));
+	EXPECT_EQ(0, omrthread_attr_init(&attr));
+	EXPECT_EQ(0, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+
+	data.hookInterface = hookInterface;
+	data.startMonitor = startMonitor;
+	data.started = &started;
+	data.go = &go;
+	data.dispatches = HOOK_BENCH_DISPATCHES_PER_THREAD;
+
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		EXPECT_EQ(0, omrthread_create_ex(&threads[i], &attr, 0, benchThreadProc, &data));
+	}
+
+	omrthread_monitor_enter(startMonitor);
+	while (threadCount != started) {
+		omrthread_monitor_wait(startMonitor);
+	}
+	uint64_t start = omrtime_hires_clock();
+	go = 1;
+	omrthread_monitor_notify_all(startMonitor);
+	omrthread_monitor_exit(startMonitor);
+
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_join(threads[i]);
+	}
+	uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	EXPECT_EQ(0, omrhook_lib_control(J9HOOK_LIB_CONTROL_AGGREGATE_STATS, (uintptr_t)hook));
+	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO((J9CommonHookInterface *)hook, BENCHHOOK_EVENT);
+	uintptr_t count = eventDump->count;
+	if (1 == samplingInterval) {
+		/* the last and longest calls recorded by the dispatching threads are merged by the aggregation */
+		EXPECT_EQ((void *)benchListener, eventDump->lastHook.func_ptr);
+		EXPECT_EQ((void *)benchListener, eventDump->longestHook.func_ptr);
+	} else if (100 < samplingInterval) {
+		EXPECT_TRUE(NULL == eventDump->longestHook.func_ptr);
+	}
+
+	uintptr_t total = threadCount * HOOK_BENCH_DISPATCHES_PER_THREAD;
+	omrtty_printf("%s: %2zu threads, %zu dispatches in %llu us (%llu dispatches/ms)\n",
+			mode, threadCount, total, (unsigned long long)elapsed,
+			(unsigned long long)((0 == elapsed) ? 0 : ((uint64_t)total * 1000 / elapsed)));
+
+	omrthread_attr_destroy(&attr);
+	omrthread_monitor_destroy(startMonitor);
+	(*hook)->J9HookShutdownInterface(hook);
+	return count;
+}
+
+static void
+runDispatchBenchmarks(uintptr_t samplingInterval, const char *mode)
+{
+	omrthread_t self = NULL;
+	OMRPortLibrary portLib;
+	BenchHookInterface hookInterface;
+
+	ASSERT_EQ(0, omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT));
+	ASSERT_EQ(0, omrport_init_library(&portLib, sizeof(OMRPortLibrary)));
+
+	for (uintptr_t threadCount = 1; threadCount <= 64; threadCount *= 2) {
+		uintptr_t count = runDispatchBenchmark(&portLib, &hookInterface, threadCount, samplingInterval, mode);
+		EXPECT_EQ(threadCount * HOOK_BENCH_DISPATCHES_PER_THREAD, count);
+	}
+
+	portLib.port_shutdown_library(&portLib);
+	omrthread_detach(self);
+}
+
+TEST(HookDispatchBenchmark, timedEveryCall)
+{
+	runDispatchBenchmarks(1, "timed");
+}
+
+TEST(HookDispatchBenchmark, sampledTiming)
+{
+	runDispatchBenchmarks(64, "sampled");
+}
+
+TEST(HookDispatchBenchmark, untimed)
+{
+	runDispatchBenchmarks(J9HOOK_TAG_SAMPLING_MASK >> 16, "untimed");
+}
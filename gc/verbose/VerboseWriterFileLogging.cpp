@@ -290,6 +290,19 @@ MM_VerboseWriterFileLogging::findInitialFile(MM_EnvironmentBase *env)
 	return oldestFile; 
 }
 
+/**
+ * Advise the OS that a finished log file won't be read back, so its pages
+ * needn't stay in the page cache once they are written out. This matters most
+ * when rotating through large files.
+ * @param fd the log file, after all output to it has been passed to the OS
+ */
+void
+MM_VerboseWriterFileLogging::releaseFileCache(MM_EnvironmentBase *env, intptr_t fd)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	omrfile_fadvise(fd, 0, 0, OMRPORT_FILE_ADVICE_DONTNEED);
+}
+
 /**
  * Closes the agent's output stream.
  */
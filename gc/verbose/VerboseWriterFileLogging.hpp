@@ -84,6 +84,7 @@ protected:
 	bool initializeFilename(MM_EnvironmentBase *env, const char *filename);
 	bool initializeTokens(MM_EnvironmentBase *env);
 	char* expandFilename(MM_EnvironmentBase *env, uintptr_t currentFile);
+	void releaseFileCache(MM_EnvironmentBase *env, intptr_t fd);
 private:
 };
 
@@ -145,6 +145,9 @@ MM_VerboseWriterFileLoggingBuffered::closeFile(MM_EnvironmentBase *env)
 	if(NULL != _logFileStream) {
 		omrfilestream_write_text(_logFileStream, getFooter(env), strlen(getFooter(env)), J9STR_CODE_PLATFORM_RAW);
 		omrfilestream_write_text(_logFileStream, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+		if (0 == omrfilestream_sync(_logFileStream)) {
+			releaseFileCache(env, omrfilestream_fileno(_logFileStream));
+		}
 		omrfilestream_close(_logFileStream);
 		_logFileStream = NULL;
 	}
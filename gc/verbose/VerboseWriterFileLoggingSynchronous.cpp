@@ -144,8 +144,9 @@ MM_VerboseWriterFileLoggingSynchronous::closeFile(MM_EnvironmentBase *env)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	
 	if(-1 != _logFileDescriptor) {
-		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
-		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		/* footer and newline in one write */
+		omrfile_printf(_logFileDescriptor, "%s\n", getFooter(env));
+		releaseFileCache(env, _logFileDescriptor);
 		omrfile_close(_logFileDescriptor);
 		_logFileDescriptor = -1;
 	}
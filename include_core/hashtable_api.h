@@ -180,6 +180,15 @@ void
 hashTableRehash(J9HashTable *table);
 
 
+/**
+* @brief
+* @param *table
+* @return void
+*/
+void
+hashTableReclaimRetired(J9HashTable *table);
+
+
 /**
 * @brief
 * @param *table
@@ -79,11 +79,13 @@ typedef struct J9Pool {
 	uint16_t alignment;
 	uint16_t flags;
 	uint32_t memoryCategory;
+	uint32_t lock;
 } J9Pool;
 
 #define POOL_NO_ZERO  8
 #define POOL_ROUND_TO_PAGE_SIZE  16
 #define POOL_USES_HOLES  32
+#define POOL_CONCURRENT  64
 #define POOL_NEVER_FREE_PUDDLES  2
 #define POOL_ALLOC_TYPE_PUDDLE  1
 #define POOL_ALWAYS_KEEP_SORTED  4
@@ -105,6 +107,17 @@ typedef struct J9PoolState {
 
 #define POOLSTATE_FOLLOW_NEXT_POINTERS  1
 
+#define J9POOL_MAGAZINE_SIZE  32
+
+/*
+ * Per-thread cache of free elements for a POOL_CONCURRENT pool.
+ */
+typedef struct J9PoolMagazine {
+	struct J9Pool *pool;
+	uintptr_t count;
+	void *elements[J9POOL_MAGAZINE_SIZE];
+} J9PoolMagazine;
+
 #define pool_state J9PoolState
 
 #define J9POOLPUDDLE_FIRSTFREESLOT(parm) SRP_GET((parm)->firstFreeSlot, uintptr_t*)
@@ -51,6 +51,18 @@ extern "C" {
 #define J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32	0x00000004	/*!< Allocate table elements using the malloc32 function */
 #define J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION	0x00000008	/*!< Allow space optimized hashTable, some functions not supported */
 #define J9HASH_TABLE_DO_NOT_REHASH	0x00000010	/*!< Do not rehash the table while set */
+#define J9HASH_TABLE_CONCURRENT	0x00000020	/*!< Lock-free finds, writers synchronize internally (not with COLLISION_RESILIENT; ALLOW_SIZE_OPTIMIZATION is ignored) */
+#define J9HASH_TABLE_OPEN_ADDRESSING	0x00000040	/*!< Store entries inline, probed by groups of control bytes; entries move on add (not with COLLISION_RESILIENT or CONCURRENT) */
+
+/**
+ * Number of bucket lock stripes used by J9HASH_TABLE_CONCURRENT tables
+ */
+#define J9HASH_TABLE_CONCURRENT_LOCK_COUNT 64
+
+/**
+ * Number of control bytes examined together by J9HASH_TABLE_OPEN_ADDRESSING tables
+ */
+#define J9HASH_TABLE_GROUP_WIDTH 16
 
 /*
  * This used to include a cast to uintptr_t, but ddrgen doesn't
@@ -86,7 +98,9 @@ extern "C" {
 /**
 * Hash table state queries
 */
-#define hashTableIsSpaceOptimized(table) (NULL == table->listNodePool)
+#define hashTableIsSpaceOptimized(table) ((NULL == table->listNodePool) && (NULL == table->controlBytes))
+#define hashTableIsConcurrent(table) (J9HASH_TABLE_CONCURRENT == ((table)->flags & J9HASH_TABLE_CONCURRENT))
+#define hashTableIsOpenAddressing(table) (J9HASH_TABLE_OPEN_ADDRESSING == ((table)->flags & J9HASH_TABLE_OPEN_ADDRESSING))
 
 
 struct J9HashTable; /* Forward struct declaration */
@@ -120,6 +134,12 @@ typedef struct J9HashTable {
 	void *equalFnUserData;
 	void *hashFnUserData;
 	struct J9HashTable *previous;
+	uint32_t *bucketLocks;
+	uint32_t allocatorLock;
+	volatile uintptr_t resizeCount;
+	struct J9Pool *retiredPool;
+	uint8_t *controlBytes;
+	uint32_t numberOfDeletedSlots;
 } J9HashTable;
 
 typedef struct J9HashTableState {
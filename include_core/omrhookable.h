@@ -43,6 +43,9 @@ extern "C" {
 
 #define J9HOOK_LIB_CONTROL_TRACE_START "trace_start"
 #define J9HOOK_LIB_CONTROL_TRACE_STOP "trace_stop"
+/* value is a struct J9HookInterface **; folds the thread-local dispatch statistics into the interface's OMREventInfo4Dump entries.
+ * The count, totalTime, lastHook and longestHook of the entries are only current after this call. */
+#define J9HOOK_LIB_CONTROL_AGGREGATE_STATS "aggregate_stats"
 
 intptr_t
 omrhook_lib_control(const char *key, uintptr_t value);
@@ -60,6 +63,7 @@ typedef struct J9HookInterface {
 	intptr_t (*J9HookIsEnabled)(struct J9HookInterface **hookInterface, uintptr_t eventNum);
 	uintptr_t (*J9HookAllocateAgentID)(struct J9HookInterface **hookInterface);
 	void (*J9HookDeallocateAgentID)(struct J9HookInterface **hookInterface, uintptr_t agentID);
+	void (*J9HookSetSamplingInterval)(struct J9HookInterface **hookInterface, uintptr_t samplingInterval);
 } J9HookInterface;
 
 
@@ -99,6 +103,20 @@ typedef struct OMREventInfo4Dump {
 	volatile uintptr_t totalTime;
 }OMREventInfo4Dump;
 
+/* dispatch statistics of one event kept by one thread, aggregated into OMREventInfo4Dump on demand */
+typedef struct OMREventStats4Thread {
+	struct OMRHookInfo4Dump longestHook;
+	struct OMRHookInfo4Dump lastHook;
+	volatile uintptr_t count;
+	volatile uintptr_t totalTime;
+} OMREventStats4Thread;
+
+/* the dispatch statistics of one thread for all events of a hook interface, followed by eventSize OMREventStats4Thread entries */
+typedef struct J9HookThreadStats {
+	struct J9HookThreadStats *next;
+	struct J9CommonHookInterface *commonInterface;
+} J9HookThreadStats;
+
 typedef struct J9CommonHookInterface {
 	struct J9HookInterface *hookInterface;
 	uintptr_t size;
@@ -108,6 +126,10 @@ typedef struct J9CommonHookInterface {
 	struct OMRPortLibrary *portLib;		/* for accessing PortLibrary  */
 	uint64_t threshold4Trace;			/* the threshold for triggering tracepoint */
 	uintptr_t eventSize;				/* how many events supported by this hook interface */
+	uintptr_t samplingInterval;			/* sampling interval for listener timing of events dispatched without J9HOOK_TAG_SAMPLING_MASK bits, set by J9HookSetSamplingInterval */
+	omrthread_tls_key_t threadStatsKey;	/* TLS key of the J9HookThreadStats of the current thread, 0 if dispatch updates the OMREventInfo4Dump entries directly */
+	struct J9HookThreadStats *threadStats;	/* statistics of the live threads that dispatched events of this interface, guarded by lock */
+	struct OMREventStats4Thread *retiredStats;	/* eventSize entries accumulating the statistics of exited threads, guarded by lock */
 } J9CommonHookInterface;
 
 
@@ -457,6 +457,37 @@ typedef struct J9FileStatFilesystem {
 	uint64_t totalSizeBytes;
 } J9FileStatFilesystem;
 
+/**
+ * One buffer of a vectored file read or write, see omrfile_preadv and omrfile_pwritev.
+ * The layout matches struct iovec on the platforms that have it.
+ */
+typedef struct OMRIOVec {
+	void *iov_base;
+	uintptr_t iov_len;
+} OMRIOVec;
+
+/**
+ * A read or write submitted to an asynchronous file I/O context with omrfile_async_submit.
+ * The request, its buffers and the buffer list belong to the context until the request
+ * is returned by omrfile_async_complete.
+ */
+typedef struct OMRFileAsyncRequest {
+	int32_t operation; /**< OMRPORT_FILE_ASYNC_READ or OMRPORT_FILE_ASYNC_WRITE */
+	int32_t iovcnt; /**< number of buffers */
+	intptr_t fd; /**< file to read or write */
+	OMRIOVec *iov; /**< buffers to fill or write, in order */
+	int64_t offset; /**< file offset of the transfer */
+	void *userData; /**< for the caller, not used by the context */
+	intptr_t result; /**< on completion, the bytes transferred or a negative portable error code */
+	struct OMRFileAsyncRequest *next; /**< private to the context */
+} OMRFileAsyncRequest;
+
+/**
+ * An asynchronous file I/O context, see omrfile_async_create.
+ * Private, platform specific implementation.
+ */
+typedef struct OMRFileAsyncContext OMRFileAsyncContext;
+
 /**
  * A handle to a filestream.
  * Private, platform specific implementation.
@@ -561,6 +592,30 @@ typedef struct OMRCgroupMetricIteratorState {
 	char *fileContent;
 } OMRCgroupMetricIteratorState;
 
+/**
+ * @name Resource Snapshot Flags
+ * Flags indicating which fields of an OMRResourceSnapshot are valid
+ * @{
+ */
+#define OMRPORT_RESOURCE_SNAPSHOT_CPU_QUOTA_SET ((uint32_t)0x1)
+#define OMRPORT_RESOURCE_SNAPSHOT_MEMORY_LIMIT_SET ((uint32_t)0x2)
+#define OMRPORT_RESOURCE_SNAPSHOT_MEMORY_PRESSURE_AVAILABLE ((uint32_t)0x4)
+/** @} */
+
+/**
+ * The resources available to the process, see @ref omrsysinfo.c::omrsysinfo_get_resource_snapshot "omrsysinfo_get_resource_snapshot".
+ */
+typedef struct OMRResourceSnapshot {
+	uint64_t generation; /**< number of times the snapshot has been taken, it changes whenever the values may have changed */
+	uint64_t onlineCPUs; /**< number of online CPUs, see OMRPORT_CPU_ONLINE */
+	uint64_t boundCPUs; /**< number of CPUs the process may use, including the cgroup CPU quota, see OMRPORT_CPU_BOUND */
+	uint64_t cpuQuotaMillicores; /**< cgroup CPU quota in thousandths of a CPU, valid with OMRPORT_RESOURCE_SNAPSHOT_CPU_QUOTA_SET */
+	uint64_t memoryLimit; /**< cgroup memory limit in bytes, valid with OMRPORT_RESOURCE_SNAPSHOT_MEMORY_LIMIT_SET */
+	uint32_t memoryPressureSome; /**< share of the last 10 seconds in which some tasks stalled on memory, in hundredths of a percent */
+	uint32_t memoryPressureFull; /**< share of the last 10 seconds in which all tasks stalled on memory, in hundredths of a percent */
+	uint32_t flags; /**< bit-wise OMRPORT_RESOURCE_SNAPSHOT_* flags */
+} OMRResourceSnapshot;
+
 
 
 /**
@@ -888,6 +943,27 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_FILE_WAIT_FOR_LOCK  4
 #define OMRPORT_FILE_NOWAIT_FOR_LOCK  8
 
+/* Access pattern hints for omrfile_fadvise */
+#define OMRPORT_FILE_ADVICE_NORMAL  0
+#define OMRPORT_FILE_ADVICE_SEQUENTIAL  1
+#define OMRPORT_FILE_ADVICE_RANDOM  2
+#define OMRPORT_FILE_ADVICE_WILLNEED  3
+#define OMRPORT_FILE_ADVICE_DONTNEED  4
+#define OMRPORT_FILE_ADVICE_NOREUSE  5
+
+/* Reserve space with omrfile_fallocate without changing the file length */
+#define OMRPORT_FILE_FALLOCATE_KEEP_SIZE  1
+
+/* Operations of an OMRFileAsyncRequest */
+#define OMRPORT_FILE_ASYNC_READ  1
+#define OMRPORT_FILE_ASYNC_WRITE  2
+
+/* Flags for omrfile_async_create */
+#define OMRPORT_FILE_ASYNC_FLAG_THREAD_POOL  1
+
+/* Use the size-binned (segregated free list) suballocator rather than the first-fit one. */
+#define OMRPORT_HEAP_FLAG_BINNED  1
+
 #define OMRPORT_MMAP_CAPABILITY_COPYONWRITE  1
 #define OMRPORT_MMAP_CAPABILITY_READ  2
 #define OMRPORT_MMAP_CAPABILITY_WRITE  4
@@ -1865,6 +1941,8 @@ typedef struct OMRPortLibrary {
 	uint64_t (*time_hires_frequency)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrtime.c::omrtime_hires_delta "omrtime_hires_delta"*/
 	uint64_t (*time_hires_delta)(struct OMRPortLibrary *portLibrary, uint64_t startTime, uint64_t endTime, uint64_t requiredResolution) ;
+	/** see @ref omrtime.c::omrtime_fast_nano_time "omrtime_fast_nano_time"*/
+	int64_t (*time_fast_nano_time)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_startup "omrsysinfo_startup"*/
 	int32_t (*sysinfo_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_shutdown "omrsysinfo_shutdown"*/
@@ -1981,6 +2059,24 @@ typedef struct OMRPortLibrary {
 	int32_t (*file_stat)(struct OMRPortLibrary *portLibrary, const char *path, uint32_t flags, struct J9FileStat *buf) ;
 	/** see @ref omrfile.c::omrfile_stat_filesystem "omrfile_stat_filesystem"*/
 	int32_t (*file_stat_filesystem)(struct OMRPortLibrary *portLibrary, const char *path, uint32_t flags, struct J9FileStatFilesystem *buf) ;
+	/** see @ref omrfile.c::omrfile_preadv "omrfile_preadv"*/
+	intptr_t (*file_preadv)(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRIOVec *iov, int32_t iovcnt, int64_t offset) ;
+	/** see @ref omrfile.c::omrfile_pwritev "omrfile_pwritev"*/
+	intptr_t (*file_pwritev)(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRIOVec *iov, int32_t iovcnt, int64_t offset) ;
+	/** see @ref omrfile.c::omrfile_fadvise "omrfile_fadvise"*/
+	int32_t (*file_fadvise)(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, int32_t advice) ;
+	/** see @ref omrfile.c::omrfile_fallocate "omrfile_fallocate"*/
+	int32_t (*file_fallocate)(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, uint32_t flags) ;
+	/** see @ref omrfile.c::omrfile_readahead "omrfile_readahead"*/
+	int32_t (*file_readahead)(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length) ;
+	/** see @ref omrfile_async.c::omrfile_async_create "omrfile_async_create"*/
+	int32_t (*file_async_create)(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, struct OMRFileAsyncContext **context) ;
+	/** see @ref omrfile_async.c::omrfile_async_destroy "omrfile_async_destroy"*/
+	void (*file_async_destroy)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context) ;
+	/** see @ref omrfile_async.c::omrfile_async_submit "omrfile_async_submit"*/
+	int32_t (*file_async_submit)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context, struct OMRFileAsyncRequest **requests, uint32_t count) ;
+	/** see @ref omrfile_async.c::omrfile_async_complete "omrfile_async_complete"*/
+	int32_t (*file_async_complete)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context, struct OMRFileAsyncRequest **completed, uint32_t maxCompleted, uint32_t minCompleted) ;
 	/** see @ref omrfile_blockingasync.c::omrfile_blockingasync_open "omrfile_blockingasync_open"*/
 	intptr_t (*file_blockingasync_open)(struct OMRPortLibrary *portLibrary, const char *path, int32_t flags, int32_t mode) ;
 	/** see @ref omrfile_blockingasync.c::omrfile_blockingasync_close "omrfile_blockingasync_close"*/
@@ -2411,6 +2507,10 @@ typedef struct OMRPortLibrary {
 	int32_t (*sysinfo_cgroup_subsystem_iterator_next)(struct OMRPortLibrary *portLibrary, struct OMRCgroupMetricIteratorState *state, struct OMRCgroupMetricElement *metricElement);
 	/** see @ref omrsysinfo.c::omrsysinfo_cgroup_subsystem_iterator_destroy "omrsysinfo_cgroup_subsystem_iterator_destroy"*/
 	void (*sysinfo_cgroup_subsystem_iterator_destroy)(struct OMRPortLibrary *portLibrary, struct OMRCgroupMetricIteratorState *state);
+	/** see @ref omrsysinfo.c::omrsysinfo_get_resource_snapshot "omrsysinfo_get_resource_snapshot"*/
+	int32_t (*sysinfo_get_resource_snapshot)(struct OMRPortLibrary *portLibrary, struct OMRResourceSnapshot *snapshot);
+	/** see @ref omrsysinfo.c::omrsysinfo_refresh_resource_snapshot "omrsysinfo_refresh_resource_snapshot"*/
+	int32_t (*sysinfo_refresh_resource_snapshot)(struct OMRPortLibrary *portLibrary);
 	/** see @ref omrport.c::omrport_init_library "omrport_init_library"*/
 	int32_t (*port_init_library)(struct OMRPortLibrary *portLibrary, uintptr_t size) ;
 	/** see @ref omrport.c::omrport_startup_library "omrport_startup_library"*/
@@ -2539,6 +2639,30 @@ typedef struct OMRPortLibrary {
 	int32_t (*sock_getsockopt_linger)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval) ;
 	/** see @ref omrsock.c::omrsock_getsockopt_timeval "omrsock_getsockopt_timeval"*/
 	int32_t (*sock_getsockopt_timeval)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval) ;
+	/** see @ref omrsock.c::omrsock_eventloop_create "omrsock_eventloop_create"*/
+	int32_t (*sock_eventloop_create)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop) ;
+	/** see @ref omrsock.c::omrsock_eventloop_destroy "omrsock_eventloop_destroy"*/
+	int32_t (*sock_eventloop_destroy)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop) ;
+	/** see @ref omrsock.c::omrsock_eventloop_add "omrsock_eventloop_add"*/
+	int32_t (*sock_eventloop_add)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData) ;
+	/** see @ref omrsock.c::omrsock_eventloop_modify "omrsock_eventloop_modify"*/
+	int32_t (*sock_eventloop_modify)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData) ;
+	/** see @ref omrsock.c::omrsock_eventloop_remove "omrsock_eventloop_remove"*/
+	int32_t (*sock_eventloop_remove)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock) ;
+	/** see @ref omrsock.c::omrsock_eventloop_timer_add "omrsock_eventloop_timer_add"*/
+	int32_t (*sock_eventloop_timer_add)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, uint64_t delayMillis, uint64_t periodMillis, void *userData, omrsock_timer_t *timer) ;
+	/** see @ref omrsock.c::omrsock_eventloop_timer_cancel "omrsock_eventloop_timer_cancel"*/
+	int32_t (*sock_eventloop_timer_cancel)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_timer_t *timer) ;
+	/** see @ref omrsock.c::omrsock_eventloop_wait "omrsock_eventloop_wait"*/
+	int32_t (*sock_eventloop_wait)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs) ;
+	/** see @ref omrsock.c::omrsock_sendmsg "omrsock_sendmsg"*/
+	intptr_t (*sock_sendmsg)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const struct OMRIOVec *iov, int32_t iovcnt, int32_t flags) ;
+	/** see @ref omrsock.c::omrsock_recvmsg "omrsock_recvmsg"*/
+	intptr_t (*sock_recvmsg)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const struct OMRIOVec *iov, int32_t iovcnt, int32_t flags) ;
+	/** see @ref omrsock.c::omrsock_sendfile "omrsock_sendfile"*/
+	int64_t (*sock_sendfile)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, int64_t count) ;
+	/** see @ref omrsock.c::omrsock_get_zerocopy_completion "omrsock_get_zerocopy_completion"*/
+	int32_t (*sock_get_zerocopy_completion)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *firstSend, uint32_t *lastSend, BOOLEAN *copied) ;
 #if defined(OMR_OPT_CUDA)
 	/** CUDA configuration data */
 	J9CudaConfig *cuda_configData;
@@ -2782,6 +2906,7 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrtime_hires_clock() privateOmrPortLibrary->time_hires_clock(privateOmrPortLibrary)
 #define omrtime_hires_frequency() privateOmrPortLibrary->time_hires_frequency(privateOmrPortLibrary)
 #define omrtime_hires_delta(param1,param2,param3) privateOmrPortLibrary->time_hires_delta(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrtime_fast_nano_time() privateOmrPortLibrary->time_fast_nano_time(privateOmrPortLibrary)
 #define omrsysinfo_startup() privateOmrPortLibrary->sysinfo_startup(privateOmrPortLibrary)
 #define omrsysinfo_shutdown() privateOmrPortLibrary->sysinfo_shutdown(privateOmrPortLibrary)
 #define omrsysinfo_process_exists(param1) privateOmrPortLibrary->sysinfo_process_exists(privateOmrPortLibrary, (param1))
@@ -2842,6 +2967,15 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrfile_fstat(param1,param2) privateOmrPortLibrary->file_fstat(privateOmrPortLibrary, (param1), (param2))
 #define omrfile_stat(param1,param2,param3) privateOmrPortLibrary->file_stat(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrfile_stat_filesystem(param1,param2,param3) privateOmrPortLibrary->file_stat_filesystem(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_preadv(param1,param2,param3,param4) privateOmrPortLibrary->file_preadv(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_pwritev(param1,param2,param3,param4) privateOmrPortLibrary->file_pwritev(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_fadvise(param1,param2,param3,param4) privateOmrPortLibrary->file_fadvise(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_fallocate(param1,param2,param3,param4) privateOmrPortLibrary->file_fallocate(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_readahead(param1,param2,param3) privateOmrPortLibrary->file_readahead(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_async_create(param1,param2,param3) privateOmrPortLibrary->file_async_create(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_async_destroy(param1) privateOmrPortLibrary->file_async_destroy(privateOmrPortLibrary, (param1))
+#define omrfile_async_submit(param1,param2,param3) privateOmrPortLibrary->file_async_submit(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_async_complete(param1,param2,param3,param4) privateOmrPortLibrary->file_async_complete(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrfile_blockingasync_open(param1,param2,param3) privateOmrPortLibrary->file_blockingasync_open(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrfile_blockingasync_close(param1) privateOmrPortLibrary->file_blockingasync_close(privateOmrPortLibrary, (param1))
 #define omrfile_blockingasync_read(param1,param2,param3) privateOmrPortLibrary->file_blockingasync_read(privateOmrPortLibrary, (param1), (param2), (param3))
@@ -3054,6 +3188,8 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsysinfo_cgroup_subsystem_iterator_metricKey(param1, param2) privateOmrPortLibrary->sysinfo_cgroup_subsystem_iterator_metricKey(privateOmrPortLibrary, param1, param2)
 #define omrsysinfo_cgroup_subsystem_iterator_next(param1, param2) privateOmrPortLibrary->sysinfo_cgroup_subsystem_iterator_next(privateOmrPortLibrary, param1, param2)
 #define omrsysinfo_cgroup_subsystem_iterator_destroy(param1) privateOmrPortLibrary->sysinfo_cgroup_subsystem_iterator_destroy(privateOmrPortLibrary, param1)
+#define omrsysinfo_get_resource_snapshot(param1) privateOmrPortLibrary->sysinfo_get_resource_snapshot(privateOmrPortLibrary, param1)
+#define omrsysinfo_refresh_resource_snapshot() privateOmrPortLibrary->sysinfo_refresh_resource_snapshot(privateOmrPortLibrary)
 #define omrintrospect_startup() privateOmrPortLibrary->introspect_startup(privateOmrPortLibrary)
 #define omrintrospect_shutdown() privateOmrPortLibrary->introspect_shutdown(privateOmrPortLibrary)
 #define omrintrospect_set_suspend_signal_offset(param1) privateOmrPortLibrary->introspect_set_suspend_signal_offset(privateOmrPortLibrary, param1)
@@ -3114,6 +3250,18 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsock_getsockopt_int(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_int(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_linger(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_linger(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_timeval(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_timeval(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_create(param1) privateOmrPortLibrary->sock_eventloop_create(privateOmrPortLibrary, (param1))
+#define omrsock_eventloop_destroy(param1) privateOmrPortLibrary->sock_eventloop_destroy(privateOmrPortLibrary, (param1))
+#define omrsock_eventloop_add(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_add(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_modify(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_modify(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_remove(param1,param2) privateOmrPortLibrary->sock_eventloop_remove(privateOmrPortLibrary, (param1), (param2))
+#define omrsock_eventloop_timer_add(param1,param2,param3,param4,param5) privateOmrPortLibrary->sock_eventloop_timer_add(privateOmrPortLibrary, (param1), (param2), (param3), (param4), (param5))
+#define omrsock_eventloop_timer_cancel(param1,param2) privateOmrPortLibrary->sock_eventloop_timer_cancel(privateOmrPortLibrary, (param1), (param2))
+#define omrsock_eventloop_wait(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_wait(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_sendmsg(param1,param2,param3,param4) privateOmrPortLibrary->sock_sendmsg(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_recvmsg(param1,param2,param3,param4) privateOmrPortLibrary->sock_recvmsg(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_sendfile(param1,param2,param3,param4) privateOmrPortLibrary->sock_sendfile(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_get_zerocopy_completion(param1,param2,param3,param4) privateOmrPortLibrary->sock_get_zerocopy_completion(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 
 #if defined(OMR_OPT_CUDA)
 #define omrcuda_startup() \
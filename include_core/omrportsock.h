@@ -46,6 +46,15 @@ typedef struct OMRTimeval *omrsock_timeval_t;
 /* Pointer to OMRLinger, a struct that contains struct linger.*/
 typedef struct OMRLinger *omrsock_linger_t;
 
+/* Pointer to OMREventLoop, a struct that contains the OS event queue and the timers. */
+typedef struct OMREventLoop *omrsock_eventloop_t;
+
+/* Pointer to OMRSockEvent, a struct that describes a ready socket or expired timer. */
+typedef struct OMRSockEvent *omrsock_event_t;
+
+/* Pointer to OMRSockTimer, a timer of an event loop. */
+typedef struct OMRSockTimer *omrsock_timer_t;
+
 /* Bind to all available interfaces */
 #define OMRSOCK_INADDR_ANY ((uint32_t)0)
 
@@ -72,11 +81,17 @@ typedef struct OMRLinger *omrsock_linger_t;
 #define OMRSOCK_SO_RCVTIMEO 4
 #define OMRSOCK_SO_SNDTIMEO 5
 #define OMRSOCK_TCP_NODELAY 6
+#define OMRSOCK_SO_ZEROCOPY 7
 
 /* Socket Flags */
 #define OMRSOCK_O_ASYNC 0x0100
 #define OMRSOCK_O_NONBLOCK 0x1000
 
+/* Message Flags, see omrsock_sendmsg and omrsock_recvmsg */
+#define OMRSOCK_MSG_DONTWAIT 0x0001
+#define OMRSOCK_MSG_WAITALL 0x0002
+#define OMRSOCK_MSG_ZEROCOPY 0x0004
+
 /* Poll Constants */
 #define OMRSOCK_POLLIN 0x0001
 #define OMRSOCK_POLLOUT 0x0002
@@ -87,4 +102,15 @@ typedef struct OMRLinger *omrsock_linger_t;
 #define OMRSOCK_POLLHUP 0x0010
 #endif
 
+/* Event Loop Events */
+#define OMRSOCK_EVENT_READ 0x0001
+#define OMRSOCK_EVENT_WRITE 0x0002
+#define OMRSOCK_EVENT_ERROR 0x0004
+#define OMRSOCK_EVENT_HANGUP 0x0008
+#define OMRSOCK_EVENT_TIMER 0x0010
+
+/* Event Loop Registration Flags */
+#define OMRSOCK_EVENT_EDGE_TRIGGERED 0x0100
+#define OMRSOCK_EVENT_ONESHOT 0x0200
+
 #endif /* !defined(OMRPORTSOCK_H_) */
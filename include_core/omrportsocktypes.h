@@ -101,6 +101,7 @@ typedef struct OMRSockAddrStorage {
  */
 typedef struct OMRSocket {
 	omr_os_socket data;
+	void *eventUserData; /**< userData of the event loop the socket is registered with */
 } OMRSocket;
 
 /**
@@ -148,6 +149,37 @@ typedef struct OMRLinger {
 	struct linger data;
 } OMRLinger;
 
+/**
+ * A ready socket or expired timer. Filled in using @ref omrsock_eventloop_wait.
+ */
+typedef struct OMRSockEvent {
+	OMRSocket *socket; /**< NULL for a timer */
+	void *userData; /**< given when the socket or timer was added to the event loop */
+	uint32_t events; /**< OMRSOCK_EVENT_* bits */
+} OMRSockEvent;
+
+/**
+ * A timer of an event loop. Created using @ref omrsock_eventloop_timer_add.
+ */
+typedef struct OMRSockTimer {
+	uint64_t deadline; /**< omrtime_nano_time() at which the timer expires */
+	uint64_t periodNanos; /**< 0 for a timer that fires once */
+	void *userData;
+	uint32_t heapIndex; /**< position in the timer heap of the event loop */
+} OMRSockTimer;
+
+/**
+ * An event loop. Created using @ref omrsock_eventloop_create.
+ */
+typedef struct OMREventLoop {
+	int32_t data; /**< the epoll or kqueue descriptor */
+	void *osEvents; /**< buffer for the events returned by the OS */
+	uint32_t osEventCapacity;
+	OMRSockTimer **timers; /**< binary min-heap ordered by deadline */
+	uint32_t timerCount;
+	uint32_t timerCapacity;
+} OMREventLoop;
+
 /* Additional constants: Set maximum backlog for listen */
 #define OMRSOCK_MAXCONN SOMAXCONN
 
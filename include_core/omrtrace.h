@@ -53,7 +53,7 @@ extern "C" {
 #define UT_IPRINT_KEYWORD             "IPRINT"
 #define UT_EXCEPTION_KEYWORD          "EXCEPTION"
 #define UT_NONE_KEYWORD               "NONE"
-#define UT_OUTPUT_KEYWORD             "OUTPUT" /* deprecated */
+#define UT_OUTPUT_KEYWORD             "OUTPUT"
 #define UT_LEVEL_KEYWORD              "LEVEL"
 #define UT_SUSPEND_KEYWORD            "SUSPEND"
 #define UT_RESUME_KEYWORD             "RESUME"
@@ -63,6 +63,7 @@ extern "C" {
 #define UT_BACKTRACE                  "BACKTRACE"
 #define UT_FATAL_ASSERT_KEYWORD       "FATALASSERT"
 #define UT_NO_FATAL_ASSERT_KEYWORD    "NOFATALASSERT"
+#define UT_PUBLISH_KEYWORD            "PUBLISH"
 
 /*
  * =============================================================================
@@ -200,6 +201,28 @@ omr_error_t omr_trc_startThreadTrace(OMR_VMThread *currentThread, const char *th
  */
 omr_error_t omr_trc_stopThreadTrace(OMR_VMThread *currentThread);
 
+/**
+ * Statistics of the asynchronous trace buffer publication queue,
+ * enabled with the publish=async trace option.
+ */
+typedef struct OMR_TracePublishStatistics {
+	uintptr_t queueDepth;		/* Buffers waiting for the publisher thread */
+	uintptr_t queueHighWater;	/* Largest queue depth observed */
+	uintptr_t publishedBuffers;	/* Buffers passed to subscribers by the publisher thread */
+	uintptr_t droppedBuffers;	/* Buffers discarded by the dropoldest policy */
+} OMR_TracePublishStatistics;
+
+/**
+ * Get the statistics of the asynchronous trace buffer publication queue.
+ * All statistics are 0 if trace buffers are published synchronously.
+ *
+ * @param[in]  omrVM The OMR VM.
+ * @param[out] stats The statistics.
+ *
+ * @return an OMR error code
+ */
+omr_error_t omr_trc_getPublishStatistics(OMR_VM *omrVM, OMR_TracePublishStatistics *stats);
+
 #if defined(OMR_THR_FORK_SUPPORT)
 
 /**
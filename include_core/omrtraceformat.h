@@ -163,6 +163,47 @@ uint64_t omr_trc_getBufferIteratorThreadId(UtTracePointIterator *iter);
  */
 uint32_t omr_trc_getBufferIteratorThreadName(UtTracePointIterator *iter, char *buffer, uint32_t buffLen);
 
+/**
+ * A callback receiving a tracepoint formatted by omr_trc_formatTraceFile.
+ *
+ * Tracepoints are passed to the callback one at a time, on the thread that called omr_trc_formatTraceFile.
+ *
+ * @param[in] userData the userData passed to omr_trc_formatTraceFile
+ * @param[in] threadName the name of the thread that logged the tracepoint
+ * @param[in] threadId the id of the thread that logged the tracepoint
+ * @param[in] timeStamp the raw timestamp of the tracepoint
+ * @param[in] formattedTracePoint the formatted tracepoint, valid only for the duration of the call
+ * @return OMR_ERROR_NONE to continue formatting, any other value stops formatting and is returned by omr_trc_formatTraceFile
+ */
+typedef omr_error_t (*FormattedTracePointCallback)(void *userData, const char *threadName, uint64_t threadId, uint64_t timeStamp, const char *formattedTracePoint);
+
+/**
+ * Format every trace buffer remaining in a file opened by a UtTraceFileIterator.
+ *
+ * Buffers are read in batches. The buffers of a batch are formatted in parallel, one buffer at a time
+ * per thread. Batches are processed in file order. The worker threads are started once per call and
+ * format every batch in turn.
+ *
+ * Tracepoints are passed to the callback in timestamp order across the whole file. After each batch
+ * the tracepoints older than the start of every buffer still to be read are merged, and the rest are
+ * held back until a later batch or the end of the file. Finding those start times reads the buffer
+ * headers of the file once before formatting starts.
+ *
+ * Format strings are parsed once per tracepoint id, and the getFormatString callback of the file
+ * iterator is only called from one thread at a time.
+ *
+ * @param[in] fileIter the UtTraceFileIterator to format the remaining buffers of
+ * @param[in] workerCount the number of threads formatting buffers, including the calling thread
+ * @param[in] callback the callback receiving the formatted tracepoints
+ * @param[in] userData data passed to the callback
+ * @return OMR_ERROR_NONE on success
+ * @return OMR_ERROR_ILLEGAL_ARGUMENT if callback is NULL
+ * @return OMR_ERROR_OUT_OF_NATIVE_MEMORY if the formatted tracepoints cannot be stored
+ * @return OMR_ERROR_INTERNAL if the file ends unexpectedly
+ * @return the first error returned by the callback
+ */
+omr_error_t omr_trc_formatTraceFile(UtTraceFileIterator *fileIter, uint32_t workerCount, FormattedTracePointCallback callback, void *userData);
+
 #ifdef __cplusplus
 }
 #endif
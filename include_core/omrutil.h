@@ -431,6 +431,30 @@ U_32 omrcrc32(U_32 crc, U_8 *bytes, U_32 len);
 */
 U_32 omrcrcSparse32(U_32 crc, U_8 *bytes, U_32 len, U_32 step);
 
+/**
+* @brief Compute the CRC-32C (Castagnoli) checksum of a buffer. Unlike omrcrc32(),
+* which must stay compatible with existing checksums, this polynomial has direct
+* hardware support on x86 (SSE4.2) and aarch64 and is the faster choice for new data.
+* @param crc the checksum of the preceding data, or 0
+* @param *bytes
+* @param len
+* @return U_32
+*/
+U_32 omrcrc32c(U_32 crc, U_8 *bytes, U_32 len);
+
+/* ---------------- omrhash64.c ---------------- */
+
+/**
+* @brief Compute a fast, non-cryptographic 64 bit hash of a buffer, suitable for
+* hash tables and content keys. The result depends only on the bytes and the seed,
+* so it is the same on every platform and may be persisted.
+* @param data
+* @param length
+* @param seed
+* @return U_64
+*/
+U_64 omrhash64(const void *data, uintptr_t length, U_64 seed);
+
 /* ---------------- archinfo.c ---------------- */
 /**
  * @brief
@@ -139,6 +139,18 @@ subtractAtomic(volatile uintptr_t *address, uintptr_t value);
  */
 uintptr_t setAtomic(volatile uintptr_t *address, uintptr_t value);
 
+/**
+ * @brief Hint to the processor that the caller is spinning on a contended location,
+ * (e.g. the pause instruction on x86). Unlike a thread yield, the calling thread
+ * keeps its processor.
+ *
+ * @param[in] void
+ *
+ * @return void
+ */
+void
+issueYieldCPU(void);
+
 /* ---------------- cas8help.s ---------------- */
 #if !defined(OMR_ENV_DATA64) && (defined(AIXPPC) || defined(LINUXPPC))
 
@@ -142,6 +142,65 @@ void
 pool_removeElement(J9Pool *aPool, void *anElement);
 
 
+/**
+* @brief
+* @param *aPool
+* @param *magazine
+* @return void
+*/
+void
+pool_initMagazine(J9Pool *aPool, J9PoolMagazine *magazine);
+
+
+/**
+* @brief
+* @param *aPool
+* @param *magazine
+* @return void *
+*/
+void *
+pool_newElementCached(J9Pool *aPool, J9PoolMagazine *magazine);
+
+
+/**
+* @brief
+* @param *aPool
+* @param *magazine
+* @param *anElement
+* @return void
+*/
+void
+pool_removeElementCached(J9Pool *aPool, J9PoolMagazine *magazine, void *anElement);
+
+
+/**
+* @brief
+* @param *aPool
+* @param *magazine
+* @return void
+*/
+void
+pool_flushMagazine(J9Pool *aPool, J9PoolMagazine *magazine);
+
+
+/**
+* @brief
+* @param *aPool
+* @return void
+*/
+void
+pool_lock(J9Pool *aPool);
+
+
+/**
+* @brief
+* @param *aPool
+* @return void
+*/
+void
+pool_unlock(J9Pool *aPool);
+
+
 /**
 * @brief
 * @param *aPool
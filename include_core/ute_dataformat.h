@@ -52,6 +52,7 @@ extern "C" {
 #define UT_SERVICE_SECTION_NAME       "UTSS"
 #define UT_ACTIVE_SECTION_NAME        "UTTA"
 #define UT_PROC_SECTION_NAME          "UTPR"
+#define UT_FILE_SLOTS_SECTION_NAME    "UTFS"
 #define UT_NULL_POINTER               "[Null Pointer]"
 
 #define UT_ENDIAN_SIGNATURE           0x12345678
@@ -205,6 +206,26 @@ typedef struct UtStartupSection {
 	char options[1]; /* Startup options                */
 } UtStartupSection;
 
+/*
+ * =============================================================================
+ * UtFileSlotsSection (UTFS)
+ * =============================================================================
+ */
+/*
+ * The last section of a wrap-around trace file written by the output= option.
+ * The header is followed by slotCount slots of UT_FILE_SLOT_LENGTH(bufferSize)
+ * bytes. Each slot holds a trace record between two copies of the sequence
+ * number of the write that filled it, numbered from 1. A slot whose sequence
+ * numbers are 0 has not been written, and one whose sequence numbers differ
+ * was torn by a write that did not complete.
+ */
+typedef struct UtFileSlotsSection {
+	UtDataHeader header; /* Eyecatcher, version etc        */
+	uint64_t slotCount; /* Number of slots in the file    */
+} UtFileSlotsSection;
+
+#define UT_FILE_SLOT_LENGTH(bufferSize) ((uint64_t)(bufferSize) + (2 * sizeof(uint64_t)))
+
 /*
  * =============================================================================
  * UtTraceSection  (UTTS)
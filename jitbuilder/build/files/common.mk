@@ -34,6 +34,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/infra/BitVector.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/Checklist.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/HashTab.cpp \
+    $(JIT_OMR_DIRTY_DIR)/infra/HybridBitVector.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/STLUtils.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/IGBase.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/IGNode.cpp \
@@ -142,6 +143,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopCanonicalizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopReducer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopReplicator.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/LoopVectorizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopVersioner.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRLocalCSE.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LocalDeadStoreElimination.cpp \
@@ -150,6 +152,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMROptimizationManager.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRTransformUtil.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMROptimizer.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/OptimizerBudget.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OrderBlocks.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OSRDefAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/PartialRedundancy.cpp \
@@ -160,6 +163,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/RedundantAsyncCheckRemoval.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRRegisterCandidate.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/ReorderIndexExpr.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/SLPVectorizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/SinkStores.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/StripMiner.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/VPConstraint.cpp \
@@ -249,10 +253,12 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/env/OMRCompilerEnv.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/PersistentAllocator.cpp \
     $(JIT_PRODUCT_DIR)/compile/ResolvedMethod.cpp \
+    $(JIT_PRODUCT_DIR)/control/CompilationService.cpp \
     $(JIT_PRODUCT_DIR)/control/Jit.cpp \
     $(JIT_PRODUCT_DIR)/env/FrontEnd.cpp \
     $(JIT_PRODUCT_DIR)/ilgen/JBIlGeneratorMethodDetails.cpp \
     $(JIT_PRODUCT_DIR)/optimizer/JBOptimizer.cpp \
+    $(JIT_PRODUCT_DIR)/runtime/AOTCache.cpp \
     $(JIT_PRODUCT_DIR)/runtime/JBCodeCacheManager.cpp \
     $(JIT_PRODUCT_DIR)/runtime/JBJitConfig.cpp \
 
@@ -0,0 +1,357 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "control/CompilationService.hpp"
+
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "infra/Assert.hpp"
+
+extern int32_t internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry);
+extern bool internal_releaseCompiledMethod(void *entryPoint);
+
+// Compilations run on the compilation threads as deep as they would on a
+// client's main thread
+#define COMPILATION_THREAD_STACK_SIZE (8 * 1024 * 1024)
+
+namespace JitBuilder
+{
+
+struct CompilationService::Request
+   {
+   CompilationService *_service;
+   TR::MethodBuilder *_methodBuilder;
+   int32_t _priority;
+   uint64_t _sequence;
+   bool _started;
+   bool _released;
+   bool _done;
+   int32_t _rc;
+   void *_entryPoint;
+   };
+
+namespace
+{
+
+// omrthread monitors can only be used by attached threads, but clients need
+// not attach the threads that submit and wait for compilations. The thread
+// library must be initialized before omrthread_self() can be trusted.
+class AttachedThread
+   {
+public:
+   AttachedThread() : _attached(false)
+      {
+      TR_ASSERT_FATAL(0 == omrthread_init_library(), "Failed to initialize the thread library");
+      if (NULL == omrthread_self())
+         {
+         omrthread_t self = NULL;
+         intptr_t rc = omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT);
+         TR_ASSERT_FATAL(0 == rc, "Failed to attach thread to use the compilation service");
+         _attached = true;
+         }
+      }
+
+   ~AttachedThread()
+      {
+      if (_attached)
+         omrthread_detach(omrthread_self());
+      }
+
+private:
+   bool _attached;
+   };
+
+}
+
+CompilationService *CompilationService::_instance = NULL;
+
+bool
+CompilationService::RequestOrder::operator()(const Request *a, const Request *b) const
+   {
+   // std::priority_queue serves the largest element first
+   if (a->_priority != b->_priority)
+      return a->_priority < b->_priority;
+   return a->_sequence > b->_sequence;
+   }
+
+CompilationService::CompilationService(TR::RawAllocator rawAllocator, int64_t inFlightMemoryLimit) :
+   _rawAllocator(rawAllocator),
+   _monitor(NULL),
+   _queue(RequestOrder(), RequestVector(RequestVector::allocator_type(rawAllocator))),
+   _nextSequence(0),
+   _inFlightMemoryLimit(inFlightMemoryLimit),
+   _compilationsInFlight(0),
+   _numThreads(0),
+   _references(1),
+   _stopping(false)
+   {
+   }
+
+bool
+CompilationService::start(int32_t numThreads, int64_t inFlightMemoryLimit)
+   {
+   if (_instance)
+      return true;
+   if (numThreads <= 0)
+      return false;
+
+   AttachedThread attached;
+   TR::RawAllocator rawAllocator;
+   CompilationService *service = new (rawAllocator) CompilationService(rawAllocator, inFlightMemoryLimit);
+   if (0 != omrthread_monitor_init_with_name(&service->_monitor, 0, "JIT-CompilationServiceMonitor"))
+      {
+      service->~CompilationService();
+      rawAllocator.deallocate(service);
+      return false;
+      }
+
+   omrthread_monitor_enter(service->_monitor);
+   for (int32_t i = 0; i < numThreads; i++)
+      {
+      omrthread_t thread = NULL;
+      if (0 != omrthread_create(&thread, COMPILATION_THREAD_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0, compilationThreadProc, service))
+         break;
+      service->_numThreads++;
+      }
+   omrthread_monitor_exit(service->_monitor);
+
+   _instance = service;
+   if (0 == service->_numThreads)
+      {
+      stop();
+      return false;
+      }
+
+   return true;
+   }
+
+void
+CompilationService::stop()
+   {
+   CompilationService *service = _instance;
+   if (!service)
+      return;
+
+   AttachedThread attached;
+   omrthread_monitor_enter(service->_monitor);
+   service->_stopping = true;
+   omrthread_monitor_notify_all(service->_monitor);
+   while (service->_numThreads > 0)
+      omrthread_monitor_wait(service->_monitor);
+
+   while (!service->_queue.empty())
+      {
+      Request *request = service->_queue.top();
+      service->_queue.pop();
+      if (request->_released)
+         {
+         service->freeRequest(request);
+         continue;
+         }
+      request->_rc = COMPILATION_REQUESTED;
+      request->_done = true;
+      }
+   omrthread_monitor_notify_all(service->_monitor);
+
+   // Clients still waiting for requests keep the service until they are done
+   // with them; a later start() creates a new one.
+   _instance = NULL;
+   service->exitMonitorAndRelease();
+   }
+
+CompilationService::Request *
+CompilationService::submit(TR::MethodBuilder *methodBuilder, int32_t priority)
+   {
+   Request *request = new (_rawAllocator) Request;
+   request->_service = this;
+   request->_methodBuilder = methodBuilder;
+   request->_priority = priority;
+   request->_started = false;
+   request->_released = false;
+   request->_done = false;
+   request->_rc = COMPILATION_REQUESTED;
+   request->_entryPoint = NULL;
+
+   AttachedThread attached;
+   omrthread_monitor_enter(_monitor);
+   _references++;
+   if (_stopping)
+      {
+      request->_done = true;
+      }
+   else
+      {
+      request->_sequence = _nextSequence++;
+      _queue.push(request);
+      omrthread_monitor_notify(_monitor);
+      }
+   omrthread_monitor_exit(_monitor);
+
+   return request;
+   }
+
+bool
+CompilationService::isDone(Request *request)
+   {
+   CompilationService *service = request->_service;
+   AttachedThread attached;
+   omrthread_monitor_enter(service->_monitor);
+   bool done = request->_done;
+   omrthread_monitor_exit(service->_monitor);
+   return done;
+   }
+
+int32_t
+CompilationService::wait(Request *request, void **entryPoint)
+   {
+   CompilationService *service = request->_service;
+   AttachedThread attached;
+   omrthread_monitor_enter(service->_monitor);
+   while (!request->_done)
+      omrthread_monitor_wait(service->_monitor);
+
+   int32_t rc = request->_rc;
+   *entryPoint = request->_entryPoint;
+   service->_rawAllocator.deallocate(request);
+   service->exitMonitorAndRelease();
+   return rc;
+   }
+
+bool
+CompilationService::release(Request *request)
+   {
+   CompilationService *service = request->_service;
+   AttachedThread attached;
+   omrthread_monitor_enter(service->_monitor);
+   bool done = request->_done;
+   bool started = request->_started;
+   if (!done)
+      {
+      // The compilation thread that takes the request, or stop(), frees it
+      request->_released = true;
+      omrthread_monitor_exit(service->_monitor);
+      return !started;
+      }
+
+   if (COMPILATION_SUCCEEDED == request->_rc)
+      internal_releaseCompiledMethod(request->_entryPoint);
+   service->_rawAllocator.deallocate(request);
+   service->exitMonitorAndRelease();
+   return true;
+   }
+
+// Each compilation may use up to the scratch space limit, so at most as many
+// compilations as fit within the in-flight memory limit are run at once.
+bool
+CompilationService::canStartCompilation()
+   {
+   if (0 == _compilationsInFlight || 0 == _inFlightMemoryLimit)
+      return true;
+   int64_t scratchSpaceLimit = (int64_t)TR::Options::getScratchSpaceLimit();
+   return (_compilationsInFlight + 1) * scratchSpaceLimit <= _inFlightMemoryLimit;
+   }
+
+// Free a released request and drop its reference to the service. The monitor
+// must be held. Only stop() and the compilation threads free released
+// requests, while the service is still referenced as the instance.
+void
+CompilationService::freeRequest(Request *request)
+   {
+   _rawAllocator.deallocate(request);
+   _references--;
+   }
+
+// Drop a reference to the service and exit the monitor, which must be held.
+// The service and its monitor are freed when the last reference is dropped.
+void
+CompilationService::exitMonitorAndRelease()
+   {
+   bool last = (0 == --_references);
+   omrthread_monitor_exit(_monitor);
+   if (last)
+      {
+      omrthread_monitor_destroy(_monitor);
+      TR::RawAllocator rawAllocator = _rawAllocator;
+      this->~CompilationService();
+      rawAllocator.deallocate(this);
+      }
+   }
+
+int J9THREAD_PROC
+CompilationService::compilationThreadProc(void *entryArg)
+   {
+   static_cast<CompilationService *>(entryArg)->run();
+   return 0;
+   }
+
+void
+CompilationService::run()
+   {
+   omrthread_monitor_enter(_monitor);
+   while (!_stopping)
+      {
+      if (_queue.empty() || !canStartCompilation())
+         {
+         omrthread_monitor_wait(_monitor);
+         continue;
+         }
+
+      Request *request = _queue.top();
+      _queue.pop();
+      if (request->_released)
+         {
+         freeRequest(request);
+         continue;
+         }
+      request->_started = true;
+      _compilationsInFlight++;
+      omrthread_monitor_exit(_monitor);
+
+      void *entryPoint = NULL;
+      int32_t rc = internal_compileMethodBuilder(request->_methodBuilder, &entryPoint);
+
+      omrthread_monitor_enter(_monitor);
+      _compilationsInFlight--;
+      if (request->_released)
+         {
+         // Nobody will call the method
+         if (COMPILATION_SUCCEEDED == rc)
+            internal_releaseCompiledMethod(entryPoint);
+         freeRequest(request);
+         }
+      else
+         {
+         request->_rc = rc;
+         request->_entryPoint = entryPoint;
+         request->_done = true;
+         }
+      // wake waiting clients, and threads held back by the memory limit
+      omrthread_monitor_notify_all(_monitor);
+      }
+
+   _numThreads--;
+   omrthread_monitor_notify_all(_monitor);
+   omrthread_exit(_monitor);
+   }
+
+} // namespace JitBuilder
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef JITBUILDER_COMPILATIONSERVICE_INCL
+#define JITBUILDER_COMPILATIONSERVICE_INCL
+
+#include <stdint.h>
+#include <queue>
+#include <vector>
+#include "omrthread.h"
+#include "env/RawAllocator.hpp"
+#include "env/TypedAllocator.hpp"
+
+namespace TR { class MethodBuilder; }
+
+namespace JitBuilder
+{
+
+/**
+ * Compiles MethodBuilders asynchronously on a pool of compilation threads.
+ *
+ * Requests are served highest priority first, and in submission order within
+ * a priority. Each compilation thread compiles one method at a time with its
+ * own scratch region, and the number of compilations in flight is limited so
+ * that their combined scratch memory limit (TR::Options::getScratchSpaceLimit())
+ * stays within the limit given to start(). One compilation may always run.
+ *
+ * The service is a singleton that is instance() from start() to stop(). Each
+ * outstanding request holds a reference to it, so a stopped service and its
+ * monitor are freed when the last of its requests is waited for or released.
+ */
+class CompilationService
+   {
+public:
+
+   struct Request;
+
+   static CompilationService *instance() { return _instance; }
+
+   /**
+    * @brief Start the compilation threads.
+    *
+    * @param numThreads The number of compilation threads.
+    * @param inFlightMemoryLimit The scratch memory, in bytes, that compilations
+    *        in flight may use together, or 0 for no limit.
+    * @return true if the threads were started or were already running.
+    */
+   static bool start(int32_t numThreads, int64_t inFlightMemoryLimit);
+
+   /**
+    * @brief Stop the compilation threads.
+    *
+    * Compilations in flight are completed. Requests that have not been
+    * started complete with COMPILATION_REQUESTED.
+    */
+   static void stop();
+
+   /**
+    * @brief Queue a MethodBuilder for compilation.
+    *
+    * The MethodBuilder must stay alive until the request is waited for or
+    * released.
+    *
+    * @param methodBuilder The method to compile.
+    * @param priority Requests with larger priorities are compiled first.
+    * @return The request, which must be passed to wait() or release(), or
+    *         NULL if the service is not running.
+    */
+   Request *submit(TR::MethodBuilder *methodBuilder, int32_t priority);
+
+   /**
+    * @brief Has the request's compilation finished?
+    */
+   static bool isDone(Request *request);
+
+   /**
+    * @brief Wait for a request's compilation to finish and release the request.
+    *
+    * @param request The request returned by submit().
+    * @param entryPoint Set to the entry point of the compiled method.
+    * @return The return code of the compilation.
+    */
+   static int32_t wait(Request *request, void **entryPoint);
+
+   /**
+    * @brief Release a request whose compiled method is not wanted.
+    *
+    * A request that has not been started is not compiled, and the method
+    * compiled for one that has is released with releaseCompiledMethod() as
+    * soon as its compilation finishes. The request must not be used
+    * afterwards.
+    *
+    * @param request The request returned by submit().
+    * @return true if the MethodBuilder is no longer used by the service, or
+    *         false if it is being compiled, in which case it must stay alive
+    *         until the compilation threads are stopped.
+    */
+   static bool release(Request *request);
+
+private:
+
+   struct RequestOrder
+      {
+      bool operator()(const Request *a, const Request *b) const;
+      };
+
+   typedef std::vector<Request *, TR::typed_allocator<Request *, TR::RawAllocator> > RequestVector;
+   typedef std::priority_queue<Request *, RequestVector, RequestOrder> RequestQueue;
+
+   CompilationService(TR::RawAllocator rawAllocator, int64_t inFlightMemoryLimit);
+
+   static int J9THREAD_PROC compilationThreadProc(void *entryArg);
+   void run();
+   bool canStartCompilation();
+   void freeRequest(Request *request);
+   void exitMonitorAndRelease();
+
+   static CompilationService *_instance;
+
+   TR::RawAllocator _rawAllocator;
+   omrthread_monitor_t _monitor;
+   RequestQueue _queue;
+   uint64_t _nextSequence;
+   int64_t _inFlightMemoryLimit;
+   int32_t _compilationsInFlight;
+   int32_t _numThreads;
+   int32_t _references;
+   bool _stopping;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_COMPILATIONSERVICE_INCL)
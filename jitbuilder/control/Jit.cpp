@@ -21,9 +21,11 @@
  *******************************************************************************/
 
 #include <stdio.h>
+#include <string.h>
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
+#include "control/CompilationService.hpp"
 #include "control/CompileMethod.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
@@ -32,7 +34,9 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
+#include "runtime/AOTCache.hpp"
 #include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
 #include "runtime/Runtime.hpp"
 #include "runtime/JBJitConfig.hpp"
 #include "control/CompilationController.hpp"
@@ -110,6 +114,10 @@ initializeCodeCache(TR::CodeCacheManager & codeCacheManager)
    TR::CodeCache *firstCodeCache = codeCacheManager.initialize(true, 1);
    }
 
+// Hash of the options the JIT was initialized with, which compiled code in
+// an AOT cache depends on
+static uint64_t jitOptionsHash = 0;
+
 // helperIDs is an array of helper id corresponding to the addresses passed in "helpers"
 // helpers is an array of pointers to helpers that compiled code needs to reference
 //   currently this argument isn't needed by anything so this function can stay internal
@@ -144,6 +152,9 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
    if (commonJitInit(fe, options) < 0)
       return false;
 
+   if (options)
+      jitOptionsHash = JitBuilder::AOTCache::hash(options, strlen(options));
+
    initializeCodeCache(fe.codeCacheManager());
 
    return true;
@@ -211,9 +222,98 @@ internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
    return rc;
    }
 
+// Return the code of a compiled method to its code cache so the space can be
+// reused by later compilations, and drop the AOT cache's hold on the entry
+// it was made from. The caller must ensure that no thread is executing, or
+// will call, the method. JitBuilder creates no metadata for compiled methods;
+// symbols registered for perf or ELF files describe the code as generated and
+// are kept.
+bool
+internal_releaseCompiledMethod(void *entryPoint)
+   {
+#if defined(AIXPPC)
+   // entryPoint is a function descriptor allocated by internal_compileMethodBuilder
+   return false;
+#else
+   if (!TR::CodeCacheManager::instance()->releaseCompiledBody(entryPoint))
+      return false;
+
+   JitBuilder::AOTCache *cache = JitBuilder::AOTCache::instance();
+   if (cache)
+      cache->releaseCompiledBody(entryPoint);
+   return true;
+#endif
+   }
+
+bool
+internal_startCompilationThreads(int32_t numThreads, int64_t inFlightMemoryLimit)
+   {
+   return JitBuilder::CompilationService::start(numThreads, inFlightMemoryLimit);
+   }
+
+// Queue a method for compilation on the compilation threads. The returned
+// request must be passed to internal_waitForMethodBuilder or
+// internal_releaseMethodBuilderRequest.
+void *
+internal_submitMethodBuilder(TR::MethodBuilder *m, int32_t priority)
+   {
+   JitBuilder::CompilationService *service = JitBuilder::CompilationService::instance();
+   if (!service)
+      return NULL;
+   return service->submit(m, priority);
+   }
+
+bool
+internal_isMethodBuilderCompiled(void *request)
+   {
+   JitBuilder::CompilationService::Request *r = static_cast<JitBuilder::CompilationService::Request *>(request);
+   return JitBuilder::CompilationService::isDone(r);
+   }
+
+int32_t
+internal_waitForMethodBuilder(void *request, void **entry)
+   {
+   JitBuilder::CompilationService::Request *r = static_cast<JitBuilder::CompilationService::Request *>(request);
+   return JitBuilder::CompilationService::wait(r, entry);
+   }
+
+// Give up on a request whose compiled method is not wanted. Returns false if
+// the method is being compiled, in which case its MethodBuilder must stay
+// alive until the compilation threads are stopped.
+bool
+internal_releaseMethodBuilderRequest(void *request)
+   {
+   JitBuilder::CompilationService::Request *r = static_cast<JitBuilder::CompilationService::Request *>(request);
+   return JitBuilder::CompilationService::release(r);
+   }
+
+void
+internal_stopCompilationThreads()
+   {
+   JitBuilder::CompilationService::stop();
+   }
+
+// Compiled methods are kept in the given file and reused by later processes
+// that build the same methods with the same options on the same processor
+bool
+internal_openAOTCache(char *fileName)
+   {
+   return JitBuilder::AOTCache::open(fileName, jitOptionsHash);
+   }
+
+// No compilation may be in flight when the cache is closed
+void
+internal_closeAOTCache()
+   {
+   JitBuilder::AOTCache::close();
+   }
+
 void
 internal_shutdownJit()
    {
+   JitBuilder::CompilationService::stop();
+   JitBuilder::AOTCache::close();
+
    auto fe = JitBuilder::FrontEnd::instance();
 
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
@@ -29,17 +29,28 @@
 #include "compile/InlineBlock.hpp"
 #include "compile/ResolvedMethod.hpp"
 #include "env/IO.hpp"
+#include "runtime/CodeCacheManager.hpp"
 
 namespace JitBuilder
 {
 
 IlGeneratorMethodDetails::IlGeneratorMethodDetails(TR_ResolvedMethod *method) :
    OMR::IlGeneratorMethodDetailsConnector(),
-   _method(static_cast<TR::ResolvedMethod *>(method))
+   _method(static_cast<TR::ResolvedMethod *>(method)),
+   _codeBlocks(NULL)
    {
    }
 
 
+IlGeneratorMethodDetails::~IlGeneratorMethodDetails()
+   {
+   // Only the list is freed: the code memory of a failed compilation is not
+   // reclaimed
+   if (_codeBlocks)
+      TR::CodeCacheManager::instance()->freeCodeBlockList(_codeBlocks);
+   }
+
+
 bool
 IlGeneratorMethodDetails::sameAs(TR::IlGeneratorMethodDetails & other, TR_FrontEnd *fe)
    {
@@ -62,6 +73,41 @@ IlGeneratorMethodDetails::getIlGenerator(TR::ResolvedMethodSymbol *methodSymbol,
    }
 
 
+void *
+IlGeneratorMethodDetails::findCompiledBody(TR::Compilation *comp)
+   {
+   AOTCache *cache = AOTCache::instance();
+   if (!cache || !AOTCache::describeIL(comp, _il))
+      return NULL;
+   return cache->findCompiledBody(comp, _il);
+   }
+
+
+void
+IlGeneratorMethodDetails::recordCompiledBody(TR::Compilation *comp, uint8_t *startPC)
+   {
+   AOTCache *cache = AOTCache::instance();
+   if (cache && _il._bytes)
+      cache->recordCompiledBody(comp, _il, startPC);
+   }
+
+
+void
+IlGeneratorMethodDetails::addCodeBlock(CodeBlock *block)
+   {
+   block->_next = _codeBlocks;
+   _codeBlocks = block;
+   }
+
+
+void
+IlGeneratorMethodDetails::registerCompiledBody(void *entryPoint)
+   {
+   TR::CodeCacheManager::instance()->registerCompiledBody(entryPoint, _codeBlocks);
+   _codeBlocks = NULL;
+   }
+
+
 void
 IlGeneratorMethodDetails::print(TR_FrontEnd *fe, TR::FILE *file)
    {
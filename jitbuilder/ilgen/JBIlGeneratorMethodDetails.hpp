@@ -36,6 +36,7 @@ namespace JitBuilder { typedef ::JitBuilder::IlGeneratorMethodDetails IlGenerato
 
 #include "infra/Annotations.hpp"
 #include "env/IO.hpp"
+#include "runtime/AOTCache.hpp"
 
 class TR_InlineBlocks;
 class TR_ResolvedMethod;
@@ -49,6 +50,7 @@ namespace JitBuilder
 {
 
 class ResolvedMethod;
+struct CodeBlock;
 
 class OMR_EXTENSIBLE IlGeneratorMethodDetails : public OMR::IlGeneratorMethodDetailsConnector
    {
@@ -57,16 +59,20 @@ public:
 
    IlGeneratorMethodDetails() :
       OMR::IlGeneratorMethodDetailsConnector(),
-      _method(NULL)
+      _method(NULL),
+      _codeBlocks(NULL)
    { }
 
    IlGeneratorMethodDetails(TR::ResolvedMethod *method) :
       OMR::IlGeneratorMethodDetailsConnector(),
-      _method(method)
+      _method(method),
+      _codeBlocks(NULL)
    { }
 
    IlGeneratorMethodDetails(TR_ResolvedMethod *method);
 
+   virtual ~IlGeneratorMethodDetails();
+
    TR::ResolvedMethod * getMethod() { return _method; }
    TR_ResolvedMethod * getResolvedMethod() { return (TR_ResolvedMethod *)_method; }
 
@@ -74,6 +80,20 @@ public:
 
    void print(TR_FrontEnd *fe, TR::FILE *file);
 
+   void *findCompiledBody(TR::Compilation *comp);
+   void recordCompiledBody(TR::Compilation *comp, uint8_t *startPC);
+
+   /**
+    * @brief Note a block of code memory allocated for the method.
+    */
+   void addCodeBlock(CodeBlock *block);
+
+   /**
+    * @brief Hand the code blocks of the method to the code cache manager,
+    *        which frees them when the method is released.
+    */
+   void registerCompiledBody(void *entryPoint);
+
    virtual TR_IlGenerator *getIlGenerator(TR::ResolvedMethodSymbol *methodSymbol,
                                           TR_FrontEnd * fe,
                                           TR::Compilation *comp,
@@ -84,6 +104,12 @@ public:
 protected:
 
    TR::ResolvedMethod * _method;
+
+   // Description of the method's IL when an AOTCache is open
+   AOTCache::MethodIL _il;
+
+   // Code memory allocated for the method so far
+   CodeBlock *_codeBlocks;
    };
 
 }
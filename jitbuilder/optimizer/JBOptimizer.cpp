@@ -55,11 +55,13 @@
 #include "optimizer/LoopCanonicalizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/LoopVersioner.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/PartialRedundancy.hpp"
 #include "optimizer/RegDepCopyRemoval.hpp"
 #include "optimizer/Simplifier.hpp"
+#include "optimizer/SLPVectorizer.hpp"
 #include "optimizer/SinkStores.hpp"
 #include "optimizer/TrivialDeadBlockRemover.hpp"
 #include "optimizer/GlobalValuePropagation.hpp"
@@ -126,11 +128,13 @@ static const OptimizationStrategy JBwarmStrategyOpts[] =
 
    { OMR::basicBlockOrdering,                        OMR::IfLoops                  }, // clean up block order for loop canonicalization, if it will run
    { OMR::loopCanonicalization,                      OMR::IfLoops                  }, // canonicalization must run before inductionVariableAnalysis else indvar data gets messed up
-   { OMR::inductionVariableAnalysis,                 OMR::IfLoops                  }, // needed for loop unroller
+   { OMR::inductionVariableAnalysis,                 OMR::IfLoops                  }, // needed for loop vectorizer and unroller
+   { OMR::loopVectorizer,                            OMR::IfLoops                  },
    { OMR::generalLoopUnroller,                       OMR::IfLoops                  },
    { OMR::basicBlockExtension,                       OMR::MarkLastRun              }, // clean up order and extend blocks now
    { OMR::treeSimplification                                                       },
    { OMR::localCSE                                                                 },
+   { OMR::slpVectorizer                                                            }, // pack isomorphic statements within the extended blocks
    { OMR::treeSimplification,                        OMR::IfEnabled                },
    { OMR::trivialDeadTreeRemoval,                    OMR::IfEnabled                },
    { OMR::cheapTacticalGlobalRegisterAllocatorGroup                                },
@@ -187,6 +191,10 @@ Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *methodSymb
       new (comp->allocator()) TR::OptimizationManager(self(), TR_Rematerialization::create, OMR::rematerialization);
    _opts[OMR::loopCanonicalization] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopCanonicalizer::create, OMR::loopCanonicalization);
+   _opts[OMR::loopVectorizer] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopVectorizer::create, OMR::loopVectorizer);
+   _opts[OMR::slpVectorizer] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_SLPVectorizer::create, OMR::slpVectorizer);
    _opts[OMR::inductionVariableAnalysis] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_InductionVariableAnalysis::create, OMR::inductionVariableAnalysis);
    _opts[OMR::liveRangeSplitter] =
@@ -0,0 +1,907 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "runtime/AOTCache.hpp"
+
+#include <string.h>
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/Relocation.hpp"
+#include "codegen/StaticRelocation.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "env/CompilerEnv.hpp"
+#include "il/Block.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ParameterSymbol.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/List.hpp"
+#include "infra/Monitor.hpp"
+#include "omrthread.h"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+
+// Bodies are moved by patching 64-bit absolute addresses, which is all the
+// x86-64 code generator emits for references that depend on the position of
+// the code
+#if defined(TR_HOST_X86) && defined(TR_HOST_64BIT) && (defined(LINUX) || defined(OSX))
+#define AOTCACHE_SUPPORTED
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define AOTCACHE_EYECATCHER "JBAOTC\0"
+#define AOTCACHE_VERSION 2
+
+namespace JitBuilder
+{
+
+// The file starts with a header and is followed by entries, each 8 byte
+// aligned. An entry is an EntryHeader followed by the IL description, the
+// code, the offsets in the code of absolute label addresses (uint32_t each)
+// and the symbol relocations (a uint32_t offset in the code, a uint32_t name
+// length, a uint64_t addend and the name, each)
+struct AOTCache::FileHeader
+   {
+   char _eyeCatcher[8];
+   uint32_t _version;
+   uint32_t _headerSize;
+   uint64_t _environmentHash;
+   };
+
+struct AOTCache::EntryHeader
+   {
+   uint32_t _size;
+   uint32_t _ilLength;
+   uint32_t _codeLength;
+   uint32_t _entryOffset;
+   uint32_t _numLabelRelocations;
+   uint32_t _numSymbolRelocations;
+   uint64_t _ilHash;
+   uint64_t _codeStart;
+   uint64_t _checksum;
+
+   const uint8_t *il() const { return reinterpret_cast<const uint8_t *>(this + 1); }
+   const uint8_t *code() const { return il() + _ilLength; }
+   const uint8_t *relocations() const { return code() + _codeLength; }
+   const uint8_t *symbolRelocations() const { return relocations() + _numLabelRelocations * sizeof(uint32_t); }
+   };
+
+AOTCache *AOTCache::_instance = NULL;
+
+namespace
+{
+
+const uint64_t HASH_SEED = 0xcbf29ce484222325ULL;
+
+uint64_t
+hashBytes(const void *data, size_t length, uint64_t hash)
+   {
+   const uint8_t *bytes = static_cast<const uint8_t *>(data);
+   for (size_t i = 0; i < length; i++)
+      hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+   return hash;
+   }
+
+uint32_t
+readUInt32(const uint8_t *cursor)
+   {
+   uint32_t value;
+   memcpy(&value, cursor, sizeof(value));
+   return value;
+   }
+
+uint64_t
+readUInt64(const uint8_t *cursor)
+   {
+   uint64_t value;
+   memcpy(&value, cursor, sizeof(value));
+   return value;
+   }
+
+// Each symbol relocation starts with its offset, name length and addend
+const size_t SYMBOL_RELOCATION_HEADER_SIZE = 2 * sizeof(uint32_t) + sizeof(uint64_t);
+
+// Finds the address of a called function or a named static of the method
+// being compiled by its name, or returns 0
+uintptr_t
+findSymbolAddress(TR::Compilation *comp, const char *name, uint32_t nameLength)
+   {
+   TR::SymbolReferenceTable *symRefTab = comp->getSymRefTab();
+   for (int32_t i = 0; i < symRefTab->getNumSymRefs(); i++)
+      {
+      TR::SymbolReference *symRef = symRefTab->getSymRef(i);
+      if (!symRef)
+         continue;
+
+      TR::Symbol *symbol = symRef->getSymbol();
+      const char *candidate;
+      uintptr_t address;
+      if (symbol->isResolvedMethod())
+         {
+         TR::ResolvedMethodSymbol *methodSymbol = symbol->castToResolvedMethodSymbol();
+         candidate = methodSymbol->getResolvedMethod()->externalName(comp->trMemory());
+         address = reinterpret_cast<uintptr_t>(methodSymbol->getMethodAddress());
+         }
+      else if (symbol->isNamed())
+         {
+         candidate = symbol->castToStaticSymbol()->getName();
+         address = reinterpret_cast<uintptr_t>(symbol->castToStaticSymbol()->getStaticAddress());
+         }
+      else
+         {
+         continue;
+         }
+
+      if (address && strlen(candidate) == nameLength && 0 == memcmp(candidate, name, nameLength))
+         return address;
+      }
+   return 0;
+   }
+
+// Builds the description of a method's IL in the compilation's heap memory
+class ILWriter
+   {
+public:
+   ILWriter(TR::Compilation *comp) :
+      _comp(comp), _bytes(NULL), _length(0), _capacity(0), _numNodes(0)
+      { }
+
+   bool describeMethod();
+
+   const uint8_t *bytes() const { return _bytes; }
+   uint32_t length() const { return _length; }
+
+private:
+   bool describeNode(TR::Node *node, vcount_t visitCount);
+   bool describeSymbolReference(TR::SymbolReference *symRef);
+
+   void write(const void *data, uint32_t length)
+      {
+      if (_length + length > _capacity)
+         {
+         uint32_t capacity = _capacity ? _capacity * 2 : 1024;
+         while (capacity < _length + length)
+            capacity *= 2;
+         uint8_t *bytes = static_cast<uint8_t *>(_comp->trMemory()->allocateHeapMemory(capacity));
+         if (_length)
+            memcpy(bytes, _bytes, _length);
+         _bytes = bytes;
+         _capacity = capacity;
+         }
+      memcpy(_bytes + _length, data, length);
+      _length += length;
+      }
+
+   void write32(uint32_t value) { write(&value, sizeof(value)); }
+   void write64(uint64_t value) { write(&value, sizeof(value)); }
+
+   void writeString(const char *string)
+      {
+      uint32_t length = static_cast<uint32_t>(strlen(string));
+      write32(length);
+      write(string, length);
+      }
+
+   TR::Compilation *_comp;
+   uint8_t *_bytes;
+   uint32_t _length;
+   uint32_t _capacity;
+   int32_t _numNodes;
+   };
+
+// Nodes seen before are written as a reference to their first occurrence
+const uint32_t COMMONED_NODE = 0xffffffff;
+
+bool
+ILWriter::describeMethod()
+   {
+   TR::ResolvedMethodSymbol *methodSymbol = _comp->getMethodSymbol();
+
+   // The return type shows in the return opcodes
+   write32(_comp->getMethodHotness());
+   ListIterator<TR::ParameterSymbol> parms(&methodSymbol->getParameterList());
+   for (TR::ParameterSymbol *parm = parms.getFirst(); parm; parm = parms.getNext())
+      {
+      write32(parm->getDataType().getDataType());
+      write64(parm->getSize());
+      }
+
+   vcount_t visitCount = _comp->incVisitCount();
+   for (TR::TreeTop *tt = _comp->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      if (!describeNode(tt->getNode(), visitCount))
+         return false;
+      }
+   return true;
+   }
+
+bool
+ILWriter::describeNode(TR::Node *node, vcount_t visitCount)
+   {
+   if (node->getVisitCount() == visitCount)
+      {
+      write32(COMMONED_NODE);
+      write32(node->getLocalIndex());
+      return true;
+      }
+   node->setVisitCount(visitCount);
+   node->setLocalIndex(_numNodes++);
+
+   TR::ILOpCode &op = node->getOpCode();
+   write32(node->getOpCodeValue());
+   write32(node->getDataType().getDataType());
+   write32(node->getNumChildren());
+   write32(node->getFlags().getValue());
+
+   if (op.isLoadConst())
+      {
+      switch (node->getDataType().getDataType())
+         {
+         case TR::Int8:    write64(node->getByte()); break;
+         case TR::Int16:   write64(node->getShortInt()); break;
+         case TR::Int32:   write64(node->getInt()); break;
+         case TR::Int64:   write64(node->getLongInt()); break;
+         case TR::Float:   write64(node->getFloatBits()); break;
+         case TR::Double:  write64(node->getDoubleBits()); break;
+         case TR::Address: write64(node->getAddress()); break;
+         default:          return false;
+         }
+      }
+
+   if (op.hasSymbolReference() && node->getSymbolReference())
+      {
+      if (!describeSymbolReference(node->getSymbolReference()))
+         return false;
+      }
+
+   if (node->getOpCodeValue() == TR::BBStart || node->getOpCodeValue() == TR::BBEnd)
+      {
+      TR::Block *block = node->getBlock();
+      write32(block->getNumber());
+      write32(block->isCold());
+      }
+
+   if (op.isCase())
+      write64(node->getCaseConstant());
+
+   if (op.isBranch() || op.isCase())
+      write32(node->getBranchDestination()->getNode()->getBlock()->getNumber());
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!describeNode(node->getChild(i), visitCount))
+         return false;
+      }
+   return true;
+   }
+
+bool
+ILWriter::describeSymbolReference(TR::SymbolReference *symRef)
+   {
+   TR::Symbol *symbol = symRef->getSymbol();
+   write32(symRef->getReferenceNumber());
+   write64(symRef->getOffset());
+   write32(symbol->getFlags());
+   write32(symbol->getFlags2());
+   write64(symbol->getSize());
+
+   if (symbol->isResolvedMethod())
+      {
+      // Called functions are found again by name when a body is loaded, so
+      // their addresses may differ from one process to the next
+      TR::ResolvedMethodSymbol *methodSymbol = symbol->castToResolvedMethodSymbol();
+      if (!methodSymbol->getMethodAddress())
+         return false;
+      writeString(methodSymbol->getResolvedMethod()->externalName(_comp->trMemory()));
+      }
+   else if (symbol->isMethod())
+      {
+      // Helpers are called relative to the code, which cannot be moved then
+      if (symbol->castToMethodSymbol()->getMethodAddress())
+         return false;
+      }
+   else if (symbol->isStatic())
+      {
+      // Likewise, named statics are found again by name
+      if (!symbol->isNamed())
+         return false;
+      writeString(symbol->castToStaticSymbol()->getName());
+      }
+   return true;
+   }
+
+}
+
+uint64_t
+AOTCache::hash(const void *data, size_t length)
+   {
+   return hashBytes(data, length, HASH_SEED);
+   }
+
+bool
+AOTCache::describeIL(TR::Compilation *comp, MethodIL &il)
+   {
+   ILWriter writer(comp);
+   if (!writer.describeMethod())
+      return false;
+
+   il._bytes = writer.bytes();
+   il._length = writer.length();
+   il._hash = hash(il._bytes, il._length);
+   return true;
+   }
+
+AOTCache::AOTCache(TR::RawAllocator rawAllocator, int fd, uint64_t environmentHash) :
+   _rawAllocator(rawAllocator),
+   _monitor(NULL),
+   _index(std::less<uint64_t>(), EntryIndex::allocator_type(rawAllocator)),
+   _bodies(std::less<void *>(), BodyMap::allocator_type(rawAllocator)),
+   _entryUses(std::less<const EntryHeader *>(), EntryUseMap::allocator_type(rawAllocator)),
+   _fd(fd),
+   _environmentHash(environmentHash),
+   _mapping(NULL),
+   _mappingSize(0),
+   _endOfEntries(0)
+   {
+   }
+
+AOTCache::~AOTCache()
+   {
+   // Entries recorded by this process were copied to raw memory
+   for (EntryIndex::iterator it = _index.begin(); it != _index.end(); ++it)
+      {
+      if (!isMapped(it->second))
+         _rawAllocator.deallocate(const_cast<EntryHeader *>(it->second));
+      }
+#if defined(AOTCACHE_SUPPORTED)
+   if (_mapping)
+      munmap(_mapping, _mappingSize);
+   if (_fd >= 0)
+      ::close(_fd);
+#endif
+   if (_monitor)
+      TR::Monitor::destroy(_monitor);
+   }
+
+bool
+AOTCache::open(const char *fileName, uint64_t optionsHash)
+   {
+#if defined(AOTCACHE_SUPPORTED)
+   if (_instance)
+      return false;
+
+   int fd = ::open(fileName, O_RDWR | O_CREAT, 0644);
+   if (fd < 0)
+      return false;
+
+   // Bodies are only valid for the processor features and options they
+   // were compiled with
+   OMRProcessorDesc processor = TR::Compiler->target.cpu.getProcessorDescription();
+   uint64_t environmentHash = HASH_SEED;
+   uint32_t version = AOTCACHE_VERSION;
+   uint32_t pointerSize = sizeof(void *);
+   uint32_t processorArchitecture = processor.processor;
+   uint32_t physicalProcessorArchitecture = processor.physicalProcessor;
+   environmentHash = hashBytes(&version, sizeof(version), environmentHash);
+   environmentHash = hashBytes(&pointerSize, sizeof(pointerSize), environmentHash);
+   environmentHash = hashBytes(&processorArchitecture, sizeof(processorArchitecture), environmentHash);
+   environmentHash = hashBytes(&physicalProcessorArchitecture, sizeof(physicalProcessorArchitecture), environmentHash);
+   environmentHash = hashBytes(processor.features, sizeof(processor.features), environmentHash);
+   environmentHash = hashBytes(&optionsHash, sizeof(optionsHash), environmentHash);
+
+   TR::RawAllocator rawAllocator;
+   AOTCache *cache = new (rawAllocator) AOTCache(rawAllocator, fd, environmentHash);
+   cache->_monitor = TR::Monitor::create((char *)"JIT-AOTCacheMonitor");
+   if (!cache->_monitor || !cache->load())
+      {
+      cache->~AOTCache();
+      rawAllocator.deallocate(cache);
+      return false;
+      }
+
+   // Calls to other functions must be recorded to be moved
+   TR::Options::getCmdLineOptions()->setOption(TR_RecordStaticRelocations);
+
+   _instance = cache;
+   return true;
+#else
+   return false;
+#endif
+   }
+
+void
+AOTCache::close()
+   {
+   AOTCache *cache = _instance;
+   if (!cache)
+      return;
+
+   TR::Options::getCmdLineOptions()->setOption(TR_RecordStaticRelocations, false);
+
+   _instance = NULL;
+   TR::RawAllocator rawAllocator = cache->_rawAllocator;
+   cache->~AOTCache();
+   rawAllocator.deallocate(cache);
+   }
+
+#if defined(AOTCACHE_SUPPORTED)
+
+namespace
+{
+
+// Holds an exclusive lock on the cache file, against other processes
+class FileLock
+   {
+public:
+   FileLock(int fd) : _fd(fd) { _locked = (0 == flock(_fd, LOCK_EX)); }
+   ~FileLock() { if (_locked) flock(_fd, LOCK_UN); }
+   bool locked() const { return _locked; }
+
+private:
+   int _fd;
+   bool _locked;
+   };
+
+bool
+writeFully(int fd, const void *data, size_t length, size_t offset)
+   {
+   const uint8_t *cursor = static_cast<const uint8_t *>(data);
+   while (length > 0)
+      {
+      ssize_t written = pwrite(fd, cursor, length, offset);
+      if (written <= 0)
+         return false;
+      cursor += written;
+      offset += written;
+      length -= written;
+      }
+   return true;
+   }
+
+}
+
+// Checks that an entry read from the file is complete and intact
+bool
+AOTCache::isValidEntry(const uint8_t *cursor, size_t available)
+   {
+   if (available < sizeof(EntryHeader))
+      return false;
+
+   const EntryHeader *entry = reinterpret_cast<const EntryHeader *>(cursor);
+   uint64_t size = entry->_size;
+   if (size < sizeof(EntryHeader) || size > available || size % 8 != 0)
+      return false;
+
+   uint64_t bodySize = size - sizeof(EntryHeader);
+   uint64_t fixedSize = (uint64_t)entry->_ilLength + entry->_codeLength + (uint64_t)entry->_numLabelRelocations * sizeof(uint32_t);
+   if (fixedSize > bodySize || entry->_entryOffset >= entry->_codeLength)
+      return false;
+
+   if (entry->_checksum != hashBytes(entry + 1, bodySize, HASH_SEED))
+      return false;
+
+   for (uint32_t i = 0; i < entry->_numLabelRelocations; i++)
+      {
+      if ((uint64_t)readUInt32(entry->relocations() + i * sizeof(uint32_t)) + sizeof(uint64_t) > entry->_codeLength)
+         return false;
+      }
+
+   const uint8_t *symbolRelocation = entry->symbolRelocations();
+   const uint8_t *end = cursor + size;
+   for (uint32_t i = 0; i < entry->_numSymbolRelocations; i++)
+      {
+      if (end - symbolRelocation < (ptrdiff_t)SYMBOL_RELOCATION_HEADER_SIZE)
+         return false;
+      uint32_t offset = readUInt32(symbolRelocation);
+      uint32_t nameLength = readUInt32(symbolRelocation + sizeof(uint32_t));
+      symbolRelocation += SYMBOL_RELOCATION_HEADER_SIZE;
+      if ((uint64_t)offset + sizeof(uint64_t) > entry->_codeLength || (uint64_t)(end - symbolRelocation) < nameLength)
+         return false;
+      symbolRelocation += nameLength;
+      }
+   return true;
+   }
+
+bool
+AOTCache::load()
+   {
+   FileLock lock(_fd);
+   if (!lock.locked())
+      return false;
+
+   struct stat status;
+   if (0 != fstat(_fd, &status))
+      return false;
+   size_t fileSize = status.st_size;
+
+   FileHeader header;
+   if (fileSize < sizeof(header))
+      {
+      // The file is new, or the process that created it died before
+      // writing its header. Nobody can have mapped any entries yet.
+      memset(&header, 0, sizeof(header));
+      memcpy(header._eyeCatcher, AOTCACHE_EYECATCHER, sizeof(header._eyeCatcher));
+      header._version = AOTCACHE_VERSION;
+      header._headerSize = sizeof(header);
+      header._environmentHash = _environmentHash;
+      if (sizeof(header) != pwrite(_fd, &header, sizeof(header), 0))
+         return false;
+      _endOfEntries = sizeof(header);
+      return true;
+      }
+
+   // A file that is damaged, or was written for another processor or other
+   // options, may be in use by other processes, so it is left alone and the
+   // cache is not used
+   if (sizeof(header) != pread(_fd, &header, sizeof(header), 0)
+       || 0 != memcmp(header._eyeCatcher, AOTCACHE_EYECATCHER, sizeof(header._eyeCatcher))
+       || AOTCACHE_VERSION != header._version
+       || sizeof(header) != header._headerSize
+       || _environmentHash != header._environmentHash)
+      return false;
+
+   size_t cursor = sizeof(header);
+   if (fileSize > cursor)
+      {
+      void *mapping = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, _fd, 0);
+      if (MAP_FAILED == mapping)
+         return false;
+      _mapping = static_cast<uint8_t *>(mapping);
+      _mappingSize = fileSize;
+
+      // Anything after an entry that an earlier process did not finish
+      // writing is ignored, and written over by the next entry recorded
+      while (cursor < fileSize && isValidEntry(_mapping + cursor, fileSize - cursor))
+         {
+         const EntryHeader *entry = reinterpret_cast<const EntryHeader *>(_mapping + cursor);
+         addEntry(entry);
+         cursor += entry->_size;
+         }
+      }
+   _endOfEntries = cursor;
+   return true;
+   }
+
+// Called with the file locked. Steps over the entries that other processes
+// have added after the given offset since this one last wrote to the file.
+// Returns false if they cannot be read, in which case nothing may be written.
+bool
+AOTCache::findEndOfEntries(size_t &offset)
+   {
+   struct stat status;
+   if (0 != fstat(_fd, &status))
+      return false;
+   size_t fileSize = status.st_size;
+
+   EntryHeader header;
+   while (fileSize - offset >= sizeof(header))
+      {
+      if (sizeof(header) != pread(_fd, &header, sizeof(header), offset))
+         return false;
+      if (header._size < sizeof(header) || header._size > fileSize - offset)
+         break;
+
+      uint8_t *bytes = static_cast<uint8_t *>(_rawAllocator.allocate(header._size, std::nothrow));
+      if (!bytes)
+         return false;
+      bool read = (ssize_t)header._size == pread(_fd, bytes, header._size, offset);
+      bool valid = read && isValidEntry(bytes, header._size);
+      _rawAllocator.deallocate(bytes);
+      if (!read)
+         return false;
+      if (!valid)
+         break;
+      offset += header._size;
+      }
+   return true;
+   }
+
+#else
+
+bool
+AOTCache::load()
+   {
+   return false;
+   }
+
+#endif
+
+void
+AOTCache::addEntry(const EntryHeader *entry)
+   {
+   _index.insert(std::make_pair(entry->_ilHash, entry));
+   }
+
+bool
+AOTCache::isMapped(const EntryHeader *entry) const
+   {
+   const uint8_t *bytes = reinterpret_cast<const uint8_t *>(entry);
+   return bytes >= _mapping && bytes < _mapping + _mappingSize;
+   }
+
+// The entry found is kept until releaseEntry() is called for it
+const AOTCache::EntryHeader *
+AOTCache::findEntry(const MethodIL &il)
+   {
+   OMR::CriticalSection findingEntry(_monitor);
+   std::pair<EntryIndex::iterator, EntryIndex::iterator> range = _index.equal_range(il._hash);
+   for (EntryIndex::iterator it = range.first; it != range.second; ++it)
+      {
+      const EntryHeader *entry = it->second;
+      if (entry->_ilLength == il._length && 0 == memcmp(entry->il(), il._bytes, il._length))
+         {
+         _entryUses[entry]++;
+         return entry;
+         }
+      }
+   return NULL;
+   }
+
+// Called with the monitor held
+void
+AOTCache::releaseEntry(const EntryHeader *entry)
+   {
+   EntryUseMap::iterator uses = _entryUses.find(entry);
+   if (--uses->second > 0)
+      return;
+   _entryUses.erase(uses);
+
+   // Entries read from the file stay mapped. One recorded by this process
+   // is freed; should the method be compiled again, the file gets a second
+   // copy of it, which load() indexes harmlessly
+   if (isMapped(entry))
+      return;
+   std::pair<EntryIndex::iterator, EntryIndex::iterator> range = _index.equal_range(entry->_ilHash);
+   for (EntryIndex::iterator it = range.first; it != range.second; ++it)
+      {
+      if (it->second == entry)
+         {
+         _index.erase(it);
+         break;
+         }
+      }
+   _rawAllocator.deallocate(const_cast<EntryHeader *>(entry));
+   }
+
+void
+AOTCache::releaseCompiledBody(void *entryPoint)
+   {
+   OMR::CriticalSection releasingBody(_monitor);
+   BodyMap::iterator body = _bodies.find(entryPoint);
+   if (body == _bodies.end())
+      return;
+   const EntryHeader *entry = body->second;
+   _bodies.erase(body);
+   releaseEntry(entry);
+   }
+
+void *
+AOTCache::findCompiledBody(TR::Compilation *comp, const MethodIL &il)
+   {
+   const EntryHeader *entry = findEntry(il);
+   if (!entry)
+      return NULL;
+
+   // Find the functions and statics the body refers to before committing
+   // any code memory
+   uintptr_t *symbolAddresses = NULL;
+   if (entry->_numSymbolRelocations > 0)
+      symbolAddresses = static_cast<uintptr_t *>(comp->trMemory()->allocateHeapMemory(entry->_numSymbolRelocations * sizeof(uintptr_t)));
+
+   const uint8_t *symbolRelocation = entry->symbolRelocations();
+   bool symbolsFound = true;
+   for (uint32_t i = 0; i < entry->_numSymbolRelocations && symbolsFound; i++)
+      {
+      uint32_t nameLength = readUInt32(symbolRelocation + sizeof(uint32_t));
+      const char *name = reinterpret_cast<const char *>(symbolRelocation + SYMBOL_RELOCATION_HEADER_SIZE);
+      symbolRelocation += SYMBOL_RELOCATION_HEADER_SIZE + nameLength;
+
+      symbolAddresses[i] = findSymbolAddress(comp, name, nameLength);
+      symbolsFound = (0 != symbolAddresses[i]);
+      }
+
+   TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+   TR::CodeCache *codeCache = NULL;
+   uint8_t *code = NULL;
+   if (symbolsFound)
+      {
+      int32_t numReserved = 0;
+      codeCache = manager->reserveCodeCache(false, entry->_codeLength, comp->getCompThreadID(), &numReserved);
+      }
+   if (codeCache)
+      {
+      uint8_t *coldCode = NULL;
+      code = manager->allocateCodeMemory(entry->_codeLength, 0, &codeCache, &coldCode, false);
+      manager->unreserveCodeCache(codeCache);
+      }
+   if (!code)
+      {
+      OMR::CriticalSection abandoningEntry(_monitor);
+      releaseEntry(entry);
+      return NULL;
+      }
+
+   omrthread_jit_write_protect_disable();
+   memcpy(code, entry->code(), entry->_codeLength);
+
+   uint64_t delta = reinterpret_cast<uintptr_t>(code) - entry->_codeStart;
+   for (uint32_t i = 0; i < entry->_numLabelRelocations; i++)
+      {
+      uint8_t *location = code + readUInt32(entry->relocations() + i * sizeof(uint32_t));
+      uint64_t address;
+      memcpy(&address, location, sizeof(address));
+      address += delta;
+      memcpy(location, &address, sizeof(address));
+      }
+
+   symbolRelocation = entry->symbolRelocations();
+   for (uint32_t i = 0; i < entry->_numSymbolRelocations; i++)
+      {
+      uint8_t *location = code + readUInt32(symbolRelocation);
+      uint64_t address = symbolAddresses[i] + readUInt64(symbolRelocation + 2 * sizeof(uint32_t));
+      memcpy(location, &address, sizeof(address));
+      symbolRelocation += SYMBOL_RELOCATION_HEADER_SIZE + readUInt32(symbolRelocation + sizeof(uint32_t));
+      }
+   omrthread_jit_write_protect_enable();
+
+   void *entryPoint = code + entry->_entryOffset;
+   OMR::CriticalSection addingBody(_monitor);
+   _bodies[entryPoint] = entry;
+   return entryPoint;
+   }
+
+void
+AOTCache::recordCompiledBody(TR::Compilation *comp, const MethodIL &il, uint8_t *startPC)
+   {
+#if defined(AOTCACHE_SUPPORTED)
+   TR::CodeGenerator *cg = comp->cg();
+   uint8_t *codeStart = cg->getBinaryBufferStart();
+   uint8_t *codeEnd = cg->getCodeEnd();
+   if (!il._bytes || startPC < codeStart || startPC >= codeEnd)
+      return;
+
+   // Only bodies whose position dependent references are all understood
+   // can be moved
+   if (!cg->getExternalRelocationList().empty())
+      return;
+
+   uint32_t codeLength = static_cast<uint32_t>(codeEnd - codeStart);
+   size_t size = sizeof(EntryHeader) + il._length + codeLength;
+
+   // A symbol is found the same way when the body is loaded, so the
+   // relocation keeps what the code adds to its address
+   TR::list<TR::StaticRelocation> &staticRelocations = cg->getStaticRelocations();
+   uint32_t numSymbolRelocations = 0;
+   for (auto it = staticRelocations.begin(); it != staticRelocations.end(); ++it)
+      {
+      if (it->size() != TR::StaticRelocationSize::word64
+          || it->type() != TR::StaticRelocationType::Absolute
+          || it->location() < codeStart
+          || it->location() + sizeof(uint64_t) > codeEnd
+          || !findSymbolAddress(comp, it->symbol(), static_cast<uint32_t>(strlen(it->symbol()))))
+         return;
+      size += SYMBOL_RELOCATION_HEADER_SIZE + strlen(it->symbol());
+      numSymbolRelocations++;
+      }
+
+   TR::list<TR::Relocation *> &relocations = cg->getRelocationList();
+   uint32_t numLabelRelocations = 0;
+   for (auto it = relocations.begin(); it != relocations.end(); ++it)
+      {
+      if (!(*it)->isLabelAbsoluteRelocation())
+         continue;
+      uint8_t *location = (*it)->getUpdateLocation();
+      if (location < codeStart || location + sizeof(uint64_t) > codeEnd)
+         return;
+      size += sizeof(uint32_t);
+      numLabelRelocations++;
+      }
+
+   size = (size + 7) & ~(size_t)7;
+   if (size > UINT32_MAX)
+      return;
+
+   uint8_t *bytes = static_cast<uint8_t *>(_rawAllocator.allocate(size, std::nothrow));
+   if (!bytes)
+      return;
+   memset(bytes, 0, size);
+
+   EntryHeader *entry = reinterpret_cast<EntryHeader *>(bytes);
+   entry->_size = static_cast<uint32_t>(size);
+   entry->_ilLength = il._length;
+   entry->_codeLength = codeLength;
+   entry->_entryOffset = static_cast<uint32_t>(startPC - codeStart);
+   entry->_numLabelRelocations = numLabelRelocations;
+   entry->_numSymbolRelocations = numSymbolRelocations;
+   entry->_ilHash = il._hash;
+   entry->_codeStart = reinterpret_cast<uintptr_t>(codeStart);
+
+   uint8_t *cursor = bytes + sizeof(EntryHeader);
+   memcpy(cursor, il._bytes, il._length);
+   cursor += il._length;
+   memcpy(cursor, codeStart, codeLength);
+   cursor += codeLength;
+   for (auto it = relocations.begin(); it != relocations.end(); ++it)
+      {
+      if (!(*it)->isLabelAbsoluteRelocation())
+         continue;
+      uint32_t offset = static_cast<uint32_t>((*it)->getUpdateLocation() - codeStart);
+      memcpy(cursor, &offset, sizeof(offset));
+      cursor += sizeof(offset);
+      }
+   for (auto it = staticRelocations.begin(); it != staticRelocations.end(); ++it)
+      {
+      uint32_t offset = static_cast<uint32_t>(it->location() - codeStart);
+      uint32_t nameLength = static_cast<uint32_t>(strlen(it->symbol()));
+      uint64_t addend = readUInt64(it->location()) - findSymbolAddress(comp, it->symbol(), nameLength);
+      memcpy(cursor, &offset, sizeof(offset));
+      memcpy(cursor + sizeof(offset), &nameLength, sizeof(nameLength));
+      memcpy(cursor + 2 * sizeof(uint32_t), &addend, sizeof(addend));
+      memcpy(cursor + SYMBOL_RELOCATION_HEADER_SIZE, it->symbol(), nameLength);
+      cursor += SYMBOL_RELOCATION_HEADER_SIZE + nameLength;
+      }
+   entry->_checksum = hashBytes(entry + 1, size - sizeof(EntryHeader), HASH_SEED);
+
+   OMR::CriticalSection recordingEntry(_monitor);
+
+   // Another compilation may have recorded the same method meanwhile
+   std::pair<EntryIndex::iterator, EntryIndex::iterator> range = _index.equal_range(il._hash);
+   for (EntryIndex::iterator it = range.first; it != range.second; ++it)
+      {
+      if (it->second->_ilLength == il._length && 0 == memcmp(it->second->il(), il._bytes, il._length))
+         {
+         _rawAllocator.deallocate(bytes);
+         _entryUses[it->second]++;
+         _bodies[startPC] = it->second;
+         return;
+         }
+      }
+   addEntry(entry);
+   _entryUses[entry]++;
+   _bodies[startPC] = entry;
+
+   FileLock lock(_fd);
+   if (!lock.locked())
+      return;
+   size_t end = _endOfEntries;
+   if (!findEndOfEntries(end))
+      return;
+
+   // A partial entry is ignored by load() and written over by the next one
+   if (writeFully(_fd, bytes, size, end))
+      _endOfEntries = end + size;
+#endif
+   }
+
+} // namespace JitBuilder
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef JITBUILDER_AOTCACHE_INCL
+#define JITBUILDER_AOTCACHE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include "env/RawAllocator.hpp"
+#include "env/TypedAllocator.hpp"
+
+namespace TR { class Compilation; }
+namespace TR { class Monitor; }
+
+namespace JitBuilder
+{
+
+/**
+ * Keeps the bodies of compiled methods in a file so that a later process
+ * generating the same IL can reuse them instead of compiling again.
+ *
+ * A method is identified by a description of its IL trees taken right after
+ * IL generation: opcodes, types, flags, constants, symbols and control flow.
+ * Two methods share a body only if their descriptions are identical, so the
+ * hash of the description only narrows the search.
+ *
+ * Bodies are stored with the relocations needed to move them: absolute
+ * addresses of labels in the body, and the addresses of called functions
+ * and named statics, which are recorded by name and looked up again when
+ * the body is loaded. The description refers to them by name too, so that
+ * it does not depend on where they live in a given process.
+ * Methods whose code refers to anything else that depends on where it lives
+ * are not recorded. The file is only valid for the processor, pointer size
+ * and JIT options it was written with. Other processes may have it mapped, so
+ * it is never truncated or rewritten: a process whose environment does not
+ * match the file's cannot open it, and an entry cut short by a process that
+ * died while writing it is ignored and later written over.
+ *
+ * The cache is a singleton that lives from open() to close().
+ */
+class AOTCache
+   {
+public:
+
+   /**
+    * @brief The description of a method's IL, used as the key of its body.
+    */
+   struct MethodIL
+      {
+      MethodIL() : _hash(0), _bytes(NULL), _length(0) { }
+
+      uint64_t _hash;
+      const uint8_t *_bytes;
+      uint32_t _length;
+      };
+
+   static AOTCache *instance() { return _instance; }
+
+   /**
+    * @brief Open the cache file, creating it if needed.
+    *
+    * @param fileName The file holding the cache.
+    * @param optionsHash A hash of the JIT options in effect.
+    * @return true if the cache is open.
+    */
+   static bool open(const char *fileName, uint64_t optionsHash);
+
+   /**
+    * @brief Hash a string of bytes, as done for the keys and checksums of
+    *        the cache. The value is the same in every process.
+    */
+   static uint64_t hash(const void *data, size_t length);
+
+   /**
+    * @brief Close the cache. No compilation may be in flight.
+    */
+   static void close();
+
+   /**
+    * @brief Describe the IL of a compilation that has just generated it.
+    *
+    * @param comp The compilation.
+    * @param il Set to the description, allocated in the compilation's heap
+    *        memory.
+    * @return false if the IL refers to something that cannot be described,
+    *         in which case the method is not cached.
+    */
+   static bool describeIL(TR::Compilation *comp, MethodIL &il);
+
+   /**
+    * @brief Load a body compiled from the given IL into the code cache.
+    *
+    * @return The entry point of the body, or NULL if there is none.
+    */
+   void *findCompiledBody(TR::Compilation *comp, const MethodIL &il);
+
+   /**
+    * @brief Add the body just compiled from the given IL to the cache.
+    */
+   void recordCompiledBody(TR::Compilation *comp, const MethodIL &il, uint8_t *startPC);
+
+   /**
+    * @brief Forget a body loaded or recorded by this process, which has
+    *        been released. An entry recorded by this process is freed once
+    *        no body made from it is left; the file keeps it for later
+    *        processes.
+    *
+    * @param entryPoint The entry point of the body.
+    */
+   void releaseCompiledBody(void *entryPoint);
+
+private:
+
+   struct FileHeader;
+   struct EntryHeader;
+
+   typedef std::multimap<uint64_t, const EntryHeader *, std::less<uint64_t>,
+                         TR::typed_allocator<std::pair<const uint64_t, const EntryHeader *>, TR::RawAllocator> > EntryIndex;
+   typedef std::map<void *, const EntryHeader *, std::less<void *>,
+                    TR::typed_allocator<std::pair<void * const, const EntryHeader *>, TR::RawAllocator> > BodyMap;
+   typedef std::map<const EntryHeader *, uint32_t, std::less<const EntryHeader *>,
+                    TR::typed_allocator<std::pair<const EntryHeader * const, uint32_t>, TR::RawAllocator> > EntryUseMap;
+
+   AOTCache(TR::RawAllocator rawAllocator, int fd, uint64_t environmentHash);
+   ~AOTCache();
+
+   static bool isValidEntry(const uint8_t *cursor, size_t available);
+   bool load();
+   bool findEndOfEntries(size_t &offset);
+   void addEntry(const EntryHeader *entry);
+   const EntryHeader *findEntry(const MethodIL &il);
+   void releaseEntry(const EntryHeader *entry);
+   bool isMapped(const EntryHeader *entry) const;
+
+   static AOTCache *_instance;
+
+   TR::RawAllocator _rawAllocator;
+   TR::Monitor *_monitor;
+   EntryIndex _index;
+   BodyMap _bodies;
+   EntryUseMap _entryUses;
+   int _fd;
+   uint64_t _environmentHash;
+   uint8_t *_mapping;
+   size_t _mappingSize;
+   size_t _endOfEntries;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_AOTCACHE_INCL)
@@ -28,7 +28,13 @@
 #include "runtime/CodeCache.hpp"
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/CodeCacheMemorySegment.hpp"
+#include "runtime/CodeCacheTypes.hpp"
+#include "compile/Compilation.hpp"
 #include "env/FrontEnd.hpp"
+#include "ilgen/IlGenRequest.hpp"
+#include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
 
 
 // Allocate and initialize a new code cache
@@ -41,7 +47,9 @@
 TR::CodeCacheManager *JitBuilder::CodeCacheManager::_codeCacheManager = NULL;
 
 JitBuilder::CodeCacheManager::CodeCacheManager(TR::RawAllocator rawAllocator)
-   : OMR::CodeCacheManagerConnector(rawAllocator)
+   : OMR::CodeCacheManagerConnector(rawAllocator),
+   _compiledBodiesMonitor(NULL),
+   _compiledBodies(std::less<void *>(), CompiledBodyMap::allocator_type(rawAllocator))
    {
    TR_ASSERT_FATAL(!_codeCacheManager, "CodeCacheManager already instantiated. "
                                        "Cannot create multiple instances");
@@ -135,3 +143,90 @@ JitBuilder::CodeCacheManager::freeCodeCacheSegment(TR::CodeCacheMemorySegment *
    munmap(memSegment->_base, memSegment->_top - memSegment->_base + sizeof(TR::CodeCacheMemorySegment));
 #endif
    }
+
+TR::CodeCache *
+JitBuilder::CodeCacheManager::initialize(bool useConsolidatedCache, uint32_t numberOfCodeCachesToCreateAtStartup)
+   {
+   _compiledBodiesMonitor = TR::Monitor::create("JIT-CompiledBodiesMonitor");
+   if (!_compiledBodiesMonitor)
+      return NULL;
+   return OMR::CodeCacheManager::initialize(useConsolidatedCache, numberOfCodeCachesToCreateAtStartup);
+   }
+
+uint8_t *
+JitBuilder::CodeCacheManager::allocateCodeMemory(size_t warmCodeSize,
+                                                 size_t coldCodeSize,
+                                                 TR::CodeCache **codeCache_pp,
+                                                 uint8_t **coldCode,
+                                                 bool needsToBeContiguous,
+                                                 bool isMethodHeaderNeeded)
+   {
+   uint8_t *warmCode = OMR::CodeCacheManager::allocateCodeMemory(warmCodeSize, coldCodeSize, codeCache_pp, coldCode, needsToBeContiguous, isMethodHeaderNeeded);
+
+   // The size of a block is kept in its method header, so only blocks with
+   // one can be freed again
+   TR::Compilation *comp = TR::comp();
+   if (!warmCode || !comp || !isMethodHeaderNeeded)
+      return warmCode;
+
+   uint8_t *blocks[2] = { NULL, NULL };
+   if (warmCodeSize || needsToBeContiguous)
+      blocks[0] = warmCode;
+   if (coldCodeSize && !needsToBeContiguous)
+      blocks[1] = *coldCode;
+
+   TR::IlGeneratorMethodDetails &details = comp->ilGenRequest().details();
+   for (int32_t i = 0; i < 2; i++)
+      {
+      if (!blocks[i])
+         continue;
+      CodeBlock *block = static_cast<CodeBlock *>(self()->getMemory(sizeof(CodeBlock)));
+      if (!block)
+         continue;
+      block->_codeCache = *codeCache_pp;
+      block->_start = blocks[i] - sizeof(OMR::CodeCacheMethodHeader);
+      details.addCodeBlock(block);
+      }
+   return warmCode;
+   }
+
+void
+JitBuilder::CodeCacheManager::registerCompiledBody(void *entryPoint, CodeBlock *blocks)
+   {
+   OMR::CriticalSection registeringBody(_compiledBodiesMonitor);
+   _compiledBodies[entryPoint] = blocks;
+   }
+
+bool
+JitBuilder::CodeCacheManager::releaseCompiledBody(void *entryPoint)
+   {
+   CodeBlock *blocks = NULL;
+      {
+      OMR::CriticalSection releasingBody(_compiledBodiesMonitor);
+      CompiledBodyMap::iterator body = _compiledBodies.find(entryPoint);
+      if (body == _compiledBodies.end())
+         return false;
+      blocks = body->second;
+      _compiledBodies.erase(body);
+      }
+
+   for (CodeBlock *block = blocks; block; block = block->_next)
+      {
+      OMR::CodeCacheMethodHeader *header = reinterpret_cast<OMR::CodeCacheMethodHeader *>(block->_start);
+      OMR::CodeCache::CacheCriticalSection releasingBlock(block->_codeCache);
+      block->_codeCache->addFreeBlock2(block->_start, block->_start + header->_size);
+      }
+   self()->freeCodeBlockList(blocks);
+   return true;
+   }
+
+void
+JitBuilder::CodeCacheManager::freeCodeBlockList(CodeBlock *blocks)
+   {
+   while (blocks)
+      {
+      CodeBlock *next = blocks->_next;
+      self()->freeMemory(blocks);
+      blocks = next;
+      }
+   }
@@ -35,11 +35,14 @@ namespace JitBuilder { typedef CodeCacheManager CodeCacheManagerConnector; }
 
 #include <stddef.h>
 #include <stdint.h>
+#include <map>
+#include "env/TypedAllocator.hpp"
 #include "runtime/OMRCodeCacheManager.hpp"
 
 namespace TR { class CodeCacheMemorySegment; }
 namespace TR { class CodeCache; }
 namespace TR { class CodeCacheManager; }
+namespace TR { class Monitor; }
 
 namespace JitBuilder
 {
@@ -47,6 +50,17 @@ namespace JitBuilder
 class JitConfig;
 class FrontEnd;
 
+/**
+ * A block of code memory allocated for a compiled method, starting with its
+ * CodeCacheMethodHeader. The blocks of a method are kept in a list.
+ */
+struct CodeBlock
+   {
+   TR::CodeCache *_codeCache;
+   uint8_t *_start;
+   CodeBlock *_next;
+   };
+
 class OMR_EXTENSIBLE CodeCacheManager : public OMR::CodeCacheManagerConnector
    {
    TR::CodeCacheManager *self();
@@ -71,8 +85,51 @@ public:
     */
    void freeCodeCacheSegment(TR::CodeCacheMemorySegment * memSegment);
 
+   TR::CodeCache *initialize(bool useConsolidatedCache, uint32_t numberOfCodeCachesToCreateAtStartup);
+
+   /**
+    * @brief Override of OMR::allocateCodeMemory that adds the blocks it
+    *        allocates for a compilation to the list of blocks of the method
+    *        being compiled.
+    */
+   uint8_t *allocateCodeMemory(size_t warmCodeSize,
+                               size_t coldCodeSize,
+                               TR::CodeCache **codeCache_pp,
+                               uint8_t **coldCode,
+                               bool needsToBeContiguous,
+                               bool isMethodHeaderNeeded=true);
+
+   /**
+    * @brief Take over the code blocks of a compiled method, which are freed
+    *        when the method is released.
+    *
+    * @param[in] entryPoint : the entry point of the method
+    * @param[in] blocks : the blocks allocated for the method
+    */
+   void registerCompiledBody(void *entryPoint, CodeBlock *blocks);
+
+   /**
+    * @brief Return the code blocks of a compiled method to their code caches.
+    *        No thread may be executing, or call, the method any more.
+    *
+    * @param[in] entryPoint : the entry point of the method
+    * @return false if entryPoint is not the entry point of a registered method
+    */
+   bool releaseCompiledBody(void *entryPoint);
+
+   /**
+    * @brief Free a list of code blocks without freeing the code memory itself.
+    */
+   void freeCodeBlockList(CodeBlock *blocks);
+
 private :
+   typedef std::map<void *, CodeBlock *, std::less<void *>,
+                    TR::typed_allocator<std::pair<void * const, CodeBlock *>, TR::RawAllocator> > CompiledBodyMap;
+
    static TR::CodeCacheManager *_codeCacheManager;
+
+   TR::Monitor *_compiledBodiesMonitor;
+   CompiledBodyMap _compiledBodies;
    };
 
 
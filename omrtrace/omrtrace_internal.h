@@ -43,11 +43,6 @@ extern "C" {
  * =============================================================================
  */
 
-/* Temporarily allow and ignore the output=<filename> command-line option until
- * it has been removed from all test scripts.
- */
-#define OMR_ALLOW_OUTPUT_OPTION 1
-
 #define UT_DEBUG                      "UTE_DEBUG"
 #define UT_TPID                       "TPID"
 #define UT_TPNID                      "TPNID"
@@ -66,6 +61,23 @@ extern "C" {
 #define UT_TRC_BUFFER_NEW             0x20000000 /* indicates an empty new buffer in use by a thread. cleared when buffer is written to. */
 #define UT_TRC_BUFFER_ACTIVE          0x80000000 /* indicates a buffer in use by a thread */
 
+/* Trace buffer publication modes, set by the publish= option */
+#define UT_PUBLISH_SYNC               0 /* subscribers run on the thread that filled the buffer */
+#define UT_PUBLISH_ASYNC_GROW         1 /* queue to the publisher thread, the queue is unbounded */
+#define UT_PUBLISH_ASYNC_DROP_OLDEST  2 /* queue to the publisher thread, discard the oldest buffer when the queue is full */
+#define UT_PUBLISH_ASYNC_BLOCK        3 /* queue to the publisher thread, wait for space when the queue is full */
+
+#define UT_PUBLISH_DEFAULT_QUEUE_DEPTH 64
+
+#define UT_TRACE_FILE_DEFAULT_SIZE    (16 * 1024 * 1024) /* size of the output= file when no size is given */
+
+/* States of the asynchronous publisher thread */
+#define UT_PUBLISHER_NOT_STARTED      0
+#define UT_PUBLISHER_RUNNING          1 /* buffers may be queued */
+#define UT_PUBLISHER_DRAINING         2 /* no new buffers are queued, waiting for producers already queueing */
+#define UT_PUBLISHER_STOPPING         3 /* the publisher empties the queue and exits */
+#define UT_PUBLISHER_STOPPED          4
+
 /*
  * =============================================================================
  * Constants for trace point actions.
@@ -243,6 +255,30 @@ struct OMR_TraceGlobal {
 	omrthread_monitor_t         bufferPoolLock;         /* Lock for buffer pool. Do not allow tracepoints while locking, holding, or releasing this monitor. */
 	J9Pool                     *threadPool;             /* Pool for allocating all UtThreadData */
 	omrthread_monitor_t         threadPoolLock;         /* Lock for thread pool. Do not allow tracepoints while locking, holding, or releasing this monitor. */
+	int32_t                     publishMode;            /* UT_PUBLISH_SYNC or one of the UT_PUBLISH_ASYNC_* policies */
+	uint32_t                    publishQueueMaxDepth;   /* Queue depth at which the back-pressure policy applies */
+	volatile uint32_t           publisherState;         /* UT_PUBLISHER_* state of the publisher thread */
+	omrthread_t                 publisherThread;        /* Thread draining the publish queue */
+	OMR_TraceThread            *publisherTraceThread;   /* Trace data of the publisher thread */
+	omrthread_monitor_t         publishQueueLock;       /* Wakes the publisher, blocked producers and flushes. Never held while queueing. */
+	OMR_TraceBuffer            *publishQueueHead;       /* Oldest queued buffer, owned by the consumer */
+	OMR_TraceBuffer * volatile  publishQueueTail;       /* Newest queued buffer, swapped in by producers */
+	OMR_TraceBuffer             publishQueueStub;       /* Placeholder node keeping the queue non-empty */
+	volatile uint32_t           publishQueueConsumerLock; /* Serializes dequeues by the publisher and dropping producers */
+	volatile uintptr_t          publishQueueDepth;      /* Number of queued buffers */
+	volatile uintptr_t          publishQueueHighWater;  /* Largest observed queue depth */
+	volatile uintptr_t          publishedBuffers;       /* Buffers delivered by the publisher thread */
+	volatile uintptr_t          droppedBuffers;         /* Buffers discarded by UT_PUBLISH_ASYNC_DROP_OLDEST */
+	volatile uintptr_t          publishProducersInFlight; /* Producers between the state check and the end of queueing */
+	volatile uintptr_t          publishBlockedProducers;  /* Producers waiting under UT_PUBLISH_ASYNC_BLOCK */
+	char                       *traceFileName;          /* File named by the output= option */
+	uint64_t                    traceFileSize;          /* Requested size of the output= file */
+	intptr_t                    traceFileHandle;        /* Open output= file, or -1 */
+	J9MmapHandle               *traceFileMapping;       /* Shared mapping of the whole output= file */
+	char                       *traceFileSlots;         /* First buffer slot in the mapping, following the file header */
+	int64_t                     traceFileSlotsOffset;   /* File offset of the first buffer slot */
+	uintptr_t                   traceFileSlotCount;     /* Number of UT_FILE_SLOT_LENGTH slots the file wraps around */
+	volatile uintptr_t          traceFileNextSlot;      /* Count of buffers written, the sequence number of the last slot claimed */
 };
 
 /*
@@ -515,6 +551,68 @@ void omrTrace(void *env, UtModuleInfo *modInfo, uint32_t traceId, const char *sp
  */
 omr_error_t publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf);
 
+/**
+ * @brief Start the asynchronous publisher thread.
+ *
+ * Does nothing unless an asynchronous publish mode is selected and the publisher has not been started.
+ * Until the publisher is running, buffers are published synchronously.
+ *
+ * @return an OMR error code
+ */
+omr_error_t startAsyncPublisher(void);
+
+/**
+ * @brief Stop the asynchronous publisher thread after it has published every queued buffer.
+ *
+ * Buffers published after this call are published synchronously.
+ *
+ * @pre The current thread is not the publisher thread.
+ */
+void stopAsyncPublisher(void);
+
+/**
+ * @brief Wait until every buffer queued before the call has been published.
+ */
+void flushAsyncPublisher(void);
+
+/**
+ * @brief Forget the publisher thread and queued buffers in a forked child process.
+ */
+void resetAsyncPublisher(void);
+
+/**
+ * @brief Create, size and map the file named by the output= option.
+ *
+ * The file holds the trace file header followed by a fixed number of buffer-sized
+ * slots that are overwritten in a round-robin fashion. If the file can't be mapped
+ * the slots are written with positional writes instead.
+ * Does nothing if the output= option was not specified.
+ *
+ * @return an OMR error code
+ */
+omr_error_t openTraceFile(void);
+
+/**
+ * @brief Copy a full trace buffer into the next slot of the output= file.
+ *
+ * Does nothing if no output= file is open.
+ *
+ * @param[in] buf The trace buffer to write.
+ */
+void writeTraceFileBuffer(OMR_TraceBuffer *buf);
+
+/**
+ * @brief Schedule the dirty pages of a mapped output= file to be written to disk.
+ */
+void flushTraceFile(void);
+
+/**
+ * @brief Unmap, if mapped, and close the output= file.
+ *
+ * @pre No buffers are being published.
+ */
+void closeTraceFile(void);
+
 /**
  * @brief Release a trace buffer.
  *
@@ -91,6 +91,12 @@ omr_trc_startup(OMR_VM *omrVM, const OMR_TraceLanguageInterface *languageIntf, c
 		}
 	}
 
+	rc = openTraceFile();
+	if (OMR_ERROR_NONE != rc) {
+		omrtty_printf("omr_trc_startup: failed to open the trace output file, rc=%d\n", rc);
+		goto done;
+	}
+
 	omrVM->_trcEngine = newTrcEngine;
 done:
 	return rc;
@@ -170,6 +176,24 @@ omr_trc_stopThreadTrace(OMR_VMThread *currentThread)
 	return rc;
 }
 
+omr_error_t
+omr_trc_getPublishStatistics(OMR_VM *omrVM, OMR_TracePublishStatistics *stats)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	if (NULL == stats) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else if ((NULL == omrVM->_trcEngine) || (NULL == omrTraceGlobal)) {
+		rc = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+		stats->queueDepth = OMR_TRACEGLOBAL(publishQueueDepth);
+		stats->queueHighWater = OMR_TRACEGLOBAL(publishQueueHighWater);
+		stats->publishedBuffers = OMR_TRACEGLOBAL(publishedBuffers);
+		stats->droppedBuffers = OMR_TRACEGLOBAL(droppedBuffers);
+	}
+	return rc;
+}
+
 #if defined(OMR_THR_FORK_SUPPORT)
 
 void
@@ -188,6 +212,10 @@ omr_trc_preForkHandler(void)
 		omrthread_monitor_enter(OMR_TRACEGLOBAL(subscribersLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: obtained global subscribers lock.\n"));
 
+		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: requesting global publish queue lock.\n"));
+		omrthread_monitor_enter(OMR_TRACEGLOBAL(publishQueueLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: obtained global publish queue lock.\n"));
+
 		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: requesting global trace lock.\n"));
 		omrthread_monitor_enter(OMR_TRACEGLOBAL(traceLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: obtained global trace lock.\n"));
@@ -215,6 +243,9 @@ omr_trc_postForkParentHandler(void)
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(traceLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global trace lock.\n"));
 
+		omrthread_monitor_exit(OMR_TRACEGLOBAL(publishQueueLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global publish queue lock.\n"));
+
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(subscribersLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global subscribers lock.\n"));
 
@@ -241,6 +272,9 @@ omr_trc_postForkChildHandler(void)
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(traceLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkChildHandler: released global trace lock.\n"));
 
+		omrthread_monitor_exit(OMR_TRACEGLOBAL(publishQueueLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_postForkChildHandler: released global publish queue lock.\n"));
+
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(subscribersLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global subscribers lock.\n"));
 
@@ -269,6 +303,7 @@ postForkCleanupGlobals(OMR_TraceThread *thr)
 	}
 	OMR_TRACEGLOBAL(lastPrint) = NULL;
 	OMR_TRACEGLOBAL(lostRecords) = 0;
+	resetAsyncPublisher();
 }
 
 void
@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+
+#include "omrtrace_internal.h"
+
+/*
+ * The output= file starts with the trace file header returned by GetTraceMetadata, with a
+ * UtFileSlotsSection appended, followed by fixed size slots. Each slot holds a trace record
+ * between two copies of the sequence number of the write that filled it, so formatters can
+ * start at the oldest slot once the file has wrapped and can detect slots whose write was
+ * torn. The file is sized and its blocks reserved up front, then mapped shared, and
+ * published buffers are copied straight into the page cache in round-robin order, so
+ * writing a buffer doesn't need a system call or a lock. Where the file can't be mapped
+ * each slot is written with one positional write, which publishing threads can issue
+ * concurrently without seeking. Slots that have not been written yet are zero-filled.
+ */
+
+omr_error_t
+openTraceFile(void)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	const char *fileName = OMR_TRACEGLOBAL(traceFileName);
+	intptr_t fd = -1;
+	J9MmapHandle *mapping = NULL;
+	UtTraceFileHdr *traceHeader = NULL;
+	UtTraceFileHdr *header = NULL;
+	UtFileSlotsSection *slotsSection = NULL;
+	uint64_t slotsSectionStart = 0;
+	uint64_t headerLength = 0;
+	uint64_t slotLength = 0;
+	uint64_t slotCount = 0;
+	uint64_t fileLength = 0;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+
+	if ((NULL == fileName) || (-1 != OMR_TRACEGLOBAL(traceFileHandle))) {
+		return OMR_ERROR_NONE;
+	}
+
+	/* buffers must be queued for publication so the header records external trace */
+	OMR_TRACEGLOBAL(traceInCore) = FALSE;
+	rc = initTraceHeader();
+	if (OMR_ERROR_NONE != rc) {
+		return rc;
+	}
+	traceHeader = OMR_TRACEGLOBAL(traceHeader);
+	slotsSectionStart = ((uint64_t)traceHeader->header.length + sizeof(uint64_t) - 1) & ~(uint64_t)(sizeof(uint64_t) - 1);
+	headerLength = slotsSectionStart + sizeof(UtFileSlotsSection);
+	slotLength = UT_FILE_SLOT_LENGTH(OMR_TRACEGLOBAL(bufferSize));
+
+	if (OMR_TRACEGLOBAL(traceFileSize) > headerLength) {
+		slotCount = (OMR_TRACEGLOBAL(traceFileSize) - headerLength) / slotLength;
+	}
+	if (0 == slotCount) {
+		slotCount = 1;
+	}
+	fileLength = headerLength + (slotCount * slotLength);
+
+	/* the file header is the trace header with the slots section as its last section */
+	header = (UtTraceFileHdr *)omrmem_allocate_memory((uintptr_t)headerLength, OMRMEM_CATEGORY_TRACE);
+	if (NULL == header) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	memset(header, 0, (size_t)headerLength);
+	memcpy(header, traceHeader, (size_t)traceHeader->header.length);
+	header->header.length = (int32_t)headerLength;
+	slotsSection = (UtFileSlotsSection *)((char *)header + slotsSectionStart);
+	initHeader(&slotsSection->header, UT_FILE_SLOTS_SECTION_NAME, sizeof(UtFileSlotsSection));
+	slotsSection->slotCount = slotCount;
+
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if (fd < 0) {
+		UT_DBGOUT(1, ("<UT> Unable to open trace output file %s\n", fileName));
+		omrmem_free_memory(header);
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+
+	if (0 != omrfile_set_length(fd, (int64_t)fileLength)) {
+		UT_DBGOUT(1, ("<UT> Unable to size trace output file %s to %llu bytes\n", fileName, fileLength));
+		rc = OMR_ERROR_FILE_UNAVAILABLE;
+		goto fail;
+	}
+
+	/* Reserve the blocks now, a store to a mapped page with no space behind it would fault. */
+	if (0 != omrfile_fallocate(fd, 0, (int64_t)fileLength, 0)) {
+		UT_DBGOUT(1, ("<UT> Unable to reserve %llu bytes for trace output file %s\n", fileLength, fileName));
+		rc = OMR_ERROR_FILE_UNAVAILABLE;
+		goto fail;
+	}
+
+	if (OMRPORT_MMAP_CAPABILITY_WRITE == (omrmmap_capabilities() & OMRPORT_MMAP_CAPABILITY_WRITE)) {
+		mapping = omrmmap_map_file(fd, 0, (uintptr_t)fileLength, NULL,
+				OMRPORT_MMAP_FLAG_WRITE | OMRPORT_MMAP_FLAG_SHARED, OMRMEM_CATEGORY_TRACE);
+	}
+
+	if (NULL != mapping) {
+		memcpy(mapping->pointer, header, (size_t)headerLength);
+		OMR_TRACEGLOBAL(traceFileSlots) = (char *)mapping->pointer + headerLength;
+	} else {
+		OMRIOVec headerVec;
+		headerVec.iov_base = header;
+		headerVec.iov_len = (uintptr_t)headerLength;
+
+		UT_DBGOUT(1, ("<UT> Unable to map trace output file %s, writing it instead\n", fileName));
+		if ((intptr_t)headerLength != omrfile_pwritev(fd, &headerVec, 1, 0)) {
+			UT_DBGOUT(1, ("<UT> Unable to write the header of trace output file %s\n", fileName));
+			rc = OMR_ERROR_FILE_UNAVAILABLE;
+			goto fail;
+		}
+		OMR_TRACEGLOBAL(traceFileSlots) = NULL;
+	}
+
+	OMR_TRACEGLOBAL(traceFileSlotsOffset) = (int64_t)headerLength;
+	OMR_TRACEGLOBAL(traceFileSlotCount) = (uintptr_t)slotCount;
+	OMR_TRACEGLOBAL(traceFileNextSlot) = 0;
+	OMR_TRACEGLOBAL(traceFileMapping) = mapping;
+	/* an open handle is what tells writers the file is ready */
+	OMR_TRACEGLOBAL(traceFileHandle) = fd;
+
+	UT_DBGOUT(1, ("<UT> Trace output file %s holds %llu buffers\n", fileName, slotCount));
+	omrmem_free_memory(header);
+	return OMR_ERROR_NONE;
+
+fail:
+	omrfile_close(fd);
+	omrfile_unlink(fileName);
+	omrmem_free_memory(header);
+	return rc;
+}
+
+/*
+ * Copy a buffer to the next slot of the output= file. The sequence number before the record
+ * is stored before the record is copied and the one after it is stored once the copy is
+ * complete, so a formatter sees different sequence numbers in a slot whose write was cut
+ * short. Writers only collide if the file wraps around completely while a copy is in progress.
+ */
+void
+writeTraceFileBuffer(OMR_TraceBuffer *buf)
+{
+	if (-1 != OMR_TRACEGLOBAL(traceFileHandle)) {
+		const uintptr_t bufferSize = (uintptr_t)OMR_TRACEGLOBAL(bufferSize);
+		const uintptr_t slotLength = (uintptr_t)UT_FILE_SLOT_LENGTH(bufferSize);
+		/* Claim a slot, numbering the writes from 1 so that 0 marks a slot that was never written. */
+		const uint64_t sequence = (uint64_t)VM_AtomicSupport::add(&OMR_TRACEGLOBAL(traceFileNextSlot), 1);
+		const uintptr_t slot = (uintptr_t)((sequence - 1) % OMR_TRACEGLOBAL(traceFileSlotCount));
+
+		if (NULL != OMR_TRACEGLOBAL(traceFileSlots)) {
+			char *slotStart = OMR_TRACEGLOBAL(traceFileSlots) + (slot * slotLength);
+
+			/* the sequence numbers are unaligned unless bufferSize is a multiple of their size */
+			memcpy(slotStart, &sequence, sizeof(sequence));
+			VM_AtomicSupport::writeBarrier();
+			memcpy(slotStart + sizeof(sequence), &buf->record, bufferSize);
+			VM_AtomicSupport::writeBarrier();
+			memcpy(slotStart + sizeof(sequence) + bufferSize, &sequence, sizeof(sequence));
+		} else {
+			OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+			OMRIOVec slotVec[3];
+			slotVec[0].iov_base = (void *)&sequence;
+			slotVec[0].iov_len = sizeof(sequence);
+			slotVec[1].iov_base = &buf->record;
+			slotVec[1].iov_len = bufferSize;
+			slotVec[2].iov_base = (void *)&sequence;
+			slotVec[2].iov_len = sizeof(sequence);
+
+			if ((intptr_t)slotLength != omrfile_pwritev(OMR_TRACEGLOBAL(traceFileHandle), slotVec, 3,
+					OMR_TRACEGLOBAL(traceFileSlotsOffset) + (int64_t)(slot * slotLength))) {
+				UT_DBGOUT(1, ("<UT> Unable to write trace buffer to slot %zu of the trace output file\n", slot));
+			}
+		}
+	}
+}
+
+void
+flushTraceFile(void)
+{
+	J9MmapHandle *mapping = OMR_TRACEGLOBAL(traceFileMapping);
+
+	if (NULL != mapping) {
+		OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+		omrmmap_msync(mapping->pointer, mapping->size, OMRPORT_MMAP_SYNC_ASYNC);
+	}
+}
+
+void
+closeTraceFile(void)
+{
+	J9MmapHandle *mapping = OMR_TRACEGLOBAL(traceFileMapping);
+
+	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+
+	if (-1 != OMR_TRACEGLOBAL(traceFileHandle)) {
+		UT_DBGOUT(1, ("<UT> Closing trace output file %s after %llu buffers\n",
+				OMR_TRACEGLOBAL(traceFileName), (uint64_t)OMR_TRACEGLOBAL(traceFileNextSlot)));
+		if (NULL != mapping) {
+			omrmmap_msync(mapping->pointer, mapping->size, OMRPORT_MMAP_SYNC_WAIT);
+			OMR_TRACEGLOBAL(traceFileMapping) = NULL;
+			OMR_TRACEGLOBAL(traceFileSlots) = NULL;
+			omrmmap_unmap_file(mapping);
+		}
+		omrfile_close(OMR_TRACEGLOBAL(traceFileHandle));
+		OMR_TRACEGLOBAL(traceFileHandle) = -1;
+	}
+
+	if (NULL != OMR_TRACEGLOBAL(traceFileName)) {
+		omrmem_free_memory(OMR_TRACEGLOBAL(traceFileName));
+		OMR_TRACEGLOBAL(traceFileName) = NULL;
+	}
+}
@@ -26,11 +26,53 @@
 
 #include "omrtraceformat.h"
 #include "omrtrace_internal.h"
+#include "thread_api.h"
+
+#include "AtomicSupport.hpp"
 
 #define ONEMILLION (1000000)
 
+#define UT_TRACE_FORMATTER_64BIT_DATA		64
+#define UT_TRACE_FORMATTER_32BIT_DATA		32
+#define UT_TRACE_FORMATTER_8BIT_DATA		8
+#define UT_TRACE_FORMATTER_STRING_DATA	-1
+#define UT_FORMAT_TEMPLATE_LITERAL		0
+
+/* must be a power of 2 */
+#define UT_FORMAT_TEMPLATE_BUCKETS 1024
+
+/* A run of literal text, or a single printf conversion specification and the size of its data */
+typedef struct UtFormatTemplateSegment {
+	int32_t traceDataType; /* UT_TRACE_FORMATTER_*_DATA, or UT_FORMAT_TEMPLATE_LITERAL */
+	uint32_t numberOfStars;
+	uint32_t length;
+	const char *text;
+} UtFormatTemplateSegment;
+
+/* The parsed format string of one tracepoint */
+typedef struct UtFormatTemplate {
+	struct UtFormatTemplate *next; /* next template in the hash chain */
+	uint32_t traceId;
+	uint32_t segmentCount;
+	int32_t hasFormat; /* FALSE if the format string callback returned NULL */
+	char *componentName;
+	UtFormatTemplateSegment *segments;
+} UtFormatTemplate;
+
+typedef struct UtFormatTemplateCache {
+	omrthread_monitor_t lock;
+	UtFormatTemplate * volatile buckets[UT_FORMAT_TEMPLATE_BUCKETS];
+} UtFormatTemplateCache;
+
+#if defined(OMR_ENV_LITTLE_ENDIAN)
+#define UT_FORMATTER_HOST_IS_BIG_ENDIAN FALSE
+#else /* defined(OMR_ENV_LITTLE_ENDIAN) */
+#define UT_FORMATTER_HOST_IS_BIG_ENDIAN TRUE
+#endif /* defined(OMR_ENV_LITTLE_ENDIAN) */
+
 struct UtTracePointIterator {
-	OMR_TraceBuffer *buffer;
+	UtTraceRecord *record;
+	void *ownedRecord; /* allocated copy of the record, or NULL if the record is in the file mapping */
 	int32_t recordLength;
 	uint64_t end;
 	uint64_t start;
@@ -53,6 +95,8 @@ struct UtTracePointIterator {
 	uint32_t numberOfBytesInPlatformShort;
 	OMRPortLibrary *portLib;
 	FormatStringCallback getFormatStringFn;
+	UtFormatTemplateCache *templateCache;
+	uint64_t timeStamp; /* timestamp of the last tracepoint formatted */
 };
 
 struct UtTraceFileIterator {
@@ -65,9 +109,22 @@ struct UtTraceFileIterator {
 	FormatStringCallback getFormatStringFn;
 	OMRPortLibrary *portLib;
 	intptr_t traceFileHandle;
-	intptr_t currentPosition;
+	intptr_t currentPosition; /* file offset of the next record, or of the first slot of a file with slots */
+	J9MmapHandle *mapping; /* read-only mapping of the whole file, or NULL if the file is read */
+	intptr_t fileLength;
+	UtFormatTemplateCache *templateCache; /* shared by the buffer iterators of this file */
+	uint64_t slotCount; /* slots of a wrap-around file written by the output= option, 0 if the records follow each other */
+	uint64_t oldestSlot; /* the slot with the lowest sequence number, where iteration starts */
+	uint64_t slotsVisited; /* slots returned or skipped so far, counting from oldestSlot */
 };
 
+static omr_error_t mapTraceFile(OMRPortLibrary *portLib, intptr_t traceFileHandle, J9MmapHandle **mappingPtr);
+static omr_error_t findTraceFileSlots(UtTraceFileIterator *iter);
+static omr_error_t readTraceFileSlot(UtTraceFileIterator *iter, uint64_t slot, uint64_t *sequence, uint64_t *endSequence, UtTraceRecord **record, void *recordCopy);
+static omr_error_t getNextTraceFileSlot(UtTraceFileIterator *fileIterator, UtTracePointIterator *iterator);
+static omr_error_t createFormatTemplateCache(OMRPortLibrary *portLib, UtFormatTemplateCache **cachePtr);
+static void freeFormatTemplateCache(OMRPortLibrary *portLib, UtFormatTemplateCache *cache);
+
 omr_error_t
 omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFileIterator **iteratorPtr,
 							 FormatStringCallback getFormatStringFn)
@@ -76,8 +133,12 @@ omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFil
 	UtTraceFileIterator *iterator = NULL;
 	intptr_t traceFileHandle = -1;
 	intptr_t bytesRead = -1;
+	int64_t fileLength = -1;
+	J9MmapHandle *mapping = NULL;
 	UtTraceFileHdr dummyHeader;
 	UtTraceFileHdr *header = NULL;
+	OMRIOVec headerVec;
+	omr_error_t rc = OMR_ERROR_NONE;
 
 	/* Open the trace file and copy out the header. */
 	traceFileHandle = omrfile_open(fileName, EsOpenRead, 0);
@@ -86,52 +147,103 @@ omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFil
 		return OMR_ERROR_FILE_UNAVAILABLE;
 	}
 
-	bytesRead = omrfile_read(traceFileHandle, &dummyHeader, sizeof(UtTraceFileHdr));
-
-	if (bytesRead != sizeof(UtTraceFileHdr)) {
-		omrmem_free_memory(header);
+	fileLength = omrfile_flength(traceFileHandle);
+	if (fileLength < (int64_t)sizeof(UtTraceFileHdr)) {
+		omrfile_close(traceFileHandle);
 		return OMR_ERROR_INTERNAL;
 	}
 
-	/* Check for a valid looking header. */
-	if (dummyHeader.endianSignature != UT_ENDIAN_SIGNATURE) {
-		/* TODO - If this is the wrong endianess we'll either need to fix up the header
-		 * and change the formatter to cope with files from other platforms OR document
-		 * that the native formatter can't cope with that.
-		 */
-		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	/* The whole file is going to be read in order, start pulling it in. */
+	omrfile_readahead(traceFileHandle, 0, fileLength);
+
+	/* Map the whole file if possible so buffers can be formatted in place. */
+	rc = mapTraceFile(OMRPORTLIB, traceFileHandle, &mapping);
+	if (OMR_ERROR_NONE != rc) {
+		omrfile_close(traceFileHandle);
+		return rc;
 	}
 
-	/* Now we know how big the header really is, reset the file and read it again. */
-	header = (UtTraceFileHdr *)omrmem_allocate_memory(dummyHeader.header.length, OMRMEM_CATEGORY_TRACE);
+	if (NULL != mapping) {
+		header = (UtTraceFileHdr *)mapping->pointer;
+		bytesRead = header->header.length;
+
+		/* Check for a valid looking header. */
+		if ((header->endianSignature != UT_ENDIAN_SIGNATURE)
+			|| (header->header.length < (int32_t)sizeof(UtTraceFileHdr))
+			|| (header->header.length > fileLength)
+		) {
+			omrmmap_unmap_file(mapping);
+			omrfile_close(traceFileHandle);
+			return OMR_ERROR_ILLEGAL_ARGUMENT;
+		}
+	} else {
+		headerVec.iov_base = &dummyHeader;
+		headerVec.iov_len = sizeof(UtTraceFileHdr);
+		bytesRead = omrfile_preadv(traceFileHandle, &headerVec, 1, 0);
 
-	if (NULL == header) {
-		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
-	}
+		if (bytesRead != sizeof(UtTraceFileHdr)) {
+			omrfile_close(traceFileHandle);
+			return OMR_ERROR_INTERNAL;
+		}
 
-	omrfile_seek(traceFileHandle, 0, EsSeekSet);
-	bytesRead = omrfile_read(traceFileHandle, header, dummyHeader.header.length);
+		/* Check for a valid looking header. */
+		if (dummyHeader.endianSignature != UT_ENDIAN_SIGNATURE) {
+			/* TODO - If this is the wrong endianess we'll either need to fix up the header
+			 * and change the formatter to cope with files from other platforms OR document
+			 * that the native formatter can't cope with that.
+			 */
+			omrfile_close(traceFileHandle);
+			return OMR_ERROR_ILLEGAL_ARGUMENT;
+		}
 
-	if (bytesRead != dummyHeader.header.length) {
-		omrmem_free_memory(header);
-		return OMR_ERROR_INTERNAL;
-	}
+		/* Now we know how big the header really is, read it again. */
+		header = (UtTraceFileHdr *)omrmem_allocate_memory(dummyHeader.header.length, OMRMEM_CATEGORY_TRACE);
 
-	/* Check for a valid looking header. */
-	if (header->endianSignature != UT_ENDIAN_SIGNATURE) {
-		/* TODO - If this is the wrong endianess we'll either need to fix up the header
-		 * and change the formatter to cope with files from other platforms OR document
-		 * that the native formatter can't cope with that.
-		 */
-		omrmem_free_memory(header);
-		return OMR_ERROR_ILLEGAL_ARGUMENT;
+		if (NULL == header) {
+			omrfile_close(traceFileHandle);
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+
+		headerVec.iov_base = header;
+		headerVec.iov_len = (uintptr_t)dummyHeader.header.length;
+		bytesRead = omrfile_preadv(traceFileHandle, &headerVec, 1, 0);
+
+		if (bytesRead != dummyHeader.header.length) {
+			omrmem_free_memory(header);
+			omrfile_close(traceFileHandle);
+			return OMR_ERROR_INTERNAL;
+		}
+
+		/* Check for a valid looking header. */
+		if (header->endianSignature != UT_ENDIAN_SIGNATURE) {
+			/* TODO - If this is the wrong endianess we'll either need to fix up the header
+			 * and change the formatter to cope with files from other platforms OR document
+			 * that the native formatter can't cope with that.
+			 */
+			omrmem_free_memory(header);
+			omrfile_close(traceFileHandle);
+			return OMR_ERROR_ILLEGAL_ARGUMENT;
+		}
 	}
 
 	iterator = (UtTraceFileIterator *)omrmem_allocate_memory(sizeof(UtTraceFileIterator), OMRMEM_CATEGORY_TRACE);
 
 	if (NULL == iterator) {
-		omrmem_free_memory(header);
-		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	} else {
+		rc = createFormatTemplateCache(OMRPORTLIB, &iterator->templateCache);
+		if (OMR_ERROR_NONE != rc) {
+			omrmem_free_memory(iterator);
+		}
+	}
+	if (OMR_ERROR_NONE != rc) {
+		if (NULL != mapping) {
+			omrmmap_unmap_file(mapping);
+		} else {
+			omrmem_free_memory(header);
+		}
+		omrfile_close(traceFileHandle);
+		return rc;
 	}
 
 	iterator->header = header;
@@ -145,6 +257,17 @@ omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFil
 	iterator->currentPosition = bytesRead;
 	iterator->portLib = OMRPORTLIB;
 	iterator->traceFileHandle = traceFileHandle;
+	iterator->mapping = mapping;
+	iterator->fileLength = (intptr_t)fileLength;
+	iterator->slotCount = 0;
+	iterator->oldestSlot = 0;
+	iterator->slotsVisited = 0;
+
+	rc = findTraceFileSlots(iterator);
+	if (OMR_ERROR_NONE != rc) {
+		omr_trc_freeTraceFileIterator(iterator);
+		return rc;
+	}
 
 	*iteratorPtr = iterator;
 
@@ -152,6 +275,163 @@ omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFil
 
 }
 
+/**
+ * Map a trace file read-only so that trace records can be formatted in place.
+ *
+ * *mappingPtr is set to NULL if the platform can't map files, in which case the file
+ * must be read.
+ */
+static omr_error_t
+mapTraceFile(OMRPortLibrary *portLib, intptr_t traceFileHandle, J9MmapHandle **mappingPtr)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	*mappingPtr = NULL;
+	if (OMRPORT_MMAP_CAPABILITY_READ == (omrmmap_capabilities() & OMRPORT_MMAP_CAPABILITY_READ)) {
+		/* a size of 0 maps the whole file */
+		*mappingPtr = omrmmap_map_file(traceFileHandle, 0, 0, NULL, OMRPORT_MMAP_FLAG_READ, OMRMEM_CATEGORY_TRACE);
+		if (NULL == *mappingPtr) {
+			UT_DBGOUT_CHECKED(1, ("<UT> omr_trc_getTraceFileIterator cannot map the trace file, reading it instead\n"));
+		}
+	}
+	return OMR_ERROR_NONE;
+}
+
+/**
+ * Recognise a wrap-around file written by the output= option, whose header ends with a
+ * UtFileSlotsSection, and find the slot holding the oldest record so that its records
+ * are returned in the order they were written. Files without the section are read
+ * record after record.
+ */
+static omr_error_t
+findTraceFileSlots(UtTraceFileIterator *iter)
+{
+	UtTraceFileHdr *header = iter->header;
+	const UtFileSlotsSection *slotsSection = NULL;
+	uint64_t slotCount = 0;
+	uint64_t oldestSequence = 0;
+	uint64_t slot = 0;
+
+	if ((header->processorStart <= 0)
+		|| ((uint64_t)header->header.length < ((uint64_t)header->processorStart + sizeof(UtProcSection) + sizeof(UtFileSlotsSection)))
+	) {
+		return OMR_ERROR_NONE;
+	}
+	slotsSection = (const UtFileSlotsSection *)((char *)header + header->header.length - sizeof(UtFileSlotsSection));
+	if (0 != memcmp(slotsSection->header.eyecatcher, UT_FILE_SLOTS_SECTION_NAME, sizeof(slotsSection->header.eyecatcher))) {
+		return OMR_ERROR_NONE;
+	}
+
+	memcpy(&slotCount, &slotsSection->slotCount, sizeof(slotCount));
+	if ((0 == slotCount)
+		|| (slotCount > ((uint64_t)(iter->fileLength - iter->currentPosition) / UT_FILE_SLOT_LENGTH(header->bufferSize)))
+	) {
+		UT_DBGOUT_CHECKED(1, ("<UT> omr_trc_getTraceFileIterator: %llu slots do not fit in the trace file\n", slotCount));
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+	iter->slotCount = slotCount;
+
+	for (slot = 0; slot < slotCount; slot++) {
+		uint64_t sequence = 0;
+		omr_error_t rc = readTraceFileSlot(iter, slot, &sequence, NULL, NULL, NULL);
+		if (OMR_ERROR_NONE != rc) {
+			return rc;
+		}
+		if ((0 != sequence) && ((0 == oldestSequence) || (sequence < oldestSequence))) {
+			oldestSequence = sequence;
+			iter->oldestSlot = slot;
+		}
+	}
+	return OMR_ERROR_NONE;
+}
+
+/**
+ * Read the sequence numbers of a slot, and optionally its record. A mapped record is
+ * returned in place; otherwise it is read into recordCopy, which must hold bufferSize
+ * bytes. The sequence numbers may be unaligned, so they are always copied out.
+ */
+static omr_error_t
+readTraceFileSlot(UtTraceFileIterator *iter, uint64_t slot, uint64_t *sequence, uint64_t *endSequence, UtTraceRecord **record, void *recordCopy)
+{
+	const uint64_t bufferSize = (uint64_t)iter->header->bufferSize;
+	const uint64_t slotPosition = (uint64_t)iter->currentPosition + (slot * UT_FILE_SLOT_LENGTH(bufferSize));
+
+	if (NULL != iter->mapping) {
+		char *slotStart = (char *)iter->mapping->pointer + slotPosition;
+
+		memcpy(sequence, slotStart, sizeof(uint64_t));
+		if (NULL != endSequence) {
+			memcpy(endSequence, slotStart + sizeof(uint64_t) + bufferSize, sizeof(uint64_t));
+		}
+		if (NULL != record) {
+			*record = (UtTraceRecord *)(slotStart + sizeof(uint64_t));
+		}
+	} else {
+		OMRPORT_ACCESS_FROM_OMRPORT(iter->portLib);
+		OMRIOVec slotVec[3];
+		uint64_t length = sizeof(uint64_t);
+		uintptr_t vecCount = 1;
+
+		slotVec[0].iov_base = sequence;
+		slotVec[0].iov_len = sizeof(uint64_t);
+		if (NULL != record) {
+			slotVec[1].iov_base = recordCopy;
+			slotVec[1].iov_len = (uintptr_t)bufferSize;
+			slotVec[2].iov_base = endSequence;
+			slotVec[2].iov_len = sizeof(uint64_t);
+			length = UT_FILE_SLOT_LENGTH(bufferSize);
+			vecCount = 3;
+		}
+		if ((intptr_t)length != omrfile_preadv(iter->traceFileHandle, slotVec, vecCount, (int64_t)slotPosition)) {
+			return OMR_ERROR_INTERNAL;
+		}
+		if (NULL != record) {
+			*record = (UtTraceRecord *)recordCopy;
+		}
+	}
+	return OMR_ERROR_NONE;
+}
+
+/**
+ * Find the next record of a file with slots, oldest first. Slots that have not been
+ * written are skipped, as are torn slots whose two sequence numbers differ. The
+ * iterator's record is left NULL once every slot has been visited.
+ */
+static omr_error_t
+getNextTraceFileSlot(UtTraceFileIterator *fileIterator, UtTracePointIterator *iterator)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(fileIterator->portLib);
+
+	if ((NULL == fileIterator->mapping) && (NULL == iterator->ownedRecord)) {
+		iterator->ownedRecord = omrmem_allocate_memory(fileIterator->header->bufferSize, OMRMEM_CATEGORY_TRACE);
+		if (NULL == iterator->ownedRecord) {
+			UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator's buffer\n"));
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+	}
+
+	while (fileIterator->slotsVisited < fileIterator->slotCount) {
+		const uint64_t slot = (fileIterator->oldestSlot + fileIterator->slotsVisited) % fileIterator->slotCount;
+		uint64_t sequence = 0;
+		uint64_t endSequence = 0;
+		UtTraceRecord *record = NULL;
+		omr_error_t rc = readTraceFileSlot(fileIterator, slot, &sequence, &endSequence, &record, iterator->ownedRecord);
+
+		if (OMR_ERROR_NONE != rc) {
+			return rc;
+		}
+		fileIterator->slotsVisited += 1;
+		if (0 != sequence) {
+			if ((sequence == endSequence) && (0 != record->firstEntry)) {
+				iterator->record = record;
+				break;
+			}
+			UT_DBGOUT_CHECKED(1, ("<UT> omr_trc_getTracePointIteratorForNextBuffer: skipping torn slot %llu\n", slot));
+		}
+	}
+	return OMR_ERROR_NONE;
+}
+
 /**
  * This frees a trace file iterator and closes the associated trace file.
  * Any UtTracePointIterators returned by this UtTraceFileIterator must be
@@ -162,10 +442,14 @@ omr_trc_freeTraceFileIterator(UtTraceFileIterator *iter)
 {
 	if (NULL != iter) {
 		OMRPORT_ACCESS_FROM_OMRPORT(iter->portLib);
-		omrfile_close(iter->traceFileHandle);
-		if (NULL != iter->header) {
+		freeFormatTemplateCache(iter->portLib, iter->templateCache);
+		if (NULL != iter->mapping) {
+			/* the header is in the mapping */
+			omrmmap_unmap_file(iter->mapping);
+		} else if (NULL != iter->header) {
 			omrmem_free_memory(iter->header);
 		}
+		omrfile_close(iter->traceFileHandle);
 		omrmem_free_memory(iter);
 	}
 	return OMR_ERROR_NONE;
@@ -184,6 +468,7 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 {
 	UtTracePointIterator *iterator = NULL;
 	intptr_t bytesRead = -1;
+	OMRIOVec recordVec;
 	uint64_t spanPlatform, spanSystem;
 
 	OMRPORT_ACCESS_FROM_OMRPORT(fileIterator->portLib);
@@ -195,42 +480,100 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
 	}
 
-	iterator->buffer = (OMR_TraceBuffer *)omrmem_allocate_memory(
-			fileIterator->header->bufferSize + offsetof(OMR_TraceBuffer, record), OMRMEM_CATEGORY_TRACE);
-	if (iterator->buffer == NULL) {
-		UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator's buffer\n"));
-		omrmem_free_memory(iterator);
-		*bufferIteratorPtr = NULL;
-		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	iterator->record = NULL;
+	iterator->ownedRecord = NULL;
+
+	if (0 != fileIterator->slotCount) {
+		omr_error_t rc = getNextTraceFileSlot(fileIterator, iterator);
+
+		if ((OMR_ERROR_NONE != rc) || (NULL == iterator->record)) {
+			/* every slot has been visited, or reading one failed */
+			omrmem_free_memory(iterator->ownedRecord);
+			omrmem_free_memory(iterator);
+			*bufferIteratorPtr = NULL;
+			return rc;
+		}
+	} else if (NULL != fileIterator->mapping) {
+		const intptr_t bufferSize = fileIterator->header->bufferSize;
+		char *fileStart = (char *)fileIterator->mapping->pointer;
+
+		/* Skip zero-filled records, which have not been written. */
+		while ((fileIterator->currentPosition + bufferSize) <= fileIterator->fileLength) {
+			UtTraceRecord *record = (UtTraceRecord *)(fileStart + fileIterator->currentPosition);
+			fileIterator->currentPosition += bufferSize;
+			if (0 != record->firstEntry) {
+				iterator->record = record;
+				break;
+			}
+		}
+
+		if (NULL == iterator->record) {
+			omrmem_free_memory(iterator);
+			*bufferIteratorPtr = NULL;
+			if (fileIterator->currentPosition == fileIterator->fileLength) {
+				/* End of file, not an error! */
+				return OMR_ERROR_NONE;
+			} else {
+				/* Unexpectedly reached the end of the file. */
+				return OMR_ERROR_INTERNAL;
+			}
+		}
+	} else {
+		iterator->ownedRecord = omrmem_allocate_memory(fileIterator->header->bufferSize, OMRMEM_CATEGORY_TRACE);
+		if (NULL == iterator->ownedRecord) {
+			UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator's buffer\n"));
+			omrmem_free_memory(iterator);
+			*bufferIteratorPtr = NULL;
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		iterator->record = (UtTraceRecord *)iterator->ownedRecord;
+
+		/* set up the iterator */
+		recordVec.iov_base = iterator->record;
+		recordVec.iov_len = (uintptr_t)fileIterator->header->bufferSize;
+		bytesRead = omrfile_preadv(fileIterator->traceFileHandle, &recordVec, 1, fileIterator->currentPosition);
+		if (fileIterator->header->bufferSize != bytesRead) {
+			omrmem_free_memory(iterator->ownedRecord);
+			omrmem_free_memory(iterator);
+			*bufferIteratorPtr = NULL;
+			if (0 == bytesRead) {
+				/* End of file, not an error! */
+				return OMR_ERROR_NONE;
+			} else {
+				/* Unexpectedly reached the end of the file. */
+				return OMR_ERROR_INTERNAL;
+			}
+		}
+		fileIterator->currentPosition += bytesRead;
 	}
 
-	/* set up the iterator */
-	bytesRead = omrfile_read(fileIterator->traceFileHandle, &iterator->buffer->record, fileIterator->header->bufferSize);
-	if (fileIterator->header->bufferSize != bytesRead) {
-		omrmem_free_memory(iterator->buffer);
-		omrmem_free_memory(iterator);
-		*bufferIteratorPtr = NULL;
-		if (-1 == bytesRead) {
-			/* End of file, not an error! */
-			return OMR_ERROR_NONE;
-		} else {
-			/* Unexpectedly reached the end of the file. */
-			return OMR_ERROR_INTERNAL;
+	/* A mapped record is formatted in place unless its 64-bit fields are misaligned. */
+	if ((NULL == iterator->ownedRecord) && (0 != ((uintptr_t)iterator->record & (sizeof(uint64_t) - 1)))) {
+		iterator->ownedRecord = omrmem_allocate_memory(fileIterator->header->bufferSize, OMRMEM_CATEGORY_TRACE);
+		if (NULL == iterator->ownedRecord) {
+			UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator's buffer\n"));
+			omrmem_free_memory(iterator);
+			*bufferIteratorPtr = NULL;
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
 		}
+		memcpy(iterator->ownedRecord, iterator->record, fileIterator->header->bufferSize);
+		iterator->record = (UtTraceRecord *)iterator->ownedRecord;
 	}
 
 	iterator->recordLength = fileIterator->header->bufferSize;
-	iterator->end = iterator->buffer->record.nextEntry;
-	iterator->start = iterator->buffer->record.firstEntry;
-	iterator->dataLength = iterator->buffer->record.nextEntry - iterator->buffer->record.firstEntry;
-	iterator->currentUpperTimeWord = (uint64_t)(iterator->buffer->record.sequence) & J9CONST64(0xFFFFFFFF00000000);
-	iterator->currentPos = iterator->buffer->record.nextEntry;
+	iterator->end = iterator->record->nextEntry;
+	iterator->start = iterator->record->firstEntry;
+	iterator->dataLength = iterator->record->nextEntry - iterator->record->firstEntry;
+	iterator->currentUpperTimeWord = (uint64_t)(iterator->record->sequence) & J9CONST64(0xFFFFFFFF00000000);
+	iterator->currentPos = iterator->record->nextEntry;
 	iterator->startPlatform = fileIterator->traceSection->startPlatform;
 	iterator->startSystem = fileIterator->traceSection->startSystem;
 	iterator->endPlatform = omrtime_hires_clock(); /* TODO - Is there a better timestamp we can use here? */
 	iterator->endSystem = ((uint64_t) omrtime_current_time_millis()); /* TODO - Is there a better timestamp we can use here? */
 	iterator->portLib = fileIterator->portLib;
 	iterator->getFormatStringFn = fileIterator->getFormatStringFn;
+	iterator->templateCache = fileIterator->templateCache;
+	iterator->timeStamp = 0;
 
 	spanPlatform = iterator->endPlatform - iterator->startPlatform;
 	spanSystem = iterator->endSystem - iterator->startSystem;
@@ -241,12 +584,9 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 		iterator->timeConversion = 1;
 	}
 
-#ifdef OMR_ENV_LITTLE_ENDIAN
-	iterator->isBigEndian = FALSE;
-#else
-	iterator->isBigEndian = TRUE;
-#endif
-	iterator->isCircularBuffer = TRUE;
+	iterator->isBigEndian = UT_FORMATTER_HOST_IS_BIG_ENDIAN;
+	/* Only in-core trace wraps around within a buffer, external trace continues a tracepoint in the thread's next buffer */
+	iterator->isCircularBuffer = (UT_TRACE_INTERNAL == fileIterator->traceSection->type);
 	iterator->iteratorHasWrapped = FALSE;
 	iterator->processingIncompleteDueToPartialTracePoint = FALSE;
 	iterator->longTracePointLength = 0;
@@ -258,7 +598,7 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 	UT_DBGOUT_CHECKED(4,
 			("<UT> firstEntry: %d, offset of record: %ld buffer size: %d endianness %s\n", iterator->start, offsetof(OMR_TraceBuffer, record), fileIterator->header->bufferSize, (iterator->isBigEndian)?"bigEndian":"littleEndian"));
 	UT_DBGOUT_CHECKED(2,
-			("<UT> omr_trc_getTracePointIteratorForNextBuffer: Thread %s returning iterator %p\n", iterator->buffer->record.threadName, iterator));
+			("<UT> omr_trc_getTracePointIteratorForNextBuffer: Thread %s returning iterator %p\n", iterator->record->threadName, iterator));
 
 	*bufferIteratorPtr = iterator;
 	return OMR_ERROR_NONE;
@@ -268,14 +608,14 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 uint64_t
 omr_trc_getBufferIteratorThreadId(UtTracePointIterator *iter)
 {
-	return iter->buffer->record.threadId;
+	return iter->record->threadId;
 }
 
 uint32_t
 omr_trc_getBufferIteratorThreadName(UtTracePointIterator *iter, char *buffer, uint32_t buffLen)
 {
 	memset(buffer, 0, buffLen);
-	strncpy(buffer, iter->buffer->record.threadName, buffLen - 1);
+	strncpy(buffer, iter->record->threadName, buffLen - 1);
 	return (uint32_t)strlen(buffer);
 }
 
@@ -284,7 +624,9 @@ omr_trc_freeTracePointIterator(UtTracePointIterator *iter)
 {
 	if (iter != NULL) {
 		OMRPORT_ACCESS_FROM_OMRPORT(iter->portLib);
-		omrmem_free_memory(iter->buffer);
+		if (NULL != iter->ownedRecord) {
+			omrmem_free_memory(iter->ownedRecord);
+		}
 		UT_DBGOUT_CHECKED(2, ("<UT> trcFreeTracePointIterator freeing iterator %p\n", iter));
 		omrmem_free_memory(iter);
 	}
@@ -316,20 +658,18 @@ getTraceIdFromBuffer(UtTraceRecord *record, uint32_t offset)
 	return ret;
 }
 
+/*
+ * Integer values are written out in platform endianess, so they are loaded whole and only
+ * byte-swapped when the trace data came from a platform of the other endianness.
+ */
 static uint16_t
 getU_16FromBuffer(UtTraceRecord *record, uint32_t offset, int32_t isBigEndian)
 {
 	uint16_t ret = 0;
-	unsigned char data[2];
-
-	data[0] = getUnsignedByteFromBuffer(record, offset);
-	data[1] = getUnsignedByteFromBuffer(record, offset + 1);
 
-	/* integer values are written out in platform endianess */
-	if (isBigEndian) {
-		ret = (data[0] << 8) | (data[1]);
-	} else {
-		ret = (data[1] << 8) | (data[0]);
+	memcpy(&ret, (char *)record + offset, sizeof(ret));
+	if (isBigEndian != UT_FORMATTER_HOST_IS_BIG_ENDIAN) {
+		ret = (uint16_t)((ret << 8) | (ret >> 8));
 	}
 	return ret;
 }
@@ -338,18 +678,10 @@ static uint32_t
 getU_32FromBuffer(UtTraceRecord *record, uint32_t offset, int32_t isBigEndian)
 {
 	uint32_t ret = 0;
-	unsigned char data[4];
 
-	data[0] = getUnsignedByteFromBuffer(record, offset);
-	data[1] = getUnsignedByteFromBuffer(record, offset + 1);
-	data[2] = getUnsignedByteFromBuffer(record, offset + 2);
-	data[3] = getUnsignedByteFromBuffer(record, offset + 3);
-
-	/* integer values are written out in platform endianess */
-	if (isBigEndian) {
-		ret = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | (data[3]);
-	} else {
-		ret = (data[3] << 24) | (data[2] << 16) | (data[1] << 8) | (data[0]);
+	memcpy(&ret, (char *)record + offset, sizeof(ret));
+	if (isBigEndian != UT_FORMATTER_HOST_IS_BIG_ENDIAN) {
+		ret = ((ret & 0x000000FF) << 24) | ((ret & 0x0000FF00) << 8) | ((ret & 0x00FF0000) >> 8) | ((ret & 0xFF000000) >> 24);
 	}
 	return ret;
 }
@@ -358,33 +690,17 @@ static uint64_t
 getU_64FromBuffer(UtTraceRecord *record, uint32_t offset, int32_t isBigEndian)
 {
 	uint64_t ret = 0;
-	unsigned char data[8];
 
-	data[0] = getUnsignedByteFromBuffer(record, offset);
-	data[1] = getUnsignedByteFromBuffer(record, offset + 1);
-	data[2] = getUnsignedByteFromBuffer(record, offset + 2);
-	data[3] = getUnsignedByteFromBuffer(record, offset + 3);
-	data[4] = getUnsignedByteFromBuffer(record, offset + 4);
-	data[5] = getUnsignedByteFromBuffer(record, offset + 5);
-	data[6] = getUnsignedByteFromBuffer(record, offset + 6);
-	data[7] = getUnsignedByteFromBuffer(record, offset + 7);
-
-	/* integer values are written out in platform endianess */
-	if (isBigEndian) {
-		ret = ((uint64_t)data[0] << 56) | ((uint64_t)data[1] << 48) | ((uint64_t)data[2] << 40) | ((uint64_t)data[3] << 32)
-			  | ((uint64_t)data[4] << 24) | ((uint64_t)data[5] << 16) | ((uint64_t)data[6] << 8) | ((uint64_t)data[7]);
-	} else {
-		ret = ((uint64_t)data[7] << 56) | ((uint64_t)data[6] << 48) | ((uint64_t)data[5] << 40) | ((uint64_t)data[4] << 32)
-			  | ((uint64_t)data[3] << 24) | ((uint64_t)data[2] << 16) | ((uint64_t)data[1] << 8) | ((uint64_t)data[0]);
+	memcpy(&ret, (char *)record + offset, sizeof(ret));
+	if (isBigEndian != UT_FORMATTER_HOST_IS_BIG_ENDIAN) {
+		ret = ((ret & J9CONST64(0x00000000000000FF)) << 56) | ((ret & J9CONST64(0x000000000000FF00)) << 40)
+			  | ((ret & J9CONST64(0x0000000000FF0000)) << 24) | ((ret & J9CONST64(0x00000000FF000000)) << 8)
+			  | ((ret & J9CONST64(0x000000FF00000000)) >> 8) | ((ret & J9CONST64(0x0000FF0000000000)) >> 24)
+			  | ((ret & J9CONST64(0x00FF000000000000)) >> 40) | ((ret & J9CONST64(0xFF00000000000000)) >> 56);
 	}
 	return ret;
 }
 
-#define UT_TRACE_FORMATTER_64BIT_DATA		64
-#define UT_TRACE_FORMATTER_32BIT_DATA		32
-#define UT_TRACE_FORMATTER_8BIT_DATA		8
-#define UT_TRACE_FORMATTER_STRING_DATA	-1
-
 static uint32_t
 readConsumeAndSPrintfParameter(OMRPortLibrary *portLib, char *rawParameterData, uint32_t rawParameterDataLength,
 							   uint32_t *offsetInParameterData, char *destBuffer, uint32_t destBufferLength, uint32_t *offsetInDestBuffer,
@@ -548,20 +864,279 @@ readConsumeAndSPrintfParameter(OMRPortLibrary *portLib, char *rawParameterData,
 	return (uint32_t)temp;
 }
 
+/**
+ * Parse a tracepoint format string into a template of literal text and conversion specifications,
+ * so that each format string is scanned once rather than for every tracepoint that uses it.
+ * The template, the copy of the component name and the text of the segments are allocated in one block.
+ *
+ * A NULL format string produces a template without segments, which formats nothing.
+ */
+static UtFormatTemplate *
+createFormatTemplate(UtTracePointIterator *iter, const char *componentName, uint32_t traceId, const char *format)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(iter->portLib);
+	uintptr_t formatLength = (NULL == format) ? 0 : strlen(format);
+	uintptr_t componentNameLength = strlen(componentName);
+	uint32_t maxSegments = 0;
+	UtFormatTemplate *formatTemplate = NULL;
+	char *text = NULL;
+	uint32_t segmentCount = 0;
+	uintptr_t offsetInFormat = 0;
+
+	/* Every conversion can be preceded by a literal */
+	for (offsetInFormat = 0; offsetInFormat < formatLength; offsetInFormat++) {
+		if ('%' == format[offsetInFormat]) {
+			maxSegments += 2;
+		}
+	}
+	maxSegments += 1;
+
+	formatTemplate = (UtFormatTemplate *)omrmem_allocate_memory(sizeof(UtFormatTemplate)
+			+ (maxSegments * sizeof(UtFormatTemplateSegment)) + componentNameLength + 1
+			+ formatLength + maxSegments, OMRMEM_CATEGORY_TRACE);
+	if (NULL == formatTemplate) {
+		UT_DBGOUT_CHECKED(1, ("<UT> createFormatTemplate cannot allocate the template for %s.%u\n", componentName, traceId));
+		return NULL;
+	}
+	formatTemplate->next = NULL;
+	formatTemplate->traceId = traceId;
+	formatTemplate->hasFormat = (NULL != format);
+	formatTemplate->segments = (UtFormatTemplateSegment *)(formatTemplate + 1);
+	formatTemplate->componentName = (char *)(formatTemplate->segments + maxSegments);
+	memcpy(formatTemplate->componentName, componentName, componentNameLength + 1);
+	text = formatTemplate->componentName + componentNameLength + 1;
+
+	offsetInFormat = 0;
+	while (offsetInFormat < formatLength) {
+		UtFormatTemplateSegment *segment = &formatTemplate->segments[segmentCount];
+		const char *conversion = &format[offsetInFormat];
+		int32_t foundType = FALSE;
+		int32_t longModifierFound = FALSE;
+		int32_t platformUDATAWidthDataFound = FALSE;
+		uint32_t numberOfStars = 0;
+		uintptr_t offsetOfType = 1;
+		char type = '\0';
+
+		if (('%' != *conversion) || ('%' == conversion[1])) {
+			/* Copy literal text up to the next conversion. A %% is written as a single percent. */
+			segment->traceDataType = UT_FORMAT_TEMPLATE_LITERAL;
+			segment->numberOfStars = 0;
+			segment->text = text;
+			segment->length = 0;
+			do {
+				text[segment->length] = format[offsetInFormat];
+				segment->length += 1;
+				offsetInFormat += ('%' == format[offsetInFormat]) ? 2 : 1;
+			} while ((offsetInFormat < formatLength)
+					 && (('%' != format[offsetInFormat]) || ('%' == format[offsetInFormat + 1])));
+			text[segment->length] = '\0';
+			text += segment->length + 1;
+			segmentCount += 1;
+			continue;
+		}
+
+		for (offsetOfType = 1; (FALSE == foundType) && ('\0' != conversion[offsetOfType]); offsetOfType++) {
+			switch (conversion[offsetOfType]) {
+			case 'x':
+			case 'X':
+			case 'u':
+			case 'i':
+			case 'd':
+			case 'f':
+			case 'p':
+			case 'P':
+			case 'c':
+			case 's':
+				/* we found the type */
+				foundType = TRUE;
+				type = conversion[offsetOfType];
+				break;
+			case '*':
+				numberOfStars++;
+				break;
+			case 'l':
+				/* 64bit number - its actually 'll' but we'll give it benefit of doubt */
+				longModifierFound = TRUE;
+				break;
+			case 'z':
+				/* platform udata width data */
+				platformUDATAWidthDataFound = TRUE;
+				break;
+			default:
+				break;
+			}
+		}
+
+		segment->numberOfStars = numberOfStars;
+		segment->text = text;
+		segment->length = (uint32_t)offsetOfType;
+		memcpy(text, conversion, offsetOfType);
+		text[offsetOfType] = '\0';
+		text += offsetOfType + 1;
+		offsetInFormat += offsetOfType;
+
+		switch (type) {
+		case 'x':
+		case 'X':
+		case 'u':
+		case 'i':
+		case 'd':
+			if (longModifierFound == TRUE) {
+				segment->traceDataType = UT_TRACE_FORMATTER_64BIT_DATA;
+			} else if (platformUDATAWidthDataFound == TRUE) {
+				if (iter->numberOfBytesInPlatformUDATA == 8) {
+					segment->traceDataType = UT_TRACE_FORMATTER_64BIT_DATA;
+				} else {
+					segment->traceDataType = UT_TRACE_FORMATTER_32BIT_DATA;
+				}
+			} else {
+				/* normal integer */
+				segment->traceDataType = UT_TRACE_FORMATTER_32BIT_DATA;
+			}
+			break;
+		case 'p':
+		case 'P':
+			if (iter->numberOfBytesInPlatformPtr == 8) {
+				segment->traceDataType = UT_TRACE_FORMATTER_64BIT_DATA;
+			} else {
+				segment->traceDataType = UT_TRACE_FORMATTER_32BIT_DATA;
+			}
+			break;
+		case 'c':
+			segment->traceDataType = UT_TRACE_FORMATTER_8BIT_DATA;
+			break;
+		case 's':
+			segment->traceDataType = UT_TRACE_FORMATTER_STRING_DATA;
+			break;
+		case 'f':
+			/* Floats are promoted to doubles by convention, so all %fs are 64bit */
+			segment->traceDataType = UT_TRACE_FORMATTER_64BIT_DATA;
+			break;
+		default:
+			/* the format string ended inside the conversion, keep it as text */
+			UT_DBGOUT_CHECKED(1, ("<UT> createFormatTemplate unknown trace format type: [%s]\n", conversion));
+			segment->traceDataType = UT_FORMAT_TEMPLATE_LITERAL;
+			break;
+		}
+		segmentCount += 1;
+	}
+	formatTemplate->segmentCount = segmentCount;
+
+	return formatTemplate;
+}
+
 static uint32_t
-formatTracePointParameters(UtTracePointIterator *iter, char *destBuffer, uint32_t destBufferLength, const char *format,
+hashFormatTemplateKey(const char *componentName, uintptr_t componentNameLength, uint32_t traceId)
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261U;
+	uintptr_t i = 0;
+
+	for (i = 0; i < componentNameLength; i++) {
+		hash = (hash ^ (uint8_t)componentName[i]) * 16777619U;
+	}
+	hash = (hash ^ traceId) * 16777619U;
+	return hash & (UT_FORMAT_TEMPLATE_BUCKETS - 1);
+}
+
+static UtFormatTemplate *
+findFormatTemplate(UtFormatTemplate *chain, const char *componentName, uintptr_t componentNameLength, uint32_t traceId)
+{
+	for (; NULL != chain; chain = chain->next) {
+		if ((chain->traceId == traceId)
+			&& (0 == strncmp(chain->componentName, componentName, componentNameLength))
+			&& ('\0' == chain->componentName[componentNameLength])
+		) {
+			break;
+		}
+	}
+	return chain;
+}
+
+/**
+ * Find the format template of a tracepoint, creating it on first use.
+ *
+ * Templates are never removed while the cache is in use, so lookups walk the hash chains
+ * without locking. Templates are created under the cache monitor, which also serializes
+ * calls to the format string callback, and are fully initialized before they are linked in.
+ */
+static UtFormatTemplate *
+getFormatTemplate(UtTracePointIterator *iter, const char *componentName, uintptr_t componentNameLength, uint32_t traceId)
+{
+	UtFormatTemplateCache *cache = iter->templateCache;
+	const uint32_t bucket = hashFormatTemplateKey(componentName, componentNameLength, traceId);
+	UtFormatTemplate *formatTemplate = findFormatTemplate(cache->buckets[bucket], componentName, componentNameLength, traceId);
+
+	if (NULL == formatTemplate) {
+		OMRPORT_ACCESS_FROM_OMRPORT(iter->portLib);
+		char *nameCopy = NULL;
+
+		omrthread_monitor_enter(cache->lock);
+		formatTemplate = findFormatTemplate(cache->buckets[bucket], componentName, componentNameLength, traceId);
+		if (NULL == formatTemplate) {
+			nameCopy = (char *)omrmem_allocate_memory(componentNameLength + 1, OMRMEM_CATEGORY_TRACE);
+			if (NULL != nameCopy) {
+				memcpy(nameCopy, componentName, componentNameLength);
+				nameCopy[componentNameLength] = '\0';
+				formatTemplate = createFormatTemplate(iter, nameCopy, traceId, iter->getFormatStringFn(nameCopy, traceId));
+				omrmem_free_memory(nameCopy);
+			}
+			if (NULL != formatTemplate) {
+				formatTemplate->next = cache->buckets[bucket];
+				VM_AtomicSupport::writeBarrier();
+				cache->buckets[bucket] = formatTemplate;
+			}
+		}
+		omrthread_monitor_exit(cache->lock);
+	}
+	return formatTemplate;
+}
+
+static omr_error_t
+createFormatTemplateCache(OMRPortLibrary *portLib, UtFormatTemplateCache **cachePtr)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	UtFormatTemplateCache *cache = (UtFormatTemplateCache *)omrmem_allocate_memory(sizeof(UtFormatTemplateCache), OMRMEM_CATEGORY_TRACE);
+
+	*cachePtr = NULL;
+	if (NULL == cache) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	memset(cache, 0, sizeof(UtFormatTemplateCache));
+	if (0 != omrthread_monitor_init_with_name(&cache->lock, 0, "Trace format template cache")) {
+		omrmem_free_memory(cache);
+		return OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
+	}
+	*cachePtr = cache;
+	return OMR_ERROR_NONE;
+}
+
+static void
+freeFormatTemplateCache(OMRPortLibrary *portLib, UtFormatTemplateCache *cache)
+{
+	if (NULL != cache) {
+		OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+		uint32_t bucket = 0;
+
+		for (bucket = 0; bucket < UT_FORMAT_TEMPLATE_BUCKETS; bucket++) {
+			UtFormatTemplate *formatTemplate = cache->buckets[bucket];
+			while (NULL != formatTemplate) {
+				UtFormatTemplate *next = formatTemplate->next;
+				omrmem_free_memory(formatTemplate);
+				formatTemplate = next;
+			}
+		}
+		omrthread_monitor_destroy(cache->lock);
+		omrmem_free_memory(cache);
+	}
+}
+
+static uint32_t
+formatTracePointParameters(UtTracePointIterator *iter, char *destBuffer, uint32_t destBufferLength, const UtFormatTemplate *formatTemplate,
 						   char *rawParameterData, uint32_t rawParameterDataLength)
 {
-	uint32_t formatLength;
-	uint32_t offsetInFormat = 0, offsetInDestBuffer = 0, offsetInParameterData = 0;
-	int numberOfStars = 0;
-	char type = '\0';
-	int32_t longModifierFound = FALSE;
-	int32_t platformUDATAWidthDataFound = FALSE;
-	char formatBuffer[20];
-	uint32_t offsetInFormatBuffer = 0;
-	uint32_t offsetOfType = 0;
-	int traceDataType = 0;
+	uint32_t offsetInDestBuffer = 0, offsetInParameterData = 0;
+	uint32_t segmentIndex = 0;
 
 	if (destBuffer == NULL || destBufferLength == 0) {
 		UT_DBGOUT_CHECKED(1,
@@ -569,138 +1144,47 @@ formatTracePointParameters(UtTracePointIterator *iter, char *destBuffer, uint32_
 		return 0;
 	}
 
-	if (format == NULL) {
+	if (!formatTemplate->hasFormat) {
 		UT_DBGOUT_CHECKED(1, ("<UT> formatTracePointParameters called with no format string\n"));
 		return 0;
 	}
-	formatLength = (uint32_t)strlen(format);
 
-	/* walk the format string copying it char by char into the destination buffer */
-	for (offsetInFormat = 0, offsetInDestBuffer = 0; offsetInFormat <= formatLength;
-		 offsetInFormat++, offsetInDestBuffer++) {
-		if (format[offsetInFormat] == '%') {
-			if (format[offsetInFormat + 1] == '%') {
-				destBuffer[offsetInDestBuffer] = format[offsetInFormat];
-				offsetInFormat++; /* skip the percent, just write a single percent to the destination buffer */
-			} else {
-				int32_t foundType = FALSE;
-				offsetInFormatBuffer = 0;
-				platformUDATAWidthDataFound = longModifierFound = FALSE;
-				numberOfStars = 0;
-				traceDataType = 0;
-
-				for (offsetOfType = 0; foundType == FALSE; offsetOfType++) {
-					/* have we read off the end? */
-					if (format[offsetInFormat + offsetOfType] == 'x' || format[offsetInFormat + offsetOfType] == 'X'
-						|| format[offsetInFormat + offsetOfType] == 'u'
-						|| format[offsetInFormat + offsetOfType] == 'i'
-						|| format[offsetInFormat + offsetOfType] == 'd'
-						|| format[offsetInFormat + offsetOfType] == 'f'
-						|| format[offsetInFormat + offsetOfType] == 'p'
-						|| format[offsetInFormat + offsetOfType] == 'P'
-						|| format[offsetInFormat + offsetOfType] == 'c'
-						|| format[offsetInFormat + offsetOfType] == 's'
-					) {
-						/* we found the type */
-						foundType = TRUE;
-						type = format[offsetInFormat + offsetOfType];
-					} else if (format[offsetInFormat + offsetOfType] == '*') {
-						numberOfStars++;
-					} else if (format[offsetInFormat + offsetOfType] == 'l') {
-						/* 64bit number - its actually 'll' but we'll give it benefit of doubt */
-						longModifierFound = TRUE;
-					} else if (format[offsetInFormat + offsetOfType] == 'z') {
-						/* platform udata width data */
-						platformUDATAWidthDataFound = TRUE;
-					}
-					/* this is both default behaviour and always needs to happen */
-					formatBuffer[offsetInFormatBuffer] = format[offsetInFormat + offsetInFormatBuffer];
-					offsetInFormatBuffer++;
-				}
-				offsetInFormat += (offsetOfType - 1);
-				formatBuffer[offsetInFormatBuffer] = '\0';
-				/*increment offsetInFormatBuffer here if it needs to be used further*/
-
-				switch (type) {
-				case 'x':
-				case 'X':
-				case 'u':
-				case 'i':
-				case 'd':
-					if (longModifierFound == TRUE) {
-						traceDataType = UT_TRACE_FORMATTER_64BIT_DATA;
-					} else if (platformUDATAWidthDataFound == TRUE) {
-						if (iter->numberOfBytesInPlatformUDATA == 8) {
-							traceDataType = UT_TRACE_FORMATTER_64BIT_DATA;
-						} else {
-							traceDataType = UT_TRACE_FORMATTER_32BIT_DATA;
-						}
-					} else {
-						/* normal integer */
-						traceDataType = UT_TRACE_FORMATTER_32BIT_DATA;
-					}
-					readConsumeAndSPrintfParameter(iter->portLib, rawParameterData, rawParameterDataLength,
-												   &offsetInParameterData, destBuffer, destBufferLength, &offsetInDestBuffer,
-												   (const char *)formatBuffer, traceDataType, numberOfStars, iter->isBigEndian);
-					break;
-				case 'p':
-				case 'P':
-					if (iter->numberOfBytesInPlatformPtr == 8) {
-						traceDataType = UT_TRACE_FORMATTER_64BIT_DATA;
-					} else {
-						traceDataType = UT_TRACE_FORMATTER_32BIT_DATA;
-					}
-
-					readConsumeAndSPrintfParameter(iter->portLib, rawParameterData, rawParameterDataLength,
-												   &offsetInParameterData, destBuffer, destBufferLength, &offsetInDestBuffer,
-												   (const char *)formatBuffer, traceDataType, numberOfStars, iter->isBigEndian);
-					break;
-				case 'c':
-					traceDataType = UT_TRACE_FORMATTER_8BIT_DATA;
-					readConsumeAndSPrintfParameter(iter->portLib, rawParameterData, rawParameterDataLength,
-												   &offsetInParameterData, destBuffer, destBufferLength, &offsetInDestBuffer,
-												   (const char *)formatBuffer, traceDataType, numberOfStars, iter->isBigEndian);
-					break;
-				case 's':
-					traceDataType = UT_TRACE_FORMATTER_STRING_DATA;
-					readConsumeAndSPrintfParameter(iter->portLib, rawParameterData, rawParameterDataLength,
-												   &offsetInParameterData, destBuffer, destBufferLength, &offsetInDestBuffer,
-												   (const char *)formatBuffer, traceDataType, numberOfStars, iter->isBigEndian);
-					break;
-				case 'f':
-					/* Floats are promoted to doubles by convention, so all %fs are 64bit */
-					traceDataType = UT_TRACE_FORMATTER_64BIT_DATA;
-					readConsumeAndSPrintfParameter(iter->portLib, rawParameterData, rawParameterDataLength,
-												   &offsetInParameterData, destBuffer, destBufferLength, &offsetInDestBuffer,
-												   (const char *)formatBuffer, traceDataType, numberOfStars, iter->isBigEndian);
-					break;
-				default:
-					UT_DBGOUT_CHECKED(1,
-							("<UT> formatTracePointParameters unknown trace format type: %c [%s]\n", type, formatBuffer));
-					break;
-				}
-				offsetInDestBuffer--;
+	for (segmentIndex = 0; segmentIndex < formatTemplate->segmentCount; segmentIndex++) {
+		const UtFormatTemplateSegment *segment = &formatTemplate->segments[segmentIndex];
 
-			}
-		} else {
-			if (offsetInDestBuffer > destBufferLength) {
+		if (UT_FORMAT_TEMPLATE_LITERAL == segment->traceDataType) {
+			if ((offsetInDestBuffer + segment->length) >= destBufferLength) {
 				/* return now before writing off the end */
 				UT_DBGOUT_CHECKED(1,
-							("<UT> formatTracePointParameters truncated output due to buffer exhaustion at format type: %c [%s]\n", type, formatBuffer));
-				return offsetInDestBuffer;
+						("<UT> formatTracePointParameters truncated output due to buffer exhaustion at [%s]\n", segment->text));
+				memcpy(destBuffer + offsetInDestBuffer, segment->text, destBufferLength - offsetInDestBuffer - 1);
+				destBuffer[destBufferLength - 1] = '\0';
+				return destBufferLength;
+			}
+			memcpy(destBuffer + offsetInDestBuffer, segment->text, segment->length);
+			offsetInDestBuffer += segment->length;
+		} else {
+			readConsumeAndSPrintfParameter(iter->portLib, rawParameterData, rawParameterDataLength,
+										   &offsetInParameterData, destBuffer, destBufferLength, &offsetInDestBuffer,
+										   segment->text, segment->traceDataType, segment->numberOfStars, iter->isBigEndian);
+			if (offsetInDestBuffer >= destBufferLength) {
+				destBuffer[destBufferLength - 1] = '\0';
+				return destBufferLength;
 			}
-			destBuffer[offsetInDestBuffer] = format[offsetInFormat];
 		}
 	}
+	destBuffer[offsetInDestBuffer] = '\0';
 
-	/* the number of characters successfully written to destination buffer */
-	return offsetInDestBuffer;
+	/* the number of characters successfully written to destination buffer, including the NUL */
+	return offsetInDestBuffer + 1;
 }
 
-#undef UT_TRACE_FORMATTER_64BIT_DATA
-#undef UT_TRACE_FORMATTER_32BIT_DATA
-#undef UT_TRACE_FORMATTER_8BIT_DATA
-#undef UT_TRACE_FORMATTER_STRING_DATA
+static UtFormatTemplateSegment internalTracePointSegment = {
+	UT_FORMAT_TEMPLATE_LITERAL, 0, sizeof("internal Trace Data Point") - 1, "internal Trace Data Point"
+};
+static UtFormatTemplate internalTracePointTemplate = {
+	NULL, 0, 1, TRUE, (char *)"dg", &internalTracePointSegment
+};
 
 static const char *
 parseTracePoint(OMRPortLibrary *portLib, UtTraceRecord *record, uint32_t offset, int tpLength,
@@ -714,10 +1198,7 @@ parseTracePoint(OMRPortLibrary *portLib, UtTraceRecord *record, uint32_t offset,
 	const char *modNameString = NULL;
 	uint32_t modNameLength;
 	char *tempPtr = (char *)record;
-	const char *formatString;
-	char tempSwapChar = '\0';
-	char tempSwapChar2 = '\0';
-	char *tempSwapCharLoc;
+	const UtFormatTemplate *formatTemplate = NULL;
 	uint32_t nanos, millis, seconds, minutes, hours;
 	uint64_t splitTime = 0, splitTimeRem = 0;
 	uint32_t offsetOfParameters = 0;
@@ -791,31 +1272,26 @@ parseTracePoint(OMRPortLibrary *portLib, UtTraceRecord *record, uint32_t offset,
 		}
 		modNameLength = 2;
 		modNameString = "dg";
-		formatString = "internal Trace Data Point";
+		formatTemplate = &internalTracePointTemplate;
 	} else {
+		const char *compositeNameStart = NULL;
+		uintptr_t componentNameLength = modNameLength;
+
 		if (traceId <= 256) {
 			return omr_trc_formatNextTracePoint(iter, buffer, bufferLength);
 		}
 		traceId -= 257;
-		/* temporarily add NULL terminator to the modName in copy of the buffer for getFormatString
-		 * to be able to do look up on it - save the overwritten data and reinstate once finished. Doing
-		 * this avoids allocing a temp buffer. We also need to check to see if this is a composite name,
-		 * e.g. pool(j9mm). If it is then we need to take the string before the opening brace as the
-		 * component name. We don't do this in getFormatString because that's in the fastpath for
-		 * -Xtrace:print
+		/* We need to check to see if this is a composite name, e.g. pool(j9mm). If it is then we need
+		 * to take the string before the opening brace as the component name. We don't do this in
+		 * getFormatString because that's in the fastpath for -Xtrace:print
 		 */
-		tempSwapChar = modName[modNameLength];
-		modName[modNameLength] = '\0';
-
-		tempSwapCharLoc = strchr(modName, '(');
-		if (tempSwapCharLoc != NULL) {
-			tempSwapChar2 = *tempSwapCharLoc;
-			*tempSwapCharLoc = '\0';
+		compositeNameStart = (const char *)memchr(modName, '(', modNameLength);
+		if (NULL != compositeNameStart) {
+			componentNameLength = compositeNameStart - modName;
 		}
-		formatString = iter->getFormatStringFn((const char *)modName, traceId);
-		modName[modNameLength] = tempSwapChar;
-		if (tempSwapCharLoc != NULL) {
-			*tempSwapCharLoc = tempSwapChar2;
+		formatTemplate = getFormatTemplate(iter, modName, componentNameLength, traceId);
+		if (NULL == formatTemplate) {
+			return NULL;
 		}
 		modNameString = modName;
 	}
@@ -823,6 +1299,7 @@ parseTracePoint(OMRPortLibrary *portLib, UtTraceRecord *record, uint32_t offset,
 	tempLower = (uint64_t)timeStampLeastSignificantBytes;
 	tempUpper = (uint64_t)*timeStampMostSignificantBytes;
 	timeStamp = tempUpper | tempLower;
+	iter->timeStamp = timeStamp;
 
 	/* this formula is taken directly from the trace formatter to maintain agreement between representations
 	 *	made by this function and those made by the TraceFormat tool. */
@@ -851,7 +1328,7 @@ parseTracePoint(OMRPortLibrary *portLib, UtTraceRecord *record, uint32_t offset,
 	rawParameterDataLength = tpLength - (TRACEPOINT_RAW_DATA_MODULE_NAME_DATA_OFFSET + modNameLength);
 
 	/* the parameters will be formatted as question marks if there is no data to populate them with */
-	if (!formatTracePointParameters(iter, buffer + offsetOfParameters, bufferLength - offsetOfParameters, formatString,
+	if (!formatTracePointParameters(iter, buffer + offsetOfParameters, bufferLength - offsetOfParameters, formatTemplate,
 									rawParameterData, rawParameterDataLength)) {
 		return NULL;
 	}
@@ -875,7 +1352,7 @@ omr_trc_formatNextTracePoint(UtTracePointIterator *iter, char *buffer, uint32_t
 		return NULL;
 	}
 
-	if (iter->buffer == NULL) {
+	if (iter->record == NULL) {
 		UT_DBGOUT_CHECKED(1, ("<UT> omr_trc_formatNextTracePoint called with unpopulated iterator buffer\n"));
 		return NULL;
 	}
@@ -886,7 +1363,7 @@ omr_trc_formatNextTracePoint(UtTracePointIterator *iter, char *buffer, uint32_t
 		return NULL;
 	}
 
-	record = &iter->buffer->record;
+	record = iter->record;
 	recordDataStart = record->firstEntry;
 	recordDataLength = iter->recordLength;
 	offset = iter->currentPos;
@@ -983,3 +1460,490 @@ omr_trc_formatNextTracePoint(UtTracePointIterator *iter, char *buffer, uint32_t
 						   buffer, bufferLength);
 }
 
+
+/* Buffers formatted per worker thread before their tracepoints are merged and handed out */
+#define UT_FORMAT_BATCH_BUFFERS_PER_WORKER 16
+#define UT_FORMAT_BATCH_MAX_WORKERS 64
+#define UT_FORMAT_MAX_TRACEPOINT_LENGTH 1024
+
+typedef struct UtFormattedTracePoint {
+	uint64_t timeStamp;
+	uintptr_t textOffset;
+} UtFormattedTracePoint;
+
+/* The formatted tracepoints of one trace buffer, oldest first. The thread name is copied into
+ * the text so that the tracepoints can be merged after the buffer's iterator has been freed. */
+typedef struct UtFormattedBuffer {
+	UtTracePointIterator *iterator;
+	uint64_t threadId;
+	uintptr_t threadNameOffset;
+	UtFormattedTracePoint *tracePoints;
+	uintptr_t tracePointCount;
+	uintptr_t tracePointCapacity;
+	char *text;
+	uintptr_t textUsed;
+	uintptr_t textCapacity;
+	uintptr_t mergePosition;
+	omr_error_t rc;
+} UtFormattedBuffer;
+
+/* The current batch and the worker threads formatting it. The workers live for the whole
+ * omr_trc_formatTraceFile call and wait on the monitor for the next batch. */
+typedef struct UtFormatBatch {
+	OMRPortLibrary *portLib;
+	UtFormattedBuffer *buffers;
+	uintptr_t bufferCount;
+	volatile uintptr_t nextBuffer;
+	omrthread_monitor_t monitor;
+	uintptr_t batchNumber; /* incremented when a new batch is handed to the workers */
+	uintptr_t busyWorkers; /* workers that haven't finished the current batch yet */
+	BOOLEAN shutdown;
+} UtFormatBatch;
+
+static omr_error_t
+appendFormattedText(OMRPortLibrary *portLib, UtFormattedBuffer *formatted, const char *text, uintptr_t *textOffset)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	const uintptr_t textLength = strlen(text) + 1;
+
+	if ((formatted->textUsed + textLength) > formatted->textCapacity) {
+		uintptr_t newCapacity = (0 == formatted->textCapacity) ? (8 * UT_FORMAT_MAX_TRACEPOINT_LENGTH) : (formatted->textCapacity * 2);
+		char *newText = NULL;
+		while ((formatted->textUsed + textLength) > newCapacity) {
+			newCapacity *= 2;
+		}
+		newText = (char *)omrmem_reallocate_memory(formatted->text, newCapacity, OMRMEM_CATEGORY_TRACE);
+		if (NULL == newText) {
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		formatted->text = newText;
+		formatted->textCapacity = newCapacity;
+	}
+
+	*textOffset = formatted->textUsed;
+	memcpy(formatted->text + formatted->textUsed, text, textLength);
+	formatted->textUsed += textLength;
+	return OMR_ERROR_NONE;
+}
+
+static omr_error_t
+appendFormattedTracePoint(OMRPortLibrary *portLib, UtFormattedBuffer *formatted, uint64_t timeStamp, const char *text)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	if (formatted->tracePointCount == formatted->tracePointCapacity) {
+		const uintptr_t newCapacity = (0 == formatted->tracePointCapacity) ? 64 : (formatted->tracePointCapacity * 2);
+		UtFormattedTracePoint *newTracePoints = (UtFormattedTracePoint *)omrmem_reallocate_memory(formatted->tracePoints,
+				newCapacity * sizeof(UtFormattedTracePoint), OMRMEM_CATEGORY_TRACE);
+		if (NULL == newTracePoints) {
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		formatted->tracePoints = newTracePoints;
+		formatted->tracePointCapacity = newCapacity;
+	}
+
+	rc = appendFormattedText(portLib, formatted, text, &formatted->tracePoints[formatted->tracePointCount].textOffset);
+	if (OMR_ERROR_NONE == rc) {
+		formatted->tracePoints[formatted->tracePointCount].timeStamp = timeStamp;
+		formatted->tracePointCount += 1;
+	}
+	return rc;
+}
+
+static void
+formatBuffer(OMRPortLibrary *portLib, UtFormattedBuffer *formatted)
+{
+	char tracePoint[UT_FORMAT_MAX_TRACEPOINT_LENGTH];
+	uintptr_t low = 0;
+	uintptr_t high = 0;
+
+	formatted->threadId = formatted->iterator->record->threadId;
+	formatted->rc = appendFormattedText(portLib, formatted, formatted->iterator->record->threadName, &formatted->threadNameOffset);
+	if (OMR_ERROR_NONE != formatted->rc) {
+		return;
+	}
+	while (NULL != omr_trc_formatNextTracePoint(formatted->iterator, tracePoint, sizeof(tracePoint))) {
+		formatted->rc = appendFormattedTracePoint(portLib, formatted, formatted->iterator->timeStamp, tracePoint);
+		if (OMR_ERROR_NONE != formatted->rc) {
+			return;
+		}
+	}
+
+	/* Buffers are formatted from the newest tracepoint backwards */
+	for (high = formatted->tracePointCount; (low + 1) < high; low++) {
+		UtFormattedTracePoint swap = formatted->tracePoints[low];
+		high -= 1;
+		formatted->tracePoints[low] = formatted->tracePoints[high];
+		formatted->tracePoints[high] = swap;
+	}
+}
+
+/* Format buffers of the current batch until none are left */
+static void
+formatBatchBuffers(UtFormatBatch *batch)
+{
+	for (;;) {
+		const uintptr_t index = VM_AtomicSupport::add(&batch->nextBuffer, 1) - 1;
+		if (index >= batch->bufferCount) {
+			break;
+		}
+		formatBuffer(batch->portLib, &batch->buffers[index]);
+	}
+}
+
+static int J9THREAD_PROC
+formatBufferWorker(void *entryArg)
+{
+	UtFormatBatch *batch = (UtFormatBatch *)entryArg;
+	uintptr_t lastBatchNumber = 0;
+
+	omrthread_monitor_enter(batch->monitor);
+	for (;;) {
+		while (!batch->shutdown && (lastBatchNumber == batch->batchNumber)) {
+			omrthread_monitor_wait(batch->monitor);
+		}
+		if (batch->shutdown) {
+			break;
+		}
+		lastBatchNumber = batch->batchNumber;
+		omrthread_monitor_exit(batch->monitor);
+
+		formatBatchBuffers(batch);
+
+		omrthread_monitor_enter(batch->monitor);
+		batch->busyWorkers -= 1;
+		if (0 == batch->busyWorkers) {
+			omrthread_monitor_notify_all(batch->monitor);
+		}
+	}
+	omrthread_monitor_exit(batch->monitor);
+	return 0;
+}
+
+static BOOLEAN
+isEarlierFormattedTracePoint(UtFormattedBuffer *buffers, uintptr_t first, uintptr_t second)
+{
+	const uint64_t firstTimeStamp = buffers[first].tracePoints[buffers[first].mergePosition].timeStamp;
+	const uint64_t secondTimeStamp = buffers[second].tracePoints[buffers[second].mergePosition].timeStamp;
+
+	/* ties keep file order */
+	return (firstTimeStamp < secondTimeStamp) || ((firstTimeStamp == secondTimeStamp) && (first < second));
+}
+
+static void
+siftDownFormattedBuffer(UtFormattedBuffer *buffers, uintptr_t *heap, uintptr_t heapSize, uintptr_t position)
+{
+	for (;;) {
+		uintptr_t earliest = position;
+		const uintptr_t left = (2 * position) + 1;
+		const uintptr_t right = left + 1;
+
+		if ((left < heapSize) && isEarlierFormattedTracePoint(buffers, heap[left], heap[earliest])) {
+			earliest = left;
+		}
+		if ((right < heapSize) && isEarlierFormattedTracePoint(buffers, heap[right], heap[earliest])) {
+			earliest = right;
+		}
+		if (earliest == position) {
+			break;
+		}
+		uintptr_t swap = heap[position];
+		heap[position] = heap[earliest];
+		heap[earliest] = swap;
+		position = earliest;
+	}
+}
+
+/**
+ * Pass the formatted tracepoints to the callback in timestamp order, merging the buffers
+ * with a binary heap keyed by each buffer's next tracepoint. Tracepoints at or after
+ * holdBackFrom are left unmerged, since buffers later in the file may hold older ones,
+ * unless the end of the file has been reached.
+ */
+static omr_error_t
+mergeFormattedBuffers(UtFormattedBuffer *buffers, uintptr_t bufferCount, uintptr_t *heap,
+					  uint64_t holdBackFrom, BOOLEAN endOfFile, FormattedTracePointCallback callback, void *userData)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	uintptr_t heapSize = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < bufferCount; i++) {
+		if (buffers[i].mergePosition < buffers[i].tracePointCount) {
+			heap[heapSize] = i;
+			heapSize += 1;
+		}
+	}
+	for (i = heapSize / 2; i > 0; i--) {
+		siftDownFormattedBuffer(buffers, heap, heapSize, i - 1);
+	}
+
+	while ((OMR_ERROR_NONE == rc) && (0 != heapSize)) {
+		UtFormattedBuffer *earliest = &buffers[heap[0]];
+		UtFormattedTracePoint *tracePoint = &earliest->tracePoints[earliest->mergePosition];
+
+		if (!endOfFile && (tracePoint->timeStamp >= holdBackFrom)) {
+			break;
+		}
+		rc = callback(userData, earliest->text + earliest->threadNameOffset, earliest->threadId, tracePoint->timeStamp,
+				earliest->text + tracePoint->textOffset);
+
+		earliest->mergePosition += 1;
+		if (earliest->mergePosition == earliest->tracePointCount) {
+			heapSize -= 1;
+			heap[0] = heap[heapSize];
+		}
+		siftDownFormattedBuffer(buffers, heap, heapSize, 0);
+	}
+	return rc;
+}
+
+/**
+ * Move the buffers with tracepoints left to merge to the front, keeping them in file order,
+ * so that the next batch is formatted into the fully merged buffers after them and reuses
+ * their allocations.
+ *
+ * @return the number of buffers with tracepoints left to merge
+ */
+static uintptr_t
+compactFormattedBuffers(UtFormattedBuffer *buffers, uintptr_t bufferCount)
+{
+	uintptr_t heldCount = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < bufferCount; i++) {
+		if (buffers[i].mergePosition < buffers[i].tracePointCount) {
+			if (i != heldCount) {
+				UtFormattedBuffer swap = buffers[heldCount];
+				buffers[heldCount] = buffers[i];
+				buffers[i] = swap;
+			}
+			heldCount += 1;
+		}
+	}
+	return heldCount;
+}
+
+/**
+ * Read the start time of every buffer left in the file, then replace each with the earliest
+ * start time of that buffer and all the buffers after it. No tracepoint is older than the start
+ * time of its buffer, so once the first i buffers have been formatted, their tracepoints older
+ * than bounds[i] can be merged without waiting for the rest of the file. The position of the
+ * file iterator is restored afterwards.
+ *
+ * Reading stops at the first buffer that can't be read, where formatting will stop too.
+ */
+static omr_error_t
+getLaterBufferStartBounds(UtTraceFileIterator *fileIter, uint64_t **boundsPtr, uintptr_t *boundCountPtr)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(fileIter->portLib);
+	const intptr_t currentPosition = fileIter->currentPosition;
+	const uint64_t slotsVisited = fileIter->slotsVisited;
+	uint64_t *bounds = NULL;
+	uintptr_t boundCount = 0;
+	uintptr_t boundCapacity = 0;
+	omr_error_t rc = OMR_ERROR_NONE;
+	uintptr_t i = 0;
+
+	for (;;) {
+		UtTracePointIterator *bufferIter = NULL;
+
+		if ((OMR_ERROR_NONE != omr_trc_getTracePointIteratorForNextBuffer(fileIter, &bufferIter)) || (NULL == bufferIter)) {
+			break;
+		}
+		if (boundCount == boundCapacity) {
+			const uintptr_t newCapacity = (0 == boundCapacity) ? 64 : (boundCapacity * 2);
+			uint64_t *newBounds = (uint64_t *)omrmem_reallocate_memory(bounds, newCapacity * sizeof(uint64_t), OMRMEM_CATEGORY_TRACE);
+			if (NULL == newBounds) {
+				omr_trc_freeTracePointIterator(bufferIter);
+				rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+				break;
+			}
+			bounds = newBounds;
+			boundCapacity = newCapacity;
+		}
+		/* wrapSequence is the time the buffer was started */
+		bounds[boundCount] = bufferIter->record->wrapSequence;
+		boundCount += 1;
+		omr_trc_freeTracePointIterator(bufferIter);
+	}
+	fileIter->currentPosition = currentPosition;
+	fileIter->slotsVisited = slotsVisited;
+
+	if (OMR_ERROR_NONE != rc) {
+		omrmem_free_memory(bounds);
+		return rc;
+	}
+	for (i = boundCount; i > 1; i--) {
+		if (bounds[i - 1] < bounds[i - 2]) {
+			bounds[i - 2] = bounds[i - 1];
+		}
+	}
+	*boundsPtr = bounds;
+	*boundCountPtr = boundCount;
+	return OMR_ERROR_NONE;
+}
+
+omr_error_t
+omr_trc_formatTraceFile(UtTraceFileIterator *fileIter, uint32_t workerCount, FormattedTracePointCallback callback, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(fileIter->portLib);
+	omr_error_t rc = OMR_ERROR_NONE;
+	uintptr_t batchCapacity = 0;
+	UtFormattedBuffer *buffers = NULL;
+	uintptr_t bufferCapacity = 0;
+	uintptr_t heldCount = 0;
+	uintptr_t *heap = NULL;
+	uint64_t *bounds = NULL;
+	uintptr_t boundCount = 0;
+	uintptr_t buffersRead = 0;
+	UtFormatBatch batch;
+	omrthread_t workers[UT_FORMAT_BATCH_MAX_WORKERS];
+	uint32_t startedWorkers = 0;
+	BOOLEAN endOfFile = FALSE;
+
+	if (NULL == callback) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+	if (0 == workerCount) {
+		workerCount = 1;
+	} else if (workerCount > UT_FORMAT_BATCH_MAX_WORKERS) {
+		workerCount = UT_FORMAT_BATCH_MAX_WORKERS;
+	}
+
+	memset(&batch, 0, sizeof(batch));
+	batch.portLib = OMRPORTLIB;
+
+	rc = getLaterBufferStartBounds(fileIter, &bounds, &boundCount);
+	if (OMR_ERROR_NONE != rc) {
+		goto done;
+	}
+
+	batchCapacity = workerCount * UT_FORMAT_BATCH_BUFFERS_PER_WORKER;
+
+	/* Start the workers once, the calling thread formats buffers too. Without workers it formats every batch alone. */
+	if ((workerCount > 1) && (0 == omrthread_monitor_init_with_name(&batch.monitor, 0, "Trace format batch"))) {
+		for (startedWorkers = 0; (startedWorkers + 1) < workerCount; startedWorkers++) {
+			omrthread_attr_t attr = NULL;
+			BOOLEAN started = FALSE;
+
+			if (J9THREAD_SUCCESS == omrthread_attr_init(&attr)) {
+				started = (J9THREAD_SUCCESS == omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+						&& (J9THREAD_SUCCESS == omrthread_create_ex(&workers[startedWorkers], &attr, 0, formatBufferWorker, &batch));
+				omrthread_attr_destroy(&attr);
+			}
+			if (!started) {
+				UT_DBGOUT_CHECKED(1, ("<UT> omr_trc_formatTraceFile: unable to start worker %u\n", startedWorkers));
+				break;
+			}
+		}
+	}
+
+	while ((OMR_ERROR_NONE == rc) && !endOfFile) {
+		uintptr_t bufferIndex = 0;
+
+		/* The buffers held back from earlier batches stay at the front, the batch is formatted after them */
+		if ((heldCount + batchCapacity) > bufferCapacity) {
+			const uintptr_t newCapacity = OMR_MAX(heldCount + batchCapacity, bufferCapacity * 2);
+			UtFormattedBuffer *newBuffers = (UtFormattedBuffer *)omrmem_reallocate_memory(buffers,
+					newCapacity * sizeof(UtFormattedBuffer), OMRMEM_CATEGORY_TRACE);
+			uintptr_t *newHeap = NULL;
+
+			if (NULL == newBuffers) {
+				rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+				break;
+			}
+			memset(newBuffers + bufferCapacity, 0, (newCapacity - bufferCapacity) * sizeof(UtFormattedBuffer));
+			buffers = newBuffers;
+			bufferCapacity = newCapacity;
+
+			newHeap = (uintptr_t *)omrmem_reallocate_memory(heap, newCapacity * sizeof(uintptr_t), OMRMEM_CATEGORY_TRACE);
+			if (NULL == newHeap) {
+				rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+				break;
+			}
+			heap = newHeap;
+		}
+
+		/* Buffer iterators have to be created in file order, the formatting can be done in any order */
+		batch.buffers = buffers + heldCount;
+		batch.bufferCount = 0;
+		batch.nextBuffer = 0;
+		while (batch.bufferCount < batchCapacity) {
+			UtFormattedBuffer *formatted = &batch.buffers[batch.bufferCount];
+			rc = omr_trc_getTracePointIteratorForNextBuffer(fileIter, &formatted->iterator);
+			if ((OMR_ERROR_NONE != rc) || (NULL == formatted->iterator)) {
+				endOfFile = TRUE;
+				break;
+			}
+			formatted->tracePointCount = 0;
+			formatted->textUsed = 0;
+			formatted->mergePosition = 0;
+			batch.bufferCount += 1;
+		}
+
+		if (0 == startedWorkers) {
+			formatBatchBuffers(&batch);
+		} else {
+			omrthread_monitor_enter(batch.monitor);
+			batch.busyWorkers = startedWorkers;
+			batch.batchNumber += 1;
+			omrthread_monitor_notify_all(batch.monitor);
+			omrthread_monitor_exit(batch.monitor);
+
+			formatBatchBuffers(&batch);
+
+			omrthread_monitor_enter(batch.monitor);
+			while (0 != batch.busyWorkers) {
+				omrthread_monitor_wait(batch.monitor);
+			}
+			omrthread_monitor_exit(batch.monitor);
+		}
+
+		/* The formatted buffers no longer refer to their records */
+		for (bufferIndex = 0; bufferIndex < batch.bufferCount; bufferIndex++) {
+			if (OMR_ERROR_NONE == rc) {
+				rc = batch.buffers[bufferIndex].rc;
+			}
+			omr_trc_freeTracePointIterator(batch.buffers[bufferIndex].iterator);
+			batch.buffers[bufferIndex].iterator = NULL;
+		}
+		buffersRead += batch.bufferCount;
+
+		if (OMR_ERROR_NONE == rc) {
+			/* Merge the tracepoints that no buffer later in the file can precede, including those held back from earlier batches */
+			const BOOLEAN mergeAll = endOfFile || (buffersRead >= boundCount);
+			const uint64_t holdBackFrom = mergeAll ? 0 : bounds[buffersRead];
+
+			rc = mergeFormattedBuffers(buffers, heldCount + batch.bufferCount, heap, holdBackFrom, mergeAll, callback, userData);
+		}
+		heldCount = compactFormattedBuffers(buffers, heldCount + batch.bufferCount);
+	}
+
+	if (NULL != batch.monitor) {
+		uint32_t workerIndex = 0;
+
+		omrthread_monitor_enter(batch.monitor);
+		batch.shutdown = TRUE;
+		omrthread_monitor_notify_all(batch.monitor);
+		omrthread_monitor_exit(batch.monitor);
+		for (workerIndex = 0; workerIndex < startedWorkers; workerIndex++) {
+			omrthread_join(workers[workerIndex]);
+		}
+		omrthread_monitor_destroy(batch.monitor);
+	}
+
+done:
+	if (NULL != buffers) {
+		uintptr_t i = 0;
+		for (i = 0; i < bufferCapacity; i++) {
+			omrmem_free_memory(buffers[i].tracePoints);
+			omrmem_free_memory(buffers[i].text);
+		}
+		omrmem_free_memory(buffers);
+	}
+	omrmem_free_memory(heap);
+	omrmem_free_memory(bounds);
+	return rc;
+}
@@ -224,8 +224,12 @@ threadStop(OMR_TraceThread **thrSlot)
 			 */
 			internalTrace(thr, NULL, (UT_TRC_PURGE_ID << 8) | UT_MINIMAL, NULL);
 
-			UT_DBGOUT(3, ("<UT> Purging buffer " UT_POINTER_SPEC " for thread " UT_POINTER_SPEC "\n", trcBuf, thr));
-			publishTraceBuffer(thr, trcBuf);
+			/* The purge tracepoint may have filled and published the buffer, and started another */
+			trcBuf = thr->trcBuf;
+			if (NULL != trcBuf) {
+				UT_DBGOUT(3, ("<UT> Purging buffer " UT_POINTER_SPEC " for thread " UT_POINTER_SPEC "\n", trcBuf, thr));
+				publishTraceBuffer(thr, trcBuf);
+			}
 		} else {
 			releaseTraceBuffer(thr, trcBuf);
 		}
@@ -306,6 +310,9 @@ utTerminateTrace(void)
 		result = OMR_ERROR_INTERNAL;
 	}
 
+	/* publish everything still queued while the subscribers are registered */
+	stopAsyncPublisher();
+
 	if (OMR_TRACEGLOBAL(traceCount)) {
 		listCounters();
 	}
@@ -332,6 +339,9 @@ freeTrace(void)
 
 	UT_DBGOUT(1, ("<UT> freeTrace Entered\n"));
 
+	/* every thread has stopped, so no more buffers are published */
+	closeTraceFile();
+
 	if (OMR_TRACEGLOBAL(initState) < OMR_TRACE_ENGINE_SHUTDOWN_STARTED) {
 		/* shut everything down before freeing everything */
 		UT_DBGOUT(1, ("<UT> Error: freeTrace called before trace has been finalized\n"));
@@ -406,6 +416,9 @@ freeTrace(void)
 	omrthread_monitor_destroy(global->freeQueueLock);
 	global->freeQueueLock = NULL;
 
+	omrthread_monitor_destroy(global->publishQueueLock);
+	global->publishQueueLock = NULL;
+
 	omrthread_monitor_destroy(global->traceLock);
 	global->traceLock = NULL;
 
@@ -499,6 +512,9 @@ initializeTrace(OMR_VM *vm, const char *datDir, const OMR_TraceLanguageInterface
 
 	tempGbl.dynamicBuffers = TRUE;
 	tempGbl.bufferSize = UT_DEFAULT_BUFFERSIZE;
+	tempGbl.publishMode = UT_PUBLISH_SYNC;
+	tempGbl.publishQueueMaxDepth = UT_PUBLISH_DEFAULT_QUEUE_DEPTH;
+	tempGbl.traceFileHandle = -1;
 
 	/* Make the trace functions available to the rest of OMR */
 	/* OMRTODO Remove this. GC uses it to register the module.
@@ -553,6 +569,11 @@ initializeTrace(OMR_VM *vm, const char *datDir, const OMR_TraceLanguageInterface
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
 		goto fail;
 	}
+	if (0 != omrthread_monitor_init_with_name(&OMR_TRACEGLOBAL(publishQueueLock), 0, "Global Trace Publish Queue")) {
+		UT_DBGOUT(1, ("<UT> Initialization of publishQueueLock failed\n"));
+		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
+		goto fail;
+	}
 	if (0 != omrthread_monitor_init_with_name(&OMR_TRACEGLOBAL(bufferPoolLock), 0, "Global Trace Buffer Pool")) {
 		UT_DBGOUT(1, ("<UT> Initialization of bufferPoolLock failed\n"));
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
@@ -655,6 +676,11 @@ trcRegisterRecordSubscriber(OMR_TraceThread *thr, const char *description, utsSu
 		return OMR_THREAD_NOT_ATTACHED;
 	}
 
+	/* With publish=async, the first subscriber starts the publisher thread. Failing to start it is not
+	 * fatal since buffers are then published synchronously.
+	 */
+	startAsyncPublisher();
+
 	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
 	UtSubscription *subscription = (UtSubscription *)omrmem_allocate_memory(sizeof(UtSubscription), OMRMEM_CATEGORY_TRACE);
 	if (subscription == NULL) {
@@ -760,6 +786,8 @@ trcDeregisterRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription
 static omr_error_t
 trcFlushTraceData(OMR_TraceThread *thr)
 {
+	flushAsyncPublisher();
+	flushTraceFile();
 	return OMR_ERROR_NONE;
 }
 
@@ -966,7 +994,7 @@ destroyRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription, BOOL
 	 */
 	delistRecordSubscriber(subscription);
 
-	if (NULL == OMR_TRACEGLOBAL(subscribers)) {
+	if ((NULL == OMR_TRACEGLOBAL(subscribers)) && (-1 == OMR_TRACEGLOBAL(traceFileHandle))) {
 		OMR_TRACEGLOBAL(traceInCore) = TRUE;
 		UT_DBGOUT(5, ("<UT thr=" UT_POINTER_SPEC "> Set traceInCore to TRUE\n", thr));
 	}
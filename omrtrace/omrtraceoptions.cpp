@@ -57,10 +57,9 @@ static omr_error_t setPrint(OMR_TraceThread *thr, const char *value, BOOLEAN atR
 static omr_error_t setNone(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 static omr_error_t setIprint(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 static omr_error_t setException(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
-#if OMR_ALLOW_OUTPUT_OPTION
 static omr_error_t setOutput(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
-#endif /* OMR_ALLOW_OUTPUT_OPTION */
 static omr_error_t setBuffers(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
+static omr_error_t setPublish(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 static omr_error_t setSuspendResumeCount(OMR_TraceThread *thr, const char *value, int32_t resume, BOOLEAN atRuntime);
 static omr_error_t processSuspendOption(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 static omr_error_t processResumeOption(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
@@ -90,9 +89,7 @@ const OMR_TraceOption UTE_OPTIONS[] = {
 	{UT_PRINT_KEYWORD, TRUE, setPrint},
 	{UT_NONE_KEYWORD, TRUE, setNone},
 	{UT_IPRINT_KEYWORD, TRUE, setIprint},
-#if OMR_ALLOW_OUTPUT_OPTION
 	{UT_OUTPUT_KEYWORD, FALSE, setOutput},
-#endif /* OMR_ALLOW_OUTPUT_OPTION */
 	{UT_BUFFERS_KEYWORD, TRUE, setBuffers}, /* Not all buffers functions are exposed - but are controlled in the set function*/
 	{UT_SUSPEND_KEYWORD, TRUE, processSuspendOption},
 	{UT_RESUME_KEYWORD, TRUE, processResumeOption},
@@ -100,6 +97,7 @@ const OMR_TraceOption UTE_OPTIONS[] = {
 	{UT_SUSPEND_COUNT_KEYWORD, TRUE, processSuspendCountOption},
 	{UT_FATAL_ASSERT_KEYWORD, TRUE, setFatalAssert},
 	{UT_NO_FATAL_ASSERT_KEYWORD, TRUE, clearFatalAssert},
+	{UT_PUBLISH_KEYWORD, FALSE, setPublish},
 };
 
 #define NUMBER_OF_UTE_OPTIONS (sizeof(UTE_OPTIONS) / sizeof(UTE_OPTIONS[0]))
@@ -271,6 +269,92 @@ end:
 	return rc;
 }
 
+/*******************************************************************************
+ * name        - setPublish
+ * description - Set how full trace buffers are passed to subscribers
+ * parameters  - thr, string value of the property (sync|async[,grow|dropoldest|block][,nnn]), atRuntime
+ * returns     - UTE return code
+ ******************************************************************************/
+static omr_error_t
+setPublish(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime)
+{
+	char *localBuffer = NULL;
+	omr_error_t rc = OMR_ERROR_NONE;
+	const int numberOfArgs = getParmNumber(value);
+	int32_t publishMode = UT_PUBLISH_SYNC;
+	int32_t queueDepth = UT_PUBLISH_DEFAULT_QUEUE_DEPTH;
+	int i;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+
+	if (NULL == value) {
+		reportCommandLineError(atRuntime, "-Xtrace:publish expects an argument.");
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+	localBuffer = (char *)omrmem_allocate_memory(strlen(value) + 1, OMRMEM_CATEGORY_TRACE);
+	if (NULL == localBuffer) {
+		UT_DBGOUT(1, ("<UT> Out of memory in setPublish\n"));
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+
+	for (i = 0; i < numberOfArgs; i++) {
+		int argSize = 0;
+		const char *startOfThisArg = getPositionalParm(i + 1, value, &argSize);
+
+		if (argSize == 0) {
+			reportCommandLineError(atRuntime, "Empty option passed to -Xtrace:publish");
+			rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+			goto end;
+		}
+
+		strncpy(localBuffer, startOfThisArg, argSize);
+		localBuffer[argSize] = '\0';
+
+		if (0 == i) {
+			if (j9_cmdla_stricmp(localBuffer, "SYNC") == 0) {
+				publishMode = UT_PUBLISH_SYNC;
+			} else if (j9_cmdla_stricmp(localBuffer, "ASYNC") == 0) {
+				publishMode = UT_PUBLISH_ASYNC_GROW;
+			} else {
+				reportCommandLineError(atRuntime, "Invalid option for -Xtrace:publish - \"%s\"", localBuffer);
+				rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+				goto end;
+			}
+		} else if (UT_PUBLISH_SYNC == publishMode) {
+			reportCommandLineError(atRuntime, "-Xtrace:publish=sync does not take further arguments");
+			rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+			goto end;
+		} else if (j9_cmdla_stricmp(localBuffer, "GROW") == 0) {
+			publishMode = UT_PUBLISH_ASYNC_GROW;
+		} else if (j9_cmdla_stricmp(localBuffer, "DROPOLDEST") == 0) {
+			publishMode = UT_PUBLISH_ASYNC_DROP_OLDEST;
+		} else if (j9_cmdla_stricmp(localBuffer, "BLOCK") == 0) {
+			publishMode = UT_PUBLISH_ASYNC_BLOCK;
+		} else {
+			queueDepth = decimalString2Int(localBuffer, FALSE, &rc, atRuntime);
+			if (OMR_ERROR_NONE != rc) {
+				goto end;
+			}
+			if (queueDepth < 1) {
+				reportCommandLineError(atRuntime, "-Xtrace:publish queue depth must be at least 1");
+				rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+				goto end;
+			}
+		}
+	}
+
+	OMR_TRACEGLOBAL(publishMode) = publishMode;
+	OMR_TRACEGLOBAL(publishQueueMaxDepth) = (uint32_t)queueDepth;
+	UT_DBGOUT(1, ("<UT> Trace publish mode: %d, queue depth %d\n", publishMode, queueDepth));
+
+end:
+	if (localBuffer != NULL) {
+		omrmem_free_memory(localBuffer);
+	}
+
+	return rc;
+}
+
 /*******************************************************************************
  * name        - setMinimal
  * description - Set the minimal trace options
@@ -356,20 +440,81 @@ setException(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime)
 	return addTraceCmd(thr, UT_EXCEPTION_KEYWORD, value, atRuntime);
 }
 
-#if OMR_ALLOW_OUTPUT_OPTION
 /*******************************************************************************
  * name        - setOutput
- * description - Set the output filename and options
+ * description - Set the output filename and size
  * parameters  - thr, string value of the property
- *               (filename[,nnnm][,generations]])
+ *               (filename[,nnnk|nnnm])
  * returns     - UTE return code
  ******************************************************************************/
 static omr_error_t
 setOutput(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime)
 {
-	return OMR_ERROR_NONE;
+	omr_error_t rc = OMR_ERROR_NONE;
+	const int numberOfArgs = getParmNumber(value);
+	uint64_t fileSize = UT_TRACE_FILE_DEFAULT_SIZE;
+	const char *fileName = NULL;
+	int fileNameLength = 0;
+	char *newFileName = NULL;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+
+	if ((NULL == value) || (numberOfArgs < 1) || (numberOfArgs > 2)) {
+		reportCommandLineError(atRuntime, "-Xtrace:output expects a file name and an optional size.");
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	fileName = getPositionalParm(1, value, &fileNameLength);
+	if (0 == fileNameLength) {
+		reportCommandLineError(atRuntime, "-Xtrace:output requires a file name.");
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	if (2 == numberOfArgs) {
+		int sizeLength = 0;
+		const char *size = getPositionalParm(2, value, &sizeLength);
+		uint64_t multiplier = 1;
+		int digits = 0;
+
+		for (digits = 0; (digits < sizeLength) && isdigit(size[digits]); digits++) {
+		}
+		if ((0 == digits) || (digits < (sizeLength - 1))) {
+			reportCommandLineError(atRuntime, "Invalid size for -Xtrace:output - \"%.*s\"", sizeLength, size);
+			return OMR_ERROR_ILLEGAL_ARGUMENT;
+		}
+		if (digits == (sizeLength - 1)) {
+			switch (j9_cmdla_toupper(size[digits])) {
+			case 'K':
+				multiplier = 1024;
+				break;
+			case 'M':
+				multiplier = 1024 * 1024;
+				break;
+			default:
+				reportCommandLineError(atRuntime, "Unrecognised suffix %c specified for -Xtrace:output size", size[digits]);
+				return OMR_ERROR_ILLEGAL_ARGUMENT;
+			}
+		}
+		fileSize = (uint64_t)atoi(size) * multiplier;
+	}
+
+	newFileName = (char *)omrmem_allocate_memory(fileNameLength + 1, OMRMEM_CATEGORY_TRACE);
+	if (NULL == newFileName) {
+		UT_DBGOUT(1, ("<UT> Out of memory in setOutput\n"));
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	memcpy(newFileName, fileName, fileNameLength);
+	newFileName[fileNameLength] = '\0';
+
+	if (NULL != OMR_TRACEGLOBAL(traceFileName)) {
+		omrmem_free_memory(OMR_TRACEGLOBAL(traceFileName));
+	}
+	OMR_TRACEGLOBAL(traceFileName) = newFileName;
+	OMR_TRACEGLOBAL(traceFileSize) = fileSize;
+	UT_DBGOUT(1, ("<UT> Trace output file: %s, size %llu\n", newFileName, fileSize));
+
+	return rc;
 }
-#endif /* OMR_ALLOW_OUTPUT_OPTION */
 
 /*******************************************************************************
  * name        - setFormat
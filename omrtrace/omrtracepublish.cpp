@@ -25,6 +25,15 @@
 #include "omrtrace_internal.h"
 #include "thread_api.h"
 
+/* how long the idle publisher and blocked producers wait before re-checking the queue */
+#define UT_PUBLISH_WAIT_MILLIS 100
+
+static void notifySubscribers(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf);
+static BOOLEAN enqueueTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf);
+static OMR_TraceBuffer *dequeueTraceBuffer(void);
+static void initPublishQueue(void);
+static int J9THREAD_PROC publisherThreadMain(void *entryArg);
+
 omr_error_t
 publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 {
@@ -41,6 +50,8 @@ publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 		 * the thread that owns the trace buffer.
 		 */
 		buf->thr->trcBuf = NULL;
+		/* A queued buffer may outlive its owner, so releaseTraceBuffer() must not touch the thread again */
+		buf->thr = NULL;
 	}
 
 	/* only publish a buffer if data has been written to it */
@@ -49,39 +60,399 @@ publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 		/* CAS is not needed because flags is modified only by the thread that owns the buffer */
 		buf->flags = newFlags;
 
-		omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
-		omrthread_monitor_enter(subscribersLock);
-		for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
-			subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
-			subscription->data = &(buf->record);
+		if (enqueueTraceBuffer(currentThr, buf)) {
+			/* the publisher thread notifies the subscribers and releases the buffer */
+			decrementRecursionCounter(currentThr);
+			return rc;
+		}
+		notifySubscribers(currentThr, buf);
+	}
+	releaseTraceBuffer(currentThr, buf);
+
+	decrementRecursionCounter(currentThr);
+	return rc;
+}
+
+/**
+ * Pass a full trace buffer to the output= file and every subscriber.
+ */
+static void
+notifySubscribers(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
+{
+	writeTraceFileBuffer(buf);
+
+	omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
+	omrthread_monitor_enter(subscribersLock);
+	for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
+		subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
+		subscription->data = &(buf->record);
+
+		omr_error_t subscriberRc = subscription->subscriber(subscription);
+		if (OMR_ERROR_NONE != subscriberRc) {
+			/* If the subscriber callback fails, call the alarm callback and
+			 * remove the subscription.
+			 */
+			UtSubscription *subscriptionToDestroy = subscription;
+
+			/* adjust the loop iterator */
+			subscription = subscriptionToDestroy->prev;
+
+			getTraceLock(currentThr);
+			destroyRecordSubscriber(currentThr, subscriptionToDestroy, 1);
+			freeTraceLock(currentThr);
+
+			if (NULL == subscription) {
+				break;
+			}
+		}
+	}
+	omrthread_monitor_exit(subscribersLock);
+}
+
+/*
+ * The publish queue is an intrusive multi-producer, single-consumer queue linked through
+ * OMR_TraceBuffer::next. Producers swap themselves into publishQueueTail and then link
+ * the previous tail to the new buffer, so queueing never takes a lock. The consumer side
+ * (publishQueueHead) is serialized by publishQueueConsumerLock, which is only contended
+ * when a producer discards the oldest buffer under UT_PUBLISH_ASYNC_DROP_OLDEST.
+ */
+
+static void
+initPublishQueue(void)
+{
+	OMR_TraceBuffer *stub = &OMR_TRACEGLOBAL(publishQueueStub);
+
+	stub->next = NULL;
+	OMR_TRACEGLOBAL(publishQueueHead) = stub;
+	OMR_TRACEGLOBAL(publishQueueTail) = stub;
+	OMR_TRACEGLOBAL(publishQueueConsumerLock) = 0;
+	OMR_TRACEGLOBAL(publishQueueDepth) = 0;
+}
+
+static void
+pushTraceBuffer(OMR_TraceBuffer *buf)
+{
+	buf->next = NULL;
+	VM_AtomicSupport::writeBarrier();
+	OMR_TraceBuffer *prev = (OMR_TraceBuffer *)VM_AtomicSupport::set((volatile uintptr_t *)&OMR_TRACEGLOBAL(publishQueueTail), (uintptr_t)buf);
+	/* the queue is briefly disconnected here; the consumer treats that as empty until the link is stored */
+	*(OMR_TraceBuffer * volatile *)&prev->next = buf;
+}
+
+/**
+ * Remove the oldest buffer from the publish queue.
+ * publishQueueDepth is decremented by the caller once it is done with the buffer,
+ * so that flushAsyncPublisher() also waits for the buffer being published.
+ *
+ * @pre hold publishQueueConsumerLock
+ * @return the oldest buffer, or NULL if the queue is empty or a producer is part way through queueing
+ */
+static OMR_TraceBuffer *
+popTraceBuffer(void)
+{
+	OMR_TraceBuffer *stub = &OMR_TRACEGLOBAL(publishQueueStub);
+	OMR_TraceBuffer *head = OMR_TRACEGLOBAL(publishQueueHead);
+	OMR_TraceBuffer *next = *(OMR_TraceBuffer * volatile *)&head->next;
 
-			omr_error_t subscriberRc = subscription->subscriber(subscription);
-			if (OMR_ERROR_NONE != subscriberRc) {
-				/* If the subscriber callback fails, call the alarm callback and
-				 * remove the subscription.
-				 */
-				UtSubscription *subscriptionToDestroy = subscription;
+	if (stub == head) {
+		if (NULL == next) {
+			return NULL;
+		}
+		OMR_TRACEGLOBAL(publishQueueHead) = next;
+		head = next;
+		next = *(OMR_TraceBuffer * volatile *)&next->next;
+	}
+	if (NULL == next) {
+		if (head != OMR_TRACEGLOBAL(publishQueueTail)) {
+			/* a producer has swapped the tail but not yet linked it */
+			return NULL;
+		}
+		/* head is the last buffer: requeue the stub behind it so head can be detached */
+		pushTraceBuffer(stub);
+		next = *(OMR_TraceBuffer * volatile *)&head->next;
+		if (NULL == next) {
+			return NULL;
+		}
+	}
+	VM_AtomicSupport::readBarrier();
+	OMR_TRACEGLOBAL(publishQueueHead) = next;
+	head->next = NULL;
+	return head;
+}
 
-				/* adjust the loop iterator */
-				subscription = subscriptionToDestroy->prev;
+static void
+lockPublishQueueConsumer(void)
+{
+	volatile uint32_t *lock = &OMR_TRACEGLOBAL(publishQueueConsumerLock);
 
-				getTraceLock(currentThr);
-				destroyRecordSubscriber(currentThr, subscriptionToDestroy, 1);
-				freeTraceLock(currentThr);
+	while (0 != VM_AtomicSupport::lockCompareExchangeU32(lock, 0, 1)) {
+		omrthread_yield();
+	}
+	VM_AtomicSupport::readWriteBarrier();
+}
 
-				if (NULL == subscription) {
-					break;
+static void
+unlockPublishQueueConsumer(void)
+{
+	VM_AtomicSupport::readWriteBarrier();
+	OMR_TRACEGLOBAL(publishQueueConsumerLock) = 0;
+}
+
+static OMR_TraceBuffer *
+dequeueTraceBuffer(void)
+{
+	lockPublishQueueConsumer();
+	OMR_TraceBuffer *buf = popTraceBuffer();
+	unlockPublishQueueConsumer();
+	return buf;
+}
+
+/**
+ * Hand a full buffer to the publisher thread, applying the back-pressure policy.
+ *
+ * @return TRUE if the buffer was queued, FALSE if the caller must publish it synchronously
+ */
+static BOOLEAN
+enqueueTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
+{
+	const int32_t publishMode = OMR_TRACEGLOBAL(publishMode);
+	BOOLEAN queued = FALSE;
+
+	if ((UT_PUBLISH_SYNC == publishMode) || (UT_PUBLISHER_RUNNING != OMR_TRACEGLOBAL(publisherState))) {
+		return FALSE;
+	}
+
+	/* The in-flight count lets stopAsyncPublisher() wait for producers that passed the state check */
+	VM_AtomicSupport::add(&OMR_TRACEGLOBAL(publishProducersInFlight), 1);
+	if (UT_PUBLISHER_RUNNING == OMR_TRACEGLOBAL(publisherState)) {
+		const uintptr_t maxDepth = OMR_TRACEGLOBAL(publishQueueMaxDepth);
+		const BOOLEAN isPublisher = (currentThr == OMR_TRACEGLOBAL(publisherTraceThread));
+
+		if (OMR_TRACEGLOBAL(publishQueueDepth) >= maxDepth) {
+			OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+
+			if (UT_PUBLISH_ASYNC_DROP_OLDEST == publishMode) {
+				/* Don't wait for the publisher to finish a dequeue; overshooting the limit is harmless */
+				if (0 == VM_AtomicSupport::lockCompareExchangeU32(&OMR_TRACEGLOBAL(publishQueueConsumerLock), 0, 1)) {
+					VM_AtomicSupport::readWriteBarrier();
+					OMR_TraceBuffer *oldest = popTraceBuffer();
+					unlockPublishQueueConsumer();
+					if (NULL != oldest) {
+						VM_AtomicSupport::add(&OMR_TRACEGLOBAL(droppedBuffers), 1);
+						releaseTraceBuffer(currentThr, oldest);
+						VM_AtomicSupport::subtract(&OMR_TRACEGLOBAL(publishQueueDepth), 1);
+					}
 				}
+			} else if ((UT_PUBLISH_ASYNC_BLOCK == publishMode) && !isPublisher && (0 == omrsig_get_current_signal())) {
+				/* The publisher itself never waits, since nothing else would drain the queue */
+				omrthread_monitor_t const lock = OMR_TRACEGLOBAL(publishQueueLock);
+				omrthread_monitor_enter(lock);
+				OMR_TRACEGLOBAL(publishBlockedProducers) += 1;
+				while ((OMR_TRACEGLOBAL(publishQueueDepth) >= maxDepth) && (UT_PUBLISHER_RUNNING == OMR_TRACEGLOBAL(publisherState))) {
+					omrthread_monitor_wait_timed(lock, UT_PUBLISH_WAIT_MILLIS, 0);
+				}
+				OMR_TRACEGLOBAL(publishBlockedProducers) -= 1;
+				omrthread_monitor_exit(lock);
 			}
 		}
-		omrthread_monitor_exit(subscribersLock);
+
+		uintptr_t depth = VM_AtomicSupport::add(&OMR_TRACEGLOBAL(publishQueueDepth), 1);
+		pushTraceBuffer(buf);
+		queued = TRUE;
+
+		uintptr_t highWater = OMR_TRACEGLOBAL(publishQueueHighWater);
+		while ((depth > highWater)
+			&& (highWater != VM_AtomicSupport::lockCompareExchange(&OMR_TRACEGLOBAL(publishQueueHighWater), highWater, depth))
+		) {
+			highWater = OMR_TRACEGLOBAL(publishQueueHighWater);
+		}
+
+		if (1 == depth) {
+			/* the publisher may be idle; the timed wait bounds the latency if this notify is missed */
+			omrthread_monitor_enter(OMR_TRACEGLOBAL(publishQueueLock));
+			omrthread_monitor_notify_all(OMR_TRACEGLOBAL(publishQueueLock));
+			omrthread_monitor_exit(OMR_TRACEGLOBAL(publishQueueLock));
+		}
 	}
-	releaseTraceBuffer(currentThr, buf);
+	VM_AtomicSupport::subtract(&OMR_TRACEGLOBAL(publishProducersInFlight), 1);
 
-	decrementRecursionCounter(currentThr);
+	return queued;
+}
+
+static int J9THREAD_PROC
+publisherThreadMain(void *entryArg)
+{
+	omrthread_t self = omrthread_self();
+	OMR_TraceThread *thr = NULL;
+	omrthread_monitor_t const lock = OMR_TRACEGLOBAL(publishQueueLock);
+
+	if (OMR_ERROR_NONE == threadStart(&thr, self, "Trace Publisher", self, NULL)) {
+		OMR_TRACEGLOBAL(publisherTraceThread) = thr;
+	}
+
+	omrthread_monitor_enter(lock);
+	if (NULL == thr) {
+		/* buffers published from now on are published synchronously */
+		OMR_TRACEGLOBAL(publisherState) = UT_PUBLISHER_STOPPED;
+	} else {
+		OMR_TRACEGLOBAL(publisherState) = UT_PUBLISHER_RUNNING;
+	}
+	omrthread_monitor_notify_all(lock);
+	omrthread_monitor_exit(lock);
+
+	if (NULL == thr) {
+		return 0;
+	}
+
+	for (;;) {
+		OMR_TraceBuffer *buf = dequeueTraceBuffer();
+		if (NULL != buf) {
+			incrementRecursionCounter(thr);
+			notifySubscribers(thr, buf);
+			releaseTraceBuffer(thr, buf);
+			decrementRecursionCounter(thr);
+			VM_AtomicSupport::add(&OMR_TRACEGLOBAL(publishedBuffers), 1);
+			VM_AtomicSupport::subtract(&OMR_TRACEGLOBAL(publishQueueDepth), 1);
+
+			if (0 != OMR_TRACEGLOBAL(publishBlockedProducers)) {
+				omrthread_monitor_enter(lock);
+				omrthread_monitor_notify_all(lock);
+				omrthread_monitor_exit(lock);
+			}
+			continue;
+		}
+
+		if (0 != OMR_TRACEGLOBAL(publishQueueDepth)) {
+			/* a producer is part way through queueing */
+			omrthread_yield();
+			continue;
+		}
+
+		omrthread_monitor_enter(lock);
+		if (0 == OMR_TRACEGLOBAL(publishQueueDepth)) {
+			if (UT_PUBLISHER_STOPPING == OMR_TRACEGLOBAL(publisherState)) {
+				/* no producer is queueing once the state is STOPPING, so the queue stays empty */
+				omrthread_monitor_exit(lock);
+				break;
+			}
+			/* wake any flushAsyncPublisher() callers, then wait for a producer */
+			omrthread_monitor_notify_all(lock);
+			omrthread_monitor_wait_timed(lock, UT_PUBLISH_WAIT_MILLIS, 0);
+		}
+		omrthread_monitor_exit(lock);
+	}
+
+	/* publish this thread's own buffer, if it took any tracepoints, before detaching */
+	OMR_TRACEGLOBAL(publisherTraceThread) = NULL;
+	threadStop(&thr);
+
+	omrthread_monitor_enter(lock);
+	OMR_TRACEGLOBAL(publisherState) = UT_PUBLISHER_STOPPED;
+	omrthread_monitor_notify_all(lock);
+	omrthread_monitor_exit(lock);
+	return 0;
+}
+
+omr_error_t
+startAsyncPublisher(void)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	omrthread_monitor_t const lock = OMR_TRACEGLOBAL(publishQueueLock);
+
+	if (UT_PUBLISH_SYNC == OMR_TRACEGLOBAL(publishMode)) {
+		return rc;
+	}
+
+	omrthread_monitor_enter(lock);
+	if (UT_PUBLISHER_NOT_STARTED == OMR_TRACEGLOBAL(publisherState)) {
+		omrthread_attr_t attr = NULL;
+
+		initPublishQueue();
+		if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+			|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			|| (J9THREAD_SUCCESS != omrthread_create_ex(&OMR_TRACEGLOBAL(publisherThread), &attr, 0, publisherThreadMain, NULL))
+		) {
+			UT_DBGOUT(1, ("<UT> Unable to start the trace publisher thread, publishing synchronously\n"));
+			OMR_TRACEGLOBAL(publisherThread) = NULL;
+			OMR_TRACEGLOBAL(publisherState) = UT_PUBLISHER_STOPPED;
+			rc = OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD;
+		} else {
+			/* wait until the publisher is attached to trace, so that it is never asked to stop before running */
+			while (UT_PUBLISHER_NOT_STARTED == OMR_TRACEGLOBAL(publisherState)) {
+				omrthread_monitor_wait(lock);
+			}
+		}
+		if (NULL != attr) {
+			omrthread_attr_destroy(&attr);
+		}
+	}
+	omrthread_monitor_exit(lock);
 	return rc;
 }
 
+void
+stopAsyncPublisher(void)
+{
+	omrthread_monitor_t const lock = OMR_TRACEGLOBAL(publishQueueLock);
+	omrthread_t publisherThread = NULL;
+
+	omrthread_monitor_enter(lock);
+	if (UT_PUBLISHER_RUNNING != OMR_TRACEGLOBAL(publisherState)) {
+		omrthread_monitor_exit(lock);
+		return;
+	}
+	/* stop new buffers from being queued, and release blocked producers so they finish queueing */
+	OMR_TRACEGLOBAL(publisherState) = UT_PUBLISHER_DRAINING;
+	omrthread_monitor_notify_all(lock);
+	omrthread_monitor_exit(lock);
+
+	VM_AtomicSupport::readWriteBarrier();
+	while (0 != OMR_TRACEGLOBAL(publishProducersInFlight)) {
+		omrthread_yield();
+	}
+
+	omrthread_monitor_enter(lock);
+	OMR_TRACEGLOBAL(publisherState) = UT_PUBLISHER_STOPPING;
+	publisherThread = OMR_TRACEGLOBAL(publisherThread);
+	OMR_TRACEGLOBAL(publisherThread) = NULL;
+	omrthread_monitor_notify_all(lock);
+	omrthread_monitor_exit(lock);
+
+	omrthread_join(publisherThread);
+
+	UT_DBGOUT(1, ("<UT> Trace publisher stopped: published %zu, dropped %zu, queue high water %zu\n",
+			OMR_TRACEGLOBAL(publishedBuffers), OMR_TRACEGLOBAL(droppedBuffers), OMR_TRACEGLOBAL(publishQueueHighWater)));
+}
+
+void
+flushAsyncPublisher(void)
+{
+	omrthread_monitor_t const lock = OMR_TRACEGLOBAL(publishQueueLock);
+
+	/* a subscriber flushing from the publisher thread would wait for itself */
+	if ((UT_PUBLISH_SYNC != OMR_TRACEGLOBAL(publishMode)) && (twThreadSelf() != OMR_TRACEGLOBAL(publisherTraceThread))) {
+		omrthread_monitor_enter(lock);
+		while ((UT_PUBLISHER_RUNNING == OMR_TRACEGLOBAL(publisherState)) && (0 != OMR_TRACEGLOBAL(publishQueueDepth))) {
+			omrthread_monitor_wait_timed(lock, UT_PUBLISH_WAIT_MILLIS, 0);
+		}
+		omrthread_monitor_exit(lock);
+	}
+}
+
+void
+resetAsyncPublisher(void)
+{
+	/* the publisher thread does not exist in the child, and the buffers pool has been cleared */
+	if (UT_PUBLISHER_NOT_STARTED != OMR_TRACEGLOBAL(publisherState)) {
+		OMR_TRACEGLOBAL(publisherState) = UT_PUBLISHER_NOT_STARTED;
+		OMR_TRACEGLOBAL(publisherThread) = NULL;
+		OMR_TRACEGLOBAL(publisherTraceThread) = NULL;
+		OMR_TRACEGLOBAL(publishProducersInFlight) = 0;
+		OMR_TRACEGLOBAL(publishBlockedProducers) = 0;
+		initPublishQueue();
+	}
+}
+
 omr_error_t
 releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 {
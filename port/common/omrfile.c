@@ -734,6 +734,183 @@ omrfile_unlock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd, uint64_t o
 	return -1;
 }
 
+/**
+ * Read from a file at the given offset into a list of buffers, without using or changing
+ * the file offset of the descriptor.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] iov The buffers to fill, in order.
+ * @param[in] iovcnt The number of buffers.
+ * @param[in] offset The offset in the file to read from.
+ *
+ * @return The number of bytes read, which is less than requested at the end of the file
+ * and 0 at or beyond it, or a negative portable error code on failure.
+ *
+ * @note This generic version seeks and reads, so it restores the file offset afterwards
+ * but is not atomic with respect to other users of the descriptor.
+ */
+intptr_t
+omrfile_preadv(struct OMRPortLibrary *portLibrary, intptr_t fd, const OMRIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	intptr_t total = 0;
+	int64_t savedOffset = 0;
+	int32_t i = 0;
+
+	Trc_PRT_file_preadv_Entry(fd, iov, iovcnt, offset);
+
+	savedOffset = portLibrary->file_seek(portLibrary, fd, 0, EsSeekCur);
+	if ((iovcnt < 0) || (offset < 0) || (-1 == savedOffset) || (offset != portLibrary->file_seek(portLibrary, fd, offset, EsSeekSet))) {
+		total = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+		Trc_PRT_file_preadv_Exit(total);
+		return total;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		intptr_t bytesRead = 0;
+		if (0 == iov[i].iov_len) {
+			continue;
+		}
+		/* omrfile_read reports the end of the file as a failure */
+		bytesRead = portLibrary->file_read(portLibrary, fd, iov[i].iov_base, (intptr_t)iov[i].iov_len);
+		if (bytesRead <= 0) {
+			break;
+		}
+		total += bytesRead;
+		if ((uintptr_t)bytesRead < iov[i].iov_len) {
+			break;
+		}
+	}
+
+	portLibrary->file_seek(portLibrary, fd, savedOffset, EsSeekSet);
+	Trc_PRT_file_preadv_Exit(total);
+	return total;
+}
+
+/**
+ * Write a list of buffers to a file at the given offset, without using or changing the
+ * file offset of the descriptor.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] iov The buffers to write, in order.
+ * @param[in] iovcnt The number of buffers.
+ * @param[in] offset The offset in the file to write to.
+ *
+ * @return The number of bytes written, or a negative portable error code on failure.
+ *
+ * @note This generic version seeks and writes, so it restores the file offset afterwards
+ * but is not atomic with respect to other users of the descriptor.
+ */
+intptr_t
+omrfile_pwritev(struct OMRPortLibrary *portLibrary, intptr_t fd, const OMRIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	intptr_t total = 0;
+	int64_t savedOffset = 0;
+	int32_t i = 0;
+
+	Trc_PRT_file_pwritev_Entry(fd, iov, iovcnt, offset);
+
+	savedOffset = portLibrary->file_seek(portLibrary, fd, 0, EsSeekCur);
+	if ((iovcnt < 0) || (offset < 0) || (-1 == savedOffset) || (offset != portLibrary->file_seek(portLibrary, fd, offset, EsSeekSet))) {
+		total = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+		Trc_PRT_file_pwritev_Exit(total);
+		return total;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		intptr_t bytesWritten = portLibrary->file_write(portLibrary, fd, iov[i].iov_base, (intptr_t)iov[i].iov_len);
+		if (bytesWritten < 0) {
+			if (0 == total) {
+				total = bytesWritten;
+			}
+			break;
+		}
+		total += bytesWritten;
+		if ((uintptr_t)bytesWritten < iov[i].iov_len) {
+			break;
+		}
+	}
+
+	portLibrary->file_seek(portLibrary, fd, savedOffset, EsSeekSet);
+	Trc_PRT_file_pwritev_Exit(total);
+	return total;
+}
+
+/**
+ * Tell the operating system how a range of a file is going to be accessed. The advice
+ * is a hint, and platforms that can't use it return success.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset The start of the range.
+ * @param[in] length The length of the range, 0 meaning to the end of the file.
+ * @param[in] advice One of the OMRPORT_FILE_ADVICE_* values.
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ */
+int32_t
+omrfile_fadvise(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, int32_t advice)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_file_fadvise_Entry(fd, offset, length, advice);
+	if ((offset < 0) || (length < 0) || (advice < OMRPORT_FILE_ADVICE_NORMAL) || (advice > OMRPORT_FILE_ADVICE_NOREUSE)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+	}
+	Trc_PRT_file_fadvise_Exit(rc);
+	return rc;
+}
+
+/**
+ * Reserve disk space for a range of a file. Unless OMRPORT_FILE_FALLOCATE_KEEP_SIZE is
+ * specified the file is extended to cover the range.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset The start of the range.
+ * @param[in] length The length of the range.
+ * @param[in] flags 0 or OMRPORT_FILE_FALLOCATE_KEEP_SIZE.
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ *
+ * @note This generic version can only extend the file, which does not reserve space, and
+ * returns OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM for OMRPORT_FILE_FALLOCATE_KEEP_SIZE.
+ */
+int32_t
+omrfile_fallocate(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, uint32_t flags)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_file_fallocate_Entry(fd, offset, length, flags);
+	if ((offset < 0) || (length < 0)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+	} else if (OMR_ARE_ANY_BITS_SET(flags, OMRPORT_FILE_FALLOCATE_KEEP_SIZE)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM);
+	} else if ((0 != length) && (portLibrary->file_flength(portLibrary, fd) < (offset + length))) {
+		rc = portLibrary->file_set_length(portLibrary, fd, offset + length);
+	}
+	Trc_PRT_file_fallocate_Exit(rc);
+	return rc;
+}
+
+/**
+ * Start reading a range of a file into memory in the background. This is a hint, and
+ * platforms that can't use it return success.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset The start of the range.
+ * @param[in] length The length of the range.
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ */
+int32_t
+omrfile_readahead(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length)
+{
+	return portLibrary->file_fadvise(portLibrary, fd, offset, length, OMRPORT_FILE_ADVICE_WILLNEED);
+}
+
 /**
  * Query the properties of the specified file using file descriptor
  *
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Completion-based asynchronous file I/O
+ */
+
+#include "omrfile_async_pool.h"
+#include "omrportpriv.h"
+#include "ut_omrport.h"
+
+struct OMRFileAsyncContext {
+	OMRFileAsyncPool pool;
+};
+
+/**
+ * Create a context for asynchronous reads and writes. Requests are submitted with
+ * @ref omrfile_async_submit and collected, in any order, with @ref omrfile_async_complete.
+ *
+ * A context may be used by one thread at a time; callers sharing a context must serialize
+ * submission and completion.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queueDepth The maximum number of requests in flight, must be non zero
+ * @param[in] flags OMRPORT_FILE_ASYNC_FLAG_THREAD_POOL to use worker threads even where the operating
+ * system provides completion-based file I/O
+ * @param[out] context The new context
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ */
+int32_t
+omrfile_async_create(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, struct OMRFileAsyncContext **context)
+{
+	OMRFileAsyncContext *newContext = NULL;
+	int32_t rc = 0;
+
+	if ((NULL == context) || (0 == queueDepth)) {
+		Trc_PRT_file_async_create_failed(OMRPORT_ERROR_FILE_INVAL);
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+	*context = NULL;
+
+	newContext = (OMRFileAsyncContext *)portLibrary->mem_allocate_memory(portLibrary, sizeof(*newContext), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newContext) {
+		Trc_PRT_file_async_create_failed(OMRPORT_ERROR_FILE_OPFAILED);
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+
+	rc = omrfile_async_pool_startup(portLibrary, &newContext->pool, queueDepth);
+	if (0 != rc) {
+		portLibrary->mem_free_memory(portLibrary, newContext);
+		Trc_PRT_file_async_create_failed(rc);
+		return rc;
+	}
+
+	Trc_PRT_file_async_create(newContext, queueDepth, "worker threads");
+	*context = newContext;
+	return 0;
+}
+
+/**
+ * Destroy a context. Waits for the requests in flight to finish; requests that were not
+ * collected with @ref omrfile_async_complete are not returned.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context, may be NULL
+ */
+void
+omrfile_async_destroy(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context)
+{
+	if (NULL != context) {
+		Trc_PRT_file_async_destroy(context);
+		omrfile_async_pool_shutdown(&context->pool);
+		portLibrary->mem_free_memory(portLibrary, context);
+	}
+}
+
+/**
+ * Start reads and writes. The requests and their buffers must not be touched until
+ * they are returned by @ref omrfile_async_complete.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context
+ * @param[in] requests The requests to start
+ * @param[in] count The number of requests
+ *
+ * @return the number of requests started, from the front of the array, which is less than count
+ * when the context already has queueDepth requests in flight; a negative portable error code on failure.
+ */
+int32_t
+omrfile_async_submit(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context, struct OMRFileAsyncRequest **requests, uint32_t count)
+{
+	if ((NULL == context) || !omrfile_async_requests_valid(requests, count)) {
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+
+	return omrfile_async_pool_submit(&context->pool, requests, count);
+}
+
+/**
+ * Collect finished requests, in completion order. The result of each request is stored
+ * in its result field.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context
+ * @param[out] completed Receives the finished requests
+ * @param[in] maxCompleted The size of completed
+ * @param[in] minCompleted The number of requests to wait for; the wait ends early when fewer requests
+ * are in flight. 0 to only collect requests that have already finished.
+ *
+ * @return the number of requests stored in completed, a negative portable error code on failure.
+ */
+int32_t
+omrfile_async_complete(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context, struct OMRFileAsyncRequest **completed, uint32_t maxCompleted, uint32_t minCompleted)
+{
+	if ((NULL == context) || ((NULL == completed) && (0 != maxCompleted))) {
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+
+	return omrfile_async_pool_complete(&context->pool, completed, maxCompleted, minCompleted);
+}
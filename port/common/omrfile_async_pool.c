@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Worker thread implementation of asynchronous file I/O
+ */
+
+#include "omrfile_async_pool.h"
+#include "omrportpriv.h"
+
+#include <string.h>
+
+/* More threads than this only add contention for the same devices. */
+#define OMRFILE_ASYNC_POOL_MAX_WORKERS 4
+
+static int J9THREAD_PROC asyncPoolWorker(void *entryArg);
+static void performRequest(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *request);
+
+/**
+ * Perform one request with a blocking positional read or write.
+ */
+static void
+performRequest(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *request)
+{
+	if (OMRPORT_FILE_ASYNC_READ == request->operation) {
+		request->result = portLibrary->file_preadv(portLibrary, request->fd, request->iov, request->iovcnt, request->offset);
+	} else {
+		request->result = portLibrary->file_pwritev(portLibrary, request->fd, request->iov, request->iovcnt, request->offset);
+	}
+}
+
+static int J9THREAD_PROC
+asyncPoolWorker(void *entryArg)
+{
+	OMRFileAsyncPool *pool = (OMRFileAsyncPool *)entryArg;
+
+	omrthread_monitor_enter(pool->monitor);
+	for (;;) {
+		OMRFileAsyncRequest *request = pool->pendingHead;
+		if (NULL == request) {
+			if (pool->shutdown) {
+				break;
+			}
+			omrthread_monitor_wait(pool->monitor);
+			continue;
+		}
+		pool->pendingHead = request->next;
+		if (NULL == pool->pendingHead) {
+			pool->pendingTail = NULL;
+		}
+		omrthread_monitor_exit(pool->monitor);
+
+		performRequest(pool->portLibrary, request);
+
+		omrthread_monitor_enter(pool->monitor);
+		request->next = NULL;
+		if (NULL == pool->completedTail) {
+			pool->completedHead = request;
+		} else {
+			pool->completedTail->next = request;
+		}
+		pool->completedTail = request;
+		pool->completedCount += 1;
+		omrthread_monitor_notify_all(pool->monitor);
+	}
+	omrthread_monitor_exit(pool->monitor);
+	return 0;
+}
+
+/**
+ * Check the requests passed to omrfile_async_submit.
+ *
+ * @return TRUE if every request is complete and names a known operation.
+ */
+BOOLEAN
+omrfile_async_requests_valid(OMRFileAsyncRequest **requests, uint32_t count)
+{
+	uint32_t i = 0;
+
+	if ((NULL == requests) && (0 != count)) {
+		return FALSE;
+	}
+	for (i = 0; i < count; i++) {
+		OMRFileAsyncRequest *request = requests[i];
+		if ((NULL == request)
+			|| ((OMRPORT_FILE_ASYNC_READ != request->operation) && (OMRPORT_FILE_ASYNC_WRITE != request->operation))
+			|| (request->iovcnt <= 0) || (NULL == request->iov) || (request->offset < 0)
+		) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/**
+ * Start the worker threads of a pool.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] pool The pool to initialize
+ * @param[in] queueDepth The maximum number of requests in flight
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ */
+int32_t
+omrfile_async_pool_startup(struct OMRPortLibrary *portLibrary, OMRFileAsyncPool *pool, uint32_t queueDepth)
+{
+	omrthread_attr_t attr = NULL;
+	uint32_t i = 0;
+
+	memset(pool, 0, sizeof(*pool));
+	pool->portLibrary = portLibrary;
+	pool->queueDepth = queueDepth;
+
+	if (0 != omrthread_monitor_init_with_name(&pool->monitor, 0, "omrfile_async worker pool")) {
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+
+	pool->workerCount = OMR_MIN(queueDepth, OMRFILE_ASYNC_POOL_MAX_WORKERS);
+	pool->workers = (omrthread_t *)portLibrary->mem_allocate_memory(portLibrary,
+			pool->workerCount * sizeof(omrthread_t), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == pool->workers) {
+		omrthread_monitor_destroy(pool->monitor);
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+
+	if (J9THREAD_SUCCESS != omrthread_attr_init(&attr)) {
+		portLibrary->mem_free_memory(portLibrary, pool->workers);
+		omrthread_monitor_destroy(pool->monitor);
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+	omrthread_attr_set_category(&attr, J9THREAD_CATEGORY_SYSTEM_THREAD);
+	omrthread_attr_set_name(&attr, "omrfile_async worker");
+
+	for (i = 0; i < pool->workerCount; i++) {
+		if (J9THREAD_SUCCESS != omrthread_create_ex(&pool->workers[i], &attr, 0, asyncPoolWorker, pool)) {
+			break;
+		}
+	}
+	omrthread_attr_destroy(&attr);
+
+	if (0 == i) {
+		portLibrary->mem_free_memory(portLibrary, pool->workers);
+		omrthread_monitor_destroy(pool->monitor);
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	/* carry on with the threads that could be started */
+	pool->workerCount = i;
+	return 0;
+}
+
+/**
+ * Stop the worker threads of a pool once they have performed all submitted requests,
+ * and release its resources. Completed requests that were not collected are dropped.
+ */
+void
+omrfile_async_pool_shutdown(OMRFileAsyncPool *pool)
+{
+	struct OMRPortLibrary *portLibrary = pool->portLibrary;
+	uint32_t i = 0;
+
+	omrthread_monitor_enter(pool->monitor);
+	pool->shutdown = TRUE;
+	omrthread_monitor_notify_all(pool->monitor);
+	omrthread_monitor_exit(pool->monitor);
+
+	for (i = 0; i < pool->workerCount; i++) {
+		omrthread_join(pool->workers[i]);
+	}
+
+	portLibrary->mem_free_memory(portLibrary, pool->workers);
+	omrthread_monitor_destroy(pool->monitor);
+}
+
+/**
+ * Queue requests for the worker threads, see omrfile_async_submit.
+ */
+int32_t
+omrfile_async_pool_submit(OMRFileAsyncPool *pool, OMRFileAsyncRequest **requests, uint32_t count)
+{
+	uint32_t submitted = 0;
+
+	omrthread_monitor_enter(pool->monitor);
+	while ((submitted < count) && (pool->inflightCount < pool->queueDepth)) {
+		OMRFileAsyncRequest *request = requests[submitted];
+		request->next = NULL;
+		if (NULL == pool->pendingTail) {
+			pool->pendingHead = request;
+		} else {
+			pool->pendingTail->next = request;
+		}
+		pool->pendingTail = request;
+		pool->inflightCount += 1;
+		submitted += 1;
+	}
+	if (0 != submitted) {
+		omrthread_monitor_notify_all(pool->monitor);
+	}
+	omrthread_monitor_exit(pool->monitor);
+
+	return (int32_t)submitted;
+}
+
+/**
+ * Collect finished requests, see omrfile_async_complete.
+ */
+int32_t
+omrfile_async_pool_complete(OMRFileAsyncPool *pool, OMRFileAsyncRequest **completed, uint32_t maxCompleted, uint32_t minCompleted)
+{
+	uint32_t collected = 0;
+
+	omrthread_monitor_enter(pool->monitor);
+	minCompleted = (uint32_t)OMR_MIN(OMR_MIN(minCompleted, maxCompleted), pool->inflightCount);
+	while (pool->completedCount < minCompleted) {
+		omrthread_monitor_wait(pool->monitor);
+	}
+	while ((collected < maxCompleted) && (NULL != pool->completedHead)) {
+		OMRFileAsyncRequest *request = pool->completedHead;
+		pool->completedHead = request->next;
+		request->next = NULL;
+		completed[collected] = request;
+		collected += 1;
+	}
+	if (NULL == pool->completedHead) {
+		pool->completedTail = NULL;
+	}
+	pool->completedCount -= collected;
+	pool->inflightCount -= collected;
+	omrthread_monitor_exit(pool->monitor);
+
+	return (int32_t)collected;
+}
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Worker thread implementation of asynchronous file I/O
+ */
+
+#ifndef OMRFILE_ASYNC_POOL_H_
+#define OMRFILE_ASYNC_POOL_H_
+
+#include "omrport.h"
+#include "omrthread.h"
+
+/**
+ * Performs the requests of an asynchronous file I/O context with blocking positional
+ * reads and writes on a set of worker threads. Used where the operating system has no
+ * completion-based file I/O, or it is unavailable.
+ */
+typedef struct OMRFileAsyncPool {
+	struct OMRPortLibrary *portLibrary;
+	omrthread_monitor_t monitor; /**< protects the queues and counts, workers and waiters wait on it */
+	OMRFileAsyncRequest *pendingHead; /**< submitted requests no worker has taken yet, oldest first */
+	OMRFileAsyncRequest *pendingTail;
+	OMRFileAsyncRequest *completedHead; /**< finished requests not yet returned, oldest first */
+	OMRFileAsyncRequest *completedTail;
+	uintptr_t completedCount;
+	uintptr_t inflightCount; /**< submitted requests not yet returned */
+	uintptr_t queueDepth; /**< maximum inflightCount */
+	BOOLEAN shutdown;
+	uint32_t workerCount;
+	omrthread_t *workers;
+} OMRFileAsyncPool;
+
+extern BOOLEAN
+omrfile_async_requests_valid(OMRFileAsyncRequest **requests, uint32_t count);
+
+extern int32_t
+omrfile_async_pool_startup(struct OMRPortLibrary *portLibrary, OMRFileAsyncPool *pool, uint32_t queueDepth);
+
+extern void
+omrfile_async_pool_shutdown(OMRFileAsyncPool *pool);
+
+extern int32_t
+omrfile_async_pool_submit(OMRFileAsyncPool *pool, OMRFileAsyncRequest **requests, uint32_t count);
+
+extern int32_t
+omrfile_async_pool_complete(OMRFileAsyncPool *pool, OMRFileAsyncRequest **completed, uint32_t maxCompleted, uint32_t minCompleted);
+
+#endif /* OMRFILE_ASYNC_POOL_H_ */
@@ -39,6 +39,22 @@ struct J9Heap {
 	uintptr_t largestAllocSizeVisited; /* largest free list entry visited while performing the last allocation */
 };
 
+/* Heaps created with OMRPORT_HEAP_FLAG_BINNED keep a two level segregated free list index immediately after the
+ * J9Heap header. Free blocks smaller than J9HEAP_BIN_SL_COUNT slots get one bin per size, and every larger power of two
+ * range is split into J9HEAP_BIN_SL_COUNT equally sized bins. The bitmaps record which bins are non-empty so a suitable
+ * free block is found with two bit scans no matter how fragmented the heap is. Blocks at or beyond the last first level
+ * all go to the final bin.
+ */
+#define J9HEAP_BIN_SL_SHIFT 3
+#define J9HEAP_BIN_SL_COUNT ((uintptr_t)1 << J9HEAP_BIN_SL_SHIFT)
+#define J9HEAP_BIN_FL_COUNT 32
+
+typedef struct J9HeapBins {
+	uint32_t flBitmap; /* bit n is set when any bin of first level n is non-empty */
+	uint32_t slBitmap[J9HEAP_BIN_FL_COUNT]; /* bit m of slBitmap[n] is set when freeLists[n][m] is non-empty */
+	uintptr_t freeLists[J9HEAP_BIN_FL_COUNT][J9HEAP_BIN_SL_COUNT]; /* slot number of the first free block in each bin, 0 if empty */
+} J9HeapBins;
+
 #define ALIGNMENT_ROUND_DOWN(value) (((uintptr_t) value) & (~(sizeof(uint64_t) - 1)))
 #define ALIGNMENT_ROUND_UP(value) ((((uintptr_t) value) + (sizeof(uint64_t) - 1)) & (~(sizeof(uint64_t) - 1)))
 
@@ -49,13 +65,41 @@ struct J9Heap {
  */
 #define HEAP_MANAGEMENT_OVERHEAD (sizeof(J9Heap)+2*sizeof(uint64_t))
 
+/* A free block in a binned heap stores the slot numbers of its neighbours in its bin in its first 2 slots,
+ * so neither free nor allocated blocks may be smaller than 2 slots.
+ */
+#define BINNED_MIN_BLOCK_SIZE 2
+#define BINNED_NEXT_FREE(block) ((block)[1])
+#define BINNED_PREVIOUS_FREE(block) ((block)[2])
+
+#define HEAP_BINS(heap) ((J9HeapBins *)((heap) + 1))
+#define BINNED_FIRST_BLOCK_SLOT ((sizeof(J9Heap) + ALIGNMENT_ROUND_UP(sizeof(J9HeapBins))) / sizeof(uint64_t))
+#define BINNED_HEAP_MANAGEMENT_OVERHEAD ((BINNED_FIRST_BLOCK_SLOT + 2) * sizeof(uint64_t))
+
+/* Binned heaps don't use the first-fit search state, so they are marked by a lastAllocSlot no first-fit heap can have.
+ * This keeps the J9Heap header the same size in both modes.
+ */
+#define BINNED_HEAP_MARKER UINTPTR_MAX
+#define IS_BINNED_HEAP(heap) (BINNED_HEAP_MARKER == (heap)->lastAllocSlot)
+
+static uintptr_t floorLog2(uintptr_t value);
+static uintptr_t lowestSetBit(uint32_t value);
+static void binnedMapping(uintptr_t size, uintptr_t *fl, uintptr_t *sl);
+static void binnedInsertFreeBlock(struct J9Heap *heap, int64_t *block);
+static void binnedRemoveFreeBlock(struct J9Heap *heap, int64_t *block);
+static int64_t *binnedFindFreeBlock(struct J9Heap *heap, uintptr_t size);
+static void *binnedAllocate(struct J9Heap *heap, uintptr_t byteAmount);
+static void binnedFree(struct J9Heap *heap, void *address);
+static void *binnedReallocate(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, void *address, uintptr_t byteAmount);
+static void binnedGrow(struct J9Heap *heap, uintptr_t numSlots);
+
 /**
 * Initialize a contiguous region of memory at heapBase as a heap. The size of the heap is bounded by heapSize.
 *
 * @param[in] portLibrary The port library
 * @param[in] heapBase Base address of memory region.
 * @param[in] heapSize The size of the memory region to be used as a heap in bytes.
-* @param[in] heapFlags Flags that can affect the heap. Currently, this is not used and is there for future use, for example, to zero out memory. User must pass in zero.
+* @param[in] heapFlags Flags that can affect the heap. Pass OMRPORT_HEAP_FLAG_BINNED to use the size-binned suballocator, otherwise zero.
 *
 * @return pointer to an opaque struct representing the heap on success, NULL on failure.
 *
@@ -65,6 +109,10 @@ struct J9Heap {
 *
 * @note the algorithm used in this suballocator is based on the first-fit method in KNUTH, D. E. The Art of Computer Programming. Vol. 1: Fundamental Algorithms. (2nd edition). Addison-Wesley, Reading, Mass., 1973, Sect. 2.5.
 *
+* @note with OMRPORT_HEAP_FLAG_BINNED, free blocks are instead indexed by size in segregated free lists (similar to TLSF),
+* making omrheap_allocate and omrheap_free constant time at the cost of a larger header and a minimum block size of 2 slots.
+* The block layout is the same in both modes.
+*
 * @note due to the overhead of heap management, the actual available space consumed by the user is less than the size of the heap.
 */
 struct J9Heap *
@@ -74,6 +122,9 @@ omrheap_create(struct OMRPortLibrary *portLibrary, void *heapBase, uintptr_t hea
 	uintptr_t heapBaseDelta, adjustedHeapSize;
 	uintptr_t numSlots = 0;
 	uintptr_t blockSize = 0;
+	uintptr_t firstBlockSlot = sizeof(J9Heap) / sizeof(uint64_t);
+	uintptr_t managementOverhead = HEAP_MANAGEMENT_OVERHEAD;
+	BOOLEAN binned = OMR_ARE_ANY_BITS_SET(heapFlags, OMRPORT_HEAP_FLAG_BINNED);
 	uint64_t *baseSlot;
 
 	Trc_PRT_heap_port_omrheap_create_entry(heapBase, heapSize, heapFlags);
@@ -83,12 +134,17 @@ omrheap_create(struct OMRPortLibrary *portLibrary, void *heapBase, uintptr_t hea
 		return NULL;
 	}
 
+	if (binned) {
+		firstBlockSlot = BINNED_FIRST_BLOCK_SLOT;
+		managementOverhead = BINNED_HEAP_MANAGEMENT_OVERHEAD;
+	}
+
 	/* first we round up heapBase */
 	adjustedHeapBase = (struct J9Heap *)ALIGNMENT_ROUND_UP(heapBase);
 	heapBaseDelta = ((uintptr_t)adjustedHeapBase) - ((uintptr_t)heapBase);
 
 	/* check if we have enough space taking into account space wasted in rounding up heapBase */
-	if (heapSize <= (HEAP_MANAGEMENT_OVERHEAD + heapBaseDelta)) {
+	if (heapSize <= (managementOverhead + heapBaseDelta)) {
 		Trc_PRT_heap_port_omrheap_create_insufficient_heapSize_exit();
 		return NULL;
 	}
@@ -96,25 +152,38 @@ omrheap_create(struct OMRPortLibrary *portLibrary, void *heapBase, uintptr_t hea
 
 	/* now we round down the heap size */
 	adjustedHeapSize = ALIGNMENT_ROUND_DOWN(adjustedHeapSize);
-	if (adjustedHeapSize <= HEAP_MANAGEMENT_OVERHEAD) {
+	if (adjustedHeapSize <= managementOverhead) {
 		Trc_PRT_heap_port_omrheap_create_insufficient_heapSize_exit();
 		return NULL;
 	}
 
 	numSlots = adjustedHeapSize / sizeof(uint64_t);
-	blockSize = numSlots - (HEAP_MANAGEMENT_OVERHEAD / sizeof(uint64_t));
+	blockSize = numSlots - (managementOverhead / sizeof(uint64_t));
+	if (binned && (blockSize < BINNED_MIN_BLOCK_SIZE)) {
+		Trc_PRT_heap_port_omrheap_create_insufficient_heapSize_exit();
+		return NULL;
+	}
 
-	/* initialize the first 2 slots */
+	/* initialize the header */
 	adjustedHeapBase->heapSize = numSlots;
-	adjustedHeapBase->firstFreeBlock = (sizeof(J9Heap) / sizeof(uint64_t));
 
 	/* initialize the top and bottom padding slots */
 	baseSlot = (uint64_t *)adjustedHeapBase;
-	baseSlot[adjustedHeapBase->firstFreeBlock] = blockSize;
+	baseSlot[firstBlockSlot] = blockSize;
 	baseSlot[numSlots - 1] = blockSize;
 
-	adjustedHeapBase->lastAllocSlot = adjustedHeapBase->firstFreeBlock;
-	adjustedHeapBase->largestAllocSizeVisited = blockSize;
+	if (binned) {
+		/* the first-fit search state is unused, free blocks are only found through the bins */
+		adjustedHeapBase->firstFreeBlock = 0;
+		adjustedHeapBase->lastAllocSlot = BINNED_HEAP_MARKER;
+		adjustedHeapBase->largestAllocSizeVisited = 0;
+		memset(HEAP_BINS(adjustedHeapBase), 0, sizeof(J9HeapBins));
+		binnedInsertFreeBlock(adjustedHeapBase, (int64_t *)&baseSlot[firstBlockSlot]);
+	} else {
+		adjustedHeapBase->firstFreeBlock = firstBlockSlot;
+		adjustedHeapBase->lastAllocSlot = firstBlockSlot;
+		adjustedHeapBase->largestAllocSizeVisited = blockSize;
+	}
 
 	Trc_PRT_heap_port_omrheap_create_exit(adjustedHeapBase);
 
@@ -152,6 +221,10 @@ omrheap_allocate(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, uintpt
 
 	Trc_PRT_heap_port_omrheap_allocate_entry(heap, byteAmount);
 
+	if (IS_BINNED_HEAP(heap)) {
+		return binnedAllocate(heap, byteAmount);
+	}
+
 	/* firstFreeBlock is 0 means no free space left on the heap */
 	if (0 == firstFreeBlock) {
 		Trc_PRT_heap_port_omrheap_allocate_heap_full_exit();
@@ -302,6 +375,12 @@ omrheap_free(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, void *addr
 		return;
 	}
 
+	if (IS_BINNED_HEAP(heap)) {
+		binnedFree(heap, address);
+		Trc_PRT_heap_port_omrheap_free_exit();
+		return;
+	}
+
 	thisBlockTopPadding = ((int64_t *)address) - 1;
 
 	/*assertion to check we have an occupied block*/
@@ -395,6 +474,12 @@ omrheap_reallocate(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, void
 		return address;
 	}
 
+	if (IS_BINNED_HEAP(heap)) {
+		address = binnedReallocate(portLibrary, heap, address, byteAmount);
+		Trc_PRT_heap_port_omrheap_reallocate_exit(address);
+		return address;
+	}
+
 	thisBlockTopPadding = ((int64_t *)address) - 1;
 	thisBlockSize = -thisBlockTopPadding[0];
 	Assert_PRT_true(thisBlockSize > 0);
@@ -603,6 +688,12 @@ omrheap_grow(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, uintptr_t
 		Trc_PRT_heap_port_omrheap_grow_insufficient_heapSize_exit();
 		return FALSE;
 	}
+	if (IS_BINNED_HEAP(heap)) {
+		binnedGrow(heap, numSlots);
+		Trc_PRT_heap_port_omrheap_grow_exit(result);
+		return result;
+	}
+
 	/*
 	 * Merge the new free slots with the free slots (if there is any) at the end of the current heap.
 	 * Initialize the header and tail of the newly added slots.
@@ -633,3 +724,421 @@ omrheap_grow(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, uintptr_t
 	Trc_PRT_heap_port_omrheap_grow_exit(result);
 	return result;
 }
+
+/**
+ * Returns the index of the most significant set bit of a non-zero value.
+ */
+static uintptr_t
+floorLog2(uintptr_t value)
+{
+	uintptr_t result = 0;
+
+#if defined(OMR_ENV_DATA64)
+	if (value >= ((uintptr_t)1 << 32)) {
+		value >>= 32;
+		result += 32;
+	}
+#endif /* defined(OMR_ENV_DATA64) */
+	if (value >= ((uintptr_t)1 << 16)) {
+		value >>= 16;
+		result += 16;
+	}
+	if (value >= ((uintptr_t)1 << 8)) {
+		value >>= 8;
+		result += 8;
+	}
+	if (value >= ((uintptr_t)1 << 4)) {
+		value >>= 4;
+		result += 4;
+	}
+	if (value >= ((uintptr_t)1 << 2)) {
+		value >>= 2;
+		result += 2;
+	}
+	if (value >= ((uintptr_t)1 << 1)) {
+		result += 1;
+	}
+	return result;
+}
+
+/**
+ * Returns the index of the least significant set bit of a non-zero value.
+ */
+static uintptr_t
+lowestSetBit(uint32_t value)
+{
+	uintptr_t result = 0;
+
+	if (0 == (value & 0xFFFF)) {
+		value >>= 16;
+		result += 16;
+	}
+	if (0 == (value & 0xFF)) {
+		value >>= 8;
+		result += 8;
+	}
+	if (0 == (value & 0xF)) {
+		value >>= 4;
+		result += 4;
+	}
+	if (0 == (value & 0x3)) {
+		value >>= 2;
+		result += 2;
+	}
+	if (0 == (value & 0x1)) {
+		result += 1;
+	}
+	return result;
+}
+
+/**
+ * Map a block size in slots to the first and second level index of the bin holding blocks of that size.
+ */
+static void
+binnedMapping(uintptr_t size, uintptr_t *fl, uintptr_t *sl)
+{
+	if (size < J9HEAP_BIN_SL_COUNT) {
+		*fl = 0;
+		*sl = size;
+	} else {
+		uintptr_t log2 = floorLog2(size);
+
+		*fl = log2 - J9HEAP_BIN_SL_SHIFT + 1;
+		*sl = (size >> (log2 - J9HEAP_BIN_SL_SHIFT)) - J9HEAP_BIN_SL_COUNT;
+		if (*fl >= J9HEAP_BIN_FL_COUNT) {
+			*fl = J9HEAP_BIN_FL_COUNT - 1;
+			*sl = J9HEAP_BIN_SL_COUNT - 1;
+		}
+	}
+}
+
+/**
+ * Push a free block onto the front of its bin. The block padding must already hold the block size.
+ */
+static void
+binnedInsertFreeBlock(struct J9Heap *heap, int64_t *block)
+{
+	J9HeapBins *bins = HEAP_BINS(heap);
+	int64_t *baseSlot = (int64_t *)heap;
+	uintptr_t blockSlot = GET_SLOT_NUMBER_FROM(heap, block);
+	uintptr_t fl = 0;
+	uintptr_t sl = 0;
+	uintptr_t head = 0;
+
+	Assert_PRT_true(block[0] >= BINNED_MIN_BLOCK_SIZE);
+
+	binnedMapping((uintptr_t)block[0], &fl, &sl);
+	head = bins->freeLists[fl][sl];
+	BINNED_NEXT_FREE(block) = (int64_t)head;
+	BINNED_PREVIOUS_FREE(block) = 0;
+	if (0 != head) {
+		BINNED_PREVIOUS_FREE(&baseSlot[head]) = (int64_t)blockSlot;
+	}
+	bins->freeLists[fl][sl] = blockSlot;
+	bins->flBitmap |= (uint32_t)1 << fl;
+	bins->slBitmap[fl] |= (uint32_t)1 << sl;
+}
+
+/**
+ * Unlink a free block from its bin. The block padding must still hold the size the block was inserted with.
+ */
+static void
+binnedRemoveFreeBlock(struct J9Heap *heap, int64_t *block)
+{
+	J9HeapBins *bins = HEAP_BINS(heap);
+	int64_t *baseSlot = (int64_t *)heap;
+	uintptr_t next = (uintptr_t)BINNED_NEXT_FREE(block);
+	uintptr_t previous = (uintptr_t)BINNED_PREVIOUS_FREE(block);
+
+	if (0 != next) {
+		BINNED_PREVIOUS_FREE(&baseSlot[next]) = (int64_t)previous;
+	}
+	if (0 != previous) {
+		BINNED_NEXT_FREE(&baseSlot[previous]) = (int64_t)next;
+	} else {
+		uintptr_t fl = 0;
+		uintptr_t sl = 0;
+
+		binnedMapping((uintptr_t)block[0], &fl, &sl);
+		bins->freeLists[fl][sl] = next;
+		if (0 == next) {
+			bins->slBitmap[fl] &= ~((uint32_t)1 << sl);
+			if (0 == bins->slBitmap[fl]) {
+				bins->flBitmap &= ~((uint32_t)1 << fl);
+			}
+		}
+	}
+}
+
+/**
+ * Find a free block of at least size slots, or NULL if there is none.
+ */
+static int64_t *
+binnedFindFreeBlock(struct J9Heap *heap, uintptr_t size)
+{
+	J9HeapBins *bins = HEAP_BINS(heap);
+	int64_t *baseSlot = (int64_t *)heap;
+	uintptr_t searchSize = size;
+	uintptr_t fl = 0;
+	uintptr_t sl = 0;
+	uintptr_t cursor = 0;
+	uint32_t slMap = 0;
+
+	/* Round the request up to the next bin boundary so that any block of the bin found below fits. */
+	if (size >= J9HEAP_BIN_SL_COUNT) {
+		searchSize += ((uintptr_t)1 << (floorLog2(size) - J9HEAP_BIN_SL_SHIFT)) - 1;
+	}
+	binnedMapping(searchSize, &fl, &sl);
+
+	slMap = bins->slBitmap[fl] & (~(uint32_t)0 << sl);
+	if ((0 == slMap) && ((fl + 1) < J9HEAP_BIN_FL_COUNT)) {
+		uint32_t flMap = bins->flBitmap & (~(uint32_t)0 << (fl + 1));
+
+		if (0 != flMap) {
+			fl = lowestSetBit(flMap);
+			slMap = bins->slBitmap[fl];
+		}
+	}
+	if (0 != slMap) {
+		int64_t *block = NULL;
+
+		sl = lowestSetBit(slMap);
+		block = &baseSlot[bins->freeLists[fl][sl]];
+		/* only the last bin holds blocks that may be smaller than its lower bound */
+		if ((uintptr_t)block[0] >= size) {
+			return block;
+		}
+	}
+
+	/* Nothing in the larger bins; the bin the request itself maps to may still hold a block that is just large enough. */
+	binnedMapping(size, &fl, &sl);
+	cursor = bins->freeLists[fl][sl];
+	while (0 != cursor) {
+		int64_t *block = &baseSlot[cursor];
+
+		if ((uintptr_t)block[0] >= size) {
+			return block;
+		}
+		cursor = (uintptr_t)BINNED_NEXT_FREE(block);
+	}
+	return NULL;
+}
+
+/**
+ * omrheap_allocate for heaps created with OMRPORT_HEAP_FLAG_BINNED.
+ */
+static void *
+binnedAllocate(struct J9Heap *heap, uintptr_t byteAmount)
+{
+	uintptr_t adjustedRequestSize = BINNED_MIN_BLOCK_SIZE;
+	int64_t *blockPaddingCursor = NULL;
+	int64_t chunkSize = 0;
+	int64_t newSize = 0;
+	int64_t residualSize = 0;
+
+	if (byteAmount > (BINNED_MIN_BLOCK_SIZE * sizeof(uint64_t))) {
+		/* round up byteAmount to nearest 8-aligned value and calculate num of slots required */
+		adjustedRequestSize = (ALIGNMENT_ROUND_UP(byteAmount)) / sizeof(uint64_t);
+		/* In case of arithmetic overflow, return NULL. */
+		if (byteAmount > (adjustedRequestSize * sizeof(uint64_t))) {
+			Trc_PRT_heap_port_omrheap_allocate_arithmetic_overflow(byteAmount);
+			Trc_PRT_heap_port_omrheap_allocate_exit(NULL);
+			return NULL;
+		}
+	}
+
+	if (adjustedRequestSize > heap->heapSize) {
+		Trc_PRT_heap_port_omrheap_allocate_cannot_satisfy_reuqest_exit();
+		return NULL;
+	}
+
+	blockPaddingCursor = binnedFindFreeBlock(heap, adjustedRequestSize);
+	if (NULL == blockPaddingCursor) {
+		Trc_PRT_heap_port_omrheap_allocate_cannot_satisfy_reuqest_exit();
+		return NULL;
+	}
+
+	chunkSize = blockPaddingCursor[0];
+	binnedRemoveFreeBlock(heap, blockPaddingCursor);
+
+	newSize = (int64_t)adjustedRequestSize;
+	residualSize = chunkSize - newSize;
+	/* only split off a new free block if it has room for its padding and the free list links */
+	if (residualSize >= (2 + BINNED_MIN_BLOCK_SIZE)) {
+		int64_t *residualBlock = &blockPaddingCursor[newSize + 2];
+
+		blockPaddingCursor[0] = -newSize;
+		blockPaddingCursor[newSize + 1] = -newSize;
+		residualSize -= 2;
+		residualBlock[0] = residualSize;
+		residualBlock[residualSize + 1] = residualSize;
+		binnedInsertFreeBlock(heap, residualBlock);
+	} else {
+		blockPaddingCursor[0] = -chunkSize;
+		blockPaddingCursor[chunkSize + 1] = -chunkSize;
+	}
+
+	Trc_PRT_heap_port_omrheap_allocate_exit(&blockPaddingCursor[1]);
+	return &blockPaddingCursor[1];
+}
+
+/**
+ * omrheap_free for heaps created with OMRPORT_HEAP_FLAG_BINNED. Coalesces with free neighbours before re-binning.
+ */
+static void
+binnedFree(struct J9Heap *heap, void *address)
+{
+	int64_t *thisBlockTopPadding = ((int64_t *)address) - 1;
+	int64_t thisBlockSize = 0;
+
+	/*assertion to check we have an occupied block*/
+	Assert_PRT_true(thisBlockTopPadding[0] < 0);
+
+	thisBlockSize = -thisBlockTopPadding[0];
+
+	if (GET_SLOT_NUMBER_FROM(heap, thisBlockTopPadding) != BINNED_FIRST_BLOCK_SLOT) {
+		int64_t *previousBlockBottomPadding = &thisBlockTopPadding[-1];
+		int64_t previousBlockSize = *previousBlockBottomPadding;
+
+		if (previousBlockSize > 0) {
+			thisBlockTopPadding = &previousBlockBottomPadding[-previousBlockSize - 1];
+			binnedRemoveFreeBlock(heap, thisBlockTopPadding);
+			thisBlockSize += (previousBlockSize + 2);
+		}
+	}
+
+	if (GET_SLOT_NUMBER_FROM(heap, &thisBlockTopPadding[thisBlockSize + 1]) != (heap->heapSize - 1)) {
+		int64_t *nextBlockTopPadding = &thisBlockTopPadding[thisBlockSize + 2];
+		int64_t nextBlockSize = nextBlockTopPadding[0];
+
+		if (nextBlockSize > 0) {
+			binnedRemoveFreeBlock(heap, nextBlockTopPadding);
+			thisBlockSize += (nextBlockSize + 2);
+		}
+	}
+
+	thisBlockTopPadding[0] = thisBlockSize;
+	thisBlockTopPadding[thisBlockSize + 1] = thisBlockSize;
+	binnedInsertFreeBlock(heap, thisBlockTopPadding);
+}
+
+/**
+ * omrheap_reallocate for heaps created with OMRPORT_HEAP_FLAG_BINNED, for a non-NULL address.
+ */
+static void *
+binnedReallocate(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, void *address, uintptr_t byteAmount)
+{
+	int64_t *thisBlockTopPadding = ((int64_t *)address) - 1;
+	int64_t *nextBlockTopPadding = NULL;
+	int64_t thisBlockSize = -thisBlockTopPadding[0];
+	int64_t nextBlockSize = 0;
+	int64_t adjustedRequestSize = BINNED_MIN_BLOCK_SIZE;
+	int64_t growAmount = 0;
+
+	Assert_PRT_true(thisBlockSize > 0);
+	Assert_PRT_true(thisBlockSize == -thisBlockTopPadding[thisBlockSize + 1]);
+
+	if (byteAmount > (BINNED_MIN_BLOCK_SIZE * sizeof(uint64_t))) {
+		/* Round up byteAmount to nearest 8-aligned value and calculate number of slots required. */
+		adjustedRequestSize = (int64_t)(ALIGNMENT_ROUND_UP(byteAmount)) / sizeof(uint64_t);
+		/* In case of arithmetic overflow, return NULL. */
+		if (byteAmount > (adjustedRequestSize * sizeof(uint64_t))) {
+			Trc_PRT_heap_port_omrheap_reallocate_arithmetic_overflow(byteAmount);
+			return NULL;
+		}
+	}
+
+	growAmount = adjustedRequestSize - thisBlockSize;
+	if (0 == growAmount) {
+		Trc_PRT_heap_port_omrheap_reallocate_no_realloc_necessary();
+		return address;
+	}
+
+	if (GET_SLOT_NUMBER_FROM(heap, &thisBlockTopPadding[thisBlockSize + 1]) != (heap->heapSize - 1)) {
+		nextBlockTopPadding = &thisBlockTopPadding[thisBlockSize + 2];
+		nextBlockSize = nextBlockTopPadding[0];
+	}
+
+	if (growAmount > 0) {
+		if ((nextBlockSize > 0) && ((nextBlockSize + 2) >= growAmount)) {
+			int64_t residualSize = nextBlockSize + 2 - growAmount;
+
+			Trc_PRT_heap_port_omrheap_reallocate_grow(growAmount, residualSize);
+			binnedRemoveFreeBlock(heap, nextBlockTopPadding);
+			if (residualSize >= (2 + BINNED_MIN_BLOCK_SIZE)) {
+				thisBlockSize += growAmount;
+				nextBlockTopPadding = &thisBlockTopPadding[thisBlockSize + 2];
+				nextBlockSize = residualSize - 2;
+				nextBlockTopPadding[0] = nextBlockSize;
+				nextBlockTopPadding[nextBlockSize + 1] = nextBlockSize;
+				binnedInsertFreeBlock(heap, nextBlockTopPadding);
+			} else {
+				/* Too little left over for a free block, consume the next block completely. */
+				thisBlockSize += nextBlockSize + 2;
+			}
+			thisBlockTopPadding[0] = -thisBlockSize;
+			thisBlockTopPadding[thisBlockSize + 1] = -thisBlockSize;
+		} else {
+			/* If there is not enough free space following, we must relocate. */
+			void *newAddress = NULL;
+
+			Trc_PRT_heap_port_omrheap_reallocate_relocating();
+			newAddress = binnedAllocate(heap, byteAmount);
+			if (NULL != newAddress) {
+				memcpy(newAddress, address, (size_t)(thisBlockSize * sizeof(uint64_t)));
+				binnedFree(heap, address);
+			}
+			address = newAddress;
+		}
+	} else {
+		Trc_PRT_heap_port_omrheap_reallocate_shrink(growAmount);
+
+		/* NOTE: growAmount is negative. */
+		if (nextBlockSize > 0) {
+			/* Next block is free, so add the extra space to it. */
+			binnedRemoveFreeBlock(heap, nextBlockTopPadding);
+			nextBlockSize -= growAmount;
+		} else if (-growAmount >= (2 + BINNED_MIN_BLOCK_SIZE)) {
+			/* Split the released space into a new free block. */
+			nextBlockSize = -growAmount - 2;
+		} else {
+			return address;
+		}
+		thisBlockSize += growAmount;
+		thisBlockTopPadding[0] = -thisBlockSize;
+		thisBlockTopPadding[thisBlockSize + 1] = -thisBlockSize;
+		nextBlockTopPadding = &thisBlockTopPadding[thisBlockSize + 2];
+		nextBlockTopPadding[0] = nextBlockSize;
+		nextBlockTopPadding[nextBlockSize + 1] = nextBlockSize;
+		binnedInsertFreeBlock(heap, nextBlockTopPadding);
+	}
+
+	return address;
+}
+
+/**
+ * omrheap_grow for heaps created with OMRPORT_HEAP_FLAG_BINNED: append numSlots slots, merging them with a free tail block.
+ */
+static void
+binnedGrow(struct J9Heap *heap, uintptr_t numSlots)
+{
+	uintptr_t heapSize = heap->heapSize;
+	int64_t *baseSlot = (int64_t *)heap;
+	int64_t tailSize = baseSlot[heapSize - 1];
+	int64_t *newBlockTopPadding = NULL;
+	int64_t newBlockSize = 0;
+
+	if (0 > tailSize) {
+		newBlockTopPadding = &baseSlot[heapSize];
+		newBlockSize = numSlots - 2;
+	} else {
+		newBlockTopPadding = &baseSlot[heapSize - tailSize - 2];
+		binnedRemoveFreeBlock(heap, newBlockTopPadding);
+		newBlockSize = numSlots + tailSize;
+	}
+	newBlockTopPadding[0] = newBlockSize;
+	baseSlot[heapSize + numSlots - 1] = newBlockSize;
+
+	heap->heapSize = heapSize + numSlots;
+	binnedInsertFreeBlock(heap, newBlockTopPadding);
+}
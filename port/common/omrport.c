@@ -56,6 +56,7 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrtime_hires_clock, /* time_hires_clock */
 	omrtime_hires_frequency, /* time_hires_frequency */
 	omrtime_hires_delta, /* time_hires_delta */
+	omrtime_fast_nano_time, /* time_fast_nano_time */
 	omrsysinfo_startup, /* sysinfo_startup */
 	omrsysinfo_shutdown, /* sysinfo_shutdown */
 	omrsysinfo_process_exists, /* sysinfo_process_exists */
@@ -114,6 +115,15 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrfile_fstat, /* file_fstat */
 	omrfile_stat, /* file_stat */
 	omrfile_stat_filesystem, /* file_stat_filesystem */
+	omrfile_preadv, /* file_preadv */
+	omrfile_pwritev, /* file_pwritev */
+	omrfile_fadvise, /* file_fadvise */
+	omrfile_fallocate, /* file_fallocate */
+	omrfile_readahead, /* file_readahead */
+	omrfile_async_create, /* file_async_create */
+	omrfile_async_destroy, /* file_async_destroy */
+	omrfile_async_submit, /* file_async_submit */
+	omrfile_async_complete, /* file_async_complete */
 	omrfile_blockingasync_open, /* file_blockingasync_open */
 	omrfile_blockingasync_close, /* file_blockingasync_close */
 	omrfile_blockingasync_read, /* file_blockingasync_read */
@@ -335,6 +345,8 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrsysinfo_cgroup_subsystem_iterator_metricKey, /* sysinfo_cgroup_subsystem_iterator_metricKey */
 	omrsysinfo_cgroup_subsystem_iterator_next, /* sysinfo_cgroup_subsystem_iterator_next */
 	omrsysinfo_cgroup_subsystem_iterator_destroy, /* sysinfo_cgroup_subsystem_iterator_destroy */
+	omrsysinfo_get_resource_snapshot, /* sysinfo_get_resource_snapshot */
+	omrsysinfo_refresh_resource_snapshot, /* sysinfo_refresh_resource_snapshot */
 	omrport_init_library, /* port_init_library */
 	omrport_startup_library, /* port_startup_library */
 	omrport_create_library, /* port_create_library */
@@ -399,6 +411,18 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrsock_getsockopt_int, /* sock_getsockopt_int */
 	omrsock_getsockopt_linger, /* sock_getsockopt_linger */
 	omrsock_getsockopt_timeval, /* sock_getsockopt_timeval */
+	omrsock_eventloop_create, /* sock_eventloop_create */
+	omrsock_eventloop_destroy, /* sock_eventloop_destroy */
+	omrsock_eventloop_add, /* sock_eventloop_add */
+	omrsock_eventloop_modify, /* sock_eventloop_modify */
+	omrsock_eventloop_remove, /* sock_eventloop_remove */
+	omrsock_eventloop_timer_add, /* sock_eventloop_timer_add */
+	omrsock_eventloop_timer_cancel, /* sock_eventloop_timer_cancel */
+	omrsock_eventloop_wait, /* sock_eventloop_wait */
+	omrsock_sendmsg, /* sock_sendmsg */
+	omrsock_recvmsg, /* sock_recvmsg */
+	omrsock_sendfile, /* sock_sendfile */
+	omrsock_get_zerocopy_completion, /* sock_get_zerocopy_completion */
 #if defined(OMR_OPT_CUDA)
 	NULL, /* cuda_configData */
 	omrcuda_startup, /* cuda_startup */
@@ -847,3 +847,249 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
 }
+
+/**
+ * Create an event loop, which reports the readiness of the sockets added to it and the
+ * expiry of its timers without scanning every socket on each call, unlike @ref omrsock_poll
+ * and @ref omrsock_select.
+ *
+ * The event loop is backed by epoll on Linux and by kqueue on OSX. It may be used by one
+ * thread at a time.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[out] loop Pointer to the new event loop.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Destroy an event loop and cancel its timers. The sockets added to it are not closed.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in,out] loop Pointer to the event loop, set to NULL on success.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Add a socket to an event loop. A socket may be added to one event loop at a time, and
+ * must be removed with @ref omrsock_eventloop_remove before it is closed.
+ *
+ * Events are level triggered unless OMRSOCK_EVENT_EDGE_TRIGGERED is given, in which case a
+ * socket is reported once each time it becomes ready, and the caller must read or write until
+ * the operation would block before waiting again. With OMRSOCK_EVENT_ONESHOT the socket is
+ * reported once and then disabled until it is rearmed with @ref omrsock_eventloop_modify.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock The socket, normally non-blocking.
+ * @param[in] events The events to wait for, a combination of:
+ * \arg OMRSOCK_EVENT_READ
+ * \arg OMRSOCK_EVENT_WRITE
+ * \arg OMRSOCK_EVENT_EDGE_TRIGGERED
+ * \arg OMRSOCK_EVENT_ONESHOT
+ * @param[in] userData Returned with the events of the socket.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Change the events a socket of an event loop is waiting for, and its userData.
+ * See @ref omrsock_eventloop_add.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock The socket, already added to the event loop.
+ * @param[in] events The events to wait for.
+ * @param[in] userData Returned with the events of the socket.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Remove a socket from an event loop.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock The socket.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Add a timer to an event loop. @ref omrsock_eventloop_wait reports an OMRSOCK_EVENT_TIMER
+ * event with a NULL socket once the timer expires.
+ *
+ * A timer with a period of 0 fires once and is then released, it must not be cancelled
+ * afterwards. A periodic timer fires every periodMillis after its first expiry until it
+ * is cancelled.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] delayMillis Milliseconds until the first expiry.
+ * @param[in] periodMillis Milliseconds between later expiries, 0 to fire once.
+ * @param[in] userData Returned with the events of the timer.
+ * @param[out] timer Pointer to the new timer.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_timer_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, uint64_t delayMillis, uint64_t periodMillis, void *userData, omrsock_timer_t *timer)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Cancel and release a timer of an event loop.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in,out] timer Pointer to the timer, set to NULL on success.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_timer_cancel(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_timer_t *timer)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Wait for the sockets of an event loop to become ready or for its timers to expire,
+ * and retrieve up to maxEvents events at once. Expired timers are reported first.
+ *
+ * The events of a socket are a combination of OMRSOCK_EVENT_READ, OMRSOCK_EVENT_WRITE,
+ * OMRSOCK_EVENT_ERROR and OMRSOCK_EVENT_HANGUP. On OSX a socket waiting for both reading
+ * and writing may be reported in two events.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[out] events Array of at least maxEvents OMRSockEvent structures to fill in.
+ * @param[in] maxEvents The size of the events array.
+ * @param[in] timeoutMs Milliseconds to wait when nothing is ready, 0 to return immediately
+ * and -1 to wait until an event occurs.
+ *
+ * @return the number of events filled in, 0 on timeout or interruption, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Sends data gathered from several buffers to a connected socket in a single call.
+ * As with @ref omrsock_send, fewer bytes than the total length of the buffers may be
+ * sent, and the call blocks when the socket is blocking and no buffer space is available.
+ *
+ * With OMRSOCK_MSG_ZEROCOPY the kernel transmits directly from the buffers instead of
+ * copying them, and the buffers must not be modified until the send has completed, see
+ * @ref omrsock_get_zerocopy_completion. OMRSOCK_SO_ZEROCOPY must first be enabled on the
+ * socket with @ref omrsock_setsockopt_int. Each successful zero-copy send is numbered,
+ * starting at 0 for the first zero-copy send on the socket.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock Pointer to the socket to send on.
+ * @param[in] iov The buffers to send, in order.
+ * @param[in] iovcnt The number of buffers, at most the platform's IOV_MAX.
+ * @param[in] flags A combination of OMRSOCK_MSG_DONTWAIT and OMRSOCK_MSG_ZEROCOPY.
+ *
+ * @return the total number of bytes sent if no error occurred, otherwise return an error.
+ * OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM is returned for OMRSOCK_MSG_ZEROCOPY on
+ * platforms without zero-copy sends.
+ */
+intptr_t
+omrsock_sendmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Receives data from a connected socket, scattering it over several buffers in a single call.
+ * The buffers are filled in order.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock Pointer to the socket to read on.
+ * @param[in] iov The buffers to fill, in order.
+ * @param[in] iovcnt The number of buffers, at most the platform's IOV_MAX.
+ * @param[in] flags A combination of OMRSOCK_MSG_DONTWAIT and OMRSOCK_MSG_WAITALL.
+ * With OMRSOCK_MSG_WAITALL a blocking socket waits until all the buffers are full,
+ * unless the connection is closed or an error occurs.
+ *
+ * @return the number of bytes received if no error occurred. If the connection has been
+ * gracefully closed, return 0. Otherwise, return an error.
+ */
+intptr_t
+omrsock_recvmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Sends part of a file to a connected socket. Where the platform supports it the data is
+ * transferred by the kernel without being copied through user space. The file position of
+ * fd is not used or changed.
+ *
+ * On a blocking socket, the call returns once count bytes have been sent or the end of
+ * the file is reached. On a non-blocking socket, it returns the bytes sent so far once
+ * the socket would block, or an error if nothing could be sent.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock Pointer to the socket to send on.
+ * @param[in] fd A file descriptor opened for reading with @ref omrfile_open.
+ * @param[in,out] offset The file offset to start sending from, advanced by the bytes sent.
+ * @param[in] count The number of bytes to send.
+ *
+ * @return the number of bytes sent if no error occurred, otherwise return an error.
+ */
+int64_t
+omrsock_sendfile(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, int64_t count)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Retrieve a completion notification for the zero-copy sends of a socket, see
+ * @ref omrsock_sendmsg. A notification covers the range of sends firstSend to lastSend
+ * inclusive, whose buffers may be reused. The call does not block. Pending notifications
+ * make the socket report OMRSOCK_POLLERR or OMRSOCK_EVENT_ERROR.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock Pointer to the socket the sends were made on.
+ * @param[out] firstSend The number of the first completed send.
+ * @param[out] lastSend The number of the last completed send.
+ * @param[out] copied TRUE if the kernel copied the data instead, for example on loopback.
+ * Zero-copy sends that are always copied cost more than ordinary sends.
+ *
+ * @return 1 if a notification was retrieved, 0 if none is pending, otherwise return an error.
+ */
+int32_t
+omrsock_get_zerocopy_completion(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *firstSend, uint32_t *lastSend, BOOLEAN *copied)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
@@ -1178,3 +1178,40 @@ omrsysinfo_cgroup_subsystem_iterator_destroy(struct OMRPortLibrary *portLibrary,
 {
 	return;
 }
+
+/**
+ * Retrieve the latest snapshot of the resources available to the process: the online and
+ * usable CPUs, the cgroup CPU quota and memory limit, and the memory pressure (PSI) of the cgroup.
+ *
+ * The first call takes the snapshot and starts a background thread that takes it again
+ * periodically, so later calls only copy the cached values and don't read any files. Use it
+ * where these values are queried often, such as heuristics choosing thread counts and heap
+ * sizes. The values may be up to one refresh interval old; a change is visible as a new
+ * generation. The background thread exits when the snapshot hasn't been read for several
+ * refresh intervals, and the next call takes the snapshot again and restarts it.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[out] snapshot The snapshot to fill in.
+ *
+ * @return 0 on success, otherwise a negative error code.
+ */
+int32_t
+omrsysinfo_get_resource_snapshot(struct OMRPortLibrary *portLibrary, struct OMRResourceSnapshot *snapshot)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Take the snapshot returned by @ref omrsysinfo_get_resource_snapshot again now, rather than
+ * waiting for the background thread. Call it after a change to the resource limits is known
+ * to have happened.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return 0 on success, otherwise a negative error code.
+ */
+int32_t
+omrsysinfo_refresh_resource_snapshot(struct OMRPortLibrary *portLibrary)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
@@ -156,6 +156,26 @@ omrtime_current_time_nanos(struct OMRPortLibrary *portLibrary, uintptr_t *succes
 {
 	return 0;
 }
+/**
+ * Query OS for timestamp.
+ * Retrieve the current value of a monotonic clock in nanoseconds, favouring a low cost per call
+ * over precision. Use it to time short intervals on hot paths.
+ *
+ * Values may drift from @ref omrtime_nano_time by a small fraction of the elapsed time, so they
+ * should only be compared with other values returned by this function.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return time value in nanoseconds. 0 or -ve numbers may be returned.
+ *
+ * @note The default implementation returns @ref omrtime_nano_time.
+ */
+int64_t
+omrtime_fast_nano_time(struct OMRPortLibrary *portLibrary)
+{
+	return portLibrary->time_nano_time(portLibrary);
+}
+
 /**
  * PortLibrary shutdown.
  *
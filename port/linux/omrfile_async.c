@@ -0,0 +1,442 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Completion-based asynchronous file I/O using io_uring
+ */
+
+#define _GNU_SOURCE
+
+#include "omrfile_async_pool.h"
+#include "omrportpriv.h"
+#include "ut_omrport.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if !defined(OMRZTPF) && defined(__NR_io_uring_setup) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define OMR_FILE_ASYNC_IO_URING
+#endif /* __has_include(<linux/io_uring.h>) */
+#endif /* !defined(OMRZTPF) && defined(__NR_io_uring_setup) && defined(__has_include) */
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+/**
+ * The submission and completion rings shared with the kernel. Only the thread using
+ * the context writes the submission tail and completion head, the kernel writes the others.
+ */
+typedef struct OMRFileAsyncRing {
+	int ringFD;
+	void *sqMapping;
+	size_t sqMappingSize;
+	void *cqMapping; /**< same as sqMapping if the kernel maps both rings together */
+	size_t cqMappingSize;
+	struct io_uring_sqe *sqes;
+	size_t sqesSize;
+	uint32_t *sqHead;
+	uint32_t *sqTail;
+	uint32_t sqMask;
+	uint32_t sqEntries;
+	uint32_t *sqArray;
+	uint32_t *cqHead;
+	uint32_t *cqTail;
+	uint32_t cqMask;
+	struct io_uring_cqe *cqes;
+} OMRFileAsyncRing;
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+struct OMRFileAsyncContext {
+	BOOLEAN useRing;
+	uint32_t queueDepth;
+	uint32_t inflightCount;
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	OMRFileAsyncRing ring;
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+	OMRFileAsyncPool pool;
+};
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+static int32_t ringStartup(OMRFileAsyncRing *ring, uint32_t queueDepth);
+static void ringShutdown(OMRFileAsyncRing *ring);
+static int32_t ringSubmit(struct OMRFileAsyncContext *context, OMRFileAsyncRequest **requests, uint32_t count);
+static int32_t ringComplete(struct OMRFileAsyncContext *context, OMRFileAsyncRequest **completed, uint32_t maxCompleted, uint32_t minCompleted);
+static intptr_t ringError(int32_t errorCode);
+
+/**
+ * Map an errno value reported in a completion to a portable error code.
+ */
+static intptr_t
+ringError(int32_t errorCode)
+{
+	switch (errorCode) {
+	case EBADF:
+		return OMRPORT_ERROR_FILE_BADF;
+	case EINVAL:
+		return OMRPORT_ERROR_FILE_INVAL;
+	case EFAULT:
+		return OMRPORT_ERROR_FILE_EFAULT;
+	case EINTR:
+		return OMRPORT_ERROR_FILE_EINTR;
+	case EAGAIN:
+		return OMRPORT_ERROR_FILE_EAGAIN;
+	case EIO:
+		return OMRPORT_ERROR_FILE_IO;
+	case ENOSPC:
+		return OMRPORT_ERROR_FILE_DISKFULL;
+	case EOVERFLOW:
+		return OMRPORT_ERROR_FILE_OVERFLOW;
+	case ESPIPE:
+		return OMRPORT_ERROR_FILE_SPIPE;
+	case EISDIR:
+		return OMRPORT_ERROR_FILE_ISDIR;
+	default:
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+}
+
+/**
+ * Create an io_uring with room for queueDepth submissions and map its rings.
+ *
+ * @return 0 on success, the errno value on failure.
+ */
+static int32_t
+ringStartup(OMRFileAsyncRing *ring, uint32_t queueDepth)
+{
+	struct io_uring_params params;
+	uint8_t *sq = NULL;
+	uint8_t *cq = NULL;
+	int32_t rc = 0;
+
+	memset(ring, 0, sizeof(*ring));
+	memset(&params, 0, sizeof(params));
+
+	ring->ringFD = (int)syscall(__NR_io_uring_setup, queueDepth, &params);
+	if (ring->ringFD < 0) {
+		return errno;
+	}
+
+	ring->sqMappingSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+	ring->cqMappingSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+	if (OMR_ARE_ANY_BITS_SET(params.features, IORING_FEAT_SINGLE_MMAP)) {
+		ring->sqMappingSize = OMR_MAX(ring->sqMappingSize, ring->cqMappingSize);
+		ring->cqMappingSize = ring->sqMappingSize;
+	}
+
+	ring->sqMapping = mmap(NULL, ring->sqMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFD, IORING_OFF_SQ_RING);
+	if (MAP_FAILED == ring->sqMapping) {
+		ring->sqMapping = NULL;
+		goto fail;
+	}
+	if (OMR_ARE_ANY_BITS_SET(params.features, IORING_FEAT_SINGLE_MMAP)) {
+		ring->cqMapping = ring->sqMapping;
+	} else {
+		ring->cqMapping = mmap(NULL, ring->cqMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFD, IORING_OFF_CQ_RING);
+		if (MAP_FAILED == ring->cqMapping) {
+			ring->cqMapping = NULL;
+			goto fail;
+		}
+	}
+	ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = (struct io_uring_sqe *)mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFD, IORING_OFF_SQES);
+	if (MAP_FAILED == (void *)ring->sqes) {
+		ring->sqes = NULL;
+		goto fail;
+	}
+
+	sq = (uint8_t *)ring->sqMapping;
+	ring->sqHead = (uint32_t *)(sq + params.sq_off.head);
+	ring->sqTail = (uint32_t *)(sq + params.sq_off.tail);
+	ring->sqMask = *(uint32_t *)(sq + params.sq_off.ring_mask);
+	ring->sqEntries = params.sq_entries;
+	ring->sqArray = (uint32_t *)(sq + params.sq_off.array);
+
+	cq = (uint8_t *)ring->cqMapping;
+	ring->cqHead = (uint32_t *)(cq + params.cq_off.head);
+	ring->cqTail = (uint32_t *)(cq + params.cq_off.tail);
+	ring->cqMask = *(uint32_t *)(cq + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+	return 0;
+
+fail:
+	rc = errno;
+	ringShutdown(ring);
+	return rc;
+}
+
+static void
+ringShutdown(OMRFileAsyncRing *ring)
+{
+	if (NULL != ring->sqes) {
+		munmap(ring->sqes, ring->sqesSize);
+	}
+	if ((NULL != ring->cqMapping) && (ring->cqMapping != ring->sqMapping)) {
+		munmap(ring->cqMapping, ring->cqMappingSize);
+	}
+	if (NULL != ring->sqMapping) {
+		munmap(ring->sqMapping, ring->sqMappingSize);
+	}
+	close(ring->ringFD);
+	ring->ringFD = -1;
+}
+
+static int32_t
+ringSubmit(struct OMRFileAsyncContext *context, OMRFileAsyncRequest **requests, uint32_t count)
+{
+	OMRFileAsyncRing *ring = &context->ring;
+	uint32_t tail = *ring->sqTail;
+	uint32_t queued = 0;
+	int submitted = 0;
+
+	while ((queued < count) && ((context->inflightCount + queued) < context->queueDepth)) {
+		OMRFileAsyncRequest *request = requests[queued];
+		uint32_t index = (tail + queued) & ring->sqMask;
+		struct io_uring_sqe *sqe = &ring->sqes[index];
+
+		memset(sqe, 0, sizeof(*sqe));
+		sqe->opcode = (OMRPORT_FILE_ASYNC_READ == request->operation) ? IORING_OP_READV : IORING_OP_WRITEV;
+		sqe->fd = (int32_t)(request->fd - FD_BIAS);
+		sqe->off = (uint64_t)request->offset;
+		/* OMRIOVec has the layout of struct iovec */
+		sqe->addr = (uint64_t)(uintptr_t)request->iov;
+		sqe->len = (uint32_t)request->iovcnt;
+		sqe->user_data = (uint64_t)(uintptr_t)request;
+		ring->sqArray[index] = index;
+		queued += 1;
+	}
+	if (0 == queued) {
+		return 0;
+	}
+
+	/* the kernel must see the entries before the new tail */
+	__atomic_store_n(ring->sqTail, tail + queued, __ATOMIC_RELEASE);
+	do {
+		submitted = (int)syscall(__NR_io_uring_enter, ring->ringFD, queued, 0, 0, NULL, 0);
+	} while ((-1 == submitted) && (EINTR == errno));
+
+	if (submitted < 0) {
+		int32_t errorCode = errno;
+		/* nothing was consumed; without a polling thread the kernel only reads the ring in io_uring_enter */
+		__atomic_store_n(ring->sqTail, tail, __ATOMIC_RELEASE);
+		return (int32_t)ringError(errorCode);
+	}
+	if ((uint32_t)submitted < queued) {
+		/* hand the rest back to the caller */
+		__atomic_store_n(ring->sqTail, tail + (uint32_t)submitted, __ATOMIC_RELEASE);
+	}
+	context->inflightCount += (uint32_t)submitted;
+	return (int32_t)submitted;
+}
+
+static int32_t
+ringComplete(struct OMRFileAsyncContext *context, OMRFileAsyncRequest **completed, uint32_t maxCompleted, uint32_t minCompleted)
+{
+	OMRFileAsyncRing *ring = &context->ring;
+	uint32_t collected = 0;
+
+	minCompleted = OMR_MIN(OMR_MIN(minCompleted, maxCompleted), context->inflightCount);
+	for (;;) {
+		uint32_t head = *ring->cqHead;
+		uint32_t tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+		int rc = 0;
+
+		while ((head != tail) && (collected < maxCompleted)) {
+			struct io_uring_cqe *cqe = &ring->cqes[head & ring->cqMask];
+			OMRFileAsyncRequest *request = (OMRFileAsyncRequest *)(uintptr_t)cqe->user_data;
+
+			request->result = (cqe->res >= 0) ? (intptr_t)cqe->res : ringError(-cqe->res);
+			completed[collected] = request;
+			collected += 1;
+			head += 1;
+		}
+		/* the entries have been read before the kernel may reuse them */
+		__atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+
+		if (collected >= minCompleted) {
+			break;
+		}
+		rc = (int)syscall(__NR_io_uring_enter, ring->ringFD, 0, minCompleted - collected, IORING_ENTER_GETEVENTS, NULL, 0);
+		if ((rc < 0) && (EINTR != errno)) {
+			if (0 == collected) {
+				return (int32_t)ringError(errno);
+			}
+			break;
+		}
+	}
+
+	context->inflightCount -= collected;
+	return (int32_t)collected;
+}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+/**
+ * Create a context for asynchronous reads and writes. Requests are submitted with
+ * @ref omrfile_async_submit and collected, in any order, with @ref omrfile_async_complete.
+ *
+ * Requests go through an io_uring when the kernel supports it, and are otherwise performed
+ * by worker threads with blocking positional reads and writes.
+ *
+ * A context may be used by one thread at a time; callers sharing a context must serialize
+ * submission and completion.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queueDepth The maximum number of requests in flight, must be non zero
+ * @param[in] flags OMRPORT_FILE_ASYNC_FLAG_THREAD_POOL to use worker threads even where io_uring is available
+ * @param[out] context The new context
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ */
+int32_t
+omrfile_async_create(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, struct OMRFileAsyncContext **context)
+{
+	OMRFileAsyncContext *newContext = NULL;
+	int32_t rc = 0;
+
+	if ((NULL == context) || (0 == queueDepth)) {
+		Trc_PRT_file_async_create_failed(OMRPORT_ERROR_FILE_INVAL);
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+	*context = NULL;
+
+	newContext = (OMRFileAsyncContext *)portLibrary->mem_allocate_memory(portLibrary, sizeof(*newContext), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newContext) {
+		Trc_PRT_file_async_create_failed(OMRPORT_ERROR_FILE_OPFAILED);
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	memset(newContext, 0, sizeof(*newContext));
+	newContext->queueDepth = queueDepth;
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	if (OMR_ARE_NO_BITS_SET(flags, OMRPORT_FILE_ASYNC_FLAG_THREAD_POOL)) {
+		int32_t errorCode = ringStartup(&newContext->ring, queueDepth);
+		if (0 == errorCode) {
+			newContext->useRing = TRUE;
+			Trc_PRT_file_async_create(newContext, queueDepth, "io_uring");
+			*context = newContext;
+			return 0;
+		}
+		Trc_PRT_file_async_io_uring_unavailable(errorCode);
+	}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+	rc = omrfile_async_pool_startup(portLibrary, &newContext->pool, queueDepth);
+	if (0 != rc) {
+		portLibrary->mem_free_memory(portLibrary, newContext);
+		Trc_PRT_file_async_create_failed(rc);
+		return rc;
+	}
+
+	Trc_PRT_file_async_create(newContext, queueDepth, "worker threads");
+	*context = newContext;
+	return 0;
+}
+
+/**
+ * Destroy a context. Waits for the requests in flight to finish; requests that were not
+ * collected with @ref omrfile_async_complete are not returned.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context, may be NULL
+ */
+void
+omrfile_async_destroy(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context)
+{
+	if (NULL != context) {
+		Trc_PRT_file_async_destroy(context);
+#if defined(OMR_FILE_ASYNC_IO_URING)
+		if (context->useRing) {
+			/* the buffers of requests in flight belong to the caller once this returns */
+			while (0 != context->inflightCount) {
+				OMRFileAsyncRequest *drained[16];
+				if (ringComplete(context, drained, 16, 1) < 0) {
+					break;
+				}
+			}
+			ringShutdown(&context->ring);
+		} else
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+		{
+			omrfile_async_pool_shutdown(&context->pool);
+		}
+		portLibrary->mem_free_memory(portLibrary, context);
+	}
+}
+
+/**
+ * Start reads and writes. The requests and their buffers must not be touched until
+ * they are returned by @ref omrfile_async_complete.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context
+ * @param[in] requests The requests to start
+ * @param[in] count The number of requests
+ *
+ * @return the number of requests started, from the front of the array, which is less than count
+ * when the context already has queueDepth requests in flight; a negative portable error code on failure.
+ */
+int32_t
+omrfile_async_submit(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context, struct OMRFileAsyncRequest **requests, uint32_t count)
+{
+	if ((NULL == context) || !omrfile_async_requests_valid(requests, count)) {
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	if (context->useRing) {
+		return ringSubmit(context, requests, count);
+	}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+	return omrfile_async_pool_submit(&context->pool, requests, count);
+}
+
+/**
+ * Collect finished requests, in completion order. The result of each request is stored
+ * in its result field.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context
+ * @param[out] completed Receives the finished requests
+ * @param[in] maxCompleted The size of completed
+ * @param[in] minCompleted The number of requests to wait for; the wait ends early when fewer requests
+ * are in flight. 0 to only collect requests that have already finished.
+ *
+ * @return the number of requests stored in completed, a negative portable error code on failure.
+ */
+int32_t
+omrfile_async_complete(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context, struct OMRFileAsyncRequest **completed, uint32_t maxCompleted, uint32_t minCompleted)
+{
+	if ((NULL == context) || ((NULL == completed) && (0 != maxCompleted))) {
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	if (context->useRing) {
+		return ringComplete(context, completed, maxCompleted, minCompleted);
+	}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+	return omrfile_async_pool_complete(&context->pool, completed, maxCompleted, minCompleted);
+}
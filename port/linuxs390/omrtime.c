@@ -285,6 +285,23 @@ omrtime_calculate_hw_time_delta(struct OMRPortLibrary *portLibrary)
 	PPG_last_clock_delta_update = currentHWTime;
 }
 
+/**
+ * Query OS for timestamp.
+ * Retrieve the current value of a monotonic clock in nanoseconds, favouring a low cost per call
+ * over precision.
+ *
+ * There is no cheaper clock source on this platform, so this is @ref omrtime_nano_time.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return time value in nanoseconds, to be compared only with other values from this function.
+ */
+int64_t
+omrtime_fast_nano_time(struct OMRPortLibrary *portLibrary)
+{
+	return portLibrary->time_nano_time(portLibrary);
+}
+
 /**
  * PortLibrary shutdown.
  *
@@ -197,6 +197,26 @@ extern J9_CFUNC
 int32_t omrfile_stat(struct OMRPortLibrary *portLibrary, const char *path, uint32_t flags, struct J9FileStat *buf);
 extern J9_CFUNC
 int32_t omrfile_stat_filesystem(struct OMRPortLibrary *portLibrary, const char *path, uint32_t flags, struct J9FileStatFilesystem *buf);
+extern J9_CFUNC intptr_t
+omrfile_preadv(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRIOVec *iov, int32_t iovcnt, int64_t offset);
+extern J9_CFUNC intptr_t
+omrfile_pwritev(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRIOVec *iov, int32_t iovcnt, int64_t offset);
+extern J9_CFUNC int32_t
+omrfile_fadvise(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, int32_t advice);
+extern J9_CFUNC int32_t
+omrfile_fallocate(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, uint32_t flags);
+extern J9_CFUNC int32_t
+omrfile_readahead(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length);
+
+/* omrfile_async */
+extern J9_CFUNC int32_t
+omrfile_async_create(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, struct OMRFileAsyncContext **context);
+extern J9_CFUNC void
+omrfile_async_destroy(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context);
+extern J9_CFUNC int32_t
+omrfile_async_submit(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context, struct OMRFileAsyncRequest **requests, uint32_t count);
+extern J9_CFUNC int32_t
+omrfile_async_complete(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncContext *context, struct OMRFileAsyncRequest **completed, uint32_t maxCompleted, uint32_t minCompleted);
 extern J9_CFUNC void
 omrfile_vprintf(struct OMRPortLibrary *portLibrary, intptr_t fd, const char *format, va_list args);
 extern J9_CFUNC int32_t
@@ -661,6 +681,10 @@ extern J9_CFUNC int32_t
 omrsysinfo_cgroup_subsystem_iterator_next(struct OMRPortLibrary *portLibrary, struct OMRCgroupMetricIteratorState *state, struct OMRCgroupMetricElement *metricElement);
 extern J9_CFUNC void
 omrsysinfo_cgroup_subsystem_iterator_destroy(struct OMRPortLibrary *portLibrary, struct OMRCgroupMetricIteratorState *state);
+extern J9_CFUNC int32_t
+omrsysinfo_get_resource_snapshot(struct OMRPortLibrary *portLibrary, struct OMRResourceSnapshot *snapshot);
+extern J9_CFUNC int32_t
+omrsysinfo_refresh_resource_snapshot(struct OMRPortLibrary *portLibrary);
 
 /* J9SourceJ9Signal*/
 extern J9_CFUNC int32_t
@@ -797,6 +821,30 @@ extern J9_CFUNC int32_t
 omrsock_getsockopt_linger(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval);
 extern J9_CFUNC int32_t
 omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval);
+extern J9_CFUNC int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop);
+extern J9_CFUNC int32_t
+omrsock_eventloop_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop);
+extern J9_CFUNC int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData);
+extern J9_CFUNC int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData);
+extern J9_CFUNC int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock);
+extern J9_CFUNC int32_t
+omrsock_eventloop_timer_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, uint64_t delayMillis, uint64_t periodMillis, void *userData, omrsock_timer_t *timer);
+extern J9_CFUNC int32_t
+omrsock_eventloop_timer_cancel(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_timer_t *timer);
+extern J9_CFUNC int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs);
+extern J9_CFUNC intptr_t
+omrsock_sendmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags);
+extern J9_CFUNC intptr_t
+omrsock_recvmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags);
+extern J9_CFUNC int64_t
+omrsock_sendfile(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, int64_t count);
+extern J9_CFUNC int32_t
+omrsock_get_zerocopy_completion(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *firstSend, uint32_t *lastSend, BOOLEAN *copied);
 
 /* J9SourceJ9Str*/
 extern J9_CFUNC uintptr_t
@@ -849,6 +897,8 @@ extern J9_CFUNC uintptr_t
 omrtime_msec_clock(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC uint64_t
 omrtime_current_time_nanos(struct OMRPortLibrary *portLibrary, uintptr_t *success);
+extern J9_CFUNC int64_t
+omrtime_fast_nano_time(struct OMRPortLibrary *portLibrary);
 
 /* J9SourceJ9TTY*/
 extern J9_CFUNC void
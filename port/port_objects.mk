@@ -116,6 +116,8 @@ ifneq (win,$(OMR_HOST_OS))
   OBJECTS += omriconvhelpers
 endif
 
+OBJECTS += omrfile_async
+OBJECTS += omrfile_async_pool
 OBJECTS += omrfile_blockingasync
 
 ifeq (win,$(OMR_HOST_OS))
@@ -26,12 +26,19 @@
  * @brief file
  */
 
+#if defined(LINUX) && !defined(OMRZTPF)
+/* _GNU_SOURCE is needed for fallocate() and readahead() */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <sys/types.h>
 #if defined(LINUX) && !defined(OMRZTPF)
+#include <sys/uio.h>
 #include <sys/vfs.h>
 #elif defined(OSX)
 #include <sys/param.h>
@@ -73,6 +80,9 @@ static const char *const fileFStatVFSErrorMsgPrefix = "fstatvfs : ";
 static int32_t EsTranslateOpenFlags(int32_t flags);
 static void setPortableError(OMRPortLibrary *portLibrary, const char *funcName, int32_t portlibErrno, int systemErrno);
 static int32_t findError(int32_t errorCode);
+#if !defined(LINUX) || defined(OMRZTPF)
+static intptr_t transferAtOffset(int fd, const OMRIOVec *iov, int32_t iovcnt, int64_t offset, BOOLEAN isWrite);
+#endif /* !defined(LINUX) || defined(OMRZTPF) */
 #if (defined(LINUX) && !defined(OMRZTPF)) || defined(OSX) || (defined(AIXPPC) && !defined(J9OS_I5))
 static void updateJ9FileStat(struct OMRPortLibrary *portLibrary, J9FileStat *j9statBuf, struct stat *statBuf, PlatformStatfs *statfsBuf);
 #else /* (defined(LINUX) && !defined(OMRZTPF)) || defined(OSX) || (defined(AIXPPC) && !defined(J9OS_I5)) */
@@ -1027,6 +1037,268 @@ omrfile_set_length(struct OMRPortLibrary *portLibrary, intptr_t inFD, int64_t ne
 	return rc;
 }
 
+#if !defined(LINUX) || defined(OMRZTPF)
+/**
+ * Transfer the buffers one at a time with pread() or pwrite(), for platforms without
+ * preadv() and pwritev(). Like them, the transfer stops at the first short read or write.
+ *
+ * @return The number of bytes transferred, or -1 with errno set if nothing was transferred.
+ */
+static intptr_t
+transferAtOffset(int fd, const OMRIOVec *iov, int32_t iovcnt, int64_t offset, BOOLEAN isWrite)
+{
+	intptr_t total = 0;
+	int32_t i = 0;
+
+	for (i = 0; i < iovcnt; i++) {
+		ssize_t transferred = 0;
+		do {
+			if (isWrite) {
+				transferred = pwrite(fd, iov[i].iov_base, (size_t)iov[i].iov_len, (off_t)(offset + total));
+			} else {
+				transferred = pread(fd, iov[i].iov_base, (size_t)iov[i].iov_len, (off_t)(offset + total));
+			}
+		} while ((-1 == transferred) && (EINTR == errno));
+
+		if (-1 == transferred) {
+			return (0 == total) ? -1 : total;
+		}
+		total += transferred;
+		if ((size_t)transferred < (size_t)iov[i].iov_len) {
+			break;
+		}
+	}
+	return total;
+}
+#endif /* !defined(LINUX) || defined(OMRZTPF) */
+
+/**
+ * Read from a file at the given offset into a list of buffers. The file offset of the
+ * descriptor is neither used nor changed, so threads sharing a descriptor don't have to
+ * serialize seeks and reads.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] iov The buffers to fill, in order.
+ * @param[in] iovcnt The number of buffers, at most the platform's IOV_MAX.
+ * @param[in] offset The offset in the file to read from.
+ *
+ * @return The number of bytes read, which is less than requested at the end of the file
+ * and 0 at or beyond it, or a negative portable error code on failure.
+ */
+intptr_t
+omrfile_preadv(struct OMRPortLibrary *portLibrary, intptr_t inFD, const OMRIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	int fd = (int)inFD - FD_BIAS;
+	intptr_t result = 0;
+
+	Trc_PRT_file_preadv_Entry(inFD, iov, iovcnt, offset);
+
+	if ((iovcnt < 0) || (offset < 0)) {
+		result = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+		Trc_PRT_file_preadv_Exit(result);
+		return result;
+	}
+
+#if defined(LINUX) && !defined(OMRZTPF)
+	do {
+		/* OMRIOVec has the layout of struct iovec */
+		result = preadv(fd, (const struct iovec *)iov, iovcnt, (off_t)offset);
+	} while ((-1 == result) && (EINTR == errno));
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+	result = transferAtOffset(fd, iov, iovcnt, offset, FALSE);
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+	if (-1 == result) {
+		result = portLibrary->error_set_last_error(portLibrary, errno, findError(errno));
+	}
+	Trc_PRT_file_preadv_Exit(result);
+	return result;
+}
+
+/**
+ * Write a list of buffers to a file at the given offset. The file offset of the descriptor
+ * is neither used nor changed, so threads sharing a descriptor can write to disjoint parts
+ * of the file without serializing seeks and writes.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor. It should not be open for append, since some platforms
+ * then append the data regardless of offset.
+ * @param[in] iov The buffers to write, in order.
+ * @param[in] iovcnt The number of buffers, at most the platform's IOV_MAX.
+ * @param[in] offset The offset in the file to write to.
+ *
+ * @return The number of bytes written, or a negative portable error code on failure.
+ */
+intptr_t
+omrfile_pwritev(struct OMRPortLibrary *portLibrary, intptr_t inFD, const OMRIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	int fd = (int)inFD - FD_BIAS;
+	intptr_t result = 0;
+
+	Trc_PRT_file_pwritev_Entry(inFD, iov, iovcnt, offset);
+
+	if ((iovcnt < 0) || (offset < 0)) {
+		result = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+		Trc_PRT_file_pwritev_Exit(result);
+		return result;
+	}
+
+#if defined(LINUX) && !defined(OMRZTPF)
+	do {
+		/* OMRIOVec has the layout of struct iovec */
+		result = pwritev(fd, (const struct iovec *)iov, iovcnt, (off_t)offset);
+	} while ((-1 == result) && (EINTR == errno));
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+	result = transferAtOffset(fd, iov, iovcnt, offset, TRUE);
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+	if (-1 == result) {
+		result = portLibrary->error_set_last_error(portLibrary, errno, findError(errno));
+	}
+	Trc_PRT_file_pwritev_Exit(result);
+	return result;
+}
+
+/**
+ * Tell the operating system how a range of a file is going to be accessed, so it can
+ * adjust read-ahead and caching. The advice is a hint: platforms that can't use it
+ * ignore it and return success.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset The start of the range.
+ * @param[in] length The length of the range, 0 meaning to the end of the file.
+ * @param[in] advice One of the OMRPORT_FILE_ADVICE_* values.
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ */
+int32_t
+omrfile_fadvise(struct OMRPortLibrary *portLibrary, intptr_t inFD, int64_t offset, int64_t length, int32_t advice)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_file_fadvise_Entry(inFD, offset, length, advice);
+
+	if ((offset < 0) || (length < 0) || (advice < OMRPORT_FILE_ADVICE_NORMAL) || (advice > OMRPORT_FILE_ADVICE_NOREUSE)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+	} else {
+#if defined(LINUX) && !defined(OMRZTPF)
+		static const int platformAdvice[] = {
+			POSIX_FADV_NORMAL, /* OMRPORT_FILE_ADVICE_NORMAL */
+			POSIX_FADV_SEQUENTIAL, /* OMRPORT_FILE_ADVICE_SEQUENTIAL */
+			POSIX_FADV_RANDOM, /* OMRPORT_FILE_ADVICE_RANDOM */
+			POSIX_FADV_WILLNEED, /* OMRPORT_FILE_ADVICE_WILLNEED */
+			POSIX_FADV_DONTNEED, /* OMRPORT_FILE_ADVICE_DONTNEED */
+			POSIX_FADV_NOREUSE /* OMRPORT_FILE_ADVICE_NOREUSE */
+		};
+		/* posix_fadvise returns the error rather than setting errno */
+		int error = posix_fadvise((int)inFD - FD_BIAS, (off_t)offset, (off_t)length, platformAdvice[advice]);
+		if (0 != error) {
+			rc = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+		}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+	}
+
+	Trc_PRT_file_fadvise_Exit(rc);
+	return rc;
+}
+
+/**
+ * Reserve disk space for a range of a file, so later writes to the range, including
+ * stores to a shared mapping of it, can't fail for lack of space. Unless
+ * OMRPORT_FILE_FALLOCATE_KEEP_SIZE is specified the file is extended to cover the range.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset The start of the range.
+ * @param[in] length The length of the range.
+ * @param[in] flags 0 or OMRPORT_FILE_FALLOCATE_KEEP_SIZE.
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ * OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM is returned if space can't be reserved
+ * beyond the end of the file on this platform.
+ *
+ * @note Where space can't be reserved the file is only extended, which does not guarantee
+ * that later writes will succeed.
+ */
+int32_t
+omrfile_fallocate(struct OMRPortLibrary *portLibrary, intptr_t inFD, int64_t offset, int64_t length, uint32_t flags)
+{
+	int fd = (int)inFD - FD_BIAS;
+	int32_t rc = 0;
+
+	Trc_PRT_file_fallocate_Entry(inFD, offset, length, flags);
+
+	if ((offset < 0) || (length < 0)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+	} else if (0 != length) {
+#if defined(LINUX) && !defined(OMRZTPF)
+		const int mode = OMR_ARE_ANY_BITS_SET(flags, OMRPORT_FILE_FALLOCATE_KEEP_SIZE) ? FALLOC_FL_KEEP_SIZE : 0;
+		int error = 0;
+
+		do {
+			error = (0 == fallocate(fd, mode, (off_t)offset, (off_t)length)) ? 0 : errno;
+		} while (EINTR == error);
+
+		if ((EOPNOTSUPP == error) && (0 == mode)) {
+			/* the file system can't reserve blocks, posix_fallocate writes them instead */
+			error = posix_fallocate(fd, (off_t)offset, (off_t)length);
+		}
+		if (0 != error) {
+			rc = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+		}
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+		if (OMR_ARE_ANY_BITS_SET(flags, OMRPORT_FILE_FALLOCATE_KEEP_SIZE)) {
+			rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM);
+		} else {
+			struct stat st;
+			if (0 != fstat(fd, &st)) {
+				rc = portLibrary->error_set_last_error(portLibrary, errno, findError(errno));
+			} else if ((int64_t)st.st_size < (offset + length)) {
+				rc = portLibrary->file_set_length(portLibrary, inFD, offset + length);
+			}
+		}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+	}
+
+	Trc_PRT_file_fallocate_Exit(rc);
+	return rc;
+}
+
+/**
+ * Start reading a range of a file into the page cache in the background, so that later
+ * reads of the range, or of a mapping of it, don't block. Like omrfile_fadvise, this is
+ * a hint and platforms that can't use it return success.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset The start of the range.
+ * @param[in] length The length of the range.
+ *
+ * @return 0 on success, a negative portable error code on failure.
+ */
+int32_t
+omrfile_readahead(struct OMRPortLibrary *portLibrary, intptr_t inFD, int64_t offset, int64_t length)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_file_readahead_Entry(inFD, offset, length);
+
+	if ((offset < 0) || (length < 0)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+	} else {
+#if defined(LINUX) && !defined(OMRZTPF)
+		if (-1 == readahead((int)inFD - FD_BIAS, (off64_t)offset, (size_t)length)) {
+			rc = portLibrary->error_set_last_error(portLibrary, errno, findError(errno));
+		}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+	}
+
+	Trc_PRT_file_readahead_Exit(rc);
+	return rc;
+}
+
 /**
  * This function will acquire a lock of the requested type on the given file, starting at offset bytes
  * from the start of the file and continuing for length bytes
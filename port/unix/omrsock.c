@@ -35,11 +35,28 @@
 #include <string.h> 
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/uio.h>
 
 #include "omrport.h"
 #include "omrporterror.h"
 #include "omrsockptb.h"
 
+#if defined(LINUX)
+#include <linux/errqueue.h>
+#include <sys/sendfile.h>
+#endif /* defined(LINUX) */
+
+#if defined(LINUX)
+#include <sys/epoll.h>
+#define OMRSOCK_EVENTLOOP_EPOLL
+typedef struct epoll_event omr_os_event;
+#elif defined(OSX) /* defined(LINUX) */
+#include <sys/event.h>
+#include <sys/time.h>
+#define OMRSOCK_EVENTLOOP_KQUEUE
+typedef struct kevent omr_os_event;
+#endif /* defined(LINUX) */
+
 #if defined(J9ZOS390) && !defined(OMR_EBCDIC)
 #include "atoe.h"
 #endif /* defined(J9ZOS390) && !defined(OMR_EBCDIC) */
@@ -153,6 +170,7 @@ get_os_socket_level(int32_t socketLevel)
  * \arg SO_RCVTIMEO, the receive timeout.
  * \arg SO_SNDTIMEO, the send timeout.
  * \arg TCP_NODELAY, the buffering scheme disabling Nagle's algorithm.
+ * \arg SO_ZEROCOPY, zero-copy sends with MSG_ZEROCOPY are allowed (Linux only).
  *
  * @param[in] socketOption The portable socket option to convert.
  *
@@ -174,6 +192,10 @@ get_os_socket_option(int32_t socketOption)
 		return OS_SO_SNDTIMEO;
 	case OMRSOCK_TCP_NODELAY:
 		return OS_TCP_NODELAY;
+#if defined(OS_SO_ZEROCOPY)
+	case OMRSOCK_SO_ZEROCOPY:
+		return OS_SO_ZEROCOPY;
+#endif /* defined(OS_SO_ZEROCOPY) */
 	default:
 		break;
 	}
@@ -239,6 +261,36 @@ get_os_poll_constant(int16_t omrPollConstant)
 	return osPollConstant;
 }
 
+/**
+ * @internal Map OMRSOCK API user interface message flags to the OS message flags
+ * used by sendmsg and recvmsg. Flags the OS does not have are dropped.
+ *
+ * @param omrFlags The OMR message flags to be converted.
+ *
+ * @return OS message flags.
+ */
+static int
+get_os_msg_flags(int32_t omrFlags)
+{
+	int osFlags = 0;
+
+#if defined(OS_MSG_DONTWAIT)
+	if (OMR_ARE_ANY_BITS_SET(omrFlags, OMRSOCK_MSG_DONTWAIT)) {
+		osFlags |= OS_MSG_DONTWAIT;
+	}
+#endif /* defined(OS_MSG_DONTWAIT) */
+	if (OMR_ARE_ANY_BITS_SET(omrFlags, OMRSOCK_MSG_WAITALL)) {
+		osFlags |= OS_MSG_WAITALL;
+	}
+#if defined(OS_MSG_ZEROCOPY)
+	if (OMR_ARE_ANY_BITS_SET(omrFlags, OMRSOCK_MSG_ZEROCOPY)) {
+		osFlags |= OS_MSG_ZEROCOPY;
+	}
+#endif /* defined(OS_MSG_ZEROCOPY) */
+
+	return osFlags;
+}
+
 /* Internal: OS dependent constants TO OMRSOCK user interface constants mapping. */
 
 /**
@@ -821,6 +873,7 @@ omrsock_accept(struct OMRPortLibrary *portLibrary, omrsock_socket_t serverSock,
 		return OMRPORT_ERROR_SYSTEMFULL; 
 	}
 
+	memset(*sockHandle, 0, sizeof(struct OMRSocket));
 	(*sockHandle)->data = connSocketDescriptor;
 	return 0;
 }
@@ -1269,3 +1322,758 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return get_opt(portLibrary, handle->data, optlevel, optname, (void*)&optval->data, sizeof(struct timeval));
 }
+
+#if defined(OMRSOCK_EVENTLOOP_EPOLL) || defined(OMRSOCK_EVENTLOOP_KQUEUE)
+
+#define OMRSOCK_NANOS_PER_MILLI ((uint64_t)1000000)
+
+/**
+ * @internal Swap two timers of the timer heap of an event loop, keeping their heap indices up to date.
+ */
+static void
+timer_heap_swap(omrsock_eventloop_t loop, uint32_t a, uint32_t b)
+{
+	OMRSockTimer *timer = loop->timers[a];
+
+	loop->timers[a] = loop->timers[b];
+	loop->timers[b] = timer;
+	loop->timers[a]->heapIndex = a;
+	loop->timers[b]->heapIndex = b;
+}
+
+/**
+ * @internal Restore the heap order after the deadline of the timer at index decreased.
+ */
+static void
+timer_heap_sift_up(omrsock_eventloop_t loop, uint32_t index)
+{
+	while (0 != index) {
+		uint32_t parent = (index - 1) / 2;
+		if (loop->timers[parent]->deadline <= loop->timers[index]->deadline) {
+			break;
+		}
+		timer_heap_swap(loop, parent, index);
+		index = parent;
+	}
+}
+
+/**
+ * @internal Restore the heap order after the deadline of the timer at index increased.
+ */
+static void
+timer_heap_sift_down(omrsock_eventloop_t loop, uint32_t index)
+{
+	for (;;) {
+		uint32_t smallest = index;
+		uint32_t left = (2 * index) + 1;
+		uint32_t right = left + 1;
+
+		if ((left < loop->timerCount) && (loop->timers[left]->deadline < loop->timers[smallest]->deadline)) {
+			smallest = left;
+		}
+		if ((right < loop->timerCount) && (loop->timers[right]->deadline < loop->timers[smallest]->deadline)) {
+			smallest = right;
+		}
+		if (smallest == index) {
+			break;
+		}
+		timer_heap_swap(loop, index, smallest);
+		index = smallest;
+	}
+}
+
+/**
+ * @internal Take the timer at index out of the timer heap. The timer is not freed.
+ */
+static void
+timer_heap_remove(omrsock_eventloop_t loop, uint32_t index)
+{
+	uint32_t last = loop->timerCount - 1;
+
+	if (index != last) {
+		timer_heap_swap(loop, index, last);
+	}
+	loop->timerCount = last;
+	if (index < last) {
+		timer_heap_sift_down(loop, index);
+		timer_heap_sift_up(loop, index);
+	}
+}
+
+/**
+ * @internal Fill in events for the expired timers of an event loop, rearming the periodic
+ * timers and freeing the others.
+ *
+ * @return the number of events filled in, at most maxEvents.
+ */
+static uint32_t
+collect_expired_timers(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents)
+{
+	uint64_t now = 0;
+	uint32_t count = 0;
+
+	if (0 == loop->timerCount) {
+		return 0;
+	}
+
+	now = (uint64_t)portLibrary->time_nano_time(portLibrary);
+	while ((count < maxEvents) && (0 != loop->timerCount) && (loop->timers[0]->deadline <= now)) {
+		OMRSockTimer *timer = loop->timers[0];
+
+		events[count].socket = NULL;
+		events[count].userData = timer->userData;
+		events[count].events = OMRSOCK_EVENT_TIMER;
+		count += 1;
+
+		if (0 != timer->periodNanos) {
+			timer->deadline += timer->periodNanos;
+			if (timer->deadline <= now) {
+				/* fell behind by more than a period, do not report the missed expiries */
+				timer->deadline = now + timer->periodNanos;
+			}
+			timer_heap_sift_down(loop, 0);
+		} else {
+			timer_heap_remove(loop, 0);
+			portLibrary->mem_free_memory(portLibrary, timer);
+		}
+	}
+	return count;
+}
+
+/**
+ * @internal Shorten a wait timeout so that the wait ends when the next timer expires.
+ */
+static int32_t
+timer_wait_millis(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, int32_t timeoutMs)
+{
+	if (0 != loop->timerCount) {
+		uint64_t now = (uint64_t)portLibrary->time_nano_time(portLibrary);
+		uint64_t deadline = loop->timers[0]->deadline;
+		uint64_t waitMillis = 0;
+
+		if (deadline > now) {
+			/* round up, waking before the deadline would only wait again */
+			waitMillis = (deadline - now + OMRSOCK_NANOS_PER_MILLI - 1) / OMRSOCK_NANOS_PER_MILLI;
+		}
+		if (waitMillis > INT32_MAX) {
+			waitMillis = INT32_MAX;
+		}
+		if ((timeoutMs < 0) || ((uint64_t)timeoutMs > waitMillis)) {
+			timeoutMs = (int32_t)waitMillis;
+		}
+	}
+	return timeoutMs;
+}
+
+#if defined(OMRSOCK_EVENTLOOP_EPOLL)
+/**
+ * @internal Map OMRSOCK event loop events and flags to epoll events.
+ */
+static uint32_t
+get_os_eventloop_events(uint32_t omrEvents)
+{
+	uint32_t osEvents = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_EVENT_READ)) {
+		osEvents |= EPOLLIN | EPOLLRDHUP;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_EVENT_WRITE)) {
+		osEvents |= EPOLLOUT;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_EVENT_EDGE_TRIGGERED)) {
+		osEvents |= EPOLLET;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_EVENT_ONESHOT)) {
+		osEvents |= EPOLLONESHOT;
+	}
+	return osEvents;
+}
+
+/**
+ * @internal Map epoll events to OMRSOCK event loop events.
+ */
+static uint32_t
+get_omr_eventloop_events(uint32_t osEvents)
+{
+	uint32_t omrEvents = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLIN)) {
+		omrEvents |= OMRSOCK_EVENT_READ;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLOUT)) {
+		omrEvents |= OMRSOCK_EVENT_WRITE;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLERR)) {
+		omrEvents |= OMRSOCK_EVENT_ERROR;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLHUP | EPOLLRDHUP)) {
+		omrEvents |= OMRSOCK_EVENT_HANGUP;
+	}
+	return omrEvents;
+}
+
+/**
+ * @internal Add, modify or remove the registration of a socket.
+ */
+static int32_t
+eventloop_ctl(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int operation, uint32_t events)
+{
+	struct epoll_event event;
+
+	memset(&event, 0, sizeof(event));
+	event.events = get_os_eventloop_events(events);
+	event.data.ptr = sock;
+	if (0 != epoll_ctl(loop->data, operation, sock->data, &event)) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	return 0;
+}
+#elif defined(OMRSOCK_EVENTLOOP_KQUEUE) /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+/**
+ * @internal Add, modify or remove the registration of a socket. kqueue watches reading and
+ * writing with separate filters; the filter for an event that is not wanted is disabled.
+ */
+static int32_t
+eventloop_ctl(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int operation, uint32_t events)
+{
+	struct kevent changes[2];
+	uint16_t flags = (uint16_t)operation;
+	int32_t i = 0;
+
+	if (EV_DELETE != operation) {
+		if (OMR_ARE_ANY_BITS_SET(events, OMRSOCK_EVENT_EDGE_TRIGGERED)) {
+			flags |= EV_CLEAR;
+		}
+		if (OMR_ARE_ANY_BITS_SET(events, OMRSOCK_EVENT_ONESHOT)) {
+			flags |= EV_ONESHOT;
+		}
+	}
+	EV_SET(&changes[0], sock->data, EVFILT_READ,
+			flags | ((EV_DELETE == operation) ? 0 : (OMR_ARE_ANY_BITS_SET(events, OMRSOCK_EVENT_READ) ? EV_ENABLE : EV_DISABLE)),
+			0, 0, sock);
+	EV_SET(&changes[1], sock->data, EVFILT_WRITE,
+			flags | ((EV_DELETE == operation) ? 0 : (OMR_ARE_ANY_BITS_SET(events, OMRSOCK_EVENT_WRITE) ? EV_ENABLE : EV_DISABLE)),
+			0, 0, sock);
+
+	for (i = 0; i < 2; i++) {
+		if (0 != kevent(loop->data, &changes[i], 1, NULL, 0, NULL)) {
+			/* a filter deleted by EV_ONESHOT is already gone */
+			if ((EV_DELETE != operation) || (ENOENT != errno)) {
+				return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+			}
+		}
+	}
+	return 0;
+}
+#endif /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+
+int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	omrsock_eventloop_t newLoop = NULL;
+	int32_t descriptor = -1;
+
+	if (NULL == loop) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	*loop = NULL;
+
+#if defined(OMRSOCK_EVENTLOOP_EPOLL)
+	descriptor = epoll_create1(EPOLL_CLOEXEC);
+#else /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	descriptor = kqueue();
+	if (descriptor >= 0) {
+		fcntl(descriptor, F_SETFD, fcntl(descriptor, F_GETFD, 0) | FD_CLOEXEC);
+	}
+#endif /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	if (descriptor < 0) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+
+	newLoop = (omrsock_eventloop_t)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMREventLoop), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newLoop) {
+		close(descriptor);
+		return OMRPORT_ERROR_SYSTEMFULL;
+	}
+	memset(newLoop, 0, sizeof(OMREventLoop));
+	newLoop->data = descriptor;
+
+	*loop = newLoop;
+	return 0;
+}
+
+int32_t
+omrsock_eventloop_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	uint32_t i = 0;
+
+	if ((NULL == loop) || (NULL == *loop)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	close((*loop)->data);
+	for (i = 0; i < (*loop)->timerCount; i++) {
+		portLibrary->mem_free_memory(portLibrary, (*loop)->timers[i]);
+	}
+	portLibrary->mem_free_memory(portLibrary, (*loop)->timers);
+	portLibrary->mem_free_memory(portLibrary, (*loop)->osEvents);
+	portLibrary->mem_free_memory(portLibrary, *loop);
+	*loop = NULL;
+
+	return 0;
+}
+
+int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	int32_t rc = 0;
+
+	if ((NULL == loop) || (NULL == sock)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(OMRSOCK_EVENTLOOP_EPOLL)
+	rc = eventloop_ctl(portLibrary, loop, sock, EPOLL_CTL_ADD, events);
+#else /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	rc = eventloop_ctl(portLibrary, loop, sock, EV_ADD, events);
+#endif /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	if (0 == rc) {
+		sock->eventUserData = userData;
+	}
+	return rc;
+}
+
+int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	int32_t rc = 0;
+
+	if ((NULL == loop) || (NULL == sock)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	/* set first, the socket may be reported as soon as it is rearmed */
+	sock->eventUserData = userData;
+#if defined(OMRSOCK_EVENTLOOP_EPOLL)
+	rc = eventloop_ctl(portLibrary, loop, sock, EPOLL_CTL_MOD, events);
+#else /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	rc = eventloop_ctl(portLibrary, loop, sock, EV_ADD, events);
+#endif /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	return rc;
+}
+
+int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+	int32_t rc = 0;
+
+	if ((NULL == loop) || (NULL == sock)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(OMRSOCK_EVENTLOOP_EPOLL)
+	rc = eventloop_ctl(portLibrary, loop, sock, EPOLL_CTL_DEL, 0);
+#else /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	rc = eventloop_ctl(portLibrary, loop, sock, EV_DELETE, 0);
+#endif /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	if (0 == rc) {
+		sock->eventUserData = NULL;
+	}
+	return rc;
+}
+
+int32_t
+omrsock_eventloop_timer_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, uint64_t delayMillis, uint64_t periodMillis, void *userData, omrsock_timer_t *timer)
+{
+	OMRSockTimer *newTimer = NULL;
+
+	if ((NULL == loop) || (NULL == timer)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	*timer = NULL;
+
+	if (loop->timerCount == loop->timerCapacity) {
+		uint32_t newCapacity = (0 == loop->timerCapacity) ? 16 : (loop->timerCapacity * 2);
+		OMRSockTimer **newTimers = (OMRSockTimer **)portLibrary->mem_reallocate_memory(portLibrary, loop->timers,
+				newCapacity * sizeof(OMRSockTimer *), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == newTimers) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+		loop->timers = newTimers;
+		loop->timerCapacity = newCapacity;
+	}
+
+	newTimer = (OMRSockTimer *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRSockTimer), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newTimer) {
+		return OMRPORT_ERROR_SYSTEMFULL;
+	}
+	newTimer->deadline = (uint64_t)portLibrary->time_nano_time(portLibrary) + (delayMillis * OMRSOCK_NANOS_PER_MILLI);
+	newTimer->periodNanos = periodMillis * OMRSOCK_NANOS_PER_MILLI;
+	newTimer->userData = userData;
+	newTimer->heapIndex = loop->timerCount;
+
+	loop->timers[loop->timerCount] = newTimer;
+	loop->timerCount += 1;
+	timer_heap_sift_up(loop, newTimer->heapIndex);
+
+	*timer = newTimer;
+	return 0;
+}
+
+int32_t
+omrsock_eventloop_timer_cancel(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_timer_t *timer)
+{
+	if ((NULL == loop) || (NULL == timer) || (NULL == *timer)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	if (((*timer)->heapIndex >= loop->timerCount) || (loop->timers[(*timer)->heapIndex] != *timer)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	timer_heap_remove(loop, (*timer)->heapIndex);
+	portLibrary->mem_free_memory(portLibrary, *timer);
+	*timer = NULL;
+	return 0;
+}
+
+int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	omr_os_event *osEvents = NULL;
+	uint32_t count = 0;
+	uint32_t osMaxEvents = 0;
+	int32_t ready = 0;
+	int32_t i = 0;
+
+	if ((NULL == loop) || (NULL == events) || (0 == maxEvents)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	count = collect_expired_timers(portLibrary, loop, events, maxEvents);
+	if (count == maxEvents) {
+		return (int32_t)count;
+	}
+	timeoutMs = (0 != count) ? 0 : timer_wait_millis(portLibrary, loop, timeoutMs);
+
+	osMaxEvents = maxEvents - count;
+	if (osMaxEvents > loop->osEventCapacity) {
+		portLibrary->mem_free_memory(portLibrary, loop->osEvents);
+		loop->osEventCapacity = 0;
+		loop->osEvents = portLibrary->mem_allocate_memory(portLibrary, osMaxEvents * sizeof(omr_os_event), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == loop->osEvents) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+		loop->osEventCapacity = osMaxEvents;
+	}
+	osEvents = (omr_os_event *)loop->osEvents;
+
+#if defined(OMRSOCK_EVENTLOOP_EPOLL)
+	ready = epoll_wait(loop->data, osEvents, (int)osMaxEvents, timeoutMs);
+#else /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	if (timeoutMs < 0) {
+		ready = kevent(loop->data, NULL, 0, osEvents, (int)osMaxEvents, NULL);
+	} else {
+		struct timespec timeout;
+		timeout.tv_sec = timeoutMs / 1000;
+		timeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+		ready = kevent(loop->data, NULL, 0, osEvents, (int)osMaxEvents, &timeout);
+	}
+#endif /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+	if (ready < 0) {
+		if (EINTR != errno) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+		ready = 0;
+	}
+
+	for (i = 0; i < ready; i++) {
+#if defined(OMRSOCK_EVENTLOOP_EPOLL)
+		omrsock_socket_t sock = (omrsock_socket_t)osEvents[i].data.ptr;
+		events[count].events = get_omr_eventloop_events(osEvents[i].events);
+#else /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+		omrsock_socket_t sock = (omrsock_socket_t)osEvents[i].udata;
+		events[count].events = (EVFILT_READ == osEvents[i].filter) ? OMRSOCK_EVENT_READ : OMRSOCK_EVENT_WRITE;
+		if (OMR_ARE_ANY_BITS_SET(osEvents[i].flags, EV_EOF)) {
+			events[count].events |= OMRSOCK_EVENT_HANGUP;
+		}
+		if (OMR_ARE_ANY_BITS_SET(osEvents[i].flags, EV_ERROR)) {
+			events[count].events |= OMRSOCK_EVENT_ERROR;
+		}
+#endif /* defined(OMRSOCK_EVENTLOOP_EPOLL) */
+		events[count].socket = sock;
+		events[count].userData = sock->eventUserData;
+		count += 1;
+	}
+
+	if (0 == count) {
+		/* the wait may have ended for the next timer */
+		count = collect_expired_timers(portLibrary, loop, events, maxEvents);
+	}
+	return (int32_t)count;
+}
+
+#else /* defined(OMRSOCK_EVENTLOOP_EPOLL) || defined(OMRSOCK_EVENTLOOP_KQUEUE) */
+
+int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_timer_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, uint64_t delayMillis, uint64_t periodMillis, void *userData, omrsock_timer_t *timer)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_timer_cancel(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_timer_t *timer)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+#endif /* defined(OMRSOCK_EVENTLOOP_EPOLL) || defined(OMRSOCK_EVENTLOOP_KQUEUE) */
+
+/**
+ * @internal Send or receive a list of buffers with sendmsg or recvmsg.
+ */
+static intptr_t
+transfer_msg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags, BOOLEAN isSend)
+{
+	struct msghdr msg;
+	ssize_t result = 0;
+
+	if ((NULL == sock) || (NULL == iov) || (0 >= iovcnt)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+#if !defined(OS_MSG_ZEROCOPY)
+	if (OMR_ARE_ANY_BITS_SET(flags, OMRSOCK_MSG_ZEROCOPY)) {
+		return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+	}
+#endif /* !defined(OS_MSG_ZEROCOPY) */
+
+	memset(&msg, 0, sizeof(msg));
+	/* OMRIOVec has the layout of struct iovec */
+	msg.msg_iov = (struct iovec *)iov;
+	msg.msg_iovlen = iovcnt;
+
+	if (isSend) {
+		result = sendmsg(sock->data, &msg, get_os_msg_flags(flags));
+	} else {
+		result = recvmsg(sock->data, &msg, get_os_msg_flags(flags));
+	}
+	if (-1 == result) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	return (intptr_t)result;
+}
+
+intptr_t
+omrsock_sendmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags)
+{
+	return transfer_msg(portLibrary, sock, iov, iovcnt, flags, TRUE);
+}
+
+intptr_t
+omrsock_recvmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags)
+{
+	return transfer_msg(portLibrary, sock, iov, iovcnt, flags, FALSE);
+}
+
+#if !defined(LINUX) && !defined(OSX)
+/* Size of the buffer the file is copied through where the kernel can't send it directly */
+#define OMRSOCK_SENDFILE_BUFFER_SIZE ((intptr_t)64 * 1024)
+
+/**
+ * @internal Send part of a file by reading it into a buffer and sending the buffer,
+ * for platforms without a sendfile system call.
+ */
+static int64_t
+sendfile_copy(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, int64_t count)
+{
+	int64_t total = 0;
+	int32_t rc = 0;
+	uint8_t *buffer = portLibrary->mem_allocate_memory(portLibrary, OMRSOCK_SENDFILE_BUFFER_SIZE, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+
+	if (NULL == buffer) {
+		return OMRPORT_ERROR_SYSTEMFULL;
+	}
+
+	while (total < count) {
+		OMRIOVec iov;
+		intptr_t bytesRead = 0;
+		intptr_t bytesSent = 0;
+
+		iov.iov_base = buffer;
+		iov.iov_len = (uintptr_t)OMR_MIN(count - total, OMRSOCK_SENDFILE_BUFFER_SIZE);
+		bytesRead = portLibrary->file_preadv(portLibrary, fd, &iov, 1, *offset);
+		if (0 >= bytesRead) {
+			/* end of file, or an error already set by omrfile_preadv */
+			rc = (int32_t)bytesRead;
+			break;
+		}
+		while (bytesSent < bytesRead) {
+			ssize_t sent = send(sock->data, buffer + bytesSent, (size_t)(bytesRead - bytesSent), 0);
+			if (-1 == sent) {
+				if (EINTR == errno) {
+					continue;
+				}
+				rc = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+				break;
+			}
+			bytesSent += sent;
+		}
+		total += bytesSent;
+		*offset += bytesSent;
+		if (bytesSent < bytesRead) {
+			break;
+		}
+	}
+
+	portLibrary->mem_free_memory(portLibrary, buffer);
+	return ((0 == total) && (0 > rc)) ? rc : total;
+}
+#endif /* !defined(LINUX) && !defined(OSX) */
+
+int64_t
+omrsock_sendfile(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, int64_t count)
+{
+	int64_t total = 0;
+
+	if ((NULL == sock) || (NULL == offset) || (0 > *offset) || (0 > count)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(LINUX)
+	while (total < count) {
+		off_t fileOffset = (off_t)*offset;
+		/* Linux transfers at most 0x7ffff000 bytes per call */
+		ssize_t sent = sendfile(sock->data, (int)fd, &fileOffset, (size_t)OMR_MIN(count - total, (int64_t)0x7ffff000));
+
+		if (-1 == sent) {
+			if (EINTR == errno) {
+				continue;
+			}
+			if (0 == total) {
+				return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+			}
+			/* report the partial send; a non-blocking socket would block */
+			break;
+		}
+		if (0 == sent) {
+			/* end of file */
+			break;
+		}
+		total += sent;
+		*offset += sent;
+	}
+	return total;
+#elif defined(OSX) /* defined(LINUX) */
+	while (total < count) {
+		off_t len = (off_t)(count - total);
+		/* len is updated with the bytes sent, also when the call fails part way through */
+		int rc = sendfile((int)fd, sock->data, (off_t)*offset, &len, NULL, 0);
+
+		total += len;
+		*offset += len;
+		if (-1 == rc) {
+			if ((EINTR == errno) || ((EAGAIN == errno) && (0 != len))) {
+				continue;
+			}
+			if (0 == total) {
+				return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+			}
+			break;
+		}
+		if (0 == len) {
+			/* end of file */
+			break;
+		}
+	}
+	return total;
+#else /* defined(LINUX) */
+	return sendfile_copy(portLibrary, sock, fd, offset, count);
+#endif /* defined(LINUX) */
+}
+
+int32_t
+omrsock_get_zerocopy_completion(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *firstSend, uint32_t *lastSend, BOOLEAN *copied)
+{
+#if defined(OS_MSG_ZEROCOPY)
+	/* room for the extended error and the offending address of either family */
+	char control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(omr_os_sockaddr_storage))];
+	struct msghdr msg;
+	struct cmsghdr *cmsg = NULL;
+	ssize_t result = 0;
+
+	if ((NULL == sock) || (NULL == firstSend) || (NULL == lastSend) || (NULL == copied)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+	do {
+		result = recvmsg(sock->data, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+	} while ((-1 == result) && (EINTR == errno));
+
+	if (-1 == result) {
+		if ((EAGAIN == errno) || (EWOULDBLOCK == errno)) {
+			return 0;
+		}
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+
+	for (cmsg = CMSG_FIRSTHDR(&msg); NULL != cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (((SOL_IP == cmsg->cmsg_level) && (IP_RECVERR == cmsg->cmsg_type))
+			|| ((SOL_IPV6 == cmsg->cmsg_level) && (IPV6_RECVERR == cmsg->cmsg_type))
+		) {
+			struct sock_extended_err *error = (struct sock_extended_err *)CMSG_DATA(cmsg);
+
+			if (SO_EE_ORIGIN_ZEROCOPY == error->ee_origin) {
+				*firstSend = error->ee_info;
+				*lastSend = error->ee_data;
+				*copied = OMR_ARE_ANY_BITS_SET(error->ee_code, SO_EE_CODE_ZEROCOPY_COPIED) ? TRUE : FALSE;
+				return 1;
+			}
+			if (0 != error->ee_errno) {
+				/* another error was queued on the socket, report it */
+				return portLibrary->error_set_last_error(portLibrary, error->ee_errno, get_omr_error(error->ee_errno));
+			}
+		}
+	}
+	return portLibrary->error_set_last_error(portLibrary, EIO, get_omr_error(EIO));
+#else /* defined(OS_MSG_ZEROCOPY) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OS_MSG_ZEROCOPY) */
+}
@@ -163,6 +163,7 @@
 #include "omrportpriv.h"
 #include "omrportpg.h"
 #include "omrportptb.h"
+#include "omrutilbase.h"
 #include "portnls.h"
 #include "ut_omrport.h"
 
@@ -582,6 +583,34 @@ static uint32_t attachedPortLibraries;
 static omrthread_monitor_t cgroupMonitor;
 #endif /* defined(LINUX) */
 
+/* Interval at which the background thread takes the resource snapshot again */
+#define OMRSYSINFO_RESOURCE_SNAPSHOT_INTERVAL_MILLIS 1000
+/* Number of refreshes without a reader after which the background thread exits, until the next reader restarts it */
+#define OMRSYSINFO_RESOURCE_SNAPSHOT_IDLE_REFRESHES 10
+
+/**
+ * The cached resource snapshot of a port library, see omrsysinfo_get_resource_snapshot.
+ * Readers don't lock: the sequence number is odd while the snapshot is being replaced,
+ * and readers retry if it was odd or changed while they copied the snapshot.
+ */
+typedef struct OMRResourceSnapshotCache {
+	volatile uintptr_t sequence;
+	OMRResourceSnapshot snapshot;
+	omrthread_monitor_t monitor; /**< serializes refreshes and wakes the refresher for shutdown */
+	omrthread_t refresher; /**< the refresher thread, which may have exited after idling; joined before it is replaced */
+	volatile BOOLEAN refresherRunning; /**< the refresher is taking snapshots, cleared when it idles out */
+	BOOLEAN refresherDisabled; /**< the refresher could not be started, snapshots are only taken on request */
+	volatile BOOLEAN readSinceRefresh; /**< a reader copied the snapshot since the refresher last took it */
+	BOOLEAN shutdown;
+} OMRResourceSnapshotCache;
+
+static void takeResourceSnapshot(struct OMRPortLibrary *portLibrary, OMRResourceSnapshot *snapshot);
+static void refreshResourceSnapshot(struct OMRPortLibrary *portLibrary, OMRResourceSnapshotCache *cache);
+static int J9THREAD_PROC resourceSnapshotRefresher(void *entryArg);
+static OMRResourceSnapshotCache *getResourceSnapshotCache(struct OMRPortLibrary *portLibrary);
+static void startResourceSnapshotRefresher(struct OMRPortLibrary *portLibrary, OMRResourceSnapshotCache *cache);
+static void destroyResourceSnapshotCache(struct OMRPortLibrary *portLibrary, OMRResourceSnapshotCache *cache);
+
 static intptr_t cwdname(struct OMRPortLibrary *portLibrary, char **result);
 static uint32_t getLimitSharedMemory(struct OMRPortLibrary *portLibrary, uint64_t *limit);
 static uint32_t getLimitFileDescriptors(struct OMRPortLibrary *portLibrary, uint64_t *result, BOOLEAN hardLimitRequested);
@@ -627,6 +656,8 @@ static BOOLEAN isRunningInContainer(struct OMRPortLibrary *portLibrary);
 static int32_t scanCgroupIntOrMax(struct OMRPortLibrary *portLibrary, const char *metricString, uint64_t *val);
 static int32_t readCgroupMemoryFileIntOrMax(struct OMRPortLibrary *portLibrary, const char *fileName, uint64_t *metric);
 static int32_t getCgroupMemoryLimit(struct OMRPortLibrary *portLibrary, uint64_t *limit);
+static int32_t getCgroupCpuQuota(struct OMRPortLibrary *portLibrary, int64_t *cpuQuota, uint64_t *cpuPeriod);
+static int32_t getMemoryPressure(struct OMRPortLibrary *portLibrary, uint32_t *some, uint32_t *full);
 static int32_t getCgroupSubsystemMetricMap(struct OMRPortLibrary *portLibrary, uint64_t subsystem, const struct OMRCgroupSubsystemMetricMap **subsystemMetricMap, uint32_t *numElements);
 #endif /* defined(LINUX) */
 
@@ -3098,62 +3129,10 @@ omrsysinfo_get_number_CPUs_by_type(struct OMRPortLibrary *portLibrary, uintptr_t
 		if (0 == toReturn) {
 			Trc_PRT_sysinfo_get_number_CPUs_by_type_failedBound("errno: ", errno);
 		} else if (portLibrary->sysinfo_cgroup_are_subsystems_enabled(portLibrary, OMR_CGROUP_SUBSYSTEM_CPU)) {
-			int32_t rc = 0;
 			int64_t cpuQuota = 0;
 			uint64_t cpuPeriod = 0;
-
-			if (OMR_ARE_ANY_BITS_SET(PPG_sysinfoControlFlags, OMRPORT_SYSINFO_CGROUP_V1_AVAILABLE)) {
-				/* cpu.cfs_quota_us and cpu.cfs_period_us files each contain only one integer value. */
-				int32_t numItemsToRead = 1;
-
-				/* If either file read fails, ignore cgroup cpu quota limits and continue. */
-				rc = readCgroupSubsystemFile(
-						portLibrary,
-						OMR_CGROUP_SUBSYSTEM_CPU,
-						CGROUP_CPU_CFS_QUOTA_US_FILE,
-						numItemsToRead,
-						"%ld",
-						&cpuQuota);
-				if (0 == rc) {
-					rc = readCgroupSubsystemFile(
-							portLibrary,
-							OMR_CGROUP_SUBSYSTEM_CPU,
-							CGROUP_CPU_CFS_PERIOD_US_FILE,
-							numItemsToRead,
-							"%lu",
-							&cpuPeriod);
-				}
-			} else if (OMR_ARE_ANY_BITS_SET(PPG_sysinfoControlFlags, OMRPORT_SYSINFO_CGROUP_V2_AVAILABLE)) {
-				/* Read cpu.max file which contains the quota and period in the format
-				 * "$QUOTA $PERIOD". The value "max" for $QUOTA indicates no limit.
-				 */
-				int32_t numItemsToRead = 2;
-				char quotaString[MAX_64BIT_INT_LENGTH];
-				uint64_t quotaVal = 0;
-
-				rc = readCgroupSubsystemFile(
-						portLibrary,
-						OMR_CGROUP_SUBSYSTEM_CPU,
-						CGROUP_CPU_MAX_FILE,
-						numItemsToRead,
-						"%s %lu",
-						&quotaString,
-						&cpuPeriod);
-				if (0 != rc) {
-					Trc_PRT_sysinfo_get_number_CPUs_by_type_read_failed(CGROUP_CPU_MAX_FILE, rc);
-				} else {
-					rc = scanCgroupIntOrMax(portLibrary, quotaString, &quotaVal);
-					if (0 == rc) {
-						if (UINT64_MAX == quotaVal) {
-							cpuQuota = -1;
-						} else {
-							cpuQuota = (int64_t)quotaVal;
-						}
-					}
-				}
-			} else {
-				Trc_PRT_Assert_ShouldNeverHappen();
-			}
+			/* If the quota can't be read, ignore cgroup cpu quota limits and continue. */
+			int32_t rc = getCgroupCpuQuota(portLibrary, &cpuQuota, &cpuPeriod);
 
 			if (0 == rc) {
 				/* numCpusQuota is calculated from the cpu quota time allocated per cpu period. */
@@ -3927,6 +3906,10 @@ omrsysinfo_shutdown(struct OMRPortLibrary *portLibrary)
 			portLibrary->mem_free_memory(portLibrary, PPG_si_executableName);
 			PPG_si_executableName = NULL;
 		}
+		if (NULL != PPG_resourceSnapshotCache) {
+			destroyResourceSnapshotCache(portLibrary, PPG_resourceSnapshotCache);
+			PPG_resourceSnapshotCache = NULL;
+		}
 #if defined(LINUX) && !defined(OMRZTPF)
 		omrthread_monitor_enter(cgroupMonitor);
 		freeCgroupEntries(portLibrary, PPG_cgroupEntryList);
@@ -3951,6 +3934,7 @@ omrsysinfo_startup(struct OMRPortLibrary *portLibrary)
 
 	PPG_criuSupportFlags = 0;
 	PPG_sysinfoControlFlags = 0;
+	PPG_resourceSnapshotCache = NULL;
 	/* Obtain and cache executable name; if this fails, executable name remains NULL, but
 	 * shouldn't cause failure to startup port library.  Failure will be noticed only
 	 * when the omrsysinfo_get_executable_name() actually gets invoked.
@@ -6748,6 +6732,124 @@ _end:
 	return rc;
 }
 
+/**
+ * Read the cgroup CPU quota, from cpu.cfs_quota_us and cpu.cfs_period_us with cgroup v1
+ * or cpu.max with cgroup v2.
+ *
+ * @param[in] portLibrary pointer to OMRPortLibrary
+ * @param[out] cpuQuota the CPU time the cgroup may use in each period, in microseconds, -1 if unlimited
+ * @param[out] cpuPeriod the length of the period in microseconds
+ *
+ * @return 0 on success, negative error code on any error
+ */
+static int32_t
+getCgroupCpuQuota(struct OMRPortLibrary *portLibrary, int64_t *cpuQuota, uint64_t *cpuPeriod)
+{
+	int32_t rc = OMRPORT_ERROR_SYSINFO_CGROUP_VERSION_NOT_AVAILABLE;
+
+	if (OMR_ARE_ANY_BITS_SET(PPG_sysinfoControlFlags, OMRPORT_SYSINFO_CGROUP_V1_AVAILABLE)) {
+		/* cpu.cfs_quota_us and cpu.cfs_period_us files each contain only one integer value. */
+		int32_t numItemsToRead = 1;
+
+		rc = readCgroupSubsystemFile(
+				portLibrary,
+				OMR_CGROUP_SUBSYSTEM_CPU,
+				CGROUP_CPU_CFS_QUOTA_US_FILE,
+				numItemsToRead,
+				"%ld",
+				cpuQuota);
+		if (0 == rc) {
+			rc = readCgroupSubsystemFile(
+					portLibrary,
+					OMR_CGROUP_SUBSYSTEM_CPU,
+					CGROUP_CPU_CFS_PERIOD_US_FILE,
+					numItemsToRead,
+					"%lu",
+					cpuPeriod);
+		}
+	} else if (OMR_ARE_ANY_BITS_SET(PPG_sysinfoControlFlags, OMRPORT_SYSINFO_CGROUP_V2_AVAILABLE)) {
+		/* Read cpu.max file which contains the quota and period in the format
+		 * "$QUOTA $PERIOD". The value "max" for $QUOTA indicates no limit.
+		 */
+		int32_t numItemsToRead = 2;
+		char quotaString[MAX_64BIT_INT_LENGTH];
+		uint64_t quotaVal = 0;
+
+		rc = readCgroupSubsystemFile(
+				portLibrary,
+				OMR_CGROUP_SUBSYSTEM_CPU,
+				CGROUP_CPU_MAX_FILE,
+				numItemsToRead,
+				"%s %lu",
+				&quotaString,
+				cpuPeriod);
+		if (0 != rc) {
+			Trc_PRT_sysinfo_get_number_CPUs_by_type_read_failed(CGROUP_CPU_MAX_FILE, rc);
+		} else {
+			rc = scanCgroupIntOrMax(portLibrary, quotaString, &quotaVal);
+			if (0 == rc) {
+				if (UINT64_MAX == quotaVal) {
+					*cpuQuota = -1;
+				} else {
+					*cpuQuota = (int64_t)quotaVal;
+				}
+			}
+		}
+	} else {
+		Trc_PRT_Assert_ShouldNeverHappen();
+	}
+
+	return rc;
+}
+
+/**
+ * Read the memory pressure stall information (PSI) of the cgroup from memory.pressure with
+ * cgroup v2, or of the whole system from /proc/pressure/memory otherwise. Each file has the lines
+ * "some avg10=%f avg60=%f avg300=%f total=%lu" and "full avg10=%f avg60=%f avg300=%f total=%lu".
+ *
+ * @param[in] portLibrary pointer to OMRPortLibrary
+ * @param[out] some the avg10 value of the "some" line, in hundredths of a percent
+ * @param[out] full the avg10 value of the "full" line, in hundredths of a percent
+ *
+ * @return 0 on success, negative error code on any error
+ */
+static int32_t
+getMemoryPressure(struct OMRPortLibrary *portLibrary, uint32_t *some, uint32_t *full)
+{
+	FILE *pressureFile = NULL;
+	char line[MAX_LINE_LENGTH];
+	uintptr_t linesFound = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(PPG_sysinfoControlFlags, OMRPORT_SYSINFO_CGROUP_V2_AVAILABLE)
+		&& portLibrary->sysinfo_cgroup_are_subsystems_enabled(portLibrary, OMR_CGROUP_SUBSYSTEM_MEMORY)
+	) {
+		if (0 != getHandleOfCgroupSubsystemFile(portLibrary, OMR_CGROUP_SUBSYSTEM_MEMORY, "memory.pressure", &pressureFile)) {
+			pressureFile = NULL;
+		}
+	}
+	if (NULL == pressureFile) {
+		pressureFile = fopen("/proc/pressure/memory", "r");
+		if (NULL == pressureFile) {
+			return portLibrary->error_set_last_error(portLibrary, errno, OMRPORT_ERROR_FILE_NOENT);
+		}
+	}
+
+	while (NULL != fgets(line, sizeof(line), pressureFile)) {
+		double avg10 = 0.0;
+
+		if (1 == sscanf(line, "some avg10=%lf", &avg10)) {
+			*some = (uint32_t)((avg10 * 100) + 0.5);
+			linesFound += 1;
+		} else if (1 == sscanf(line, "full avg10=%lf", &avg10)) {
+			*full = (uint32_t)((avg10 * 100) + 0.5);
+			linesFound += 1;
+		}
+	}
+	fclose(pressureFile);
+
+	return (2 == linesFound) ? 0 : OMRPORT_ERROR_SYSINFO_CGROUP_SUBSYSTEM_METRIC_NOT_AVAILABLE;
+}
+
 /**
  * Get the cgroup memory limit from the memory subsystem file. This will either be
  * memory.limit_in_bytes for cgroup v1 or memory.max for cgroup v2.
@@ -7268,6 +7370,227 @@ omrsysinfo_cgroup_subsystem_iterator_destroy(struct OMRPortLibrary *portLibrary,
 	}
 }
 
+/**
+ * Take a snapshot of the resources available to the process.
+ */
+static void
+takeResourceSnapshot(struct OMRPortLibrary *portLibrary, OMRResourceSnapshot *snapshot)
+{
+	memset(snapshot, 0, sizeof(*snapshot));
+	snapshot->onlineCPUs = portLibrary->sysinfo_get_number_CPUs_by_type(portLibrary, OMRPORT_CPU_ONLINE);
+	snapshot->boundCPUs = portLibrary->sysinfo_get_number_CPUs_by_type(portLibrary, OMRPORT_CPU_BOUND);
+
+#if defined(LINUX) && !defined(OMRZTPF)
+	if (portLibrary->sysinfo_cgroup_are_subsystems_enabled(portLibrary, OMR_CGROUP_SUBSYSTEM_CPU)) {
+		int64_t cpuQuota = 0;
+		uint64_t cpuPeriod = 0;
+
+		if ((0 == getCgroupCpuQuota(portLibrary, &cpuQuota, &cpuPeriod)) && (cpuQuota > 0) && (0 != cpuPeriod)) {
+			snapshot->cpuQuotaMillicores = ((uint64_t)cpuQuota * 1000) / cpuPeriod;
+			snapshot->flags |= OMRPORT_RESOURCE_SNAPSHOT_CPU_QUOTA_SET;
+		}
+	}
+	if (portLibrary->sysinfo_cgroup_are_subsystems_enabled(portLibrary, OMR_CGROUP_SUBSYSTEM_MEMORY)) {
+		if (0 == getCgroupMemoryLimit(portLibrary, &snapshot->memoryLimit)) {
+			snapshot->flags |= OMRPORT_RESOURCE_SNAPSHOT_MEMORY_LIMIT_SET;
+		}
+	}
+	if (0 == getMemoryPressure(portLibrary, &snapshot->memoryPressureSome, &snapshot->memoryPressureFull)) {
+		snapshot->flags |= OMRPORT_RESOURCE_SNAPSHOT_MEMORY_PRESSURE_AVAILABLE;
+	}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+}
+
+/**
+ * Take the snapshot again and publish it to the readers of the cache.
+ */
+static void
+refreshResourceSnapshot(struct OMRPortLibrary *portLibrary, OMRResourceSnapshotCache *cache)
+{
+	OMRResourceSnapshot snapshot;
+
+	omrthread_monitor_enter(cache->monitor);
+	takeResourceSnapshot(portLibrary, &snapshot);
+	snapshot.generation = cache->snapshot.generation + 1;
+
+	cache->sequence += 1;
+	issueWriteBarrier();
+	cache->snapshot = snapshot;
+	issueWriteBarrier();
+	cache->sequence += 1;
+	omrthread_monitor_exit(cache->monitor);
+}
+
+static int J9THREAD_PROC
+resourceSnapshotRefresher(void *entryArg)
+{
+	struct OMRPortLibrary *portLibrary = (struct OMRPortLibrary *)entryArg;
+	OMRResourceSnapshotCache *cache = PPG_resourceSnapshotCache;
+	uintptr_t idleRefreshes = 0;
+
+	omrthread_monitor_enter(cache->monitor);
+	while (!cache->shutdown) {
+		omrthread_monitor_wait_timed(cache->monitor, OMRSYSINFO_RESOURCE_SNAPSHOT_INTERVAL_MILLIS, 0);
+		if (cache->shutdown) {
+			break;
+		}
+		/* the monitor is re-entrant */
+		refreshResourceSnapshot(portLibrary, cache);
+		if (cache->readSinceRefresh) {
+			cache->readSinceRefresh = FALSE;
+			idleRefreshes = 0;
+		} else {
+			idleRefreshes += 1;
+			if (OMRSYSINFO_RESOURCE_SNAPSHOT_IDLE_REFRESHES <= idleRefreshes) {
+				/* nobody is reading the snapshot, the next reader starts a new refresher */
+				break;
+			}
+		}
+	}
+	cache->refresherRunning = FALSE;
+	omrthread_monitor_exit(cache->monitor);
+	return 0;
+}
+
+/**
+ * Start the refresher thread of a resource snapshot cache, unless it is running, the cache is
+ * shutting down or the thread could not be started before. A refresher that idled out is
+ * joined first, and the snapshot it left behind is taken again.
+ */
+static void
+startResourceSnapshotRefresher(struct OMRPortLibrary *portLibrary, OMRResourceSnapshotCache *cache)
+{
+	omrthread_monitor_enter(cache->monitor);
+	if (!cache->refresherRunning && !cache->refresherDisabled && !cache->shutdown) {
+		omrthread_attr_t attr = NULL;
+
+		if (NULL != cache->refresher) {
+			/* the refresher cleared refresherRunning and released the monitor for the last time */
+			omrthread_join(cache->refresher);
+			cache->refresher = NULL;
+			refreshResourceSnapshot(portLibrary, cache);
+		}
+
+		/* without the refresher the snapshot is only taken again by omrsysinfo_refresh_resource_snapshot */
+		cache->refresherDisabled = TRUE;
+		if (J9THREAD_SUCCESS == omrthread_attr_init(&attr)) {
+			omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+			omrthread_attr_set_category(&attr, J9THREAD_CATEGORY_SYSTEM_THREAD);
+			omrthread_attr_set_name(&attr, "omrsysinfo resource snapshot");
+			cache->refresherRunning = TRUE;
+			if (J9THREAD_SUCCESS == omrthread_create_ex(&cache->refresher, &attr, 0, resourceSnapshotRefresher, portLibrary)) {
+				cache->refresherDisabled = FALSE;
+			} else {
+				cache->refresher = NULL;
+				cache->refresherRunning = FALSE;
+			}
+			omrthread_attr_destroy(&attr);
+		}
+	}
+	omrthread_monitor_exit(cache->monitor);
+}
+
+/**
+ * Return the resource snapshot cache of the port library, creating it on first use.
+ * The refresher thread is started by the readers of the snapshot.
+ *
+ * @return the cache, or NULL if it could not be created.
+ */
+static OMRResourceSnapshotCache *
+getResourceSnapshotCache(struct OMRPortLibrary *portLibrary)
+{
+	OMRResourceSnapshotCache *cache = PPG_resourceSnapshotCache;
+
+	if (NULL == cache) {
+		cache = portLibrary->mem_allocate_memory(portLibrary, sizeof(*cache), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == cache) {
+			return NULL;
+		}
+		memset(cache, 0, sizeof(*cache));
+		if (0 != omrthread_monitor_init_with_name(&cache->monitor, 0, "omrsysinfo resource snapshot")) {
+			portLibrary->mem_free_memory(portLibrary, cache);
+			return NULL;
+		}
+		takeResourceSnapshot(portLibrary, &cache->snapshot);
+		cache->snapshot.generation = 1;
+
+		/* another thread may have created the cache at the same time */
+		if (0 != compareAndSwapUDATA((uintptr_t *)&PPG_resourceSnapshotCache, (uintptr_t)NULL, (uintptr_t)cache)) {
+			omrthread_monitor_destroy(cache->monitor);
+			portLibrary->mem_free_memory(portLibrary, cache);
+			return PPG_resourceSnapshotCache;
+		}
+	}
+	return cache;
+}
+
+/**
+ * Stop the refresher thread of a resource snapshot cache, if it is still running, and free the cache.
+ */
+static void
+destroyResourceSnapshotCache(struct OMRPortLibrary *portLibrary, OMRResourceSnapshotCache *cache)
+{
+	omrthread_monitor_enter(cache->monitor);
+	cache->shutdown = TRUE;
+	omrthread_monitor_notify_all(cache->monitor);
+	omrthread_monitor_exit(cache->monitor);
+
+	if (NULL != cache->refresher) {
+		omrthread_join(cache->refresher);
+	}
+	omrthread_monitor_destroy(cache->monitor);
+	portLibrary->mem_free_memory(portLibrary, cache);
+}
+
+int32_t
+omrsysinfo_get_resource_snapshot(struct OMRPortLibrary *portLibrary, struct OMRResourceSnapshot *snapshot)
+{
+	OMRResourceSnapshotCache *cache = NULL;
+
+	if (NULL == snapshot) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	cache = getResourceSnapshotCache(portLibrary);
+	if (NULL == cache) {
+		return OMRPORT_ERROR_SYSINFO_MEMORY_ALLOC_FAILED;
+	}
+	if (!cache->refresherRunning && !cache->refresherDisabled) {
+		startResourceSnapshotRefresher(portLibrary, cache);
+	}
+	/* only store when needed, so readers don't keep writing to the cache line */
+	if (!cache->readSinceRefresh) {
+		cache->readSinceRefresh = TRUE;
+	}
+
+	for (;;) {
+		uintptr_t sequence = cache->sequence;
+
+		issueReadBarrier();
+		if (0 == (sequence & 1)) {
+			*snapshot = cache->snapshot;
+			issueReadBarrier();
+			if (sequence == cache->sequence) {
+				break;
+			}
+		}
+		/* a refresh is replacing the snapshot */
+		omrthread_yield();
+	}
+	return 0;
+}
+
+int32_t
+omrsysinfo_refresh_resource_snapshot(struct OMRPortLibrary *portLibrary)
+{
+	OMRResourceSnapshotCache *cache = getResourceSnapshotCache(portLibrary);
+
+	if (NULL == cache) {
+		return OMRPORT_ERROR_SYSINFO_MEMORY_ALLOC_FAILED;
+	}
+	refreshResourceSnapshot(portLibrary, cache);
+	return 0;
+}
+
 #if defined(OMRZTPF)
 /*
  * Return the number of I-streams ("processors", as called by other
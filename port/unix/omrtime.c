@@ -34,6 +34,18 @@
 #include <sys/types.h>
 #include <sys/time.h>
 #include "omrport.h"
+#if defined(LINUX) && defined(J9HAMMER)
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include "omrportpriv.h"
+#include "omrportpg.h"
+#include "omrsysinfo_helpers.h"
+#include "omrutilbase.h"
+
+/* omrtime_fast_nano_time reads the invariant TSC */
+#define OMRTIME_TSC_CLOCK
+#endif /* defined(LINUX) && defined(J9HAMMER) */
 
 #if defined(OSX) || defined(LINUX)
 /* Frequency is nanoseconds / second */
@@ -51,6 +63,23 @@ static clock_serv_t cs_t;
 static const clockid_t OMRTIME_NANO_CLOCK = CLOCK_MONOTONIC;
 #endif /* defined(OSX) */
 
+#if defined(OMRTIME_TSC_CLOCK)
+/* Fixed point shift of PPG_time_tscScaledNanosPerTick */
+#define OMRTIME_TSC_SCALE_SHIFT 32
+/* Length of each of the two TSC calibration intervals */
+#define OMRTIME_TSC_CALIBRATION_NANOS J9CONST_I64(1000000)
+/* Largest difference between the tick rates of the calibration intervals, as a fraction 1/n */
+#define OMRTIME_TSC_RATE_TOLERANCE 1000
+/* Bit 8 of EDX from CPUID leaf 0x80000007: the TSC runs at a constant rate in all ACPI P-, C- and T-states */
+#define OMRTIME_CPUID_INVARIANT_TSC 0x100
+/* Values of PPG_time_tscCalibrationState */
+#define OMRTIME_TSC_UNCALIBRATED 0
+#define OMRTIME_TSC_CALIBRATING 1
+#define OMRTIME_TSC_CALIBRATED 2
+
+static void calibrate_tsc(struct OMRPortLibrary *portLibrary);
+#endif /* defined(OMRTIME_TSC_CLOCK) */
+
 
 /**
  * Query OS for timestamp.
@@ -175,6 +204,214 @@ omrtime_hires_clock(struct OMRPortLibrary *portLibrary)
 	return ((uint64_t)tp.tv_sec * 1000000) + (uint64_t)tp.tv_usec;
 #endif /* defined(OSX) */
 }
+
+#if defined(OMRTIME_TSC_CLOCK)
+static VMINLINE uint64_t
+read_tsc(void)
+{
+	uint32_t lower = 0;
+	uint32_t upper = 0;
+
+	__asm__ __volatile__("rdtsc" : "=a" (lower), "=d" (upper));
+	return ((uint64_t)upper << 32) | lower;
+}
+
+/**
+ * @internal Read the TSC and CLOCK_MONOTONIC together. The TSC is read before and after the
+ * clock and the attempt with the shortest gap is kept, so an interrupt or a preemption between
+ * the reads doesn't skew the calibration.
+ *
+ * @param[out] tsc The TSC value half way between the reads.
+ * @param[out] nanos The CLOCK_MONOTONIC value in nanoseconds.
+ *
+ * @return TRUE on success, FALSE if the clock could not be read.
+ */
+static BOOLEAN
+sample_tsc(uint64_t *tsc, int64_t *nanos)
+{
+	uint64_t bestGap = (uint64_t)-1;
+	uintptr_t attempt = 0;
+
+	for (attempt = 0; attempt < 5; attempt++) {
+		struct timespec ts;
+		uint64_t before = read_tsc();
+		uint64_t after = 0;
+
+		if (0 != clock_gettime(OMRTIME_NANO_CLOCK, &ts)) {
+			return FALSE;
+		}
+		after = read_tsc();
+		if ((after >= before) && ((after - before) < bestGap)) {
+			bestGap = after - before;
+			*tsc = before + (bestGap / 2);
+			*nanos = ((int64_t)ts.tv_sec * OMRTIME_NANOSECONDS_PER_SECOND) + (int64_t)ts.tv_nsec;
+		}
+	}
+	return ((uint64_t)-1 != bestGap);
+}
+
+/**
+ * @internal Check that the TSC can be used as a clock: the CPU must report an invariant TSC and
+ * the kernel must still be using it as its clocksource. The kernel switches to another
+ * clocksource when it finds the TSC unsynchronized between CPUs or drifting against the
+ * other timers, which also covers hypervisors that don't provide a stable TSC.
+ *
+ * @return TRUE if the TSC is stable.
+ */
+static BOOLEAN
+is_tsc_stable(void)
+{
+	uint32_t cpuInfo[4];
+	char clocksource[16];
+	ssize_t bytesRead = 0;
+	int fd = -1;
+
+	omrsysinfo_get_x86_cpuid(0x80000000, cpuInfo);
+	if (cpuInfo[0] < 0x80000007) {
+		return FALSE;
+	}
+	omrsysinfo_get_x86_cpuid(0x80000007, cpuInfo);
+	if (OMR_ARE_NO_BITS_SET(cpuInfo[3], OMRTIME_CPUID_INVARIANT_TSC)) {
+		return FALSE;
+	}
+
+	fd = open("/sys/devices/system/clocksource/clocksource0/current_clocksource", O_RDONLY);
+	if (-1 == fd) {
+		return FALSE;
+	}
+	bytesRead = read(fd, clocksource, sizeof(clocksource) - 1);
+	close(fd);
+	if (bytesRead <= 0) {
+		return FALSE;
+	}
+	clocksource[bytesRead] = '\0';
+	return (0 == strcmp(clocksource, "tsc\n"));
+}
+
+/**
+ * @internal Measure the TSC rate against CLOCK_MONOTONIC over two back to back intervals.
+ *
+ * @param[out] tscBase The TSC value at the end of the measurement.
+ * @param[out] nanoBase The CLOCK_MONOTONIC value at tscBase.
+ *
+ * @return the nanoseconds per tick scaled by 2^OMRTIME_TSC_SCALE_SHIFT, or 0 if the TSC
+ * is not stable or the rates measured in both intervals don't agree.
+ */
+static uint64_t
+measure_tsc_rate(uint64_t *tscBase, int64_t *nanoBase)
+{
+	uint64_t tsc[3];
+	int64_t nanos[3];
+	uintptr_t i = 0;
+
+	if (!is_tsc_stable()) {
+		return 0;
+	}
+
+	for (i = 0; i < 3; i++) {
+		if (0 != i) {
+			/* spin rather than sleep, so the interval is not stretched by the scheduler */
+			int64_t now = 0;
+			uint64_t ignored = 0;
+			do {
+				if (!sample_tsc(&ignored, &now)) {
+					return 0;
+				}
+			} while ((now - nanos[i - 1]) < OMRTIME_TSC_CALIBRATION_NANOS);
+		}
+		if (!sample_tsc(&tsc[i], &nanos[i])) {
+			return 0;
+		}
+	}
+
+	if ((tsc[1] > tsc[0]) && (tsc[2] > tsc[1])) {
+		double rate1 = (double)(nanos[1] - nanos[0]) / (double)(tsc[1] - tsc[0]);
+		double rate2 = (double)(nanos[2] - nanos[1]) / (double)(tsc[2] - tsc[1]);
+		double difference = (rate1 > rate2) ? (rate1 - rate2) : (rate2 - rate1);
+
+		if ((difference * OMRTIME_TSC_RATE_TOLERANCE) <= rate1) {
+			*tscBase = tsc[2];
+			*nanoBase = nanos[2];
+			return ((uint64_t)(nanos[2] - nanos[0]) << OMRTIME_TSC_SCALE_SHIFT) / (tsc[2] - tsc[0]);
+		}
+	}
+	return 0;
+}
+
+/**
+ * @internal Calibrate the TSC on the first call of omrtime_fast_nano_time, so that port
+ * libraries that never use it don't spend the calibration time at startup. Only one thread
+ * calibrates; callers racing with it return at once and use omrtime_nano_time until the
+ * calibration is published. If the TSC can't be used, the scale stays 0 and
+ * omrtime_fast_nano_time always falls back to omrtime_nano_time.
+ *
+ * @param[in] portLibrary The port library.
+ */
+static void
+calibrate_tsc(struct OMRPortLibrary *portLibrary)
+{
+	uint64_t tscBase = 0;
+	int64_t nanoBase = 0;
+	uint64_t scale = 0;
+
+	if (OMRTIME_TSC_UNCALIBRATED != compareAndSwapUDATA((uintptr_t *)&PPG_time_tscCalibrationState, OMRTIME_TSC_UNCALIBRATED, OMRTIME_TSC_CALIBRATING)) {
+		return;
+	}
+
+	scale = measure_tsc_rate(&tscBase, &nanoBase);
+	PPG_time_tscBase = tscBase;
+	PPG_time_tscNanoBase = nanoBase;
+	PPG_time_tscScaledNanosPerTick = scale;
+	issueWriteBarrier();
+	PPG_time_tscCalibrationState = OMRTIME_TSC_CALIBRATED;
+}
+#endif /* defined(OMRTIME_TSC_CLOCK) */
+
+/**
+ * Query OS for timestamp.
+ * Retrieve the current value of a monotonic clock in nanoseconds, favouring a low cost per call
+ * over precision. Use it to time short intervals on hot paths.
+ *
+ * On x86-64 Linux the invariant TSC is read and converted with the rate calibrated against
+ * CLOCK_MONOTONIC on the first call, avoiding clock_gettime. Elsewhere, or when the TSC
+ * is not stable, this is @ref omrtime_nano_time.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return time value in nanoseconds, to be compared only with other values from this function.
+ */
+int64_t
+omrtime_fast_nano_time(struct OMRPortLibrary *portLibrary)
+{
+#if defined(OMRTIME_TSC_CLOCK)
+	uint64_t scale = 0;
+
+	if (OMRTIME_TSC_CALIBRATED != PPG_time_tscCalibrationState) {
+		calibrate_tsc(portLibrary);
+		if (OMRTIME_TSC_CALIBRATED != PPG_time_tscCalibrationState) {
+			return portLibrary->time_nano_time(portLibrary);
+		}
+	}
+	issueReadBarrier();
+	scale = PPG_time_tscScaledNanosPerTick;
+	if (0 != scale) {
+		uint64_t tsc = read_tsc();
+		uint64_t ticks = 0;
+
+		/* another CPU's TSC may be a few ticks behind the calibration value */
+		if (tsc <= PPG_time_tscBase) {
+			return PPG_time_tscNanoBase;
+		}
+		ticks = tsc - PPG_time_tscBase;
+		/* multiply in two halves so the 64 bit product doesn't overflow */
+		return PPG_time_tscNanoBase
+			+ (int64_t)(((ticks >> OMRTIME_TSC_SCALE_SHIFT) * scale)
+			+ (((ticks & 0xFFFFFFFF) * scale) >> OMRTIME_TSC_SCALE_SHIFT));
+	}
+#endif /* defined(OMRTIME_TSC_CLOCK) */
+	return portLibrary->time_nano_time(portLibrary);
+}
+
 /**
  * Query OS for clock frequency
  * Retrieves the frequency of the high-resolution performance counter.
@@ -273,6 +510,10 @@ omrtime_startup(struct OMRPortLibrary *portLibrary)
 	if (0 != clock_getres(OMRTIME_NANO_CLOCK, &ts)) {
 		rc = OMRPORT_ERROR_STARTUP_TIME;
 	}
+#if defined(OMRTIME_TSC_CLOCK)
+	/* the TSC is calibrated by the first omrtime_fast_nano_time call */
+	PPG_time_tscCalibrationState = OMRTIME_TSC_UNCALIBRATED;
+#endif /* defined(OMRTIME_TSC_CLOCK) */
 #endif /* defined(OSX) */
 
 	return rc;
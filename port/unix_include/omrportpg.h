@@ -110,11 +110,18 @@ typedef struct OMRPortPlatformGlobals {
 	uintptr_t performFullMemorySearch; /**< Always perform full range memory search even smart address can not be established */
 	BOOLEAN syscallNotAllowed; /**< Assigned True if the mempolicy syscall is failed due to security opts (Can be seen in case of docker) */
 #endif /* defined(LINUX) */
+#if defined(LINUX) && defined(J9HAMMER)
+	uint64_t time_tscBase; /**< TSC value when omrtime_fast_nano_time was calibrated */
+	int64_t time_tscNanoBase; /**< omrtime_nano_time value at time_tscBase */
+	uint64_t time_tscScaledNanosPerTick; /**< nanoseconds per TSC tick scaled by 2^32, 0 if the TSC is not used */
+	volatile uintptr_t time_tscCalibrationState; /**< whether omrtime_fast_nano_time has calibrated the TSC yet, see OMRTIME_TSC_CALIBRATED */
+#endif /* defined(LINUX) && defined(J9HAMMER) */
 	OMRSTFLECache stfleCache;
 #if defined(AIXPPC)
 	int pageProtectionPossible;
 #endif
 	uintptr_t criuSupportFlags;
+	struct OMRResourceSnapshotCache *resourceSnapshotCache; /**< cached resource snapshot, NULL until omrsysinfo_get_resource_snapshot is first called */
 } OMRPortPlatformGlobals;
 
 
@@ -167,6 +174,13 @@ typedef struct OMRPortPlatformGlobals {
 #define PPG_memfd_function (portLibrary->portGlobals->platformGlobals.memfd_function)
 #endif /* defined(LINUX) */
 
+#if defined(LINUX) && defined(J9HAMMER)
+#define PPG_time_tscBase (portLibrary->portGlobals->platformGlobals.time_tscBase)
+#define PPG_time_tscNanoBase (portLibrary->portGlobals->platformGlobals.time_tscNanoBase)
+#define PPG_time_tscScaledNanosPerTick (portLibrary->portGlobals->platformGlobals.time_tscScaledNanosPerTick)
+#define PPG_time_tscCalibrationState (portLibrary->portGlobals->platformGlobals.time_tscCalibrationState)
+#endif /* defined(LINUX) && defined(J9HAMMER) */
+
 #define PPG_stfleCache (portLibrary->portGlobals->platformGlobals.stfleCache)
 
 #if defined(AIXPPC)
@@ -177,6 +191,7 @@ typedef struct OMRPortPlatformGlobals {
 #endif
 
 #define PPG_criuSupportFlags (portLibrary->portGlobals->platformGlobals.criuSupportFlags)
+#define PPG_resourceSnapshotCache (portLibrary->portGlobals->platformGlobals.resourceSnapshotCache)
 
 #endif /* omrportpg_h */
 
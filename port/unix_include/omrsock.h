@@ -67,6 +67,9 @@ typedef struct sockaddr_in6 omr_os_sockaddr_in6; /* IPv6 */
 #define OS_SO_RCVTIMEO SO_RCVTIMEO
 #define OS_SO_SNDTIMEO SO_SNDTIMEO
 #define OS_TCP_NODELAY TCP_NODELAY
+#if defined(SO_ZEROCOPY)
+#define OS_SO_ZEROCOPY SO_ZEROCOPY
+#endif
 
 /* Socket Flags */
 #if defined(J9ZOS390)
@@ -78,6 +81,15 @@ typedef struct sockaddr_in6 omr_os_sockaddr_in6; /* IPv6 */
 #endif
 #define OS_O_NONBLOCK O_NONBLOCK
 
+/* Message Flags */
+#if defined(MSG_DONTWAIT)
+#define OS_MSG_DONTWAIT MSG_DONTWAIT
+#endif
+#define OS_MSG_WAITALL MSG_WAITALL
+#if defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+#define OS_MSG_ZEROCOPY MSG_ZEROCOPY
+#endif
+
 /* Socket Poll */
 #define OS_POLLIN POLLIN
 #define OS_POLLOUT POLLOUT
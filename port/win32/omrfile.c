@@ -960,6 +960,176 @@ omrfile_set_length(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t newL
 	return lastError;
 }
 
+/**
+ * Read from a file at the given offset into a list of buffers, see the unix implementation.
+ *
+ * Each buffer is read with its own overlapped ReadFile. On a handle opened for synchronous
+ * I/O this also moves the file pointer, which callers of the positional API don't rely on.
+ */
+intptr_t
+omrfile_preadv(struct OMRPortLibrary *portLibrary, intptr_t fd, const OMRIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	intptr_t total = 0;
+	int32_t i = 0;
+
+	Trc_PRT_file_preadv_Entry(fd, iov, iovcnt, offset);
+
+	if ((iovcnt < 0) || (offset < 0)) {
+		total = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+		Trc_PRT_file_preadv_Exit(total);
+		return total;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		OVERLAPPED overlapped;
+		DWORD bytesRead = 0;
+		const uint64_t position = (uint64_t)(offset + total);
+
+		memset(&overlapped, 0, sizeof(overlapped));
+		overlapped.Offset = (DWORD)position;
+		overlapped.OffsetHigh = (DWORD)(position >> 32);
+		if (FALSE == ReadFile((HANDLE)fd, iov[i].iov_base, (DWORD)iov[i].iov_len, &bytesRead, &overlapped)) {
+			int32_t error = GetLastError();
+			if (ERROR_HANDLE_EOF != error) {
+				if (0 == total) {
+					total = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+				}
+			}
+			break;
+		}
+		total += bytesRead;
+		if (bytesRead < (DWORD)iov[i].iov_len) {
+			break;
+		}
+	}
+
+	Trc_PRT_file_preadv_Exit(total);
+	return total;
+}
+
+/**
+ * Write a list of buffers to a file at the given offset, see the unix implementation.
+ *
+ * Each buffer is written with its own overlapped WriteFile. On a handle opened for
+ * synchronous I/O this also moves the file pointer.
+ */
+intptr_t
+omrfile_pwritev(struct OMRPortLibrary *portLibrary, intptr_t fd, const OMRIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	intptr_t total = 0;
+	int32_t i = 0;
+
+	Trc_PRT_file_pwritev_Entry(fd, iov, iovcnt, offset);
+
+	if ((iovcnt < 0) || (offset < 0)) {
+		total = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+		Trc_PRT_file_pwritev_Exit(total);
+		return total;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		OVERLAPPED overlapped;
+		DWORD bytesWritten = 0;
+		const uint64_t position = (uint64_t)(offset + total);
+
+		memset(&overlapped, 0, sizeof(overlapped));
+		overlapped.Offset = (DWORD)position;
+		overlapped.OffsetHigh = (DWORD)(position >> 32);
+		if (FALSE == WriteFile((HANDLE)fd, iov[i].iov_base, (DWORD)iov[i].iov_len, &bytesWritten, &overlapped)) {
+			if (0 == total) {
+				int32_t error = GetLastError();
+				total = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+			}
+			break;
+		}
+		total += bytesWritten;
+		if (bytesWritten < (DWORD)iov[i].iov_len) {
+			break;
+		}
+	}
+
+	Trc_PRT_file_pwritev_Exit(total);
+	return total;
+}
+
+/**
+ * Windows has no per-range access advice for an open handle, so the hint is only validated.
+ */
+int32_t
+omrfile_fadvise(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, int32_t advice)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_file_fadvise_Entry(fd, offset, length, advice);
+
+	if ((offset < 0) || (length < 0) || (advice < OMRPORT_FILE_ADVICE_NORMAL) || (advice > OMRPORT_FILE_ADVICE_NOREUSE)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+	}
+
+	Trc_PRT_file_fadvise_Exit(rc);
+	return rc;
+}
+
+/**
+ * Reserve disk space for a range of a file, see the unix implementation. The space is
+ * reserved by raising the allocation size of the file, which leaves its length unchanged;
+ * the file is then extended unless OMRPORT_FILE_FALLOCATE_KEEP_SIZE is specified.
+ */
+int32_t
+omrfile_fallocate(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, uint32_t flags)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_file_fallocate_Entry(fd, offset, length, flags);
+
+	if ((offset < 0) || (length < 0)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+	} else if (0 != length) {
+		const int64_t end = offset + length;
+		FILE_STANDARD_INFO standardInfo;
+
+		if (FALSE == GetFileInformationByHandleEx((HANDLE)fd, FileStandardInfo, &standardInfo, sizeof(standardInfo))) {
+			int32_t error = GetLastError();
+			rc = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+		} else if (standardInfo.AllocationSize.QuadPart < end) {
+			FILE_ALLOCATION_INFO allocationInfo;
+			allocationInfo.AllocationSize.QuadPart = end;
+			if (FALSE == SetFileInformationByHandle((HANDLE)fd, FileAllocationInfo, &allocationInfo, sizeof(allocationInfo))) {
+				int32_t error = GetLastError();
+				rc = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+			}
+		}
+
+		if ((0 == rc)
+			&& OMR_ARE_NO_BITS_SET(flags, OMRPORT_FILE_FALLOCATE_KEEP_SIZE)
+			&& (standardInfo.EndOfFile.QuadPart < end)
+		) {
+			rc = omrfile_set_length(portLibrary, fd, end);
+		}
+	}
+
+	Trc_PRT_file_fallocate_Exit(rc);
+	return rc;
+}
+
+/**
+ * Windows has no read-ahead request for an open handle, so this is a no-op.
+ */
+int32_t
+omrfile_readahead(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_file_readahead_Entry(fd, offset, length);
+
+	if ((offset < 0) || (length < 0)) {
+		rc = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_INVAL);
+	}
+
+	Trc_PRT_file_readahead_Exit(rc);
+	return rc;
+}
+
 int32_t
 omrfile_lock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd, int32_t lockFlags, uint64_t offset, uint64_t length)
 {
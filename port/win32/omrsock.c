@@ -285,3 +285,75 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
 }
+
+int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_timer_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, uint64_t delayMillis, uint64_t periodMillis, void *userData, omrsock_timer_t *timer)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_timer_cancel(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_timer_t *timer)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+intptr_t
+omrsock_sendmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+intptr_t
+omrsock_recvmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, const OMRIOVec *iov, int32_t iovcnt, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int64_t
+omrsock_sendfile(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, int64_t count)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_get_zerocopy_completion(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *firstSend, uint32_t *lastSend, BOOLEAN *copied)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
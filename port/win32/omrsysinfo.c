@@ -1989,3 +1989,15 @@ omrsysinfo_cgroup_subsystem_iterator_destroy(struct OMRPortLibrary *portLibrary,
 	return;
 }
 
+int32_t
+omrsysinfo_get_resource_snapshot(struct OMRPortLibrary *portLibrary, struct OMRResourceSnapshot *snapshot)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsysinfo_refresh_resource_snapshot(struct OMRPortLibrary *portLibrary)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
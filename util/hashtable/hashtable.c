@@ -67,6 +67,15 @@
 #define AVL_TREE_TAG(p) ((J9AVLTree *)(((uintptr_t)(p)) | AVL_TREE_TAG_BIT))
 #define AVL_TREE_UNTAG(p) ((J9AVLTree *)(((uintptr_t)(p)) & (~AVL_TREE_TAG_BIT)))
 
+/**
+ * Memory unlinked from a J9HASH_TABLE_CONCURRENT table, kept until hashTableReclaimRetired()
+ * as lock-free readers may still be traversing it.
+ */
+typedef struct J9HashTableRetired {
+	void *memory;
+	uintptr_t isBucketArray;
+} J9HashTableRetired;
+
 /**
  * Stolen from gc_base/gcutils.h
  */
@@ -92,6 +101,18 @@ static void rebuildFromPools(J9HashTable *table, uint32_t newSize, void **newNod
 static uintptr_t hashTableGrowSpaceOpt(J9HashTable *, uint32_t newSize);
 static uintptr_t hashTableGrowListNodes(J9HashTable *table, uint32_t newSize);
 static uintptr_t collisionResilientHashTableGrow(J9HashTable *table, uint32_t newSize);
+static void rehashChains(J9HashTable *table);
+static void concurrentLock(uint32_t *lock);
+static void concurrentUnlock(uint32_t *lock);
+static void concurrentLockAll(J9HashTable *table);
+static void concurrentUnlockAll(J9HashTable *table);
+static void concurrentAddToNodeCount(J9HashTable *table, int32_t delta);
+static void **concurrentLockBucket(J9HashTable *table, uintptr_t hashCode, uint32_t **lock);
+static void concurrentRetire(J9HashTable *table, void *memory, uintptr_t isBucketArray);
+static void *hashTableFindConcurrent(J9HashTable *table, void *entry);
+static void *hashTableAddConcurrent(J9HashTable *table, void *entry);
+static uint32_t hashTableRemoveConcurrent(J9HashTable *table, void *entry);
+static void hashTableGrowConcurrent(J9HashTable *table);
 
 static const uint32_t primesTable[] = {
 	17,
@@ -235,6 +256,25 @@ collisionResilientHashTableNew(
  *  	hashTableRehash()
  *  	hashTableDoRemove()
  *
+ *  When J9HASH_TABLE_CONCURRENT is set, hashTableFind() takes no locks and may run concurrently
+ *  with hashTableAdd(), hashTableRemove() and hashTableRehash(), which serialize among themselves
+ *  through per-bucket lock stripes. Growing relinks the chains in place while lookups that miss
+ *  during a resize retry, so entry addresses stay stable. Removed nodes and replaced bucket arrays
+ *  are retired rather than freed and are only released by hashTableReclaimRetired() or hashTableFree(),
+ *  which the caller must invoke when no thread can still be in hashTableFind() (for example under
+ *  exclusive access). Iteration still requires the caller to exclude writers.
+ *
+ *  When J9HASH_TABLE_OPEN_ADDRESSING is set, entries are copied into a flat slot array indexed
+ *  through one control byte per slot, and a lookup compares a whole group of control bytes at
+ *  once (with SSE2 where available) before calling hashEqualFn. There is no per-entry node or
+ *  next pointer, so lookups touch less memory and small entries such as pointer-keyed records
+ *  take less space. Entries move when the table grows or is rehashed: a pointer returned by
+ *  hashTableFind() or hashTableAdd() is only valid until the next hashTableAdd() or hashTableRehash().
+ *  Entry alignment beyond that of the port library allocator is not honoured.
+ *  Iteration, hashTableDoRemove() and hashTableForEachDo() are supported; the flag cannot be
+ *  combined with J9HASH_TABLE_COLLISION_RESILIENT or J9HASH_TABLE_CONCURRENT and
+ *  J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION is ignored.
+ *
  */
 J9HashTable *
 hashTableNew(
@@ -271,6 +311,7 @@ hashTableNewImpl(
 {
 	J9HashTable *hashTable = NULL;
 	BOOLEAN spaceOpt = FALSE;
+	BOOLEAN concurrent = (J9HASH_TABLE_CONCURRENT == (flags & J9HASH_TABLE_CONCURRENT));
 	HASHTABLE_DEBUG_PORT(portLibrary);
 
 	hashTable = portLibrary->mem_allocate_memory(portLibrary, sizeof(J9HashTable), tableName, memoryCategory);
@@ -311,6 +352,18 @@ hashTableNewImpl(
 	}
 	hashTable->nodeAlignment = entryAlignment;
 
+	if (J9HASH_TABLE_OPEN_ADDRESSING == (flags & J9HASH_TABLE_OPEN_ADDRESSING)) {
+		if (concurrent || (J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT))) {
+			goto error;
+		}
+		hashTable->equalFnUserData = functionUserData;
+		hashTable->hashEqualFn = hashEqualFn;
+		if (0 != openHashTableInitialize(hashTable, tableSize)) {
+			goto error;
+		}
+		return hashTable;
+	}
+
 	if (J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION == ((flags & J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION))
 		&& (hashTable->listNodeSize == (2 * sizeof(uintptr_t)))
 		&& (hashTable->tableSize <= SPACE_OPT_LIMIT)
@@ -318,6 +371,7 @@ hashTableNewImpl(
 		&& (0 == (flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32))
 #endif /* OMR_ENV_DATA64 */
 		&& (!(J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT)))
+		&& !concurrent
 	) {
 		/* create a hashTable with no backing pool */
 		spaceOpt = TRUE;
@@ -340,6 +394,22 @@ hashTableNewImpl(
 		}
 	}
 
+	if (concurrent) {
+		/* Lock-free readers cannot follow a list being turned into a tree */
+		if (J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT)) {
+			goto error;
+		}
+		hashTable->bucketLocks = portLibrary->mem_allocate_memory(portLibrary, sizeof(uint32_t) * J9HASH_TABLE_CONCURRENT_LOCK_COUNT, tableName, memoryCategory);
+		if (NULL == hashTable->bucketLocks) {
+			goto error;
+		}
+		memset(hashTable->bucketLocks, 0, sizeof(uint32_t) * J9HASH_TABLE_CONCURRENT_LOCK_COUNT);
+		hashTable->retiredPool = pool_new(sizeof(J9HashTableRetired), 0, sizeof(uintptr_t), POOL_NO_ZERO, tableName, memoryCategory, POOL_FOR_PORT(portLibrary));
+		if (NULL == hashTable->retiredPool) {
+			goto error;
+		}
+	}
+
 	if (J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT)) {
 		/* Additional initialization for capability to turn lists to trees */
 		hashTable->treePool = pool_new(sizeof(J9AVLTree), 0, sizeof(uintptr_t), 0, tableName, memoryCategory, POOL_FOR_PORT(portLibrary));
@@ -409,6 +479,16 @@ hashTableFree(J9HashTable *hashTable)
 		OMRPORT_ACCESS_FROM_OMRPORT(hashTable->portLibrary);
 		hashTable_printf("hashTableFree <%s>: table=%p\n", hashTable->tableName, hashTable);
 
+		if (hashTableIsOpenAddressing(hashTable)) {
+			openHashTableFree(hashTable);
+		}
+		if (NULL != hashTable->retiredPool) {
+			hashTableReclaimRetired(hashTable);
+			pool_kill(hashTable->retiredPool);
+		}
+		if (NULL != hashTable->bucketLocks) {
+			omrmem_free_memory(hashTable->bucketLocks);
+		}
 		if (NULL != hashTable->nodes) {
 			omrmem_free_memory(hashTable->nodes);
 		}
@@ -441,13 +521,23 @@ hashTableFree(J9HashTable *hashTable)
 void *
 hashTableFind(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	void *findNode = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableFind <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsConcurrent(table)) {
+		return hashTableFindConcurrent(table, entry);
+	}
+	if (hashTableIsOpenAddressing(table)) {
+		return openHashTableFind(table, entry);
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
+
 	if (NULL == table->listNodePool) {
 		void **node = hashTableFindNodeSpaceOpt(table, entry, head);
 		findNode = (NULL != *node) ? node : NULL;
@@ -516,14 +606,24 @@ hashTableFindNodeInTree(J9HashTable *table, void *entry, void **head)
 void *
 hashTableAdd(J9HashTable *table, void *entry)
 {
-	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
-	void **head = &table->nodes[hashCode % table->tableSize];
+	uintptr_t hashCode = 0;
+	void **head = NULL;
 	void *addNode = NULL;
 	BOOLEAN growFailure = FALSE;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableAdd <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsConcurrent(table)) {
+		return hashTableAddConcurrent(table, entry);
+	}
+	if (hashTableIsOpenAddressing(table)) {
+		return openHashTableAdd(table, entry);
+	}
+
+	hashCode = table->hashFn(entry, table->hashFnUserData);
+	head = &table->nodes[hashCode % table->tableSize];
+
 	if ((table->numberOfNodes + 1) == table->tableSize) {
 		if (!hashTableCanGrow(table)) {
 			goto done;
@@ -702,13 +802,23 @@ listToTree(J9HashTable *table, void **head, uintptr_t listLength)
 uint32_t
 hashTableRemove(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	uint32_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableRemove <%s>: table=%p, entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsConcurrent(table)) {
+		return hashTableRemoveConcurrent(table, entry);
+	}
+	if (hashTableIsOpenAddressing(table)) {
+		return openHashTableRemove(table, entry);
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
+
 	if (NULL == table->listNodePool) {
 		rc = hashTableRemoveNodeSpaceOpt(table, entry, head);
 	} else if (NULL == *head) {
@@ -821,7 +931,7 @@ hashTableForEachDo(J9HashTable *table, J9HashTableDoFn doFn, void *opaque)
 
 	hashTable_printf("hashTableForEachDo <%s>: table=%p\n", table->tableName, table);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsSpaceOptimized(table)) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
 	}
@@ -849,10 +959,10 @@ hashTableForEachDo(J9HashTable *table, J9HashTableDoFn doFn, void *opaque)
 void
 hashTableRehash(J9HashTable *table)
 {
-	uint32_t i = 0;
-	void *chain = NULL;
-	void  *tail = NULL;
-	uintptr_t tableSize = table->tableSize;
+	if (hashTableIsOpenAddressing(table)) {
+		openHashTableRehash(table);
+		return;
+	}
 
 	if (NULL == table->listNodePool) {
 		/* space optimized hashTable, operation not supported */
@@ -870,6 +980,28 @@ hashTableRehash(J9HashTable *table)
 		Assert_hashTable_unreachable();
 	}
 
+	if (hashTableIsConcurrent(table)) {
+		/* Relinking in place keeps every chain acyclic, so concurrent finds terminate and retry on a miss */
+		concurrentLockAll(table);
+		table->resizeCount += 1;
+		issueWriteBarrier();
+		rehashChains(table);
+		issueWriteBarrier();
+		table->resizeCount += 1;
+		concurrentUnlockAll(table);
+	} else {
+		rehashChains(table);
+	}
+}
+
+static void
+rehashChains(J9HashTable *table)
+{
+	uint32_t i = 0;
+	void *chain = NULL;
+	void  *tail = NULL;
+	uintptr_t tableSize = table->tableSize;
+
 	/* connect all the node-chains into one big chain */
 	for (i = 0; i < tableSize; i++) {
 		if (table->nodes[i]) {
@@ -1012,7 +1144,9 @@ hashTableStartDo(J9HashTable *table,  J9HashTableState *handle)
 	handle->didDeleteCurrentNode = FALSE;
 	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		result = openHashTableStartDo(handle);
+	} else if (NULL == table->listNodePool) {
 		/* find the first non-empty bucket */
 		while (handle->bucketIndex < table->tableSize) {
 			void **node = &table->nodes[handle->bucketIndex];
@@ -1071,7 +1205,9 @@ hashTableNextDo(J9HashTableState *handle)
 	void *result = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		result = openHashTableNextDo(handle);
+	} else if (NULL == table->listNodePool) {
 		/* space optimized hashTable - advance to the next bucket */
 		handle->bucketIndex += 1;
 		while (handle->bucketIndex < table->tableSize) {
@@ -1158,8 +1294,10 @@ hashTableDoRemove(J9HashTableState *handle)
 	uintptr_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	/* operation not supported on a space optimized hashTable */
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		rc = openHashTableDoRemove(handle);
+	} else if (NULL == table->listNodePool) {
+		/* operation not supported on a space optimized hashTable */
 		Assert_hashTable_unreachable();
 	} else {
 		void *currentNode = NULL;
@@ -1169,9 +1307,14 @@ hashTableDoRemove(J9HashTableState *handle)
 			currentNode = *(handle->pointerToCurrentNode);
 
 			*(handle->pointerToCurrentNode) = NEXT(currentNode);
-			pool_removeElement(table->listNodePool, currentNode);
+			if (hashTableIsConcurrent(table)) {
+				concurrentRetire(table, currentNode, FALSE);
+				concurrentAddToNodeCount(table, -1);
+			} else {
+				pool_removeElement(table->listNodePool, currentNode);
+				table->numberOfNodes -= 1;
+			}
 			handle->didDeleteCurrentNode = TRUE;
-			table->numberOfNodes -= 1;
 			rc = 0;
 			break;
 
@@ -1232,9 +1375,17 @@ hashTableGrowListNodes(J9HashTable *table, uint32_t newSize)
 				numberOfNodes += 1;
 			}
 		}
-		omrmem_free_memory(table->nodes);
-		table->tableSize = newSize;
+		if (hashTableIsConcurrent(table)) {
+			/* finds that read the old array may still be walking it */
+			concurrentRetire(table, table->nodes, TRUE);
+			issueWriteBarrier();
+		} else {
+			omrmem_free_memory(table->nodes);
+		}
+		/* the larger array is published first, so a concurrent reader never pairs the old array with the new size */
 		table->nodes = newNodes;
+		issueWriteBarrier();
+		table->tableSize = newSize;
 		/* Sanity check to make sure that the old hash table had calculated the right number of nodes */
 		HASHTABLE_ASSERT(numberOfNodes == table->numberOfNodes);
 		rc = 0;
@@ -1348,6 +1499,257 @@ hashTableGrow(J9HashTable *table)
 	return rc;
 }
 
+/**
+ * \brief       Release the nodes and bucket arrays retired by a concurrent hash table
+ * \ingroup     hash_table
+ *
+ *
+ * @param table
+ *
+ *	Entries removed from a J9HASH_TABLE_CONCURRENT table, and bucket arrays replaced when it grows,
+ *	stay allocated so that concurrent hashTableFind() calls can finish walking them. The caller must
+ *	only invoke this when no thread can be inside hashTableFind() for this table. Does nothing for
+ *	other tables.
+ */
+void
+hashTableReclaimRetired(J9HashTable *table)
+{
+	if (NULL != table->retiredPool) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		pool_state state = {0};
+		J9HashTableRetired *retired = NULL;
+
+		concurrentLock(&table->allocatorLock);
+		retired = pool_startDo(table->retiredPool, &state);
+		while (NULL != retired) {
+			if (retired->isBucketArray) {
+				omrmem_free_memory(retired->memory);
+			} else {
+				pool_removeElement(table->listNodePool, retired->memory);
+			}
+			retired = pool_nextDo(&state);
+		}
+		pool_clear(table->retiredPool);
+		concurrentUnlock(&table->allocatorLock);
+	}
+}
+
+static void
+concurrentLock(uint32_t *lock)
+{
+	while (0 != compareAndSwapU32(lock, 0, 1)) {
+		/* wait on plain reads rather than hammering the line with compare and swaps */
+		while (0 != *(volatile uint32_t *)lock) {
+		}
+	}
+	issueReadWriteBarrier();
+}
+
+static void
+concurrentUnlock(uint32_t *lock)
+{
+	issueReadWriteBarrier();
+	*(volatile uint32_t *)lock = 0;
+}
+
+/* Writers hold at most one stripe, and resizers take all of them in order, so this cannot deadlock */
+static void
+concurrentLockAll(J9HashTable *table)
+{
+	uint32_t i = 0;
+
+	for (i = 0; i < J9HASH_TABLE_CONCURRENT_LOCK_COUNT; i++) {
+		concurrentLock(&table->bucketLocks[i]);
+	}
+}
+
+static void
+concurrentUnlockAll(J9HashTable *table)
+{
+	uint32_t i = 0;
+
+	for (i = 0; i < J9HASH_TABLE_CONCURRENT_LOCK_COUNT; i++) {
+		concurrentUnlock(&table->bucketLocks[i]);
+	}
+}
+
+static void
+concurrentAddToNodeCount(J9HashTable *table, int32_t delta)
+{
+	uint32_t oldCount = 0;
+
+	do {
+		oldCount = *(volatile uint32_t *)&table->numberOfNodes;
+	} while (oldCount != compareAndSwapU32(&table->numberOfNodes, oldCount, oldCount + (uint32_t)delta));
+}
+
+/*
+ * Lock the stripe guarding the bucket for hashCode and return the bucket head.
+ * Retries if the table was resized between choosing the bucket and taking its lock.
+ */
+static void **
+concurrentLockBucket(J9HashTable *table, uintptr_t hashCode, uint32_t **lock)
+{
+	for (;;) {
+		uintptr_t resizeCount = table->resizeCount;
+
+		issueReadBarrier();
+		if (0 == (resizeCount & 1)) {
+			uintptr_t index = hashCode % table->tableSize;
+			uint32_t *stripe = &table->bucketLocks[index % J9HASH_TABLE_CONCURRENT_LOCK_COUNT];
+
+			concurrentLock(stripe);
+			if (resizeCount == table->resizeCount) {
+				*lock = stripe;
+				return &table->nodes[index];
+			}
+			concurrentUnlock(stripe);
+		}
+	}
+}
+
+static void
+concurrentRetire(J9HashTable *table, void *memory, uintptr_t isBucketArray)
+{
+	J9HashTableRetired *retired = NULL;
+
+	concurrentLock(&table->allocatorLock);
+	retired = pool_newElement(table->retiredPool);
+	if (NULL != retired) {
+		retired->memory = memory;
+		retired->isBucketArray = isBucketArray;
+	}
+	/* if the record cannot be allocated the memory is leaked until the table is freed, never reused early */
+	concurrentUnlock(&table->allocatorLock);
+}
+
+static void *
+hashTableFindConcurrent(J9HashTable *table, void *entry)
+{
+	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
+
+	for (;;) {
+		uintptr_t resizeCount = table->resizeCount;
+		void **nodes = NULL;
+		uint32_t tableSize = 0;
+
+		issueReadBarrier();
+		if (0 != (resizeCount & 1)) {
+			/* a resize is publishing nodes and tableSize, so neither can be trusted yet */
+			continue;
+		}
+		nodes = table->nodes;
+		tableSize = table->tableSize;
+		issueReadBarrier();
+
+		/* nodes and tableSize are only consistent if no resize started before they were read */
+		if (resizeCount == table->resizeCount) {
+			void *node = *(void * volatile *)&nodes[hashCode % tableSize];
+
+			while (NULL != node) {
+				if (0 != table->hashEqualFn(node, entry, table->equalFnUserData)) {
+					return node;
+				}
+				node = *(void * volatile *)&NEXT(node);
+			}
+
+			/* a miss is only conclusive if no resize moved nodes between chains while walking */
+			issueReadBarrier();
+			if (resizeCount == table->resizeCount) {
+				return NULL;
+			}
+		}
+	}
+}
+
+static void *
+hashTableAddConcurrent(J9HashTable *table, void *entry)
+{
+	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
+	uint32_t *lock = NULL;
+	void **where = NULL;
+	void *addNode = NULL;
+
+	if ((table->numberOfNodes + 1) >= table->tableSize) {
+		if (!hashTableCanGrow(table)) {
+			return NULL;
+		}
+		if (0 != hashTableCanRehash(table)) {
+			/* failing to grow only lengthens the chains */
+			hashTableGrowConcurrent(table);
+		}
+	}
+
+	where = concurrentLockBucket(table, hashCode, &lock);
+	while ((NULL != *where) && (0 == table->hashEqualFn(*where, entry, table->equalFnUserData))) {
+		where = &NEXT(*where);
+	}
+
+	if (NULL != *where) {
+		addNode = *where;
+	} else {
+		concurrentLock(&table->allocatorLock);
+		addNode = pool_newElement(table->listNodePool);
+		concurrentUnlock(&table->allocatorLock);
+		if (NULL != addNode) {
+			memcpy(addNode, entry, table->entrySize);
+			NEXT(addNode) = NULL;
+			/* the node must be complete before finds can reach it */
+			issueWriteBarrier();
+			*where = addNode;
+			concurrentAddToNodeCount(table, 1);
+		}
+	}
+	concurrentUnlock(lock);
+
+	return addNode;
+}
+
+static uint32_t
+hashTableRemoveConcurrent(J9HashTable *table, void *entry)
+{
+	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
+	uint32_t *lock = NULL;
+	void **where = concurrentLockBucket(table, hashCode, &lock);
+	uint32_t rc = 1;
+
+	while ((NULL != *where) && (0 == table->hashEqualFn(*where, entry, table->equalFnUserData))) {
+		where = &NEXT(*where);
+	}
+
+	if (NULL != *where) {
+		void *nodeToRemove = *where;
+
+		/* leave NEXT intact so finds standing on the removed node can continue down the chain */
+		*where = NEXT(nodeToRemove);
+		concurrentAddToNodeCount(table, -1);
+		concurrentRetire(table, nodeToRemove, FALSE);
+		rc = 0;
+	}
+	concurrentUnlock(lock);
+
+	return rc;
+}
+
+static void
+hashTableGrowConcurrent(J9HashTable *table)
+{
+	concurrentLockAll(table);
+	/* another writer may have grown the table while this one waited for the locks */
+	if ((table->numberOfNodes + 1) >= table->tableSize) {
+		uint32_t newSize = hashTableNextSize(table->tableSize);
+
+		if (0 != newSize) {
+			table->resizeCount += 1;
+			issueWriteBarrier();
+			hashTableGrowListNodes(table, newSize);
+			issueWriteBarrier();
+			table->resizeCount += 1;
+		}
+	}
+	concurrentUnlockAll(table);
+}
+
 static uint32_t
 hashTableNextSize(uint32_t size)
 {
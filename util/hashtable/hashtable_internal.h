@@ -39,6 +39,81 @@
 extern "C" {
 #endif
 
+/* ---------------- openhashtable.c ---------------- */
+
+/**
+* @brief Allocate the slots and control bytes of a J9HASH_TABLE_OPEN_ADDRESSING table
+* @param *table
+* @param requestedSize
+* @return uintptr_t 0 on success
+*/
+uintptr_t
+openHashTableInitialize(J9HashTable *table, uint32_t requestedSize);
+
+/**
+* @brief
+* @param *table
+*/
+void
+openHashTableFree(J9HashTable *table);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+openHashTableFind(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+openHashTableAdd(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return uint32_t
+*/
+uint32_t
+openHashTableRemove(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+*/
+void
+openHashTableRehash(J9HashTable *table);
+
+/**
+* @brief
+* @param *handle
+* @return void *
+*/
+void *
+openHashTableStartDo(J9HashTableState *handle);
+
+/**
+* @brief
+* @param *handle
+* @return void *
+*/
+void *
+openHashTableNextDo(J9HashTableState *handle);
+
+/**
+* @brief
+* @param *handle
+* @return uintptr_t
+*/
+uintptr_t
+openHashTableDoRemove(J9HashTableState *handle);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,521 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Open addressing layout for J9HASH_TABLE_OPEN_ADDRESSING hash tables.
+ *
+ * Entries are stored inline in table->nodes, one slot of listNodeSize bytes each, with no
+ * next pointer. A parallel array of control bytes, table->controlBytes, describes each slot:
+ * EMPTY, DELETED, or FULL together with 7 bits of the entry's hash. A lookup hashes once,
+ * picks a group of J9HASH_TABLE_GROUP_WIDTH slots and compares all of the group's control bytes
+ * against the 7 hash bits at once, so the equality function is normally only called for the
+ * matching entry. Groups are probed triangularly until one containing an EMPTY slot is seen.
+ *
+ * tableSize is the number of slots, always a power of two multiple of the group width.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+
+#if defined(OMR_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#include <emmintrin.h>
+#define OPEN_HASH_TABLE_USE_SSE2
+#endif
+
+#define CONTROL_EMPTY ((uint8_t)0x80)
+#define CONTROL_DELETED ((uint8_t)0xFE)
+#define CONTROL_IS_FULL(c) (0 == ((c) & 0x80))
+
+#define GROUP_WIDTH J9HASH_TABLE_GROUP_WIDTH
+#define OPEN_HASH_TABLE_SIZE_MAX ((uint32_t)1 << 30)
+
+#define SLOT(table, index) ((void *)((uint8_t *)(table)->nodes + ((uintptr_t)(index) * (table)->listNodeSize)))
+
+/* Tables are kept at most 7/8 full, counting deleted slots */
+#define MAX_USED_SLOTS(capacity) ((capacity) - ((capacity) / 8))
+
+static uintptr_t mixHash(J9HashTable *table, void *entry);
+static uint32_t matchByte(const uint8_t *group, uint8_t value);
+static uint32_t matchEmpty(const uint8_t *group);
+static uint32_t matchEmptyOrDeleted(const uint8_t *group);
+static uint32_t lowestBit(uint32_t mask);
+static uint32_t capacityForCount(uint32_t count);
+static uintptr_t findSlot(J9HashTable *table, void *entry, uintptr_t hash);
+static uintptr_t findInsertSlot(J9HashTable *table, uintptr_t hash);
+static void setControl(J9HashTable *table, uintptr_t index, uint8_t value);
+static void removeSlot(J9HashTable *table, uintptr_t index);
+static void *nextFullSlot(J9HashTableState *handle);
+static uintptr_t resize(J9HashTable *table, uint32_t newCapacity);
+static void rehashInPlace(J9HashTable *table);
+static void swapSlots(J9HashTable *table, uintptr_t first, uintptr_t second);
+static void *allocateSlots(J9HashTable *table, uintptr_t byteAmount);
+static void freeSlots(J9HashTable *table, void *slots);
+
+#define NOT_FOUND ((uintptr_t)-1)
+
+/*
+ * User hash functions are often weak in the low bits (aligned pointers, small integers), and both
+ * the group index and the 7 control bits are taken from the hash, so spread it first.
+ */
+static uintptr_t
+mixHash(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = table->hashFn(entry, table->hashFnUserData);
+
+#if defined(OMR_ENV_DATA64)
+	hash *= (uintptr_t)J9CONST64(0x9E3779B97F4A7C15);
+	return hash ^ (hash >> 32);
+#else /* OMR_ENV_DATA64 */
+	hash *= (uintptr_t)0x9E3779B9;
+	return hash ^ (hash >> 16);
+#endif /* OMR_ENV_DATA64 */
+}
+
+#define HASH_CONTROL(hash) ((uint8_t)((hash) & 0x7F))
+#define HASH_GROUP(hash) ((hash) >> 7)
+
+/* Return a bit mask with bit i set when group[i] == value */
+static uint32_t
+matchByte(const uint8_t *group, uint8_t value)
+{
+#if defined(OPEN_HASH_TABLE_USE_SSE2)
+	__m128i control = _mm_loadu_si128((const __m128i *)group);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)value)));
+#else /* OPEN_HASH_TABLE_USE_SSE2 */
+	uint32_t mask = 0;
+	uint32_t i = 0;
+
+	for (i = 0; i < GROUP_WIDTH; i++) {
+		if (group[i] == value) {
+			mask |= (uint32_t)1 << i;
+		}
+	}
+	return mask;
+#endif /* OPEN_HASH_TABLE_USE_SSE2 */
+}
+
+static uint32_t
+matchEmpty(const uint8_t *group)
+{
+	return matchByte(group, CONTROL_EMPTY);
+}
+
+/* EMPTY and DELETED are the only control values with the top bit set */
+static uint32_t
+matchEmptyOrDeleted(const uint8_t *group)
+{
+#if defined(OPEN_HASH_TABLE_USE_SSE2)
+	return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#else /* OPEN_HASH_TABLE_USE_SSE2 */
+	uint32_t mask = 0;
+	uint32_t i = 0;
+
+	for (i = 0; i < GROUP_WIDTH; i++) {
+		if (!CONTROL_IS_FULL(group[i])) {
+			mask |= (uint32_t)1 << i;
+		}
+	}
+	return mask;
+#endif /* OPEN_HASH_TABLE_USE_SSE2 */
+}
+
+static uint32_t
+lowestBit(uint32_t mask)
+{
+#if defined(__GNUC__)
+	return (uint32_t)__builtin_ctz(mask);
+#else /* defined(__GNUC__) */
+	uint32_t bit = 0;
+
+	while (0 == (mask & 1)) {
+		mask >>= 1;
+		bit += 1;
+	}
+	return bit;
+#endif /* defined(__GNUC__) */
+}
+
+/* Smallest power of two number of slots (at least one group) holding count entries under the load limit */
+static uint32_t
+capacityForCount(uint32_t count)
+{
+	uint32_t capacity = GROUP_WIDTH;
+
+	while ((capacity < OPEN_HASH_TABLE_SIZE_MAX) && (MAX_USED_SLOTS(capacity) <= count)) {
+		capacity *= 2;
+	}
+	return capacity;
+}
+
+static uintptr_t
+findSlot(J9HashTable *table, void *entry, uintptr_t hash)
+{
+	uintptr_t groupMask = (table->tableSize / GROUP_WIDTH) - 1;
+	uintptr_t group = HASH_GROUP(hash) & groupMask;
+	uint8_t control = HASH_CONTROL(hash);
+	uintptr_t probe = 0;
+
+	/* at least one EMPTY slot always exists, so the probe terminates */
+	for (;;) {
+		const uint8_t *groupControl = &table->controlBytes[group * GROUP_WIDTH];
+		uint32_t match = matchByte(groupControl, control);
+
+		while (0 != match) {
+			uintptr_t index = (group * GROUP_WIDTH) + lowestBit(match);
+
+			if (0 != table->hashEqualFn(SLOT(table, index), entry, table->equalFnUserData)) {
+				return index;
+			}
+			match &= match - 1;
+		}
+		if (0 != matchEmpty(groupControl)) {
+			return NOT_FOUND;
+		}
+		probe += 1;
+		group = (group + probe) & groupMask;
+	}
+}
+
+static uintptr_t
+findInsertSlot(J9HashTable *table, uintptr_t hash)
+{
+	uintptr_t groupMask = (table->tableSize / GROUP_WIDTH) - 1;
+	uintptr_t group = HASH_GROUP(hash) & groupMask;
+	uintptr_t probe = 0;
+
+	for (;;) {
+		uint32_t match = matchEmptyOrDeleted(&table->controlBytes[group * GROUP_WIDTH]);
+
+		if (0 != match) {
+			return (group * GROUP_WIDTH) + lowestBit(match);
+		}
+		probe += 1;
+		group = (group + probe) & groupMask;
+	}
+}
+
+static void
+setControl(J9HashTable *table, uintptr_t index, uint8_t value)
+{
+	table->controlBytes[index] = value;
+}
+
+static void *
+allocateSlots(J9HashTable *table, uintptr_t byteAmount)
+{
+	OMRPortLibrary *portLibrary = table->portLibrary;
+
+#if defined(OMR_ENV_DATA64)
+	if (J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 == (table->flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32)) {
+		return portLibrary->mem_allocate_memory32(portLibrary, byteAmount, table->tableName, table->memoryCategory);
+	}
+#endif /* OMR_ENV_DATA64 */
+	return portLibrary->mem_allocate_memory(portLibrary, byteAmount, table->tableName, table->memoryCategory);
+}
+
+static void
+freeSlots(J9HashTable *table, void *slots)
+{
+	OMRPortLibrary *portLibrary = table->portLibrary;
+
+#if defined(OMR_ENV_DATA64)
+	if (J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 == (table->flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32)) {
+		portLibrary->mem_free_memory32(portLibrary, slots);
+		return;
+	}
+#endif /* OMR_ENV_DATA64 */
+	portLibrary->mem_free_memory(portLibrary, slots);
+}
+
+/*
+ * Move every entry into freshly allocated arrays of newCapacity slots, dropping DELETED markers.
+ * On allocation failure the table is left untouched and 1 is returned.
+ */
+static uintptr_t
+resize(J9HashTable *table, uint32_t newCapacity)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	void **oldSlots = table->nodes;
+	uint8_t *oldControlBytes = table->controlBytes;
+	uint32_t oldCapacity = table->tableSize;
+	void *newSlots = allocateSlots(table, (uintptr_t)newCapacity * table->listNodeSize);
+	uint8_t *newControlBytes = omrmem_allocate_memory(newCapacity, table->memoryCategory);
+	uint32_t i = 0;
+
+	if ((NULL == newSlots) || (NULL == newControlBytes)) {
+		if (NULL != newSlots) {
+			freeSlots(table, newSlots);
+		}
+		omrmem_free_memory(newControlBytes);
+		return 1;
+	}
+
+	memset(newControlBytes, CONTROL_EMPTY, newCapacity);
+	table->nodes = newSlots;
+	table->controlBytes = newControlBytes;
+	table->tableSize = newCapacity;
+	table->numberOfDeletedSlots = 0;
+
+	if (NULL != oldSlots) {
+		for (i = 0; i < oldCapacity; i++) {
+			if (CONTROL_IS_FULL(oldControlBytes[i])) {
+				void *oldSlot = (uint8_t *)oldSlots + ((uintptr_t)i * table->listNodeSize);
+				uintptr_t hash = mixHash(table, oldSlot);
+				uintptr_t index = findInsertSlot(table, hash);
+
+				memcpy(SLOT(table, index), oldSlot, table->listNodeSize);
+				setControl(table, index, HASH_CONTROL(hash));
+			}
+		}
+		freeSlots(table, oldSlots);
+		omrmem_free_memory(oldControlBytes);
+	}
+
+	return 0;
+}
+
+static void
+swapSlots(J9HashTable *table, uintptr_t first, uintptr_t second)
+{
+	uint8_t *firstSlot = (uint8_t *)SLOT(table, first);
+	uint8_t *secondSlot = (uint8_t *)SLOT(table, second);
+	uint32_t i = 0;
+
+	for (i = 0; i < table->listNodeSize; i++) {
+		uint8_t byte = firstSlot[i];
+		firstSlot[i] = secondSlot[i];
+		secondSlot[i] = byte;
+	}
+}
+
+/*
+ * Place every entry again without allocating, dropping DELETED markers. Used when resize cannot
+ * get new arrays. Every FULL slot is first marked DELETED, meaning "entry still to be placed",
+ * and every old DELETED slot becomes EMPTY. Each entry still to be placed then either stays
+ * where it is, when that is in the first group its probe reaches with a free slot, moves to an
+ * EMPTY slot, or swaps with another entry still to be placed, which is then handled next.
+ */
+static void
+rehashInPlace(J9HashTable *table)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < table->tableSize; i++) {
+		setControl(table, i, CONTROL_IS_FULL(table->controlBytes[i]) ? CONTROL_DELETED : CONTROL_EMPTY);
+	}
+
+	for (i = 0; i < table->tableSize; i++) {
+		while (CONTROL_DELETED == table->controlBytes[i]) {
+			uintptr_t hash = mixHash(table, SLOT(table, i));
+			uintptr_t target = findInsertSlot(table, hash);
+
+			if ((target / GROUP_WIDTH) == (i / GROUP_WIDTH)) {
+				/* lookups reach this group before any group with a free slot */
+				setControl(table, i, HASH_CONTROL(hash));
+			} else if (CONTROL_EMPTY == table->controlBytes[target]) {
+				memcpy(SLOT(table, target), SLOT(table, i), table->listNodeSize);
+				setControl(table, target, HASH_CONTROL(hash));
+				setControl(table, i, CONTROL_EMPTY);
+			} else {
+				/* the entry at target still has to be placed, and now sits at i */
+				swapSlots(table, i, target);
+				setControl(table, target, HASH_CONTROL(hash));
+			}
+		}
+	}
+	table->numberOfDeletedSlots = 0;
+}
+
+uintptr_t
+openHashTableInitialize(J9HashTable *table, uint32_t requestedSize)
+{
+	/* slots hold the bare entry, so the list node size is the entry rounded up to its alignment */
+	uint32_t slotSize = (table->entrySize + (sizeof(uintptr_t) - 1)) & ~(uint32_t)(sizeof(uintptr_t) - 1);
+
+	if (0 != table->nodeAlignment) {
+		slotSize = ((slotSize + table->nodeAlignment - 1) / table->nodeAlignment) * table->nodeAlignment;
+	}
+	table->listNodeSize = slotSize;
+	table->nodes = NULL;
+	table->controlBytes = NULL;
+	table->numberOfNodes = 0;
+
+	return resize(table, capacityForCount(requestedSize));
+}
+
+void
+openHashTableFree(J9HashTable *table)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+
+	if (NULL != table->nodes) {
+		freeSlots(table, table->nodes);
+		table->nodes = NULL;
+	}
+	omrmem_free_memory(table->controlBytes);
+	table->controlBytes = NULL;
+}
+
+void *
+openHashTableFind(J9HashTable *table, void *entry)
+{
+	uintptr_t index = findSlot(table, entry, mixHash(table, entry));
+
+	return (NOT_FOUND == index) ? NULL : SLOT(table, index);
+}
+
+void *
+openHashTableAdd(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table, entry);
+	uintptr_t index = findSlot(table, entry, hash);
+
+	if (NOT_FOUND != index) {
+		return SLOT(table, index);
+	}
+
+	if ((table->numberOfNodes + table->numberOfDeletedSlots + 1) > MAX_USED_SLOTS(table->tableSize)) {
+		if (hashTableCanGrow(table) && (0 != hashTableCanRehash(table))) {
+			/* if most used slots are tombstones, purging them is enough */
+			uint32_t newCapacity = table->tableSize;
+
+			if (table->numberOfDeletedSlots < table->numberOfNodes) {
+				newCapacity = capacityForCount(table->numberOfNodes + 1);
+			}
+			if ((newCapacity == table->tableSize) || (0 != resize(table, newCapacity))) {
+				/* purging tombstones needs no new arrays; on failure to grow keep filling the current ones */
+				if (0 != table->numberOfDeletedSlots) {
+					rehashInPlace(table);
+				}
+			}
+		}
+	}
+
+	index = findInsertSlot(table, hash);
+	if (CONTROL_DELETED == table->controlBytes[index]) {
+		table->numberOfDeletedSlots -= 1;
+	} else if ((table->numberOfNodes + table->numberOfDeletedSlots + 1) >= table->tableSize) {
+		/* using the last EMPTY slot would leave probes with nothing to stop at */
+		return NULL;
+	}
+
+	memcpy(SLOT(table, index), entry, table->entrySize);
+	setControl(table, index, HASH_CONTROL(hash));
+	table->numberOfNodes += 1;
+
+	return SLOT(table, index);
+}
+
+/*
+ * A slot may go back to EMPTY when its group still has an EMPTY slot: a probe can only have
+ * continued past a group that had none, so no other entry depends on this one staying occupied.
+ */
+static void
+removeSlot(J9HashTable *table, uintptr_t index)
+{
+	const uint8_t *groupControl = &table->controlBytes[index & ~(uintptr_t)(GROUP_WIDTH - 1)];
+
+	if (0 != matchEmpty(groupControl)) {
+		setControl(table, index, CONTROL_EMPTY);
+	} else {
+		setControl(table, index, CONTROL_DELETED);
+		table->numberOfDeletedSlots += 1;
+	}
+	table->numberOfNodes -= 1;
+}
+
+uint32_t
+openHashTableRemove(J9HashTable *table, void *entry)
+{
+	uintptr_t index = findSlot(table, entry, mixHash(table, entry));
+
+	if (NOT_FOUND == index) {
+		return 1;
+	}
+	removeSlot(table, index);
+	return 0;
+}
+
+void
+openHashTableRehash(J9HashTable *table)
+{
+	rehashInPlace(table);
+}
+
+/* Advance handle->bucketIndex to the first FULL slot at or after it */
+static void *
+nextFullSlot(J9HashTableState *handle)
+{
+	J9HashTable *table = handle->table;
+	void *result = NULL;
+
+	while (handle->bucketIndex < table->tableSize) {
+		if (CONTROL_IS_FULL(table->controlBytes[handle->bucketIndex])) {
+			result = SLOT(table, handle->bucketIndex);
+			break;
+		}
+		handle->bucketIndex += 1;
+	}
+	handle->pointerToCurrentNode = (void **)result;
+	handle->iterateState = (NULL == result) ? J9HASH_TABLE_ITERATE_STATE_FINISHED : J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
+
+	return result;
+}
+
+void *
+openHashTableStartDo(J9HashTableState *handle)
+{
+	handle->bucketIndex = 0;
+	handle->didDeleteCurrentNode = FALSE;
+
+	return nextFullSlot(handle);
+}
+
+void *
+openHashTableNextDo(J9HashTableState *handle)
+{
+	if (J9HASH_TABLE_ITERATE_STATE_FINISHED == handle->iterateState) {
+		return NULL;
+	}
+	/* removal never moves other entries, so the walk continues from the next slot either way */
+	handle->didDeleteCurrentNode = FALSE;
+	handle->bucketIndex += 1;
+
+	return nextFullSlot(handle);
+}
+
+uintptr_t
+openHashTableDoRemove(J9HashTableState *handle)
+{
+	J9HashTable *table = handle->table;
+
+	if ((J9HASH_TABLE_ITERATE_STATE_FINISHED == handle->iterateState)
+		|| (TRUE == handle->didDeleteCurrentNode)
+		|| !CONTROL_IS_FULL(table->controlBytes[handle->bucketIndex])
+	) {
+		return 1;
+	}
+	removeSlot(table, handle->bucketIndex);
+	handle->didDeleteCurrentNode = TRUE;
+
+	return 0;
+}
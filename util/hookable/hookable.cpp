@@ -43,6 +43,7 @@ static void J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t tag
 static intptr_t J9HookReserve(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum);
 static uintptr_t J9HookAllocateAgentID(struct J9HookInterface **hookInterface);
 static void J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentID);
+static void J9HookSetSamplingInterval(struct J9HookInterface **hookInterface, uintptr_t samplingInterval);
 
 static const J9HookInterface hookFunctionTable = {
 	J9HookDispatch,
@@ -55,6 +56,7 @@ static const J9HookInterface hookFunctionTable = {
 	J9HookIsEnabled,
 	J9HookAllocateAgentID,
 	J9HookDeallocateAgentID,
+	J9HookSetSamplingInterval,
 };
 
 /* flags are stored at the beginning of the interface just after the common interface fields in ascending order */
@@ -86,6 +88,11 @@ static const J9HookInterface hookFunctionTable = {
 #define HOOK_INVALID_ID(id) ((id) | 1)
 #define HOOK_VALID_ID(id) ( (((id) | 1) + 1) )
 
+/* the OMREventStats4Thread entries following a J9HookThreadStats */
+#define HOOK_THREAD_STATS_ENTRIES(threadStats) ((OMREventStats4Thread *)((threadStats) + 1))
+
+static void aggregateStatistics(J9CommonHookInterface *commonInterface);
+static void J9THREAD_PROC retireThreadStatistics(void *threadStats);
 
 intptr_t
 omrhook_lib_control(const char *key, uintptr_t value)
@@ -93,6 +100,10 @@ omrhook_lib_control(const char *key, uintptr_t value)
 	intptr_t rc = -1;
 
 	if (0 != value) {
+		if (0 == strcmp(J9HOOK_LIB_CONTROL_AGGREGATE_STATS, key)) {
+			aggregateStatistics((J9CommonHookInterface *)value);
+			return 0;
+		}
 #if defined(OMR_RAS_TDF_TRACE)
 		/* return value of 0 is success */
 		if (0 == strcmp(J9HOOK_LIB_CONTROL_TRACE_START, key)) {
@@ -142,11 +153,160 @@ J9HookInitializeInterface(struct J9HookInterface **hookInterface, OMRPortLibrary
 	commonInterface->nextAgentID = J9HOOK_AGENTID_DEFAULT + 1;
 	commonInterface->portLib = portLib;
 	commonInterface->threshold4Trace = OMRHOOK_DEFAULT_THRESHOLD_IN_MICROSECONDS_WARNING_CALLBACK_ELAPSED_TIME;
+	commonInterface->samplingInterval = 1;
 
 	commonInterface->eventSize = (interfaceSize - sizeof(J9CommonHookInterface)) / (sizeof(U_8) + sizeof(OMREventInfo4Dump) + sizeof(J9HookRecord*));
+
+	/* the thread-local statistics are optional: without them dispatch falls back to updating the shared OMREventInfo4Dump */
+	if (0 != commonInterface->eventSize) {
+		OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+		uintptr_t allocSize = commonInterface->eventSize * sizeof(OMREventStats4Thread);
+
+		commonInterface->retiredStats = (OMREventStats4Thread *)omrmem_allocate_memory(allocSize, OMRMEM_CATEGORY_VM);
+		if (NULL != commonInterface->retiredStats) {
+			memset(commonInterface->retiredStats, 0, allocSize);
+			if (0 != omrthread_tls_alloc_with_finalizer(&commonInterface->threadStatsKey, retireThreadStatistics)) {
+				omrmem_free_memory(commonInterface->retiredStats);
+				commonInterface->retiredStats = NULL;
+				commonInterface->threadStatsKey = 0;
+			}
+		}
+	}
 	return 0;
 }
 
+/*
+ * Return the statistics entry of the current thread for eventNum, allocating the thread's
+ * J9HookThreadStats on its first dispatch of an event of this interface.
+ * Only the owning thread updates its entries, so no atomics are needed.
+ *
+ * Returns NULL if the thread isn't attached or its statistics could not be allocated.
+ */
+static VMINLINE OMREventStats4Thread *
+statsForCurrentThread(J9CommonHookInterface *commonInterface, uintptr_t eventNum)
+{
+	omrthread_t self = omrthread_self();
+	J9HookThreadStats *threadStats = NULL;
+
+	if ((0 == commonInterface->threadStatsKey) || (NULL == self)) {
+		return NULL;
+	}
+
+	threadStats = (J9HookThreadStats *)omrthread_tls_get(self, commonInterface->threadStatsKey);
+	if (NULL == threadStats) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		uintptr_t allocSize = sizeof(J9HookThreadStats) + (commonInterface->eventSize * sizeof(OMREventStats4Thread));
+
+		threadStats = (J9HookThreadStats *)omrmem_allocate_memory(allocSize, OMRMEM_CATEGORY_VM);
+		if (NULL == threadStats) {
+			return NULL;
+		}
+		memset(threadStats, 0, allocSize);
+		threadStats->commonInterface = commonInterface;
+
+		omrthread_monitor_enter(commonInterface->lock);
+		threadStats->next = commonInterface->threadStats;
+		commonInterface->threadStats = threadStats;
+		omrthread_monitor_exit(commonInterface->lock);
+
+		omrthread_tls_set(self, commonInterface->threadStatsKey, threadStats);
+	}
+	return &HOOK_THREAD_STATS_ENTRIES(threadStats)[eventNum];
+}
+
+/*
+ * Record a timed listener call in a lastHook and longestHook pair.
+ */
+static VMINLINE void
+recordHookTiming(OMRHookInfo4Dump *lastHook, OMRHookInfo4Dump *longestHook, J9HookRecord *record, uint64_t startTime, uint64_t duration)
+{
+	lastHook->startTime = startTime;
+	lastHook->callsite = record->callsite;
+	lastHook->func_ptr = (void *)record->function;
+	lastHook->duration = duration;
+
+	if ((longestHook->duration < duration) || (0 == longestHook->startTime)) {
+		*longestHook = *lastHook;
+	}
+}
+
+/*
+ * Fold the lastHook and longestHook of one set of statistics into another:
+ * the later of the last hooks and the longer of the longest hooks are kept.
+ */
+static void
+mergeHookTiming(OMRHookInfo4Dump *lastHook, OMRHookInfo4Dump *longestHook, const OMREventStats4Thread *stats)
+{
+	if ((0 != stats->lastHook.startTime) && (lastHook->startTime <= stats->lastHook.startTime)) {
+		*lastHook = stats->lastHook;
+	}
+	if ((0 != stats->longestHook.startTime)
+		&& ((longestHook->duration < stats->longestHook.duration) || (0 == longestHook->startTime))
+	) {
+		*longestHook = stats->longestHook;
+	}
+}
+
+/*
+ * TLS finalizer of the thread-local statistics: fold the statistics of an exiting thread
+ * into the retired statistics of the interface and free them.
+ */
+static void J9THREAD_PROC
+retireThreadStatistics(void *value)
+{
+	J9HookThreadStats *threadStats = (J9HookThreadStats *)value;
+	J9CommonHookInterface *commonInterface = threadStats->commonInterface;
+	OMREventStats4Thread *entries = HOOK_THREAD_STATS_ENTRIES(threadStats);
+	J9HookThreadStats **link = &commonInterface->threadStats;
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+
+	omrthread_monitor_enter(commonInterface->lock);
+	while (threadStats != *link) {
+		link = &(*link)->next;
+	}
+	*link = threadStats->next;
+	for (uintptr_t eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+		OMREventStats4Thread *retired = &commonInterface->retiredStats[eventNum];
+
+		retired->count += entries[eventNum].count;
+		retired->totalTime += entries[eventNum].totalTime;
+		mergeHookTiming(&retired->lastHook, &retired->longestHook, &entries[eventNum]);
+	}
+	omrthread_monitor_exit(commonInterface->lock);
+
+	omrmem_free_memory(threadStats);
+}
+
+/*
+ * Fold the thread-local statistics into the OMREventInfo4Dump entries of the interface.
+ * The counts are read without stopping dispatchers, so concurrent dispatches may or may not be included.
+ * The lastHook and longestHook are merged with those already in the entries, which include the listener
+ * calls timed by threads without thread-local statistics.
+ */
+static void
+aggregateStatistics(J9CommonHookInterface *commonInterface)
+{
+	if (0 != commonInterface->threadStatsKey) {
+		omrthread_monitor_enter(commonInterface->lock);
+		for (uintptr_t eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+			OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
+			uintptr_t count = commonInterface->retiredStats[eventNum].count;
+			uintptr_t totalTime = commonInterface->retiredStats[eventNum].totalTime;
+
+			mergeHookTiming(&eventDump->lastHook, &eventDump->longestHook, &commonInterface->retiredStats[eventNum]);
+			for (J9HookThreadStats *threadStats = commonInterface->threadStats; NULL != threadStats; threadStats = threadStats->next) {
+				OMREventStats4Thread *stats = &HOOK_THREAD_STATS_ENTRIES(threadStats)[eventNum];
+				count += stats->count;
+				totalTime += stats->totalTime;
+				mergeHookTiming(&eventDump->lastHook, &eventDump->longestHook, stats);
+			}
+			eventDump->count = count;
+			eventDump->totalTime = totalTime;
+		}
+		omrthread_monitor_exit(commonInterface->lock);
+	}
+}
+
 /*
  * Shuts down the specified hook interface.
  *
@@ -157,6 +317,23 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
 {
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
 
+	if (0 != commonInterface->threadStatsKey) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		J9HookThreadStats *threadStats = commonInterface->threadStats;
+
+		/* clears the statistics of the live threads from their TLS, so they are not finalized later */
+		omrthread_tls_free(commonInterface->threadStatsKey);
+		commonInterface->threadStatsKey = 0;
+		while (NULL != threadStats) {
+			J9HookThreadStats *next = threadStats->next;
+			omrmem_free_memory(threadStats);
+			threadStats = next;
+		}
+		commonInterface->threadStats = NULL;
+		omrmem_free_memory(commonInterface->retiredStats);
+		commonInterface->retiredStats = NULL;
+	}
+
 	if (commonInterface->lock) {
 		omrthread_monitor_destroy(commonInterface->lock);
 	}
@@ -175,6 +352,13 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
  * before the listeners are informed. Any attempts to add listeners to a TAG_ONCE event
  * once it has been reported will fail.
  *
+ * Dispatch counts, listener times and the last and longest listener calls are accumulated in
+ * thread-local statistics and folded into the OMREventInfo4Dump entries by
+ * omrhook_lib_control(J9HOOK_LIB_CONTROL_AGGREGATE_STATS).
+ * Listener calls are only timed (and the clock only read) on sampled dispatches: the sampling
+ * interval comes from the J9HOOK_TAG_SAMPLING_MASK bits or, if those are zero, from the
+ * interface's J9HookSetSamplingInterval. An interval greater than 100 disables timing.
+ *
  * This function should not be called directly. It should be called through the hook interface
  *
  */
@@ -186,8 +370,13 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
 	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
 	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
+	OMREventStats4Thread *stats = NULL;
 	bool sampling = false;
 
+	if (0 == samplingInterval) {
+		samplingInterval = commonInterface->samplingInterval;
+	}
+
 	if (taggedEventNum & J9HOOK_TAG_ONCE) {
 		uint8_t oldFlags;
 
@@ -203,6 +392,10 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 		}
 	}
 
+	if (NULL != record) {
+		stats = statsForCurrentThread(commonInterface, eventNum);
+	}
+
 	while (record) {
 		J9HookFunction function;
 		void *userData;
@@ -221,7 +414,11 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 			if (record->id == id) {
 				uint64_t startTime = 0;
 				uintptr_t count = 0;
-				if (NULL != eventDump) {
+				if (NULL != stats) {
+					count = stats->count + 1;
+					stats->count = count;
+					sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
+				} else if (NULL != eventDump) {
 					count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
 					sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
 				} else {
@@ -237,18 +434,12 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 				if (sampling) {
 					uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 
-					eventDump->lastHook.startTime = startTime;
-					eventDump->lastHook.callsite = record->callsite;
-					eventDump->lastHook.func_ptr = (void *)record->function;
-					eventDump->lastHook.duration = timeDelta;
-					VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
-
-					if ((eventDump->longestHook.duration < timeDelta) ||
-						(0 == eventDump->longestHook.startTime)) {
-							eventDump->longestHook.startTime = startTime;
-							eventDump->longestHook.callsite = record->callsite;
-							eventDump->longestHook.func_ptr = (void *)record->function;
-							eventDump->longestHook.duration = timeDelta;
+					if (NULL != stats) {
+						stats->totalTime += (uintptr_t)timeDelta;
+						recordHookTiming(&stats->lastHook, &stats->longestHook, record, startTime, timeDelta);
+					} else {
+						VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
+						recordHookTiming(&eventDump->lastHook, &eventDump->longestHook, record, startTime, timeDelta);
 					}
 
 					if (commonInterface->threshold4Trace <= timeDelta) {
@@ -624,4 +815,20 @@ J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentI
 	return;
 }
 
+/**
+ * Set the sampling interval for timing the listeners of events dispatched without
+ * J9HOOK_TAG_SAMPLING_MASK bits. With an interval of n, every nth dispatch of an event
+ * on a thread is timed; 1 (the default) times every dispatch, and an interval greater
+ * than 100 disables timing.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ */
+static void
+J9HookSetSamplingInterval(struct J9HookInterface **hookInterface, uintptr_t samplingInterval)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+
+	commonInterface->samplingInterval = samplingInterval;
+}
+
 }
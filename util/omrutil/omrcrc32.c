@@ -20,9 +20,54 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <string.h>
+
 #include "omrcomp.h"
 #include "omrutil.h"
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define OMRCRC32_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else /* defined(_MSC_VER) */
+#include <cpuid.h>
+#endif /* defined(_MSC_VER) */
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__GNUC__)
+#define OMRCRC32_AARCH64
+#include <arm_acle.h>
+#if defined(LINUX)
+#include <sys/auxv.h>
+#if !defined(HWCAP_CRC32)
+#define HWCAP_CRC32 (1 << 7)
+#endif /* !defined(HWCAP_CRC32) */
+#endif /* defined(LINUX) */
+#endif /* x86 */
+
+/* Allow hardware routines to use instructions beyond the baseline the file is compiled for. */
+#if defined(_MSC_VER)
+#define OMRCRC32_TARGET(isa)
+#elif defined(OMRCRC32_AARCH64) && defined(__clang__)
+#define OMRCRC32_TARGET(isa) __attribute__((target("crc")))
+#elif defined(OMRCRC32_AARCH64)
+#define OMRCRC32_TARGET(isa) __attribute__((target("arch=armv8-a+crc")))
+#else /* defined(_MSC_VER) */
+#define OMRCRC32_TARGET(isa) __attribute__((target(isa)))
+#endif /* defined(_MSC_VER) */
+
+/* Hardware support, probed on first use. */
+#define OMRCRC32_FEATURES_PROBED ((uintptr_t)0x1)
+#define OMRCRC32_FEATURE_CLMUL ((uintptr_t)0x2)
+#define OMRCRC32_FEATURE_CRC32C ((uintptr_t)0x4)
+#define OMRCRC32_FEATURE_CRC32 ((uintptr_t)0x8)
+
+/* The folding routine consumes whole 16 byte blocks and needs at least four of them. */
+#define OMRCRC32_CLMUL_MINIMUM_LENGTH 64
+
+#if defined(OMRCRC32_X86) || defined(OMRCRC32_AARCH64)
+static volatile uintptr_t crcFeatures = 0;
+#endif /* defined(OMRCRC32_X86) || defined(OMRCRC32_AARCH64) */
+
 U_32 const crcValues[] = {
 	0x00000000L, 0x77073096L, 0xee0e612cL, 0x990951baL, 0x076dc419L,
 	0x706af48fL, 0xe963a535L, 0x9e6495a3L, 0x0edb8832L, 0x79dcb8a4L,
@@ -78,13 +123,341 @@ U_32 const crcValues[] = {
 	0x2d02ef8dL
 };
 
+/* Table for the Castagnoli polynomial (0x82F63B78 reflected), used by omrcrc32c(). */
+static U_32 const crc32cValues[] = {
+	0x00000000L, 0xf26b8303L, 0xe13b70f7L, 0x1350f3f4L, 0xc79a971fL,
+	0x35f1141cL, 0x26a1e7e8L, 0xd4ca64ebL, 0x8ad958cfL, 0x78b2dbccL,
+	0x6be22838L, 0x9989ab3bL, 0x4d43cfd0L, 0xbf284cd3L, 0xac78bf27L,
+	0x5e133c24L, 0x105ec76fL, 0xe235446cL, 0xf165b798L, 0x030e349bL,
+	0xd7c45070L, 0x25afd373L, 0x36ff2087L, 0xc494a384L, 0x9a879fa0L,
+	0x68ec1ca3L, 0x7bbcef57L, 0x89d76c54L, 0x5d1d08bfL, 0xaf768bbcL,
+	0xbc267848L, 0x4e4dfb4bL, 0x20bd8edeL, 0xd2d60dddL, 0xc186fe29L,
+	0x33ed7d2aL, 0xe72719c1L, 0x154c9ac2L, 0x061c6936L, 0xf477ea35L,
+	0xaa64d611L, 0x580f5512L, 0x4b5fa6e6L, 0xb93425e5L, 0x6dfe410eL,
+	0x9f95c20dL, 0x8cc531f9L, 0x7eaeb2faL, 0x30e349b1L, 0xc288cab2L,
+	0xd1d83946L, 0x23b3ba45L, 0xf779deaeL, 0x05125dadL, 0x1642ae59L,
+	0xe4292d5aL, 0xba3a117eL, 0x4851927dL, 0x5b016189L, 0xa96ae28aL,
+	0x7da08661L, 0x8fcb0562L, 0x9c9bf696L, 0x6ef07595L, 0x417b1dbcL,
+	0xb3109ebfL, 0xa0406d4bL, 0x522bee48L, 0x86e18aa3L, 0x748a09a0L,
+	0x67dafa54L, 0x95b17957L, 0xcba24573L, 0x39c9c670L, 0x2a993584L,
+	0xd8f2b687L, 0x0c38d26cL, 0xfe53516fL, 0xed03a29bL, 0x1f682198L,
+	0x5125dad3L, 0xa34e59d0L, 0xb01eaa24L, 0x42752927L, 0x96bf4dccL,
+	0x64d4cecfL, 0x77843d3bL, 0x85efbe38L, 0xdbfc821cL, 0x2997011fL,
+	0x3ac7f2ebL, 0xc8ac71e8L, 0x1c661503L, 0xee0d9600L, 0xfd5d65f4L,
+	0x0f36e6f7L, 0x61c69362L, 0x93ad1061L, 0x80fde395L, 0x72966096L,
+	0xa65c047dL, 0x5437877eL, 0x4767748aL, 0xb50cf789L, 0xeb1fcbadL,
+	0x197448aeL, 0x0a24bb5aL, 0xf84f3859L, 0x2c855cb2L, 0xdeeedfb1L,
+	0xcdbe2c45L, 0x3fd5af46L, 0x7198540dL, 0x83f3d70eL, 0x90a324faL,
+	0x62c8a7f9L, 0xb602c312L, 0x44694011L, 0x5739b3e5L, 0xa55230e6L,
+	0xfb410cc2L, 0x092a8fc1L, 0x1a7a7c35L, 0xe811ff36L, 0x3cdb9bddL,
+	0xceb018deL, 0xdde0eb2aL, 0x2f8b6829L, 0x82f63b78L, 0x709db87bL,
+	0x63cd4b8fL, 0x91a6c88cL, 0x456cac67L, 0xb7072f64L, 0xa457dc90L,
+	0x563c5f93L, 0x082f63b7L, 0xfa44e0b4L, 0xe9141340L, 0x1b7f9043L,
+	0xcfb5f4a8L, 0x3dde77abL, 0x2e8e845fL, 0xdce5075cL, 0x92a8fc17L,
+	0x60c37f14L, 0x73938ce0L, 0x81f80fe3L, 0x55326b08L, 0xa759e80bL,
+	0xb4091bffL, 0x466298fcL, 0x1871a4d8L, 0xea1a27dbL, 0xf94ad42fL,
+	0x0b21572cL, 0xdfeb33c7L, 0x2d80b0c4L, 0x3ed04330L, 0xccbbc033L,
+	0xa24bb5a6L, 0x502036a5L, 0x4370c551L, 0xb11b4652L, 0x65d122b9L,
+	0x97baa1baL, 0x84ea524eL, 0x7681d14dL, 0x2892ed69L, 0xdaf96e6aL,
+	0xc9a99d9eL, 0x3bc21e9dL, 0xef087a76L, 0x1d63f975L, 0x0e330a81L,
+	0xfc588982L, 0xb21572c9L, 0x407ef1caL, 0x532e023eL, 0xa145813dL,
+	0x758fe5d6L, 0x87e466d5L, 0x94b49521L, 0x66df1622L, 0x38cc2a06L,
+	0xcaa7a905L, 0xd9f75af1L, 0x2b9cd9f2L, 0xff56bd19L, 0x0d3d3e1aL,
+	0x1e6dcdeeL, 0xec064eedL, 0xc38d26c4L, 0x31e6a5c7L, 0x22b65633L,
+	0xd0ddd530L, 0x0417b1dbL, 0xf67c32d8L, 0xe52cc12cL, 0x1747422fL,
+	0x49547e0bL, 0xbb3ffd08L, 0xa86f0efcL, 0x5a048dffL, 0x8ecee914L,
+	0x7ca56a17L, 0x6ff599e3L, 0x9d9e1ae0L, 0xd3d3e1abL, 0x21b862a8L,
+	0x32e8915cL, 0xc083125fL, 0x144976b4L, 0xe622f5b7L, 0xf5720643L,
+	0x07198540L, 0x590ab964L, 0xab613a67L, 0xb831c993L, 0x4a5a4a90L,
+	0x9e902e7bL, 0x6cfbad78L, 0x7fab5e8cL, 0x8dc0dd8fL, 0xe330a81aL,
+	0x115b2b19L, 0x020bd8edL, 0xf0605beeL, 0x24aa3f05L, 0xd6c1bc06L,
+	0xc5914ff2L, 0x37faccf1L, 0x69e9f0d5L, 0x9b8273d6L, 0x88d28022L,
+	0x7ab90321L, 0xae7367caL, 0x5c18e4c9L, 0x4f48173dL, 0xbd23943eL,
+	0xf36e6f75L, 0x0105ec76L, 0x12551f82L, 0xe03e9c81L, 0x34f4f86aL,
+	0xc69f7b69L, 0xd5cf889dL, 0x27a40b9eL, 0x79b737baL, 0x8bdcb4b9L,
+	0x988c474dL, 0x6ae7c44eL, 0xbe2da0a5L, 0x4c4623a6L, 0x5f16d052L,
+	0xad7d5351L
+};
+
+#if defined(OMRCRC32_X86) || defined(OMRCRC32_AARCH64)
+/**
+ * Determine which CRC instructions the processor provides. The result does
+ * not change, so threads racing here store the same value.
+ * @return the OMRCRC32_FEATURE_* flags for this processor
+ */
+static uintptr_t
+probeCrcFeatures(void)
+{
+	uintptr_t features = crcFeatures;
+
+	if (OMRCRC32_FEATURES_PROBED != (features & OMRCRC32_FEATURES_PROBED)) {
+		features = OMRCRC32_FEATURES_PROBED;
+#if defined(OMRCRC32_X86)
+		{
+			unsigned int ecx = 0;
+#if defined(_MSC_VER)
+			int cpuInfo[4];
+			__cpuid(cpuInfo, 1);
+			ecx = (unsigned int)cpuInfo[2];
+#else /* defined(_MSC_VER) */
+			unsigned int eax = 0;
+			unsigned int ebx = 0;
+			unsigned int edx = 0;
+			if (0 == __get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+				ecx = 0;
+			}
+#endif /* defined(_MSC_VER) */
+			/* PCLMULQDQ is ECX bit 1, SSE4.1 is bit 19 and SSE4.2 is bit 20. */
+			if ((0 != (ecx & (1 << 1))) && (0 != (ecx & (1 << 19)))) {
+				features |= OMRCRC32_FEATURE_CLMUL;
+			}
+			if (0 != (ecx & (1 << 20))) {
+				features |= OMRCRC32_FEATURE_CRC32C;
+			}
+		}
+#else /* defined(OMRCRC32_X86) */
+#if defined(__ARM_FEATURE_CRC32) || defined(OSX)
+		features |= OMRCRC32_FEATURE_CRC32 | OMRCRC32_FEATURE_CRC32C;
+#elif defined(LINUX)
+		if (0 != (getauxval(AT_HWCAP) & HWCAP_CRC32)) {
+			features |= OMRCRC32_FEATURE_CRC32 | OMRCRC32_FEATURE_CRC32C;
+		}
+#endif /* defined(__ARM_FEATURE_CRC32) || defined(OSX) */
+#endif /* defined(OMRCRC32_X86) */
+		crcFeatures = features;
+	}
+	return features;
+}
+#endif /* defined(OMRCRC32_X86) || defined(OMRCRC32_AARCH64) */
+
+/**
+ * Byte at a time CRC over an already inverted crc.
+ */
+static U_32
+crc32Table(U_32 const *table, U_32 crc, const U_8 *bytes, uintptr_t len)
+{
+	while (0 != len) {
+		crc = (crc >> 8) ^ table[(crc ^ *bytes++) & 0xff];
+		len -= 1;
+	}
+	return crc;
+}
+
+#if defined(OMRCRC32_X86)
+/**
+ * Fold the buffer with carry-less multiplication, four 16 byte lanes at a time,
+ * then Barrett reduce to 32 bits. The constants are those for the reflected IEEE
+ * polynomial given in "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+ * Instruction" (Gopal et al., Intel, 2009).
+ * @param[in] crc the inverted crc so far
+ * @param[in] bytes the data
+ * @param[in] len the data length, at least OMRCRC32_CLMUL_MINIMUM_LENGTH and a multiple of 16
+ * @return the inverted crc
+ */
+OMRCRC32_TARGET("pclmul,sse4.1")
+static U_32
+crc32Clmul(U_32 crc, const U_8 *bytes, uintptr_t len)
+{
+	__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+	__m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+	__m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+	__m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124LL);
+	__m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+
+	x1 = _mm_loadu_si128((const __m128i *)(bytes + 0x00));
+	x2 = _mm_loadu_si128((const __m128i *)(bytes + 0x10));
+	x3 = _mm_loadu_si128((const __m128i *)(bytes + 0x20));
+	x4 = _mm_loadu_si128((const __m128i *)(bytes + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+	bytes += 64;
+	len -= 64;
+
+	x0 = k1k2;
+	while (len >= 64) {
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+		y5 = _mm_loadu_si128((const __m128i *)(bytes + 0x00));
+		y6 = _mm_loadu_si128((const __m128i *)(bytes + 0x10));
+		y7 = _mm_loadu_si128((const __m128i *)(bytes + 0x20));
+		y8 = _mm_loadu_si128((const __m128i *)(bytes + 0x30));
+
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+		bytes += 64;
+		len -= 64;
+	}
+
+	/* Fold the four lanes into one. */
+	x0 = k3k4;
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	/* Fold in any remaining 16 byte blocks. */
+	while (len >= 16) {
+		x2 = _mm_loadu_si128((const __m128i *)bytes);
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+		bytes += 16;
+		len -= 16;
+	}
+
+	/* Fold 128 bits to 64. */
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x1 = _mm_srli_si128(x1, 8);
+	x1 = _mm_xor_si128(x1, x2);
+
+	x0 = k5k0;
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, x3);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	/* Barrett reduce to 32 bits. */
+	x0 = poly;
+	x2 = _mm_and_si128(x1, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return (U_32)_mm_extract_epi32(x1, 1);
+}
+
+/**
+ * CRC-32C using the SSE4.2 crc32 instruction.
+ */
+OMRCRC32_TARGET("sse4.2")
+static U_32
+crc32cHardware(U_32 crc, const U_8 *bytes, uintptr_t len)
+{
+	while ((0 != len) && (0 != ((uintptr_t)bytes & (sizeof(uintptr_t) - 1)))) {
+		crc = _mm_crc32_u8(crc, *bytes++);
+		len -= 1;
+	}
+#if defined(__x86_64__) || defined(_M_X64)
+	{
+		U_64 crc64 = crc;
+		while (len >= sizeof(U_64)) {
+			crc64 = _mm_crc32_u64(crc64, *(const U_64 *)bytes);
+			bytes += sizeof(U_64);
+			len -= sizeof(U_64);
+		}
+		crc = (U_32)crc64;
+	}
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+	while (len >= sizeof(U_32)) {
+		crc = _mm_crc32_u32(crc, *(const U_32 *)bytes);
+		bytes += sizeof(U_32);
+		len -= sizeof(U_32);
+	}
+	while (0 != len) {
+		crc = _mm_crc32_u8(crc, *bytes++);
+		len -= 1;
+	}
+	return crc;
+}
+#elif defined(OMRCRC32_AARCH64)
+/**
+ * CRC-32 using the ARMv8 crc32 instructions.
+ */
+OMRCRC32_TARGET("crc")
+static U_32
+crc32Hardware(U_32 crc, const U_8 *bytes, uintptr_t len)
+{
+	while ((0 != len) && (0 != ((uintptr_t)bytes & 7))) {
+		crc = __crc32b(crc, *bytes++);
+		len -= 1;
+	}
+	while (len >= sizeof(U_64)) {
+		crc = __crc32d(crc, *(const U_64 *)bytes);
+		bytes += sizeof(U_64);
+		len -= sizeof(U_64);
+	}
+	while (0 != len) {
+		crc = __crc32b(crc, *bytes++);
+		len -= 1;
+	}
+	return crc;
+}
+
+/**
+ * CRC-32C using the ARMv8 crc32c instructions.
+ */
+OMRCRC32_TARGET("crc")
+static U_32
+crc32cHardware(U_32 crc, const U_8 *bytes, uintptr_t len)
+{
+	while ((0 != len) && (0 != ((uintptr_t)bytes & 7))) {
+		crc = __crc32cb(crc, *bytes++);
+		len -= 1;
+	}
+	while (len >= sizeof(U_64)) {
+		crc = __crc32cd(crc, *(const U_64 *)bytes);
+		bytes += sizeof(U_64);
+		len -= sizeof(U_64);
+	}
+	while (0 != len) {
+		crc = __crc32cb(crc, *bytes++);
+		len -= 1;
+	}
+	return crc;
+}
+#endif /* defined(OMRCRC32_X86) */
+
 U_32 omrcrc32(U_32 crc, U_8 *bytes, U_32 len)
+{
+	uintptr_t remaining = len;
+
+	if (!bytes) return 0;
+	crc = crc ^ 0xffffffffL;
+#if defined(OMRCRC32_X86)
+	if ((0 != (probeCrcFeatures() & OMRCRC32_FEATURE_CLMUL)) && (remaining >= OMRCRC32_CLMUL_MINIMUM_LENGTH)) {
+		uintptr_t blocks = remaining & ~(uintptr_t)15;
+		crc = crc32Clmul(crc, bytes, blocks);
+		bytes += blocks;
+		remaining -= blocks;
+	}
+#elif defined(OMRCRC32_AARCH64)
+	if (0 != (probeCrcFeatures() & OMRCRC32_FEATURE_CRC32)) {
+		return crc32Hardware(crc, bytes, remaining) ^ 0xffffffffL;
+	}
+#endif /* defined(OMRCRC32_X86) */
+	crc = crc32Table(crcValues, crc, bytes, remaining);
+	return crc ^ 0xffffffffL;
+}
+
+U_32 omrcrc32c(U_32 crc, U_8 *bytes, U_32 len)
 {
 	if (!bytes) return 0;
 	crc = crc ^ 0xffffffffL;
-	while ( len-- ) {
-		crc = ( crc >> 8 ) ^ crcValues[(crc ^ *bytes++)& 0xff];
+#if defined(OMRCRC32_X86) || defined(OMRCRC32_AARCH64)
+	if (0 != (probeCrcFeatures() & OMRCRC32_FEATURE_CRC32C)) {
+		return crc32cHardware(crc, bytes, len) ^ 0xffffffffL;
 	}
+#endif /* defined(OMRCRC32_X86) || defined(OMRCRC32_AARCH64) */
+	crc = crc32Table(crc32cValues, crc, bytes, len);
 	return crc ^ 0xffffffffL;
 }
 
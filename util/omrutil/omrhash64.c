@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * A 64 bit hash in the style of wyhash: input is consumed eight bytes at a time
+ * and mixed with a 64x64->128 bit multiply whose halves are folded together.
+ * Inputs are read as little-endian so that hashes match across platforms.
+ */
+
+#include <string.h>
+
+#include "omrcomp.h"
+#include "omrutil.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#pragma intrinsic(_umul128)
+#endif /* defined(_MSC_VER) && defined(_M_X64) */
+
+static const U_64 hashSecret[4] = {
+	J9CONST_U64(0x2d358dccaa6c78a5),
+	J9CONST_U64(0x8bb84b93962eacc9),
+	J9CONST_U64(0x4b33a62ed433d4a3),
+	J9CONST_U64(0x4d5a2da51de1aa47)
+};
+
+/**
+ * Multiply two 64 bit values, returning the low half in *a and the high half in *b.
+ */
+static VMINLINE void
+hashMultiply(U_64 *a, U_64 *b)
+{
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product = (unsigned __int128)*a * *b;
+	*a = (U_64)product;
+	*b = (U_64)(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	*a = _umul128(*a, *b, b);
+#else /* defined(__SIZEOF_INT128__) */
+	U_64 ha = *a >> 32;
+	U_64 hb = *b >> 32;
+	U_64 la = (U_32)*a;
+	U_64 lb = (U_32)*b;
+	U_64 rh = ha * hb;
+	U_64 rm0 = ha * lb;
+	U_64 rm1 = hb * la;
+	U_64 rl = la * lb;
+	U_64 t = rl + (rm0 << 32);
+	U_64 carry = (t < rl) ? 1 : 0;
+	U_64 lo = t + (rm1 << 32);
+	carry += (lo < t) ? 1 : 0;
+	*a = lo;
+	*b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif /* defined(__SIZEOF_INT128__) */
+}
+
+static VMINLINE U_64
+hashMix(U_64 a, U_64 b)
+{
+	hashMultiply(&a, &b);
+	return a ^ b;
+}
+
+static VMINLINE U_64
+hashRead64(const U_8 *p)
+{
+	U_64 value = 0;
+	memcpy(&value, p, sizeof(value));
+#if !defined(OMR_ENV_LITTLE_ENDIAN)
+	value = ((value & J9CONST_U64(0x00000000000000ff)) << 56)
+		| ((value & J9CONST_U64(0x000000000000ff00)) << 40)
+		| ((value & J9CONST_U64(0x0000000000ff0000)) << 24)
+		| ((value & J9CONST_U64(0x00000000ff000000)) << 8)
+		| ((value & J9CONST_U64(0x000000ff00000000)) >> 8)
+		| ((value & J9CONST_U64(0x0000ff0000000000)) >> 24)
+		| ((value & J9CONST_U64(0x00ff000000000000)) >> 40)
+		| ((value & J9CONST_U64(0xff00000000000000)) >> 56);
+#endif /* !defined(OMR_ENV_LITTLE_ENDIAN) */
+	return value;
+}
+
+static VMINLINE U_64
+hashRead32(const U_8 *p)
+{
+	U_32 value = 0;
+	memcpy(&value, p, sizeof(value));
+#if !defined(OMR_ENV_LITTLE_ENDIAN)
+	value = ((value & 0x000000ff) << 24)
+		| ((value & 0x0000ff00) << 8)
+		| ((value & 0x00ff0000) >> 8)
+		| ((value & 0xff000000) >> 24);
+#endif /* !defined(OMR_ENV_LITTLE_ENDIAN) */
+	return value;
+}
+
+U_64
+omrhash64(const void *data, uintptr_t length, U_64 seed)
+{
+	const U_8 *p = (const U_8 *)data;
+	U_64 a = 0;
+	U_64 b = 0;
+
+	seed ^= hashMix(seed ^ hashSecret[0], hashSecret[1]);
+	if (length <= 16) {
+		if (length >= 4) {
+			/* Two overlapping pairs of 32 bit reads cover 4 to 16 bytes. */
+			uintptr_t middle = (length >> 3) << 2;
+			a = (hashRead32(p) << 32) | hashRead32(p + middle);
+			b = (hashRead32(p + length - 4) << 32) | hashRead32(p + length - 4 - middle);
+		} else if (length > 0) {
+			a = ((U_64)p[0] << 16) | ((U_64)p[length >> 1] << 8) | p[length - 1];
+		}
+	} else {
+		uintptr_t remaining = length;
+		if (remaining >= 48) {
+			/* Three independent lanes keep the multipliers busy on long inputs. */
+			U_64 seed1 = seed;
+			U_64 seed2 = seed;
+			do {
+				seed = hashMix(hashRead64(p) ^ hashSecret[1], hashRead64(p + 8) ^ seed);
+				seed1 = hashMix(hashRead64(p + 16) ^ hashSecret[2], hashRead64(p + 24) ^ seed1);
+				seed2 = hashMix(hashRead64(p + 32) ^ hashSecret[3], hashRead64(p + 40) ^ seed2);
+				p += 48;
+				remaining -= 48;
+			} while (remaining >= 48);
+			seed ^= seed1 ^ seed2;
+		}
+		while (remaining > 16) {
+			seed = hashMix(hashRead64(p) ^ hashSecret[1], hashRead64(p + 8) ^ seed);
+			p += 16;
+			remaining -= 16;
+		}
+		/* The final 16 bytes may overlap data already consumed. */
+		a = hashRead64(p + remaining - 16);
+		b = hashRead64(p + remaining - 8);
+	}
+	a ^= hashSecret[1];
+	b ^= seed;
+	hashMultiply(&a, &b);
+	return hashMix(a ^ hashSecret[0] ^ (U_64)length, b ^ hashSecret[1]);
+}
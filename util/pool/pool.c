@@ -32,6 +32,7 @@
 
 #include "pool_internal.h"
 #include "ut_pool.h"
+#include "omrutilbase.h"
 
 #define ROUND_TO(granularity, number) ( (((number) % (granularity)) ? ((number) + (granularity) - ((number) % (granularity))) : (number)))
 #define NEXT_FREE_SLOT(slot) SRP_PTR_GET((uintptr_t *)slot, uintptr_t*)
@@ -50,6 +51,15 @@
 #define HOLE_FREQUENCY	16
 #define ELEMENT_IS_HOLE(pool, element) (((pool)->flags & POOL_USES_HOLES) && ((uintptr_t) (element) % ((pool)->elementSize*HOLE_FREQUENCY) == 0))
 
+#define POOL_IS_CONCURRENT(pool) (POOL_CONCURRENT == ((pool)->flags & POOL_CONCURRENT))
+/* largest number of paused lock reads between attempts to take a contended pool lock */
+#define POOL_LOCK_MAX_BACKOFF 1024
+
+static void *poolPuddle_detachFreeSlot(J9Pool *pool, J9PoolPuddle **puddleOut);
+static void poolPuddle_attachFreeSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element);
+static void poolPuddle_setSlotUsed(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot, BOOLEAN used);
+static J9PoolPuddle *pool_getCheckedElementPuddle(J9Pool *pool, void *element, int32_t *slotOut);
+
 /**
  * Get a pointer to the SRP to the puddle, given a puddle element.
  *
@@ -101,6 +111,134 @@ pool_getElementPuddleSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element)
 	return returnValue;
 }
 
+/**
+ * Acquire the internal lock of a POOL_CONCURRENT pool. Does nothing for other pools,
+ * whose callers provide their own synchronization.
+ *
+ * The lock is only held for short puddle list updates, so a contended lock is spun on
+ * with exponential backoff, pausing the processor between reads of the lock word, up to
+ * POOL_LOCK_MAX_BACKOFF reads between attempts. The pool library sits below the thread
+ * library, so it never yields the thread.
+ *
+ * @param[in] pool The pool to lock.
+ *
+ * @return none
+ */
+void
+pool_lock(J9Pool *pool)
+{
+	if (POOL_IS_CONCURRENT(pool)) {
+		uintptr_t backoff = 1;
+
+		while (0 != compareAndSwapU32(&pool->lock, 0, 1)) {
+			uintptr_t spins = backoff;
+
+			while ((0 != spins) && (0 != *(volatile uint32_t *)&pool->lock)) {
+				issueYieldCPU();
+				spins -= 1;
+			}
+			if (backoff < POOL_LOCK_MAX_BACKOFF) {
+				backoff <<= 1;
+			}
+		}
+		issueReadWriteBarrier();
+	}
+}
+
+/**
+ * Release the internal lock taken by @ref pool_lock.
+ *
+ * @param[in] pool The pool to unlock.
+ *
+ * @return none
+ */
+void
+pool_unlock(J9Pool *pool)
+{
+	if (POOL_IS_CONCURRENT(pool)) {
+		issueReadWriteBarrier();
+		*(volatile uint32_t *)&pool->lock = 0;
+	}
+}
+
+/**
+ * Mark a slot used or free and update the element counts to match.
+ *
+ * Magazines change slots without holding the pool lock, so POOL_CONCURRENT pools
+ * update the shared bit words and counters atomically.
+ *
+ * @param[in] pool   The pool containing the puddle.
+ * @param[in] puddle The puddle containing the slot.
+ * @param[in] slot   The slot index.
+ * @param[in] used   TRUE to mark the slot used, FALSE to mark it free.
+ *
+ * @return none
+ */
+static void
+poolPuddle_setSlotUsed(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot, BOOLEAN used)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+
+	if (POOL_IS_CONCURRENT(pool)) {
+		uint32_t *word = PUDDLE_BITS(puddle) + (((uint32_t)slot) >> 5);
+		uint32_t bit = (uint32_t)1 << (31 - (((uint32_t)slot) & 31));
+		uint32_t oldValue = 0;
+		uint32_t newValue = 0;
+
+		do {
+			oldValue = *(volatile uint32_t *)word;
+			newValue = used ? (oldValue & ~bit) : (oldValue | bit);
+		} while (oldValue != compareAndSwapU32(word, oldValue, newValue));
+
+		if (used) {
+			addAtomic((volatile uintptr_t *)&puddle->usedElements, 1);
+			addAtomic((volatile uintptr_t *)&puddleList->numElements, 1);
+		} else {
+			subtractAtomic((volatile uintptr_t *)&puddle->usedElements, 1);
+			subtractAtomic((volatile uintptr_t *)&puddleList->numElements, 1);
+		}
+	} else if (used) {
+		MARK_SLOT_USED(puddle, slot);
+		puddle->usedElements++;
+		puddleList->numElements++;
+	} else {
+		MARK_SLOT_FREE(puddle, slot);
+		puddle->usedElements--;
+		puddleList->numElements--;
+	}
+}
+
+/**
+ * Find the puddle of an element being returned to the pool, checking that the element
+ * is a currently allocated slot of it.
+ *
+ * @param[in]  pool    The pool containing the element.
+ * @param[in]  element The element.
+ * @param[out] slotOut The slot index of the element.
+ *
+ * @return the puddle, or NULL if the element is not an allocated element of the pool.
+ */
+static J9PoolPuddle *
+pool_getCheckedElementPuddle(J9Pool *pool, void *element, int32_t *slotOut)
+{
+	J9SRP *puddleSRP = pool_getElementPuddleSRP(pool, element);
+	J9PoolPuddle *puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
+	int32_t slot = pool_getElementPuddleSlot(pool, puddle, element);
+
+	if (slot < 0) {
+		/* this is an error...  we were passed a bogus data pointer. */
+		Trc_pool_removeElement_NotFound(element, J9POOLPUDDLELIST_NEXTPUDDLE(J9POOL_PUDDLELIST(pool)));
+		return NULL;
+	}
+	if (PUDDLE_SLOT_FREE(puddle, slot)) {
+		/* this is an error... the slot was already free. */
+		Trc_pool_removeElement_NotFound(element, puddle);
+		return NULL;
+	}
+	*slotOut = slot;
+	return puddle;
+}
+
 /**
  * Common code to initialize a puddle header. Used when creating
  * a new puddle, and when clearing the pool.
@@ -264,6 +402,11 @@ poolPuddle_delete(J9Pool *pool, J9PoolPuddle *puddle)
  *
  * @return pointer to a new pool, or NULL if the pool could not be created.
  *
+ * With POOL_CONCURRENT, pool_newElement(), pool_removeElement() and pool_ensureCapacity()
+ * synchronize on a lock inside the pool and threads may allocate through magazines
+ * (see @ref pool_initMagazine). Puddles are then never freed. Iteration, pool_clear()
+ * and pool_kill() still require the caller to exclude concurrent allocation.
+ *
  */
 J9Pool *
 pool_new(uintptr_t structSizeArg,
@@ -385,7 +528,12 @@ pool_new(uintptr_t structSizeArg,
 		pool->elementSize = (uintptr_t)roundedStructSize;
 		pool->alignment = (uint16_t)elementAlignment;	/* we assume no alignment is > 64k */
 		pool->puddleAllocSize = (uintptr_t)puddleAllocSize;
+		if (POOL_CONCURRENT == (poolFlags & POOL_CONCURRENT)) {
+			/* slots held in magazines are free but off the free list, so an empty puddle is not necessarily unused */
+			poolFlags |= POOL_NEVER_FREE_PUDDLES;
+		}
 		pool->flags = (uint16_t)poolFlags;
+		pool->lock = 0;
 		pool->poolCreatorCallsite = poolCreatorCallsite;
 		pool->elementsPerPuddle = finalNumberOfElements;
 		pool->memAlloc = memAlloc;
@@ -476,12 +624,8 @@ pool_kill(J9Pool *pool)
 void *
 pool_newElement(J9Pool *pool)
 {
-	int32_t slot;
 	void *newElement;
-	void *nextFreeElement;
-	J9SRP *puddleSRP;
 	J9PoolPuddle *puddle;
-	J9PoolPuddleList *puddleList;
 
 	Trc_pool_newElement_Entry(pool);
 
@@ -490,6 +634,43 @@ pool_newElement(J9Pool *pool)
 		return NULL;
 	}
 
+	pool_lock(pool);
+	newElement = poolPuddle_detachFreeSlot(pool, &puddle);
+	if (NULL != newElement) {
+		poolPuddle_setSlotUsed(pool, puddle, pool_getElementPuddleSlot(pool, puddle, newElement), TRUE);
+	}
+	pool_unlock(pool);
+
+	if ((NULL != newElement) && !(pool->flags & POOL_NO_ZERO)) {
+		memset(newElement, 0, pool->elementSize);
+		/* zeroing also cleared the puddle SRP unless the pool uses holes */
+		NNSRP_SET(*pool_getElementPuddleSRP(pool, newElement), puddle);
+	}
+
+	Trc_pool_newElement_Exit(newElement);
+
+	return newElement;
+}
+
+/**
+ * Take the first free slot off the free list of the first available puddle, grafting a new
+ * puddle onto the pool if all are full. The slot is still marked free; the caller either
+ * marks it used or keeps it in a magazine.
+ *
+ * @param[in]  pool      The pool.
+ * @param[out] puddleOut The puddle containing the returned slot.
+ *
+ * @return NULL if a new puddle could not be allocated, otherwise the slot.
+ */
+static void *
+poolPuddle_detachFreeSlot(J9Pool *pool, J9PoolPuddle **puddleOut)
+{
+	void *newElement;
+	void *nextFreeElement;
+	J9SRP *puddleSRP;
+	J9PoolPuddle *puddle;
+	J9PoolPuddleList *puddleList;
+
 	/* Check if there is a puddle with free slots - if so use it. */
 	puddleList = J9POOL_PUDDLELIST(pool);
 
@@ -500,7 +681,6 @@ pool_newElement(J9Pool *pool)
 		/* No available puddles. Allocate a new one. */
 		puddle = poolPuddle_new(pool);
 		if (NULL == puddle) {
-			Trc_pool_newElement_Exit(NULL);
 			return NULL;
 		}
 
@@ -517,13 +697,6 @@ pool_newElement(J9Pool *pool)
 	nextFreeElement = NEXT_FREE_SLOT(newElement);
 
 	SRP_SET(puddle->firstFreeSlot, nextFreeElement);
-	slot = pool_getElementPuddleSlot(pool, puddle, newElement);
-	MARK_SLOT_USED(puddle, slot);
-	puddle->usedElements++;
-	puddleList->numElements++;
-	if (!(pool->flags & POOL_NO_ZERO)) {
-		memset(newElement, 0, pool->elementSize);
-	}
 	puddleSRP = pool_getElementPuddleSRP(pool, newElement);
 	NNSRP_SET(*puddleSRP, puddle);
 
@@ -547,11 +720,42 @@ pool_newElement(J9Pool *pool)
 		WSRP_SET(puddle->prevAvailablePuddle, NULL);
 	}
 
-	Trc_pool_newElement_Exit(newElement);
-
+	*puddleOut = puddle;
 	return newElement;
 }
 
+/**
+ * Put a free slot back on its puddle's free list, making the puddle available again
+ * if it was full.
+ *
+ * @param[in] pool    The pool.
+ * @param[in] puddle  The puddle containing the slot.
+ * @param[in] element The slot, already marked free.
+ *
+ * @return none
+ */
+static void
+poolPuddle_attachFreeSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	void *freeLocation = (void *) J9POOLPUDDLE_FIRSTFREESLOT(puddle);
+
+	SRP_SET(puddle->firstFreeSlot, element);
+	LINK_TO_FREE_LIST(element, freeLocation);
+
+	if (NULL == freeLocation) {
+		/* It was full before - but not anymore - add it to the top of the available puddles list. */
+		J9PoolPuddle *next = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+
+		WSRP_SET(puddleList->nextAvailablePuddle, puddle);
+		WSRP_SET(puddle->prevAvailablePuddle, NULL);
+		WSRP_SET(puddle->nextAvailablePuddle, next);
+		if (NULL != next) {
+			WSRP_SET(next->prevAvailablePuddle, puddle);
+		}
+	}
+}
+
 /**
  *	Deallocates an element from a pool.
  *
@@ -568,11 +772,8 @@ pool_newElement(J9Pool *pool)
 void
 pool_removeElement(J9Pool *pool, void *anElement)
 {
-	J9SRP *puddleSRP;
 	int32_t slot;
 	J9PoolPuddle *puddle;
-	J9PoolPuddleList *puddleList;
-	void *freeLocation;
 
 	Trc_pool_removeElement_Entry(pool, anElement);
 
@@ -581,47 +782,174 @@ pool_removeElement(J9Pool *pool, void *anElement)
 		return;
 	}
 
-	puddleList = J9POOL_PUDDLELIST(pool);
-	puddleSRP = pool_getElementPuddleSRP(pool, anElement);
-	puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
-	slot = pool_getElementPuddleSlot(pool, puddle, anElement);
-	if (slot < 0) {
-		Trc_pool_removeElement_NotFound(anElement, J9POOLPUDDLELIST_NEXTPUDDLE(puddleList));
-		Trc_pool_removeElement_Exit();
-		return;		/* this is an error...  we were passed a bogus data pointer. */
+	pool_lock(pool);
+	puddle = pool_getCheckedElementPuddle(pool, anElement, &slot);
+	if (NULL != puddle) {
+		poolPuddle_setSlotUsed(pool, puddle, slot, FALSE);
+		poolPuddle_attachFreeSlot(pool, puddle, anElement);
+
+		/* If the puddle's empty, and we're allowed to free it, then remove it. */
+		if ((puddle->usedElements == 0) && !(pool->flags & POOL_NEVER_FREE_PUDDLES)) {
+			poolPuddle_delete(pool, puddle);
+		}
 	}
+	pool_unlock(pool);
 
-	if (PUDDLE_SLOT_FREE(puddle, slot)) {
-		Trc_pool_removeElement_NotFound(anElement, puddle);
-		Trc_pool_removeElement_Exit();
-		return;		/* this is an error... the slot was already free. */
-	}
-
-	MARK_SLOT_FREE(puddle, slot);
-	puddle->usedElements--;
-	puddleList->numElements--;
-	freeLocation = (void *) J9POOLPUDDLE_FIRSTFREESLOT(puddle);
-	SRP_SET(puddle->firstFreeSlot, anElement);
-	LINK_TO_FREE_LIST(anElement, freeLocation);
-
-	/* If the puddle's empty, and we're allowed to free it, then remove it. */
-	if ((puddle->usedElements == 0) && !(pool->flags & POOL_NEVER_FREE_PUDDLES)) {
-		poolPuddle_delete(pool, puddle);
-	} else if (NULL == freeLocation) {
-		/* It was full before - but not anymore - add it to the top of the available puddles list. */
-		J9PoolPuddle *next = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+	Trc_pool_removeElement_Exit();
+}
 
-		WSRP_SET(puddleList->nextAvailablePuddle, puddle);
-		WSRP_SET(puddle->prevAvailablePuddle, NULL);
-		WSRP_SET(puddle->nextAvailablePuddle, next);
-		if (NULL != next) {
-			WSRP_SET(next->prevAvailablePuddle, puddle);
+/**
+ *	Prepare a per-thread magazine of free elements for a POOL_CONCURRENT pool.
+ *
+ *	A magazine belongs to one thread, which passes it to @ref pool_newElementCached and
+ *	@ref pool_removeElementCached. Those calls only take the pool lock to move half a
+ *	magazine of slots to or from the puddles at once. Slots held in a magazine stay
+ *	marked free, so they are not seen by iteration, @ref pool_numElements or
+ *	@ref pool_includesElement. The magazine must be flushed with @ref pool_flushMagazine
+ *	before the pool is cleared or killed, or before the thread exits.
+ *
+ * @param[in] pool     The pool the magazine caches elements for.
+ * @param[in] magazine The magazine to initialize.
+ *
+ * @return none
+ */
+void
+pool_initMagazine(J9Pool *pool, J9PoolMagazine *magazine)
+{
+	magazine->pool = pool;
+	magazine->count = 0;
+}
+
+/**
+ *	Allocate an element through a thread's magazine.
+ *
+ *	Behaves as @ref pool_newElement, but usually neither takes the pool lock nor
+ *	touches the puddle free lists.
+ *
+ * @param[in] pool     A POOL_CONCURRENT pool.
+ * @param[in] magazine The calling thread's magazine for pool.
+ *
+ * @return NULL on error
+ * @return pointer to a new element otherwise
+ */
+void *
+pool_newElementCached(J9Pool *pool, J9PoolMagazine *magazine)
+{
+	void *newElement = NULL;
+
+	Trc_pool_newElement_Entry(pool);
+
+	Assert_pool_true(POOL_IS_CONCURRENT(pool) && (pool == magazine->pool));
+
+	if (0 == magazine->count) {
+		J9PoolPuddle *puddle;
+
+		/* refill half the magazine so that a following free does not immediately flush it */
+		pool_lock(pool);
+		while (magazine->count < (J9POOL_MAGAZINE_SIZE / 2)) {
+			void *element = poolPuddle_detachFreeSlot(pool, &puddle);
+			if (NULL == element) {
+				break;
+			}
+			magazine->elements[magazine->count] = element;
+			magazine->count += 1;
+		}
+		pool_unlock(pool);
+	}
+
+	if (0 != magazine->count) {
+		J9PoolPuddle *puddle;
+
+		magazine->count -= 1;
+		newElement = magazine->elements[magazine->count];
+		puddle = NNSRP_GET(*pool_getElementPuddleSRP(pool, newElement), J9PoolPuddle *);
+		poolPuddle_setSlotUsed(pool, puddle, pool_getElementPuddleSlot(pool, puddle, newElement), TRUE);
+		if (!(pool->flags & POOL_NO_ZERO)) {
+			memset(newElement, 0, pool->elementSize);
+			NNSRP_SET(*pool_getElementPuddleSRP(pool, newElement), puddle);
 		}
 	}
 
+	Trc_pool_newElement_Exit(newElement);
+
+	return newElement;
+}
+
+/**
+ *	Return an element to the pool through a thread's magazine.
+ *
+ *	Behaves as @ref pool_removeElement. When the magazine is full, half of it is
+ *	returned to the puddles under a single acquisition of the pool lock.
+ *
+ * @param[in] pool      A POOL_CONCURRENT pool.
+ * @param[in] magazine  The calling thread's magazine for pool.
+ * @param[in] anElement Pointer to the element to be removed
+ *
+ * @return none
+ */
+void
+pool_removeElementCached(J9Pool *pool, J9PoolMagazine *magazine, void *anElement)
+{
+	int32_t slot;
+	J9PoolPuddle *puddle;
+
+	Trc_pool_removeElement_Entry(pool, anElement);
+
+	if (!(pool && anElement)) {
+		Trc_pool_removeElement_ExitNoop();
+		return;
+	}
+
+	Assert_pool_true(POOL_IS_CONCURRENT(pool) && (pool == magazine->pool));
+
+	puddle = pool_getCheckedElementPuddle(pool, anElement, &slot);
+	if (NULL != puddle) {
+		poolPuddle_setSlotUsed(pool, puddle, slot, FALSE);
+
+		if (J9POOL_MAGAZINE_SIZE == magazine->count) {
+			uintptr_t keep = J9POOL_MAGAZINE_SIZE / 2;
+
+			pool_lock(pool);
+			while (magazine->count > keep) {
+				void *element = NULL;
+
+				magazine->count -= 1;
+				element = magazine->elements[magazine->count];
+				poolPuddle_attachFreeSlot(pool, NNSRP_GET(*pool_getElementPuddleSRP(pool, element), J9PoolPuddle *), element);
+			}
+			pool_unlock(pool);
+		}
+		magazine->elements[magazine->count] = anElement;
+		magazine->count += 1;
+	}
+
 	Trc_pool_removeElement_Exit();
 }
 
+/**
+ *	Return every slot held by a magazine to the puddles of its pool.
+ *
+ * @param[in] pool     A POOL_CONCURRENT pool.
+ * @param[in] magazine The magazine to empty.
+ *
+ * @return none
+ */
+void
+pool_flushMagazine(J9Pool *pool, J9PoolMagazine *magazine)
+{
+	if (0 != magazine->count) {
+		pool_lock(pool);
+		while (0 != magazine->count) {
+			void *element = NULL;
+
+			magazine->count -= 1;
+			element = magazine->elements[magazine->count];
+			poolPuddle_attachFreeSlot(pool, NNSRP_GET(*pool_getElementPuddleSRP(pool, element), J9PoolPuddle *), element);
+		}
+		pool_unlock(pool);
+	}
+}
+
 /**
  *	Calls a user provided function for each element in the list.
  *
@@ -55,6 +55,7 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity)
 
 	Trc_pool_ensureCapacity_Entry(aPool, newCapacity);
 
+	pool_lock(aPool);
 	numElements = pool_capacity(aPool);
 
 	/* mark each pool as POOL_NEVER_FREE_PUDDLES */
@@ -100,6 +101,7 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity)
 			newSize -= aPool->elementsPerPuddle;
 		}
 	}
+	pool_unlock(aPool);
 
 	Trc_pool_ensureCapacity_Exit(result);
 	return result;